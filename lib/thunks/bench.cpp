@@ -0,0 +1,284 @@
+// Benchmark for the crypto thunks. Builds the same sources with the same settings as thunks.cpp
+// and runs them in place (not relocated). Output is CSV on stdout:
+//   impl,name,size,metric,value
+// where impl is "native" (all CPU features detected) or "portable" (AES-NI, PCLMULQDQ, SHA-NI,
+// SSSE3, SSE4.1 and AVX2 masked out of cpuid), metric is "cpb" (cycles per byte) for bulk
+// ciphers/hashes and "ops" (operations per second) for public key primitives.
+//
+// RSA keys are random odd bignums of the right size, not real keys, so results are for timing only.
+
+#define THUNKS_NO_MAIN
+
+#include <intrin.h>
+
+static int g_bench_portable;
+
+static void bench_cpuid(int CPUInfo[4], int function_id)
+{
+    __cpuid(CPUInfo, function_id);
+    if (g_bench_portable && function_id == 1)
+        CPUInfo[2] &= ~((1 << 1) | (1 << 9) | (1 << 19) | (1 << 25) | (1 << 28)); // PCLMULQDQ, SSSE3, SSE4.1, AES, AVX
+}
+
+static void bench_cpuidex(int CPUInfo[4], int function_id, int subfunction_id)
+{
+    __cpuidex(CPUInfo, function_id, subfunction_id);
+    if (g_bench_portable && function_id == 7)
+        CPUInfo[1] &= ~((1 << 5) | (1 << 29)); // AVX2, SHA
+}
+
+#define __cpuid(a, b) bench_cpuid(a, b)
+#define __cpuidex(a, b, c) bench_cpuidex(a, b, c)
+
+#include "thunks.cpp"
+
+#define BENCH_REPEAT 5
+#define BENCH_MIN_BYTES (4 * 1024 * 1024)
+#define BENCH_MIN_SECONDS 0.5
+
+static const size_t g_bench_sizes[] = { 64, 256, 1024, 4096, 16384 };
+
+static const char *bench_impl()
+{
+    return g_bench_portable ? "portable" : "native";
+}
+
+static void bench_random(void *p, size_t n)
+{
+    HCRYPTPROV l_prov;
+
+    if (CryptAcquireContext(&l_prov, NULL, NULL, PROV_RSA_FULL, CRYPT_VERIFYCONTEXT)) {
+        CryptGenRandom(l_prov, (DWORD)n, (BYTE *)p);
+        CryptReleaseContext(l_prov, 0);
+    }
+}
+
+static double bench_seconds()
+{
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER now;
+
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double)now.QuadPart / freq.QuadPart;
+}
+
+static void bench_report_cpb(const char *name, size_t size, uint64_t cycles, size_t iters)
+{
+    printf("%s,%s,%u,cpb,%.2f\n", bench_impl(), name, (unsigned)size, (double)cycles / ((double)size * iters));
+}
+
+static void bench_report_ops(const char *name, size_t bits, double seconds, size_t iters)
+{
+    printf("%s,%s,%u,ops,%.1f\n", bench_impl(), name, (unsigned)bits, iters / seconds);
+}
+
+// best of BENCH_REPEAT runs of iters calls, in cycles
+#define BENCH_CYCLES(result, iters, stmt) \
+    do { \
+        int _r; size_t _i; uint64_t _t; \
+        for (_r = 0, result = ~(uint64_t)0; _r < BENCH_REPEAT; _r++) { \
+            _t = __rdtsc(); \
+            for (_i = 0; _i < (iters); _i++) { stmt; } \
+            _t = __rdtsc() - _t; \
+            if (_t < result) result = _t; \
+        } \
+    } while (0)
+
+// wall time of at least BENCH_MIN_SECONDS, iters gets the number of calls made
+#define BENCH_OPS(seconds, iters, stmt) \
+    do { \
+        double _start = bench_seconds(); \
+        for (iters = 0; (seconds = bench_seconds() - _start) < BENCH_MIN_SECONDS; iters++) { stmt; } \
+    } while (0)
+
+static void bench_bulk(uint8_t *buf, uint8_t *out)
+{
+    uint8_t key[32], nonce[12], tag[16], aad[13];
+    uint64_t cycles;
+    size_t i, size, iters;
+
+    bench_random(key, sizeof key);
+    bench_random(nonce, sizeof nonce);
+    bench_random(aad, sizeof aad);
+    for (i = 0; i < _countof(g_bench_sizes); i++) {
+        size = g_bench_sizes[i];
+        iters = BENCH_MIN_BYTES / size;
+#if defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK)
+        {
+            // contexts pick AES-NI/PCLMUL at init, so create per impl
+            void *aes128 = cf_aes_ctx_init(key, 16);
+            void *aes256 = cf_aes_ctx_init(key, 32);
+#ifdef IMPL_AESGCM_THUNK
+            BENCH_CYCLES(cycles, iters, cf_aesgcm_seal(aes128, out, tag, buf, size, aad, sizeof aad, nonce));
+            bench_report_cpb("aes128-gcm-seal", size, cycles, iters);
+            BENCH_CYCLES(cycles, iters, cf_aesgcm_open(aes128, buf, out, size, tag, aad, sizeof aad, nonce));
+            bench_report_cpb("aes128-gcm-open", size, cycles, iters);
+            BENCH_CYCLES(cycles, iters, cf_aesgcm_seal(aes256, out, tag, buf, size, aad, sizeof aad, nonce));
+            bench_report_cpb("aes256-gcm-seal", size, cycles, iters);
+            BENCH_CYCLES(cycles, iters, cf_aesgcm_open(aes256, buf, out, size, tag, aad, sizeof aad, nonce));
+            bench_report_cpb("aes256-gcm-open", size, cycles, iters);
+#endif
+#ifdef IMPL_AESCBC_THUNK
+            BENCH_CYCLES(cycles, iters, cf_aescbc_seal(aes128, out, buf, size, nonce));
+            bench_report_cpb("aes128-cbc-seal", size, cycles, iters);
+            BENCH_CYCLES(cycles, iters, cf_aescbc_open(aes128, buf, out, size, nonce));
+            bench_report_cpb("aes128-cbc-open", size, cycles, iters);
+            BENCH_CYCLES(cycles, iters, cf_aescbc_seal(aes256, out, buf, size, nonce));
+            bench_report_cpb("aes256-cbc-seal", size, cycles, iters);
+            BENCH_CYCLES(cycles, iters, cf_aescbc_open(aes256, buf, out, size, nonce));
+            bench_report_cpb("aes256-cbc-open", size, cycles, iters);
+#endif
+            cf_aes_ctx_free(aes128);
+            cf_aes_ctx_free(aes256);
+        }
+#endif
+#ifdef IMPL_CHACHA20_THUNK
+        BENCH_CYCLES(cycles, iters, cf_chacha20poly1305_encrypt(key, nonce, aad, sizeof aad, buf, size, out, tag));
+        bench_report_cpb("chacha20-poly1305-encrypt", size, cycles, iters);
+        BENCH_CYCLES(cycles, iters, cf_chacha20poly1305_decrypt(key, nonce, aad, sizeof aad, out, size, tag, buf));
+        bench_report_cpb("chacha20-poly1305-decrypt", size, cycles, iters);
+#endif
+#ifdef IMPL_SHA256_THUNK
+        {
+            cf_sha256_context ctx;
+            BENCH_CYCLES(cycles, iters, (cf_sha256_init(&ctx), cf_sha256_update(&ctx, buf, size), cf_sha256_digest_final(&ctx, out)));
+            bench_report_cpb("sha256", size, cycles, iters);
+        }
+#endif
+#ifdef IMPL_SHA384_THUNK
+        {
+            cf_sha512_context ctx;
+            BENCH_CYCLES(cycles, iters, (cf_sha384_init(&ctx), cf_sha384_update(&ctx, buf, size), cf_sha384_digest_final(&ctx, out)));
+            bench_report_cpb("sha384", size, cycles, iters);
+        }
+#endif
+#ifdef IMPL_SHA512_THUNK
+        {
+            cf_sha512_context ctx;
+            BENCH_CYCLES(cycles, iters, (cf_sha512_init(&ctx), cf_sha512_update(&ctx, buf, size), cf_sha512_digest_final(&ctx, out)));
+            bench_report_cpb("sha512", size, cycles, iters);
+        }
+#endif
+    }
+}
+
+static void bench_pubkey()
+{
+    double seconds;
+    size_t iters;
+
+#ifdef IMPL_CURVE25519
+    {
+        uint8_t priv[32], pub[32], secret[32];
+
+        bench_random(priv, sizeof priv);
+        BENCH_OPS(seconds, iters, cf_curve25519_mul_base(pub, priv));
+        bench_report_ops("x25519-keygen", 255, seconds, iters);
+        BENCH_OPS(seconds, iters, cf_curve25519_mul(secret, priv, pub));
+        bench_report_ops("x25519-ecdh", 255, seconds, iters);
+    }
+#endif
+#ifdef IMPL_ECC256_THUNK
+    {
+        uint8_t priv[ECC_BYTES_256], pub[2*ECC_BYTES_256+1], cpub[ECC_BYTES_256+1], secret[ECC_BYTES_256];
+        uint8_t hash[ECC_BYTES_256], sig[2*ECC_BYTES_256];
+        uint64_t k0[NUM_ECC_DIGITS_256], k[NUM_ECC_DIGITS_256];
+
+        do {
+            bench_random(priv, sizeof priv);
+        } while (!ecc_make_key256(pub, priv));
+        bench_random(hash, sizeof hash);
+        bench_random(k0, sizeof k0);
+        cpub[0] = 2 + (pub[2*ECC_BYTES_256] & 1);
+        memcpy(cpub + 1, pub + 1, ECC_BYTES_256);
+        BENCH_OPS(seconds, iters, ecc_make_key256(pub, priv));
+        bench_report_ops("p256-keygen", 256, seconds, iters);
+        BENCH_OPS(seconds, iters, ecdh_shared_secret256(pub, priv, secret));
+        bench_report_ops("p256-ecdh", 256, seconds, iters);
+        // sign inverts k in place
+        BENCH_OPS(seconds, iters, (memcpy(k, k0, sizeof k), ecdsa_sign256(priv, hash, k, sig)));
+        bench_report_ops("p256-sign", 256, seconds, iters);
+        BENCH_OPS(seconds, iters, ecdsa_verify256(cpub, hash, sig));
+        bench_report_ops("p256-verify", 256, seconds, iters);
+    }
+#endif
+#ifdef IMPL_ECC384_THUNK
+    {
+        uint8_t priv[ECC_BYTES_384], pub[2*ECC_BYTES_384+1], cpub[ECC_BYTES_384+1], secret[ECC_BYTES_384];
+        uint8_t hash[ECC_BYTES_384], sig[2*ECC_BYTES_384];
+        uint64_t k0[NUM_ECC_DIGITS_384], k[NUM_ECC_DIGITS_384];
+
+        do {
+            bench_random(priv, sizeof priv);
+        } while (!ecc_make_key384(pub, priv));
+        bench_random(hash, sizeof hash);
+        bench_random(k0, sizeof k0);
+        cpub[0] = 2 + (pub[2*ECC_BYTES_384] & 1);
+        memcpy(cpub + 1, pub + 1, ECC_BYTES_384);
+        BENCH_OPS(seconds, iters, ecc_make_key384(pub, priv));
+        bench_report_ops("p384-keygen", 384, seconds, iters);
+        BENCH_OPS(seconds, iters, ecdh_shared_secret384(pub, priv, secret));
+        bench_report_ops("p384-ecdh", 384, seconds, iters);
+        BENCH_OPS(seconds, iters, (memcpy(k, k0, sizeof k), ecdsa_sign384(priv, hash, k, sig)));
+        bench_report_ops("p384-sign", 384, seconds, iters);
+        BENCH_OPS(seconds, iters, ecdsa_verify384(cpub, hash, sig));
+        bench_report_ops("p384-verify", 384, seconds, iters);
+    }
+#endif
+#ifdef IMPL_SSHRSA_THUNK
+    {
+        static const uint32_t rsa_bytes[] = { 256, 512 };
+        uint8_t d[512], n[512], p[256], q[256], iqmp[256], e[512], base[512], ret[512];
+        size_t i, len;
+
+        for (i = 0; i < _countof(rsa_bytes); i++) {
+            len = rsa_bytes[i];
+            bench_random(d, len);
+            bench_random(p, len / 2);
+            bench_random(q, len / 2);
+            bench_random(iqmp, len / 2);
+            bench_random(base, len);
+            // full size odd p and q, n above any base
+            p[0] |= 0x80, p[len/2 - 1] |= 1;
+            q[0] |= 0x80, q[len/2 - 1] |= 1;
+            memset(n, 0xFF, len);
+            memset(e, 0, len);
+            e[len - 3] = 0x01, e[len - 1] = 0x01; // 65537
+            base[0] &= 0x7F;
+            void *rsa_ctx = rsa_crt_ctx_init(len, d, n, p, q, iqmp);
+            BENCH_OPS(seconds, iters, rsa_crt_ctx_modexp(rsa_ctx, base, ret));
+            bench_report_ops("rsa-crt-sign", len * 8, seconds, iters);
+            rsa_crt_ctx_free(rsa_ctx);
+            BENCH_OPS(seconds, iters, rsa_modexp(len, base, e, n, ret));
+            bench_report_ops("rsa-verify", len * 8, seconds, iters);
+        }
+    }
+#endif
+}
+
+void __cdecl main()
+{
+    uint8_t *buf, *out;
+
+    initContext();
+    buf = (uint8_t *)malloc(16384 + 64);
+    out = (uint8_t *)malloc(16384 + 64);
+    bench_random(buf, 16384);
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+    printf("impl,name,size,metric,value\n");
+    for (g_bench_portable = 0; g_bench_portable < 2; g_bench_portable++) {
+        // levels are cached on first use so detect them again with this pass' cpuid mask
+#ifdef IMPL_SHA256_THUNK
+        getContext()->m_sha256_impl = 0;
+#endif
+#ifdef IMPL_CHACHA20_THUNK
+        getContext()->m_chacha20_simd = 0;
+#endif
+        bench_bulk(buf, out);
+        bench_pubkey();
+    }
+    free(buf);
+    free(out);
+}
@@ -20,6 +20,7 @@ typedef struct
   uint8_t block[64];
   size_t nblock;
   size_t ncounter;
+  int simd;
 } cf_salsa20_ctx, cf_chacha20_ctx;
 
 static
@@ -102,6 +103,217 @@ void cf_chacha20_core(const uint8_t key0[16],
   write32_le(xf, out + 60);
 }
 
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/* gcc and clang only emit XSAVE/AVX2 instructions in functions targeted at them */
+#if defined(__clang__) || defined(__GNUC__)
+#define CHACHA20_ISA_XSAVE __attribute__((target("xsave")))
+#define CHACHA20_ISA_AVX2 __attribute__((target("avx2")))
+#else
+#define CHACHA20_ISA_XSAVE
+#define CHACHA20_ISA_AVX2
+#endif
+
+/* Vectorized keystream: state words are kept "vertically", one vector per
+ * word with one block per lane, so 4 (SSE2) or 8 (AVX2) blocks are computed
+ * by the same instruction stream and transposed back when xor-ed out.
+ * Rotations use shifts and 16-bit shuffles only as a pshufb mask would be a
+ * constant outside the thunk. */
+#define CHACHA20_SIMD_NONE 0
+#define CHACHA20_SIMD_SSE2 1
+#define CHACHA20_SIMD_AVX2 2
+
+CHACHA20_ISA_XSAVE
+static int chacha20_simd_detect()
+{
+  int CPUInfo[4];
+
+  __cpuid(CPUInfo, 0);
+  if (CPUInfo[0] >= 7)
+  {
+    __cpuid(CPUInfo, 1);
+    /* OSXSAVE and AVX, then check the OS saves XMM and YMM state */
+    if ((CPUInfo[2] & (1 << 27)) && (CPUInfo[2] & (1 << 28)) && (_xgetbv(0) & 6) == 6)
+    {
+      __cpuidex(CPUInfo, 7, 0);
+      if (CPUInfo[1] & (1 << 5))
+        return CHACHA20_SIMD_AVX2;
+    }
+  }
+  return CHACHA20_SIMD_SSE2;
+}
+
+/* Detected once per process, see sha256_impl_level. */
+static int chacha20_simd_level()
+{
+  if (chacha20_simd == 0)
+    chacha20_simd = chacha20_simd_detect() + 1;
+  return chacha20_simd - 1;
+}
+
+#define QUARTER_V(a, b, c, d, ADD, XOR, ROTL16, ROTL) \
+  x[a] = ADD(x[a], x[b]); x[d] = ROTL16(XOR(x[d], x[a])); \
+  x[c] = ADD(x[c], x[d]); x[b] = ROTL(XOR(x[b], x[c]), 12); \
+  x[a] = ADD(x[a], x[b]); x[d] = ROTL(XOR(x[d], x[a]), 8);  \
+  x[c] = ADD(x[c], x[d]); x[b] = ROTL(XOR(x[b], x[c]), 7);
+
+#define DOUBLEROUND_V(ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(0, 4,  8, 12, ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(1, 5,  9, 13, ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(2, 6, 10, 14, ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(3, 7, 11, 15, ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(0, 5, 10, 15, ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(1, 6, 11, 12, ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(2, 7,  8, 13, ADD, XOR, ROTL16, ROTL) \
+  QUARTER_V(3, 4,  9, 14, ADD, XOR, ROTL16, ROTL)
+
+/* Input words of the state, counter words 12/13 are per block */
+static void chacha20_state_words(const cf_chacha20_ctx *ctx, uint32_t words[16])
+{
+  for (int i = 0; i < 4; i++)
+  {
+    words[i] = read32_le(ctx->constant + 4 * i);
+    words[4 + i] = read32_le(ctx->key0 + 4 * i);
+    words[8 + i] = read32_le(ctx->key1 + 4 * i);
+    words[12 + i] = read32_le(ctx->nonce + 4 * i);
+  }
+}
+
+/* Per lane counter words for nlanes consecutive blocks, honouring the
+ * 32- or 64-bit little-endian counter width */
+static void chacha20_lane_counters(const cf_chacha20_ctx *ctx, const uint32_t words[16],
+                                   uint32_t lo[8], uint32_t hi[8], int nlanes)
+{
+  for (int i = 0; i < nlanes; i++)
+  {
+    lo[i] = words[12] + i;
+    hi[i] = words[13] + (ctx->ncounter == 8 && lo[i] < words[12]);
+  }
+}
+
+/* Store the counter words back after nblocks were produced */
+static void chacha20_store_counter(cf_chacha20_ctx *ctx, const uint32_t words[16])
+{
+  write32_le(words[12], ctx->nonce);
+  write32_le(words[13], ctx->nonce + 4);
+}
+
+#define SSE2_ADD(a, b)    _mm_add_epi32(a, b)
+#define SSE2_XOR(a, b)    _mm_xor_si128(a, b)
+#define SSE2_ROTL16(v)    _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1))
+#define SSE2_ROTL(v, n)   _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+
+/* Transpose 4 state words of 4 lanes and xor them into the 4 blocks */
+#define SSE2_XOR_OUT(a, b, c, d, off) \
+  t0 = _mm_unpacklo_epi32(a, b); t1 = _mm_unpacklo_epi32(c, d); \
+  t2 = _mm_unpackhi_epi32(a, b); t3 = _mm_unpackhi_epi32(c, d); \
+  _mm_storeu_si128((__m128i *)(out + off), _mm_xor_si128(_mm_unpacklo_epi64(t0, t1), _mm_loadu_si128((const __m128i *)(in + off)))); \
+  _mm_storeu_si128((__m128i *)(out + 64 + off), _mm_xor_si128(_mm_unpackhi_epi64(t0, t1), _mm_loadu_si128((const __m128i *)(in + 64 + off)))); \
+  _mm_storeu_si128((__m128i *)(out + 128 + off), _mm_xor_si128(_mm_unpacklo_epi64(t2, t3), _mm_loadu_si128((const __m128i *)(in + 128 + off)))); \
+  _mm_storeu_si128((__m128i *)(out + 192 + off), _mm_xor_si128(_mm_unpackhi_epi64(t2, t3), _mm_loadu_si128((const __m128i *)(in + 192 + off))));
+
+/* 4 blocks (256 bytes) per iteration, returns number of blocks done */
+static size_t cf_chacha20_blocks_sse2(cf_chacha20_ctx *ctx, const uint8_t *in, uint8_t *out, size_t nblocks)
+{
+  uint32_t words[16], lo[8], hi[8];
+  __m128i s[16], x[16], t0, t1, t2, t3;
+  size_t done = 0;
+  int i;
+
+  chacha20_state_words(ctx, words);
+  for (i = 0; i < 16; i++)
+    s[i] = _mm_set1_epi32(words[i]);
+  for (; nblocks - done >= 4; done += 4, in += 256, out += 256)
+  {
+    chacha20_lane_counters(ctx, words, lo, hi, 4);
+    s[12] = _mm_loadu_si128((const __m128i *)lo);
+    s[13] = _mm_loadu_si128((const __m128i *)hi);
+    for (i = 0; i < 16; i++)
+      x[i] = s[i];
+    for (i = 0; i < 10; i++)
+    {
+      DOUBLEROUND_V(SSE2_ADD, SSE2_XOR, SSE2_ROTL16, SSE2_ROTL)
+    }
+    for (i = 0; i < 16; i++)
+      x[i] = _mm_add_epi32(x[i], s[i]);
+    SSE2_XOR_OUT(x[0], x[1], x[2], x[3], 0)
+    SSE2_XOR_OUT(x[4], x[5], x[6], x[7], 16)
+    SSE2_XOR_OUT(x[8], x[9], x[10], x[11], 32)
+    SSE2_XOR_OUT(x[12], x[13], x[14], x[15], 48)
+    words[12] += 4;
+    words[13] = hi[3] + (ctx->ncounter == 8 && words[12] < lo[3]);
+  }
+  chacha20_store_counter(ctx, words);
+  mem_clean(x, sizeof x);
+  mem_clean(s, sizeof s);
+  mem_clean(words, sizeof words);
+  return done;
+}
+
+#define AVX2_ADD(a, b)    _mm256_add_epi32(a, b)
+#define AVX2_XOR(a, b)    _mm256_xor_si256(a, b)
+#define AVX2_ROTL16(v)    _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1))
+#define AVX2_ROTL(v, n)   _mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - (n)))
+
+/* Same transpose within each 128-bit half, low half holds blocks 0..3,
+ * high half blocks 4..7 */
+#define AVX2_XOR_OUT1(v, off) \
+  _mm_storeu_si128((__m128i *)(out + off), _mm_xor_si128(_mm256_castsi256_si128(v), _mm_loadu_si128((const __m128i *)(in + off)))); \
+  _mm_storeu_si128((__m128i *)(out + 256 + off), _mm_xor_si128(_mm256_extracti128_si256(v, 1), _mm_loadu_si128((const __m128i *)(in + 256 + off))));
+#define AVX2_XOR_OUT(a, b, c, d, off) \
+  t0 = _mm256_unpacklo_epi32(a, b); t1 = _mm256_unpacklo_epi32(c, d); \
+  t2 = _mm256_unpackhi_epi32(a, b); t3 = _mm256_unpackhi_epi32(c, d); \
+  AVX2_XOR_OUT1(_mm256_unpacklo_epi64(t0, t1), off) \
+  AVX2_XOR_OUT1(_mm256_unpackhi_epi64(t0, t1), 64 + off) \
+  AVX2_XOR_OUT1(_mm256_unpacklo_epi64(t2, t3), 128 + off) \
+  AVX2_XOR_OUT1(_mm256_unpackhi_epi64(t2, t3), 192 + off)
+
+/* 8 blocks (512 bytes) per iteration, returns number of blocks done */
+CHACHA20_ISA_AVX2
+static size_t cf_chacha20_blocks_avx2(cf_chacha20_ctx *ctx, const uint8_t *in, uint8_t *out, size_t nblocks)
+{
+  uint32_t words[16], lo[8], hi[8];
+  __m256i s[16], x[16], t0, t1, t2, t3;
+  size_t done = 0;
+  int i;
+
+  chacha20_state_words(ctx, words);
+  for (i = 0; i < 16; i++)
+    s[i] = _mm256_set1_epi32(words[i]);
+  for (; nblocks - done >= 8; done += 8, in += 512, out += 512)
+  {
+    chacha20_lane_counters(ctx, words, lo, hi, 8);
+    s[12] = _mm256_loadu_si256((const __m256i *)lo);
+    s[13] = _mm256_loadu_si256((const __m256i *)hi);
+    for (i = 0; i < 16; i++)
+      x[i] = s[i];
+    for (i = 0; i < 10; i++)
+    {
+      DOUBLEROUND_V(AVX2_ADD, AVX2_XOR, AVX2_ROTL16, AVX2_ROTL)
+    }
+    for (i = 0; i < 16; i++)
+      x[i] = _mm256_add_epi32(x[i], s[i]);
+    AVX2_XOR_OUT(x[0], x[1], x[2], x[3], 0)
+    AVX2_XOR_OUT(x[4], x[5], x[6], x[7], 16)
+    AVX2_XOR_OUT(x[8], x[9], x[10], x[11], 32)
+    AVX2_XOR_OUT(x[12], x[13], x[14], x[15], 48)
+    words[12] += 8;
+    words[13] = hi[7] + (ctx->ncounter == 8 && words[12] < lo[7]);
+  }
+  chacha20_store_counter(ctx, words);
+  mem_clean(x, sizeof x);
+  mem_clean(s, sizeof s);
+  mem_clean(words, sizeof words);
+  _mm256_zeroupper();
+  return done;
+}
+
+#undef QUARTER_V
+#undef DOUBLEROUND_V
+
 static const uint8_t g_chacha20_tau[] = "expand 16-byte k";
 static const uint8_t g_chacha20_sigma[] = "expand 32-byte k";
 
@@ -132,6 +344,7 @@ void cf_chacha20_init(cf_chacha20_ctx *ctx, const uint8_t *key, size_t nkey, con
   memcpy(ctx->nonce + 8, nonce, 8);
   ctx->nblock = 0;
   ctx->ncounter = 8;
+  ctx->simd = chacha20_simd_level();
 }
 
 static
@@ -143,6 +356,8 @@ void cf_chacha20_init_custom(cf_chacha20_ctx *ctx, const uint8_t *key, size_t nk
   memcpy(ctx->nonce, nonce, sizeof ctx->nonce);
   ctx->nblock = 0;
   ctx->ncounter = ncounter;
+  /* vector kernels handle 32- and 64-bit block counters */
+  ctx->simd = (ncounter == 4 || ncounter == 8) ? chacha20_simd_level() : CHACHA20_SIMD_NONE;
 }
 
 static void cf_chacha20_next_block(void *vctx, uint8_t *out)
@@ -160,6 +375,29 @@ static
 void cf_chacha20_cipher(cf_chacha20_ctx *ctx, const uint8_t *input, uint8_t *output, size_t bytes)
 {
   DECLARE_PFN(cf_blockwise_out_fn, cf_chacha20_next_block);
+  if (ctx->simd != CHACHA20_SIMD_NONE && bytes >= 4 * 64)
+  {
+    /* Use up buffered key stream, then whole blocks through the vector kernels */
+    size_t done = ctx->nblock;
+    cf_blockwise_xor(ctx->block, &ctx->nblock, 64,
+                     input, output, done,
+                     pfn_cf_chacha20_next_block,
+                     ctx);
+    input += done;
+    output += done;
+    bytes -= done;
+    if (ctx->simd == CHACHA20_SIMD_AVX2)
+    {
+      done = 64 * cf_chacha20_blocks_avx2(ctx, input, output, bytes / 64);
+      input += done;
+      output += done;
+      bytes -= done;
+    }
+    done = 64 * cf_chacha20_blocks_sse2(ctx, input, output, bytes / 64);
+    input += done;
+    output += done;
+    bytes -= done;
+  }
   cf_blockwise_xor(ctx->block, &ctx->nblock, 64,
                    input, output, bytes,
                    pfn_cf_chacha20_next_block,
@@ -20,6 +20,11 @@
 #define SUCCESS 0
 #define FAILURE 1
 
+/* Encryption is done in chunks of this many bytes, each one MAC'd right
+ * after it is produced while still hot in L1.  Keep it a multiple of the
+ * 512 byte AVX2 keystream stride. */
+#define CHACHA20POLY1305_CHUNK 2048
+
 static int process(const uint8_t key[32],
                    const uint8_t nonce[12],
                    const uint8_t *header, size_t nheader,
@@ -62,9 +67,20 @@ static int process(const uint8_t key[32],
   if (mode == ENCRYPT)
   {
     /* If we're encrypting, we compute the ciphertext
-     * before inputting it into the MAC. */
-    cf_chacha20_cipher(&chacha, input, output, nbytes);
-    cf_poly1305_update(&poly, output, nbytes);
+     * before inputting it into the MAC, one chunk at a time. */
+    const uint8_t *in = input;
+    uint8_t *out = output;
+    size_t remain = nbytes;
+
+    while (remain)
+    {
+      size_t taken = MIN(remain, CHACHA20POLY1305_CHUNK);
+      cf_chacha20_cipher(&chacha, in, out, taken);
+      cf_poly1305_update(&poly, out, taken);
+      in += taken;
+      out += taken;
+      remain -= taken;
+    }
   } else {
     /* Otherwise: decryption -- input the ciphertext.
      * Delay actual decryption until we checked the MAC. */
@@ -145,3 +161,4 @@ int cf_chacha20poly1305_decrypt(const uint8_t key[32],
 }
 
 #undef PADLEN
+#undef CHACHA20POLY1305_CHUNK
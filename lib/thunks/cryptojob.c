@@ -0,0 +1,74 @@
+// public-key operation run on a thread pool thread: caller allocates crypto_job w/ CoTaskMemAlloc
+// (inputs and output after header), queues crypto_job_run w/ QueueUserWorkItem and gets its
+// window message posted back on completion
+// note: ownership is settled by a single compare-exchange on state -- worker flips queued -> done
+//   and posts, caller flips queued -> abandoned and worker frees the block instead
+// note: only ops that read nothing but the constant thunk context are allowed, so no cached RSA ctx
+
+#define CRYPTO_JOB_QUEUED 0
+#define CRYPTO_JOB_DONE 1
+#define CRYPTO_JOB_ABANDONED 2
+
+#define CRYPTO_JOB_RSA_CRT_MODEXP 1
+#define CRYPTO_JOB_ECDSA_SIGN256 2
+#define CRYPTO_JOB_ECDSA_SIGN384 3
+
+#define CRYPTO_JOB_MAX_ARGS 7
+
+typedef BOOL (__stdcall *PostMessage_t)(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam);
+
+// sync w/ UcsCryptoJob in mdTlsThunks.bas
+typedef struct {
+    volatile LONG state;
+    uint32_t op;
+    int32_t result;             // non-zero on success, valid once state is done
+    uint32_t size;              // modulus size for RSA, curve size for ECDSA
+    uint32_t nalloc;            // size of whole block, wiped before an abandoned job is freed
+    HWND hwnd;
+    UINT msg;
+    WPARAM wparam;
+    LPARAM lparam;
+    PostMessage_t post_message;
+    uint8_t *args[CRYPTO_JOB_MAX_ARGS]; // in order of wrapped function, output last
+} crypto_job;
+
+static DWORD __stdcall crypto_job_run(void *param)
+{
+    crypto_job *job = (crypto_job *)param;
+    HWND hwnd = job->hwnd;
+    UINT msg = job->msg;
+    WPARAM wparam = job->wparam;
+    LPARAM lparam = job->lparam;
+    PostMessage_t post_message = job->post_message;
+    uint8_t **a = job->args;
+
+    switch (job->op) {
+#ifdef IMPL_SSHRSA_THUNK
+    case CRYPTO_JOB_RSA_CRT_MODEXP:
+        rsa_crt_modexp(job->size, a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+        job->result = 1;
+        break;
+#endif
+#ifdef IMPL_ECC256_THUNK
+    case CRYPTO_JOB_ECDSA_SIGN256:
+        job->result = ecdsa_sign256(a[0], a[1], (uint64_t *)a[2], a[3]);
+        break;
+#endif
+#ifdef IMPL_ECC384_THUNK
+    case CRYPTO_JOB_ECDSA_SIGN384:
+        job->result = ecdsa_sign384(a[0], a[1], (uint64_t *)a[2], a[3]);
+        break;
+#endif
+    default:
+        job->result = 0;
+    }
+    // header fields are copied above, caller may free the job right after the exchange
+    if (InterlockedCompareExchange(&job->state, CRYPTO_JOB_DONE, CRYPTO_JOB_QUEUED) == CRYPTO_JOB_ABANDONED) {
+        // inputs include the private key
+        memset(job, 0, job->nalloc);
+        getContext()->m_CoTaskMemFree(job);
+    }
+    else if (post_message)
+        post_message(hwnd, msg, wparam, lparam);
+    return 0;
+}
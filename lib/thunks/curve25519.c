@@ -1,33 +1,69 @@
 /* This is based on tweetnacl.  Some typedefs have been
  * replaced with their stdint equivalents.
  *
+ * Field arithmetic uses five 51-bit limbs on 64-bit builds and
+ * ten signed limbs of alternately 26 and 25 bits (radix 2^25.5)
+ * on 32-bit builds, after curve25519-donna and ref10.
+ *
  * Original code was public domain. */
 
-typedef int64_t gf[16];
+#ifdef _WIN64
+
+#include <intrin.h>
+
+typedef uint64_t gf[5];
+
+#define MASK51 0x7ffffffffffffULL
+
+typedef struct { uint64_t lo, hi; } wide25519;
+
+static inline void mac25519(wide25519 *d, uint64_t a, uint64_t b)
+{
+  uint64_t hi, lo = _umul128(a, b, &hi);
+  d->lo += lo;
+  d->hi += hi + (d->lo < lo);
+}
 
 static void set25519(gf r, const gf a)
 {
-  for (size_t i = 0; i < 16; i++)
+  for (size_t i = 0; i < 5; i++)
     r[i] = a[i];
 }
 
+/* Carries every limb down to 51 bits, folding the top carry back in times 19 */
 static void car25519(gf o)
 {
-  int64_t c;
+  for (size_t i = 0; i < 4; i++)
+  {
+    o[i + 1] += o[i] >> 51;
+    o[i] &= MASK51;
+  }
+  o[0] += 19 * (o[4] >> 51);
+  o[4] &= MASK51;
+}
+
+static void carwide25519(gf o, wide25519 r[5])
+{
+  uint64_t c;
 
-  for (size_t i = 0; i < 16; i++)
+  for (size_t i = 0; i < 4; i++)
   {
-    o[i] += (1LL << 16);
-    c = o[i] >> 16;
-    o[(i + 1) * (i < 15)] += c - 1 + 37 * (c - 1) * (i == 15);
-    o[i] -= c << 16;
+    c = (r[i].lo >> 51) | (r[i].hi << 13);
+    o[i] = r[i].lo & MASK51;
+    r[i + 1].lo += c;
+    r[i + 1].hi += (r[i + 1].lo < c);
   }
+  c = (r[4].lo >> 51) | (r[4].hi << 13);
+  o[4] = r[4].lo & MASK51;
+  o[0] += c * 19;
+  o[1] += o[0] >> 51;
+  o[0] &= MASK51;
 }
 
 static void sel25519(gf p, gf q, int b)
 {
-  int64_t tmp, mask = ~(b-1);
-  for (size_t i = 0; i < 16; i++)
+  uint64_t tmp, mask = 0 - (uint64_t)b;
+  for (size_t i = 0; i < 5; i++)
   {
     tmp = mask & (p[i] ^ q[i]);
     p[i] ^= tmp;
@@ -37,96 +73,309 @@ static void sel25519(gf p, gf q, int b)
 
 static void pack25519(uint8_t out[32], const gf n)
 {
-  int b;
-  gf m, t;
+  gf t;
   set25519(t, n);
   car25519(t);
   car25519(t);
+
+  /* now t is between 0 and 2^255-1, properly carried. */
+  t[0] += 19;
   car25519(t);
-  
-  for(size_t j = 0; j < 2; j++)
+
+  /* now between 19 and 2^255-1 and offset by 19, so add 2^255-19 */
+  t[0] += 0x8000000000000ULL - 19;
+  for (size_t i = 1; i < 5; i++)
+    t[i] += 0x8000000000000ULL - 1;
+
+  /* now between 2^255 and 2^256-20 and offset by 2^255 */
+  for (size_t i = 0; i < 4; i++)
   {
-    m[0] = t[0] - 0xffed;
-    for (size_t i = 1; i < 15; i++)
-    {
-      m[i] = t[i] - 0xffff - ((m[i - 1] >> 16) & 1);
-      m[i - 1] &= 0xffff;
-    }
-    m[15] = t[15] - 0x7fff - ((m[14] >> 16) & 1);
-    b = (m[15] >> 16) & 1;
-    m[14] &= 0xffff;
-    sel25519(t, m, 1 - b);
+    t[i + 1] += t[i] >> 51;
+    t[i] &= MASK51;
   }
+  t[4] &= MASK51;
+
+  write64_le(t[0] | (t[1] << 51), out);
+  write64_le((t[1] >> 13) | (t[2] << 38), out + 8);
+  write64_le((t[2] >> 26) | (t[3] << 25), out + 16);
+  write64_le((t[3] >> 39) | (t[4] << 12), out + 24);
+}
+
+static void unpack25519(gf o, const uint8_t *n)
+{
+  uint64_t t[4];
+
+  for (size_t i = 0; i < 4; i++)
+    t[i] = read32_le(n + 8 * i) | ((uint64_t)read32_le(n + 8 * i + 4) << 32);
+
+  o[0] = t[0] & MASK51;
+  o[1] = ((t[0] >> 51) | (t[1] << 13)) & MASK51;
+  o[2] = ((t[1] >> 38) | (t[2] << 26)) & MASK51;
+  o[3] = ((t[2] >> 25) | (t[3] << 39)) & MASK51;
+  o[4] = (t[3] >> 12) & MASK51;
+}
+
+static void add(gf o, const gf a, const gf b)
+{
+  for (size_t i = 0; i < 5; i++)
+    o[i] = a[i] + b[i];
+}
+
+/* o = a + 4p - b, carried so the result can feed further adds */
+static void sub(gf o, const gf a, const gf b)
+{
+  o[0] = a[0] + 0x1fffffffffffb4ULL - b[0];
+  for (size_t i = 1; i < 5; i++)
+    o[i] = a[i] + 0x1ffffffffffffcULL - b[i];
+  car25519(o);
+}
+
+static void mul(gf o, const gf a, const gf b)
+{
+  wide25519 r[5] = { { 0 } };
+  const uint64_t b1 = b[1] * 19, b2 = b[2] * 19, b3 = b[3] * 19, b4 = b[4] * 19;
 
-  for (size_t i = 0; i < 16; i++)
+  mac25519(&r[0], a[0], b[0]); mac25519(&r[0], a[1], b4); mac25519(&r[0], a[2], b3); mac25519(&r[0], a[3], b2); mac25519(&r[0], a[4], b1);
+  mac25519(&r[1], a[0], b[1]); mac25519(&r[1], a[1], b[0]); mac25519(&r[1], a[2], b4); mac25519(&r[1], a[3], b3); mac25519(&r[1], a[4], b2);
+  mac25519(&r[2], a[0], b[2]); mac25519(&r[2], a[1], b[1]); mac25519(&r[2], a[2], b[0]); mac25519(&r[2], a[3], b4); mac25519(&r[2], a[4], b3);
+  mac25519(&r[3], a[0], b[3]); mac25519(&r[3], a[1], b[2]); mac25519(&r[3], a[2], b[1]); mac25519(&r[3], a[3], b[0]); mac25519(&r[3], a[4], b4);
+  mac25519(&r[4], a[0], b[4]); mac25519(&r[4], a[1], b[3]); mac25519(&r[4], a[2], b[2]); mac25519(&r[4], a[3], b[1]); mac25519(&r[4], a[4], b[0]);
+
+  carwide25519(o, r);
+}
+
+static void sqr(gf o, const gf a)
+{
+  wide25519 r[5] = { { 0 } };
+  const uint64_t d0 = a[0] * 2, d1 = a[1] * 2, d2 = a[2] * 2 * 19, d419 = a[4] * 19, d4 = d419 * 2;
+
+  mac25519(&r[0], a[0], a[0]); mac25519(&r[0], d4, a[1]); mac25519(&r[0], d2, a[3]);
+  mac25519(&r[1], d0, a[1]); mac25519(&r[1], d4, a[2]); mac25519(&r[1], a[3], a[3] * 19);
+  mac25519(&r[2], d0, a[2]); mac25519(&r[2], a[1], a[1]); mac25519(&r[2], d4, a[3]);
+  mac25519(&r[3], d0, a[3]); mac25519(&r[3], d1, a[2]); mac25519(&r[3], a[4], d419);
+  mac25519(&r[4], d0, a[4]); mac25519(&r[4], d1, a[3]); mac25519(&r[4], a[2], a[2]);
+
+  carwide25519(o, r);
+}
+
+static void mul121665(gf o, const gf a)
+{
+  wide25519 r[5] = { { 0 } };
+
+  for (size_t i = 0; i < 5; i++)
+    mac25519(&r[i], a[i], 121665);
+
+  carwide25519(o, r);
+}
+
+#else /* _WIN64 */
+
+typedef int32_t gf[10];
+
+/* Limb i holds bits LIMB_POS(i) .. LIMB_POS(i) + LIMB_BITS(i) - 1 */
+#define LIMB_BITS(i) (26 - ((i) & 1))
+#define LIMB_POS(i) (((i) * 51 + 1) / 2)
+
+static void set25519(gf r, const gf a)
+{
+  for (size_t i = 0; i < 10; i++)
+    r[i] = a[i];
+}
+
+/* Signed carry with rounding, leaves |limb| <= 2^25 (2^24 for odd limbs) */
+static void carwide25519(gf o, int64_t t[10])
+{
+  int64_t c;
+
+  for (size_t i = 0; i < 10; i += 2)
   {
-    out[2 * i] = t[i] & 0xff;
-    out[2 * i + 1] = (uint8_t)(t[i] >> 8);
+    c = (t[i] + (1 << 25)) >> 26;
+    t[i] -= c << 26;
+    t[i + 1] += c;
+    c = (t[i + 1] + (1 << 24)) >> 25;
+    t[i + 1] -= c << 25;
+    if (i < 8)
+      t[i + 2] += c;
+    else
+      t[0] += 19 * c;
   }
+  c = (t[0] + (1 << 25)) >> 26;
+  t[0] -= c << 26;
+  t[1] += c;
+
+  for (size_t i = 0; i < 10; i++)
+    o[i] = (int32_t)t[i];
 }
 
+static void car25519(gf o)
+{
+  int64_t t[10];
 
+  for (size_t i = 0; i < 10; i++)
+    t[i] = o[i];
+  carwide25519(o, t);
+}
+
+static void sel25519(gf p, gf q, int b)
+{
+  int32_t tmp, mask = ~(b-1);
+  for (size_t i = 0; i < 10; i++)
+  {
+    tmp = mask & (p[i] ^ q[i]);
+    p[i] ^= tmp;
+    q[i] ^= tmp;
+  }
+}
+
+static void pack25519(uint8_t out[32], const gf n)
+{
+  int32_t q, c;
+  uint32_t v;
+  gf t;
+  set25519(t, n);
+  car25519(t);
+
+  /* q = 1 iff t >= p */
+  q = (19 * t[9] + (1 << 24)) >> 25;
+  for (size_t i = 0; i < 10; i++)
+    q = (t[i] + q) >> LIMB_BITS(i);
+
+  /* t - q * p, then a non-rounding carry leaves each limb in [0, 2^bits) */
+  t[0] += 19 * q;
+  for (size_t i = 0; i < 9; i++)
+  {
+    c = t[i] >> LIMB_BITS(i);
+    t[i + 1] += c;
+    t[i] -= c << LIMB_BITS(i);
+  }
+  t[9] &= (1 << 25) - 1;
+
+  for (size_t i = 0; i < 32; i++)
+    out[i] = 0;
+  for (size_t i = 0; i < 10; i++)
+  {
+    v = (uint32_t)t[i] << (LIMB_POS(i) & 7);
+    for (size_t k = 0; k < 4 && (LIMB_POS(i) >> 3) + k < 32; k++)
+      out[(LIMB_POS(i) >> 3) + k] |= (uint8_t)(v >> (8 * k));
+  }
+}
 
 static void unpack25519(gf o, const uint8_t *n)
 {
-  for (size_t i = 0; i < 16; i++)
-    o[i] = n[2 * i] + ((int64_t) n[2 * i + 1] << 8);
-  o[15] &= 0x7fff;
+  for (size_t i = 0; i < 10; i++)
+    o[i] = (read32_le(n + (LIMB_POS(i) >> 3)) >> (LIMB_POS(i) & 7)) & ((1 << LIMB_BITS(i)) - 1);
 }
 
 static void add(gf o, const gf a, const gf b)
 {
-  for (size_t i = 0; i < 16; i++)
+  for (size_t i = 0; i < 10; i++)
     o[i] = a[i] + b[i];
 }
 
 static void sub(gf o, const gf a, const gf b)
 {
-  for (size_t i = 0; i < 16; i++)
+  for (size_t i = 0; i < 10; i++)
     o[i] = a[i] - b[i];
 }
 
+/* Inputs may be sums of up to three carried elements. Products of two
+ * odd limbs are doubled and limbs wrapping past 2^255 are times 19. */
 static void mul(gf o, const gf a, const gf b)
 {
-  int64_t t[31];
+  int64_t t[10];
+  int32_t ai;
+  int i, j, k;
 
-  for (size_t i = 0; i < 31; i++)
+  for (i = 0; i < 10; i++)
     t[i] = 0;
 
-  for (size_t i = 0; i < 16; i++)
-    for (size_t j = 0; j < 16; j++)
-      t[i + j] += a[i] * b[j];
+  for (i = 0; i < 10; i++)
+    for (j = 0; j < 10; j++)
+    {
+      k = i + j;
+      ai = a[i];
+      if (k >= 10)
+      {
+        k -= 10;
+        ai *= 19;
+      }
+      t[k] += (int64_t)ai * (b[j] * (1 + (i & j & 1)));
+    }
 
-  for (size_t i = 0; i < 15; i++)
-    t[i] += 38 * t[i + 16];
+  carwide25519(o, t);
+}
+
+static void sqr(gf o, const gf a)
+{
+  int64_t t[10];
+  int32_t ai;
+  int i, j, k;
 
-  for (size_t i = 0; i < 16; i++)
-    o[i] = t[i];
+  for (i = 0; i < 10; i++)
+    t[i] = 0;
 
-  car25519(o);
-  car25519(o);
+  for (i = 0; i < 10; i++)
+    for (j = i; j < 10; j++)
+    {
+      k = i + j;
+      ai = a[i];
+      if (k >= 10)
+      {
+        k -= 10;
+        ai *= 19;
+      }
+      t[k] += (int64_t)ai * (a[j] * ((1 + (i & j & 1)) << (i != j)));
+    }
+
+  carwide25519(o, t);
 }
 
-static void sqr(gf o, const gf a)
+static void mul121665(gf o, const gf a)
+{
+  int64_t t[10];
+
+  for (size_t i = 0; i < 10; i++)
+    t[i] = (int64_t)a[i] * 121665;
+
+  carwide25519(o, t);
+}
+
+#endif /* _WIN64 */
+
+static void sqrn25519(gf o, const gf a, int n)
 {
-  mul(o, a, a);
+  sqr(o, a);
+  while (--n > 0)
+    sqr(o, o);
 }
 
+/* o = i^(p - 2) via the usual 254 squarings and 11 multiplications */
 static void inv25519(gf o, const gf i)
 {
-  gf c;
-  for (int a = 0; a < 16; a++)
-    c[a] = i[a];
-  
-  for (int a = 253; a >= 0; a--)
-  {
-    sqr(c, c);
-    if(a != 2 && a != 4)
-      mul(c, c, i);
-  }
+  gf z2, z9, z11, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0, t;
 
-  for (int a = 0; a < 16; a++)
-    o[a] = c[a];
+  sqr(z2, i);
+  sqrn25519(t, z2, 2);
+  mul(z9, t, i);
+  mul(z11, z9, z2);
+  sqr(t, z11);
+  mul(z2_5_0, t, z9);
+  sqrn25519(t, z2_5_0, 5);
+  mul(z2_10_0, t, z2_5_0);
+  sqrn25519(t, z2_10_0, 10);
+  mul(z2_20_0, t, z2_10_0);
+  sqrn25519(t, z2_20_0, 20);
+  mul(t, t, z2_20_0);
+  sqrn25519(t, t, 10);
+  mul(z2_50_0, t, z2_10_0);
+  sqrn25519(t, z2_50_0, 50);
+  mul(z2_100_0, t, z2_50_0);
+  sqrn25519(t, z2_100_0, 100);
+  mul(t, t, z2_100_0);
+  sqrn25519(t, t, 50);
+  mul(t, t, z2_50_0);
+  sqrn25519(t, t, 5);
+  mul(o, t, z11);
 }
 
 static
@@ -135,7 +384,6 @@ void cf_curve25519_mul(uint8_t out[32], const uint8_t priv[32], const uint8_t pu
   uint8_t z[32];
   gf x;
   gf a, b, c, d, e, f;
-  const gf _121665 = {0xDB41, 1};
 
   for (size_t i = 0; i < 31; i++)
     z[i] = priv[i];
@@ -144,7 +392,7 @@ void cf_curve25519_mul(uint8_t out[32], const uint8_t priv[32], const uint8_t pu
   
   unpack25519(x, pub);
 
-  for(size_t i = 0; i < 16; i++)
+  for(size_t i = 0; i < sizeof(gf) / sizeof(x[0]); i++)
   {
     b[i] = x[i];
     d[i] = a[i] = c[i] = 0;
@@ -169,7 +417,7 @@ void cf_curve25519_mul(uint8_t out[32], const uint8_t priv[32], const uint8_t pu
     sub(a, a, c);
     sqr(b, a);
     sub(c, d, f);
-    mul(a, c, _121665);
+    mul121665(a, c);
     add(a, a, d);
     mul(c, c, a);
     mul(a, d, f);
@@ -184,9 +432,193 @@ void cf_curve25519_mul(uint8_t out[32], const uint8_t priv[32], const uint8_t pu
   pack25519(out, a);
 }
 
+/* Fixed-base multiply on the birationally equivalent edwards25519 curve
+ * -x^2 + y^2 = 1 + d x^2 y^2. Points are extended (X:Y:Z:T) with
+ * x = X/Z, y = Y/Z, xy = T/Z; comb entries are affine (y+x, y-x, 2dxy)
+ * and unified addition needs no special cases for the neutral element. */
+
+/* p = 2p */
+static void dbl25519(gf p[4])
+{
+  gf xx, yy, zz2, a, y3, z3, x3, t3;
+
+  sqr(xx, p[0]);
+  sqr(yy, p[1]);
+  sqr(zz2, p[2]);
+  add(zz2, zz2, zz2);
+  car25519(zz2);
+  add(a, p[0], p[1]);
+  sqr(a, a);
+  add(y3, yy, xx);
+  sub(z3, yy, xx);
+  sub(x3, a, y3);
+  sub(t3, zz2, z3);
+  mul(p[0], x3, t3);
+  mul(p[1], y3, z3);
+  mul(p[2], z3, t3);
+  mul(p[3], x3, y3);
+}
+
+/* p += q where q = (y+x, y-x, 2dxy) */
+static void madd25519(gf p[4], gf q[3])
+{
+  gf a, b, c, d, e, f, g, h;
+
+  sub(a, p[1], p[0]);
+  mul(a, a, q[1]);
+  add(b, p[1], p[0]);
+  mul(b, b, q[0]);
+  mul(c, p[3], q[2]);
+  add(d, p[2], p[2]);
+  sub(e, b, a);
+  sub(f, d, c);
+  add(g, d, c);
+  add(h, b, a);
+  mul(p[0], e, f);
+  mul(p[1], g, h);
+  mul(p[2], f, g);
+  mul(p[3], e, h);
+}
+
+/* Loads comb entry idx (1..CURVE25519_COMB_POINTS) into q, or the neutral
+ * element (1, 1, 0) for idx 0, touching every entry. */
+static void comb_select25519(gf q[3], int idx)
+{
+  uint32_t buf[24], mask;
+
+  for (size_t i = 0; i < 24; i++)
+    buf[i] = 0;
+  buf[0] = buf[8] = 1;
+
+  for (int m = 1; m <= CURVE25519_COMB_POINTS; m++)
+  {
+    mask = 0 - (uint32_t)(m == idx);
+    for (size_t i = 0; i < 24; i++)
+      buf[i] ^= (buf[i] ^ curve25519_comb[m - 1][i]) & mask;
+  }
+
+  unpack25519(q[0], (const uint8_t *)buf);
+  unpack25519(q[1], (const uint8_t *)(buf + 8));
+  unpack25519(q[2], (const uint8_t *)(buf + 16));
+}
+
 static
 void cf_curve25519_mul_base(uint8_t out[32], const uint8_t priv[32])
 {
-  const uint8_t _9[32] = {9};
-  cf_curve25519_mul(out, priv, _9);
+  uint8_t z[32];
+  gf p[4], q[3];
+  int idx, bit;
+
+  for (size_t i = 0; i < 31; i++)
+    z[i] = priv[i];
+  z[31] = (priv[31] & 127) | 64;
+  z[0] &= 248;
+
+  for (size_t i = 0; i < sizeof(gf) / sizeof(p[0][0]); i++)
+    p[0][i] = p[1][i] = p[2][i] = p[3][i] = 0;
+  p[1][0] = p[2][0] = 1;
+
+  for (int i = CURVE25519_COMB_SPACING - 1; i >= 0; i--)
+  {
+    dbl25519(p);
+    idx = 0;
+    for (int j = 0; j < CURVE25519_COMB_TEETH; j++)
+    {
+      bit = i + j * CURVE25519_COMB_SPACING;
+      if (bit < 255)
+        idx |= ((z[bit >> 3] >> (bit & 7)) & 1) << j;
+    }
+    comb_select25519(q, idx);
+    madd25519(p, q);
+  }
+
+  /* u = (1 + y) / (1 - y) = (Z + Y) / (Z - Y) */
+  add(q[0], p[2], p[1]);
+  sub(q[1], p[2], p[1]);
+  inv25519(q[1], q[1]);
+  mul(q[0], q[0], q[1]);
+  pack25519(out, q[0]);
+
+  mem_clean(z, sizeof z);
+}
+
+/* x coordinate of the edwards25519 base point, y is 4/5 */
+static const uint8_t g_curve25519_base_x[32] = {
+  0x1a, 0xd5, 0x25, 0x8f, 0x60, 0x2d, 0x56, 0xc9, 0xb2, 0xa7, 0x25, 0x95, 0x60, 0xc7, 0x2c, 0x69,
+  0x5c, 0xdc, 0xd6, 0xfd, 0x31, 0xe2, 0xa4, 0xc0, 0xfe, 0x53, 0x6e, 0xcd, 0xd3, 0x36, 0x69, 0x21
+};
+
+/* Fills curve25519_comb[m - 1] with sum of 2^(j * CURVE25519_COMB_SPACING) * B over
+ * the bits j of m. Only run when the thunk context is built, so it may use the
+ * g_curve25519_base_x constant directly. */
+static void cf_curve25519_comb_init(void)
+{
+  gf d2, ax[CURVE25519_COMB_POINTS], ay[CURVE25519_COMB_POINTS], p[4], q[3], t;
+  uint8_t buf[32];
+  int m, low;
+
+  /* 2d = 2 * -121665 / 121666 */
+  for (size_t i = 0; i < sizeof(gf) / sizeof(t[0]); i++)
+    t[i] = p[0][i] = 0;
+  t[0] = 121666;
+  inv25519(t, t);
+  mul121665(t, t);
+  sub(d2, p[0], t);
+  add(d2, d2, d2);
+  car25519(d2);
+
+  for (m = 1; m <= CURVE25519_COMB_POINTS; m++)
+  {
+    low = m & (0 - m);
+    if (m == 1)
+    {
+      for (size_t i = 0; i < sizeof(gf) / sizeof(t[0]); i++)
+        t[i] = 0;
+      t[0] = 5;
+      inv25519(t, t);
+      add(t, t, t);
+      add(t, t, t);
+      car25519(t);
+      set25519(ay[0], t);
+      unpack25519(ax[0], g_curve25519_base_x);
+      continue;
+    }
+    /* p = affine (x, y) of m - low, or of m / 2 spaced down once for powers of two */
+    set25519(p[0], ax[(m == low ? low >> 1 : m - low) - 1]);
+    set25519(p[1], ay[(m == low ? low >> 1 : m - low) - 1]);
+    for (size_t i = 0; i < sizeof(gf) / sizeof(t[0]); i++)
+      p[2][i] = 0;
+    p[2][0] = 1;
+    mul(p[3], p[0], p[1]);
+    if (m == low)
+    {
+      for (int i = 0; i < CURVE25519_COMB_SPACING; i++)
+        dbl25519(p);
+    }
+    else
+    {
+      add(q[0], ay[low - 1], ax[low - 1]);
+      sub(q[1], ay[low - 1], ax[low - 1]);
+      mul(q[2], ax[low - 1], ay[low - 1]);
+      mul(q[2], q[2], d2);
+      madd25519(p, q);
+    }
+    inv25519(t, p[2]);
+    mul(ax[m - 1], p[0], t);
+    mul(ay[m - 1], p[1], t);
+  }
+
+  for (m = 1; m <= CURVE25519_COMB_POINTS; m++)
+  {
+    add(t, ay[m - 1], ax[m - 1]);
+    pack25519(buf, t);
+    memcpy(curve25519_comb[m - 1], buf, 32);
+    sub(t, ay[m - 1], ax[m - 1]);
+    pack25519(buf, t);
+    memcpy(curve25519_comb[m - 1] + 8, buf, 32);
+    mul(t, ax[m - 1], ay[m - 1]);
+    mul(t, t, d2);
+    pack25519(buf, t);
+    memcpy(curve25519_comb[m - 1] + 16, buf, 32);
+  }
 }
@@ -13,6 +13,10 @@ typedef unsigned int uint;
     #define SUPPORTS_INT128 0
 #endif
 
+#ifdef _M_X64
+    #include <intrin.h>
+#endif
+
 #if SUPPORTS_INT128
 typedef unsigned __int128 uint128_t;
 #else
@@ -219,6 +223,35 @@ static void vli_set(uint64_t *p_dest, uint64_t *p_src, size_t p_numDigits)
     }
 }
 
+#define vli_select256(p_dest, p_src, p_mask) vli_select(p_dest, p_src, p_mask, NUM_ECC_DIGITS_256)
+#define vli_select384(p_dest, p_src, p_mask) vli_select(p_dest, p_src, p_mask, NUM_ECC_DIGITS_384)
+
+/* Sets p_dest = p_src where p_mask is all ones, leaves p_dest alone where it is zero. */
+static void vli_select(uint64_t *p_dest, uint64_t *p_src, uint64_t p_mask, size_t p_numDigits)
+{
+    uint i;
+    for(i=0; i<p_numDigits; ++i)
+    {
+        p_dest[i] ^= (p_dest[i] ^ p_src[i]) & p_mask;
+    }
+}
+
+#define vli_zeroMask256(p_vli) vli_zeroMask(p_vli, NUM_ECC_DIGITS_256)
+#define vli_zeroMask384(p_vli) vli_zeroMask(p_vli, NUM_ECC_DIGITS_384)
+
+/* Returns all ones if p_vli == 0, zero otherwise, without branching on the digits. */
+static uint64_t vli_zeroMask(uint64_t *p_vli, size_t p_numDigits)
+{
+    uint i;
+    uint64_t l_bits = 0;
+    for(i=0; i<p_numDigits; ++i)
+    {
+        l_bits |= p_vli[i];
+    }
+    l_bits = (l_bits | ((uint64_t)0 - l_bits)) >> 63;
+    return l_bits - 1;
+}
+
 #define vli_cmp256(p_left, p_right) vli_cmp(p_left, p_right, NUM_ECC_DIGITS_256)
 #define vli_cmp384(p_left, p_right) vli_cmp(p_left, p_right, NUM_ECC_DIGITS_384)
 
@@ -277,12 +310,63 @@ static void vli_rshift1(uint64_t *p_vli, size_t p_numDigits)
     }
 }
 
+/* Width-ECC_WNAF_WIDTH NAF of p_scalar, least significant digit first. Non-zero digits are odd,
+   below 2^(ECC_WNAF_WIDTH - 1) in magnitude and followed by at least ECC_WNAF_WIDTH - 1 zeros.
+   Returns the number of digits, at most p_numDigits * 64 + 1. */
+static uint ecc_wnaf(int8_t *p_naf, uint64_t *p_scalar, size_t p_numDigits)
+{
+    uint64_t l_k[MAX_NUM_ECC_DIGITS + 1];
+    uint64_t l_carry;
+    uint i, l_len = 0;
+    int l_digit;
+
+    vli_set(l_k, p_scalar, p_numDigits);
+    l_k[p_numDigits] = 0;
+    while(!vli_isZero(l_k, p_numDigits + 1))
+    {
+        l_digit = 0;
+        if(l_k[0] & 1)
+        {
+            l_digit = (int)(l_k[0] & ((1 << ECC_WNAF_WIDTH) - 1));
+            if(l_digit >= (1 << (ECC_WNAF_WIDTH - 1)))
+            {
+                l_digit -= 1 << ECC_WNAF_WIDTH;
+            }
+            if(l_digit > 0)
+            {
+                l_k[0] -= (uint64_t)l_digit;
+            }
+            else
+            {
+                l_carry = (uint64_t)-l_digit;
+                for(i = 0; i <= p_numDigits && l_carry; ++i)
+                {
+                    l_k[i] += l_carry;
+                    l_carry = (l_k[i] < l_carry);
+                }
+            }
+        }
+        p_naf[l_len++] = (int8_t)l_digit;
+        vli_rshift1(l_k, p_numDigits + 1);
+    }
+    return l_len;
+}
+
 #define vli_add256(p_result, p_left, p_right) vli_add(p_result, p_left, p_right, NUM_ECC_DIGITS_256)
 #define vli_add384(p_result, p_left, p_right) vli_add(p_result, p_left, p_right, NUM_ECC_DIGITS_384)
 
 /* Computes p_result = p_left + p_right, returning carry. Can modify in place. */
 static uint64_t vli_add(uint64_t *p_result, uint64_t *p_left, uint64_t *p_right, size_t p_numDigits)
 {
+#ifdef _M_X64
+    unsigned char l_carry = 0;
+    uint i;
+    for(i=0; i<p_numDigits; ++i)
+    {
+        l_carry = _addcarry_u64(l_carry, p_left[i], p_right[i], &p_result[i]);
+    }
+    return l_carry;
+#else
     uint64_t l_carry = 0;
     uint i;
     for(i=0; i<p_numDigits; ++i)
@@ -295,6 +379,7 @@ static uint64_t vli_add(uint64_t *p_result, uint64_t *p_left, uint64_t *p_right,
         p_result[i] = l_sum;
     }
     return l_carry;
+#endif
 }
 
 #define vli_sub256(p_result, p_left, p_right) vli_sub(p_result, p_left, p_right, NUM_ECC_DIGITS_256)
@@ -303,6 +388,15 @@ static uint64_t vli_add(uint64_t *p_result, uint64_t *p_left, uint64_t *p_right,
 /* Computes p_result = p_left - p_right, returning borrow. Can modify in place. */
 static uint64_t vli_sub(uint64_t *p_result, uint64_t *p_left, uint64_t *p_right, size_t p_numDigits)
 {
+#ifdef _M_X64
+    unsigned char l_borrow = 0;
+    uint i;
+    for(i=0; i<p_numDigits; ++i)
+    {
+        l_borrow = _subborrow_u64(l_borrow, p_left[i], p_right[i], &p_result[i]);
+    }
+    return l_borrow;
+#else
     uint64_t l_borrow = 0;
     uint i;
     for(i=0; i<p_numDigits; ++i)
@@ -315,6 +409,7 @@ static uint64_t vli_sub(uint64_t *p_result, uint64_t *p_left, uint64_t *p_right,
         p_result[i] = l_diff;
     }
     return l_borrow;
+#endif
 }
 
 #if SUPPORTS_INT128
@@ -379,7 +474,9 @@ static void vli_square(uint64_t *p_result, uint64_t *p_left)
 static uint128_t mul_64_64(uint64_t p_left, uint64_t p_right)
 {
     uint128_t l_result;
-    
+#ifdef _M_X64
+    l_result.m_low = _umul128(p_left, p_right, &l_result.m_high);
+#else
     uint64_t a0 = p_left & 0xffffffffull;
     uint64_t a1 = p_left >> 32;
     uint64_t b0 = p_right & 0xffffffffull;
@@ -399,15 +496,19 @@ static uint128_t mul_64_64(uint64_t p_left, uint64_t p_right)
     
     l_result.m_low = (m0 & 0xffffffffull) | (m2 << 32);
     l_result.m_high = m3 + (m2 >> 32);
-    
+#endif
     return l_result;
 }
 
 static uint128_t add_128_128(uint128_t a, uint128_t b)
 {
     uint128_t l_result;
+#ifdef _M_X64
+    _addcarry_u64(_addcarry_u64(0, a.m_low, b.m_low, &l_result.m_low), a.m_high, b.m_high, &l_result.m_high);
+#else
     l_result.m_low = a.m_low + b.m_low;
     l_result.m_high = a.m_high + b.m_high + (l_result.m_low < a.m_low);
+#endif
     return l_result;
 }
 
@@ -661,69 +762,111 @@ static void vli_mmod_fast256(uint64_t *p_result, uint64_t *p_product)
 #endif
 #if ECC_CURVE_384 == secp384r1
 
-static void omega_mult(uint64_t *p_result, uint64_t *p_right)
-{
-    uint64_t l_tmp[NUM_ECC_DIGITS_384];
-    uint64_t l_carry, l_diff;
-    
-    /* Multiply by (2^128 + 2^96 - 2^32 + 1). */
-    vli_set384(p_result, p_right); /* 1 */
-    l_carry = vli_lshift384(l_tmp, p_right, 32);
-    p_result[1 + NUM_ECC_DIGITS_384] = l_carry + vli_add384(p_result + 1, p_result + 1, l_tmp); /* 2^96 + 1 */
-    p_result[2 + NUM_ECC_DIGITS_384] = vli_add384(p_result + 2, p_result + 2, p_right); /* 2^128 + 2^96 + 1 */
-    l_carry += vli_sub384(p_result, p_result, l_tmp); /* 2^128 + 2^96 - 2^32 + 1 */
-    l_diff = p_result[NUM_ECC_DIGITS_384] - l_carry;
-    if(l_diff > p_result[NUM_ECC_DIGITS_384])
-    { /* Propagate borrow if necessary. */
-        uint i;
-        for(i = 1 + NUM_ECC_DIGITS_384; ; ++i)
-        {
-            --p_result[i];
-            if(p_result[i] != (uint64_t)-1)
-            {
-                break;
-            }
-        }
-    }
-    p_result[NUM_ECC_DIGITS_384] = l_diff;
-}
+/* 32-bit word i of p_vli */
+#define W32(p_vli, i) (((p_vli)[(i) >> 1] >> (((i) & 1) * 32)) & 0xffffffff)
+/* 64-bit digit made of 32-bit words hi:lo of p_vli */
+#define W64(p_vli, hi, lo) ((W32(p_vli, hi) << 32) | W32(p_vli, lo))
 
 /* Computes p_result = p_product % curve_p_384
-    see PDF "Comparing Elliptic Curve Cryptography and RSA on 8-bit CPUs"
-    section "Curve-Specific Optimizations" */
+   from http://www.nsa.gov/ia/_files/nist-routines.pdf */
 static void vli_mmod_fast384(uint64_t *p_result, uint64_t *p_product)
 {
-    uint64_t l_tmp[2*NUM_ECC_DIGITS_384];
-     
-    while(!vli_isZero384(p_product + NUM_ECC_DIGITS_384)) /* While c1 != 0 */
+    uint64_t l_tmp[NUM_ECC_DIGITS_384];
+    int l_carry; // don't change to uint64_t as it stops working
+    
+    /* t */
+    vli_set384(p_result, p_product);
+    
+    /* s1 */
+    l_tmp[0] = 0;
+    l_tmp[1] = 0;
+    l_tmp[2] = W64(p_product, 22, 21);
+    l_tmp[3] = W32(p_product, 23);
+    l_tmp[4] = 0;
+    l_tmp[5] = 0;
+    l_carry = (int)vli_lshift384(l_tmp, l_tmp, 1);
+    l_carry += (int)vli_add384(p_result, p_result, l_tmp);
+    
+    /* s2 */
+    l_carry += (int)vli_add384(p_result, p_result, p_product + NUM_ECC_DIGITS_384);
+    
+    /* s3 */
+    l_tmp[0] = W64(p_product, 22, 21);
+    l_tmp[1] = W64(p_product, 12, 23);
+    l_tmp[2] = W64(p_product, 14, 13);
+    l_tmp[3] = W64(p_product, 16, 15);
+    l_tmp[4] = W64(p_product, 18, 17);
+    l_tmp[5] = W64(p_product, 20, 19);
+    l_carry += (int)vli_add384(p_result, p_result, l_tmp);
+    
+    /* s4 */
+    l_tmp[0] = W32(p_product, 23) << 32;
+    l_tmp[1] = W32(p_product, 20) << 32;
+    l_tmp[2] = W64(p_product, 13, 12);
+    l_tmp[3] = W64(p_product, 15, 14);
+    l_tmp[4] = W64(p_product, 17, 16);
+    l_tmp[5] = W64(p_product, 19, 18);
+    l_carry += (int)vli_add384(p_result, p_result, l_tmp);
+    
+    /* s5 */
+    l_tmp[0] = 0;
+    l_tmp[1] = 0;
+    l_tmp[2] = W64(p_product, 21, 20);
+    l_tmp[3] = W64(p_product, 23, 22);
+    l_tmp[4] = 0;
+    l_tmp[5] = 0;
+    l_carry += (int)vli_add384(p_result, p_result, l_tmp);
+    
+    /* s6 */
+    l_tmp[0] = W32(p_product, 20);
+    l_tmp[1] = W32(p_product, 21) << 32;
+    l_tmp[2] = W64(p_product, 23, 22);
+    l_tmp[3] = 0;
+    l_carry += (int)vli_add384(p_result, p_result, l_tmp);
+    
+    /* d1 */
+    l_tmp[0] = W64(p_product, 12, 23);
+    l_tmp[1] = W64(p_product, 14, 13);
+    l_tmp[2] = W64(p_product, 16, 15);
+    l_tmp[3] = W64(p_product, 18, 17);
+    l_tmp[4] = W64(p_product, 20, 19);
+    l_tmp[5] = W64(p_product, 22, 21);
+    l_carry -= (int)vli_sub384(p_result, p_result, l_tmp);
+    
+    /* d2 */
+    l_tmp[0] = W32(p_product, 20) << 32;
+    l_tmp[1] = W64(p_product, 22, 21);
+    l_tmp[2] = W32(p_product, 23);
+    l_tmp[3] = 0;
+    l_tmp[4] = 0;
+    l_tmp[5] = 0;
+    l_carry -= (int)vli_sub384(p_result, p_result, l_tmp);
+    
+    /* d3 */
+    l_tmp[0] = 0;
+    l_tmp[1] = W32(p_product, 23) << 32;
+    l_tmp[2] = W32(p_product, 23);
+    l_carry -= (int)vli_sub384(p_result, p_result, l_tmp);
+    
+    if(l_carry < 0)
     {
-        uint64_t l_carry = 0;
-        uint i;
-        
-        vli_clear384(l_tmp);
-        vli_clear384(l_tmp + NUM_ECC_DIGITS_384);
-        omega_mult(l_tmp, p_product + NUM_ECC_DIGITS_384); /* tmp = w * c1 */
-        vli_clear384(p_product + NUM_ECC_DIGITS_384); /* p = c0 */
-        
-        /* (c1, c0) = c0 + w * c1 */
-        for(i=0; i<NUM_ECC_DIGITS_384+3; ++i)
+        do
         {
-            uint64_t l_sum = p_product[i] + l_tmp[i] + l_carry;
-            if(l_sum != p_product[i])
-            {
-                l_carry = (l_sum < p_product[i]);
-            }
-            p_product[i] = l_sum;
-        }
+            l_carry += (int)vli_add384(p_result, p_result, curve_p_384);
+        } while(l_carry < 0);
     }
-    
-    while(vli_cmp384(p_product, curve_p_384) > 0)
+    else
     {
-        vli_sub384(p_product, p_product, curve_p_384);
+        while(l_carry || vli_cmp384(curve_p_384, p_result) != 1)
+        {
+            l_carry -= (int)vli_sub384(p_result, p_result, curve_p_384);
+        }
     }
-    vli_set384(p_result, p_product);
 }
 
+#undef W64
+#undef W32
+
 #endif
 
 static void vli_mmod_fast(uint64_t *p_result, uint64_t *p_product, size_t p_numDigits)
@@ -1053,6 +1196,264 @@ static void EccPoint_mult256(EccPoint *p_result, EccPoint *p_point, uint64_t *p_
     vli_set256(p_result->y, Ry[0]);
 }
 
+/* Doubles in place like EccPoint_double_jacobian256 but without its early exit on Z1 == 0,
+   the point at infinity is doubled as (x1, y1, 1) and gets its zero z back by mask. */
+static void EccPoint_double_masked256(uint64_t *X1, uint64_t *Y1, uint64_t *Z1)
+{
+    uint64_t l_one[NUM_ECC_DIGITS_256];
+    uint64_t l_zero[NUM_ECC_DIGITS_256];
+    uint64_t l_inf = vli_zeroMask256(Z1);
+
+    vli_clear256(l_one);
+    l_one[0] = 1;
+    vli_clear256(l_zero);
+    vli_select256(Z1, l_one, l_inf);
+    EccPoint_double_jacobian256(X1, Y1, Z1);
+    vli_select256(Z1, l_zero, l_inf);
+}
+
+/* Mixed addition (X1, Y1, Z1) += (x2, y2, 1) in Jacobian coordinates. All special cases
+   are folded in with masks so timing does not depend on the points: p_add == 0 leaves P
+   untouched, Z1 == 0 (P at infinity) loads the affine point, P == (x2, y2) takes the
+   doubling that is always computed and P == -(x2, y2) ends with z3 = z1*H = 0. */
+static void EccPoint_add_mixed256(uint64_t *X1, uint64_t *Y1, uint64_t *Z1, EccPoint *p_point, uint64_t p_add)
+{
+    uint64_t t1[NUM_ECC_DIGITS_256];
+    uint64_t t2[NUM_ECC_DIGITS_256];
+    uint64_t t3[NUM_ECC_DIGITS_256];
+    uint64_t t4[NUM_ECC_DIGITS_256];
+    uint64_t X3[NUM_ECC_DIGITS_256];
+    uint64_t Y3[NUM_ECC_DIGITS_256];
+    uint64_t X2[NUM_ECC_DIGITS_256];
+    uint64_t Y2[NUM_ECC_DIGITS_256];
+    uint64_t Z2[NUM_ECC_DIGITS_256];
+    uint64_t l_one[NUM_ECC_DIGITS_256];
+    uint64_t l_inf = vli_zeroMask256(Z1);
+    uint64_t l_dbl;
+
+    p_add = (uint64_t)0 - (uint64_t)(p_add != 0);
+
+    vli_modSquare_fast256(t1, Z1);                /* t1 = z1^2 */
+    vli_modMult_fast256(t2, t1, Z1);              /* t2 = z1^3 */
+    vli_modMult_fast256(t1, t1, p_point->x);      /* t1 = x2*z1^2 = U2 */
+    vli_modMult_fast256(t2, t2, p_point->y);      /* t2 = y2*z1^3 = S2 */
+    vli_modSub256(t1, t1, X1, curve_p_256);       /* t1 = U2 - x1 = H */
+    vli_modSub256(t2, t2, Y1, curve_p_256);       /* t2 = S2 - y1 = R */
+
+    l_dbl = ~l_inf & vli_zeroMask256(t1) & vli_zeroMask256(t2);
+    vli_set256(X2, X1);
+    vli_set256(Y2, Y1);
+    vli_set256(Z2, Z1);
+    EccPoint_double_masked256(X2, Y2, Z2);
+
+    vli_modSquare_fast256(t3, t1);                /* t3 = H^2 */
+    vli_modMult_fast256(t4, t3, t1);              /* t4 = H^3 */
+    vli_modMult_fast256(t3, t3, X1);              /* t3 = x1*H^2 = V */
+    vli_modSquare_fast256(X3, t2);                /* x3 = R^2 */
+    vli_modSub256(X3, X3, t4, curve_p_256);       /* x3 = R^2 - H^3 */
+    vli_modSub256(X3, X3, t3, curve_p_256);
+    vli_modSub256(X3, X3, t3, curve_p_256);       /* x3 = R^2 - H^3 - 2*V */
+    vli_modSub256(t3, t3, X3, curve_p_256);       /* t3 = V - x3 */
+    vli_modMult_fast256(Y3, t2, t3);              /* y3 = R*(V - x3) */
+    vli_modMult_fast256(t4, t4, Y1);              /* t4 = y1*H^3 */
+    vli_modSub256(Y3, Y3, t4, curve_p_256);       /* y3 = R*(V - x3) - y1*H^3 */
+    vli_modMult_fast256(t1, t1, Z1);              /* t1 = z1*H = z3 */
+
+    vli_clear256(l_one);
+    l_one[0] = 1;
+    vli_select256(X3, p_point->x, l_inf);
+    vli_select256(Y3, p_point->y, l_inf);
+    vli_select256(t1, l_one, l_inf);
+    vli_select256(X3, X2, l_dbl);
+    vli_select256(Y3, Y2, l_dbl);
+    vli_select256(t1, Z2, l_dbl);
+
+    vli_select256(X1, X3, p_add);
+    vli_select256(Y1, Y3, p_add);
+    vli_select256(Z1, t1, p_add);
+}
+
+/* Copies comb table entry p_index (1..ECC_COMB_POINTS) into p_result, touching every entry. */
+static void EccPoint_comb_select256(EccPoint *p_result, uint p_index)
+{
+    uint i;
+    uint64_t l_mask;
+
+    vli_clear256(p_result->x);
+    vli_clear256(p_result->y);
+    for(i = 1; i <= ECC_COMB_POINTS; ++i)
+    {
+        l_mask = (uint64_t)0 - (uint64_t)(i == p_index);
+        vli_select256(p_result->x, curve_G_256_comb[i - 1].x, l_mask);
+        vli_select256(p_result->y, curve_G_256_comb[i - 1].y, l_mask);
+    }
+}
+
+/* Fixed-base multiply p_result = p_scalar * G using the comb table in curve_G_256_comb.
+   Bit j of column i is scalar bit i + j * ECC_COMB_SPACING_256. */
+static void EccPoint_mult_base256(EccPoint *p_result, uint64_t *p_scalar)
+{
+    uint64_t X[NUM_ECC_DIGITS_256];
+    uint64_t Y[NUM_ECC_DIGITS_256];
+    uint64_t Z[NUM_ECC_DIGITS_256];
+    EccPoint l_point;
+    uint l_index, l_bit;
+    int i, j;
+
+    vli_clear256(X);
+    vli_clear256(Y);
+    vli_clear256(Z);
+    for(i = ECC_COMB_SPACING_256 - 1; i >= 0; --i)
+    {
+        EccPoint_double_masked256(X, Y, Z);
+        l_index = 0;
+        for(j = 0; j < ECC_COMB_TEETH; ++j)
+        {
+            l_bit = i + j * ECC_COMB_SPACING_256;
+            if(l_bit < ECC_BYTES_256 * 8)
+            {
+                l_index |= (uint)((p_scalar[l_bit / 64] >> (l_bit % 64)) & 1) << j;
+            }
+        }
+        EccPoint_comb_select256(&l_point, l_index);
+        EccPoint_add_mixed256(X, Y, Z, &l_point, l_index);
+    }
+
+    /* Back to affine, Z == 0 leaves the point at infinity as (0, 0) */
+    vli_modInv256(Z, Z, curve_p_256);
+    vli_modSquare_fast256(l_point.x, Z);           /* 1/z^2 */
+    vli_modMult_fast256(l_point.y, l_point.x, Z);  /* 1/z^3 */
+    vli_modMult_fast256(p_result->x, X, l_point.x);
+    vli_modMult_fast256(p_result->y, Y, l_point.y);
+}
+
+/* Fills curve_G_256_comb[m - 1] = sum of 2^(j * ECC_COMB_SPACING_256) * G over the bits j of m.
+   Done once when the thunk context is built so the table ships with the rest of the globals. */
+static void ecc_comb_init256(void)
+{
+    uint64_t X[NUM_ECC_DIGITS_256];
+    uint64_t Y[NUM_ECC_DIGITS_256];
+    uint64_t Z[NUM_ECC_DIGITS_256];
+    uint64_t l_zinv[NUM_ECC_DIGITS_256];
+    uint64_t l_tmp[NUM_ECC_DIGITS_256];
+    uint i, j, m;
+
+    vli_set256(X, curve_G_256.x);
+    vli_set256(Y, curve_G_256.y);
+    vli_clear256(Z);
+    Z[0] = 1;
+    for(j = 0; j < ECC_COMB_TEETH; ++j)
+    {
+        vli_modInv256(l_zinv, Z, curve_p_256);
+        vli_modSquare_fast256(l_tmp, l_zinv);
+        vli_modMult_fast256(curve_G_256_comb[(1 << j) - 1].x, X, l_tmp);
+        vli_modMult_fast256(l_tmp, l_tmp, l_zinv);
+        vli_modMult_fast256(curve_G_256_comb[(1 << j) - 1].y, Y, l_tmp);
+        for(i = 0; i < ECC_COMB_SPACING_256; ++i)
+        {
+            EccPoint_double_jacobian256(X, Y, Z);
+        }
+    }
+    for(m = 3; m <= ECC_COMB_POINTS; ++m)
+    {
+        if(!(m & (m - 1)))
+        {
+            continue;
+        }
+        /* m = (m & (m - 1)) + lowest bit of m */
+        vli_set256(X, curve_G_256_comb[(m & (m - 1)) - 1].x);
+        vli_set256(Y, curve_G_256_comb[(m & (m - 1)) - 1].y);
+        vli_clear256(Z);
+        Z[0] = 1;
+        EccPoint_add_mixed256(X, Y, Z, &curve_G_256_comb[(m & (0 - m)) - 1], 1);
+        vli_modInv256(l_zinv, Z, curve_p_256);
+        vli_modSquare_fast256(l_tmp, l_zinv);
+        vli_modMult_fast256(curve_G_256_comb[m - 1].x, X, l_tmp);
+        vli_modMult_fast256(l_tmp, l_tmp, l_zinv);
+        vli_modMult_fast256(curve_G_256_comb[m - 1].y, Y, l_tmp);
+    }
+}
+
+/* p_table[i] = (2i + 1) * p_point in affine coordinates, for the wNAF loop in ecdsa_verify256.
+   2P costs one inversion and the odd multiples share another (Montgomery's trick). */
+static void EccPoint_odd_multiples256(EccPoint *p_table, EccPoint *p_point)
+{
+    uint64_t X[ECC_WNAF_POINTS][NUM_ECC_DIGITS_256];
+    uint64_t Y[ECC_WNAF_POINTS][NUM_ECC_DIGITS_256];
+    uint64_t Z[ECC_WNAF_POINTS][NUM_ECC_DIGITS_256];
+    uint64_t l_prod[ECC_WNAF_POINTS][NUM_ECC_DIGITS_256];
+    uint64_t l_inv[NUM_ECC_DIGITS_256];
+    uint64_t l_zinv[NUM_ECC_DIGITS_256];
+    uint64_t l_tmp[NUM_ECC_DIGITS_256];
+    EccPoint l_twice;
+    uint i;
+
+    vli_set256(X[0], p_point->x);
+    vli_set256(Y[0], p_point->y);
+    vli_clear256(Z[0]);
+    Z[0][0] = 1;
+    EccPoint_double_jacobian256(X[0], Y[0], Z[0]);
+    vli_modInv256(l_zinv, Z[0], curve_p_256);
+    vli_modSquare_fast256(l_tmp, l_zinv);
+    vli_modMult_fast256(l_twice.x, X[0], l_tmp);
+    vli_modMult_fast256(l_tmp, l_tmp, l_zinv);
+    vli_modMult_fast256(l_twice.y, Y[0], l_tmp);
+
+    /* (2i + 1)P = (2i - 1)P + 2P */
+    vli_set256(X[0], p_point->x);
+    vli_set256(Y[0], p_point->y);
+    vli_clear256(Z[0]);
+    Z[0][0] = 1;
+    vli_set256(l_prod[0], Z[0]);
+    for(i = 1; i < ECC_WNAF_POINTS; ++i)
+    {
+        vli_set256(X[i], X[i - 1]);
+        vli_set256(Y[i], Y[i - 1]);
+        vli_set256(Z[i], Z[i - 1]);
+        EccPoint_add_mixed256(X[i], Y[i], Z[i], &l_twice, 1);
+        vli_modMult_fast256(l_prod[i], l_prod[i - 1], Z[i]);
+    }
+
+    /* l_prod[i] = Z[0] * .. * Z[i], so one inversion of the last yields every 1/Z[i] */
+    vli_modInv256(l_inv, l_prod[ECC_WNAF_POINTS - 1], curve_p_256);
+    for(i = ECC_WNAF_POINTS; i-- > 0; )
+    {
+        if(i > 0)
+        {
+            vli_modMult_fast256(l_zinv, l_inv, l_prod[i - 1]);
+            vli_modMult_fast256(l_inv, l_inv, Z[i]);
+        }
+        else
+        {
+            vli_set256(l_zinv, l_inv);
+        }
+        vli_modSquare_fast256(l_tmp, l_zinv);
+        vli_modMult_fast256(p_table[i].x, X[i], l_tmp);
+        vli_modMult_fast256(l_tmp, l_tmp, l_zinv);
+        vli_modMult_fast256(p_table[i].y, Y[i], l_tmp);
+    }
+}
+
+/* (X1, Y1, Z1) += p_digit * P for a non-zero wNAF digit, p_table from EccPoint_odd_multiples256. */
+static void EccPoint_add_wnaf256(uint64_t *X1, uint64_t *Y1, uint64_t *Z1, EccPoint *p_table, int p_digit)
+{
+    EccPoint l_point;
+
+    vli_set256(l_point.x, p_table[(p_digit < 0 ? -p_digit : p_digit) >> 1].x);
+    vli_set256(l_point.y, p_table[(p_digit < 0 ? -p_digit : p_digit) >> 1].y);
+    if(p_digit < 0)
+    {
+        vli_sub256(l_point.y, curve_p_256, l_point.y);
+    }
+    EccPoint_add_mixed256(X1, Y1, Z1, &l_point, 1);
+}
+
+/* Fills curve_G_256_wnaf with the odd multiples of G. Done once when the thunk context is built. */
+static void ecc_wnaf_init256(void)
+{
+    EccPoint_odd_multiples256(curve_G_256_wnaf, &curve_G_256);
+}
+
 static void ecc_bytes2native256(uint64_t p_native[NUM_ECC_DIGITS_256], const uint8_t p_bytes[ECC_BYTES_256])
 {
     unsigned i;
@@ -1143,7 +1544,7 @@ static int ecc_make_key256(uint8_t p_publicKey[2*ECC_BYTES_256+1], const uint8_t
         vli_sub256(l_private, l_private, curve_n_256);
     }
 
-    EccPoint_mult256(&l_public, &curve_G_256, l_private, NULL);
+    EccPoint_mult_base256(&l_public, l_private);
     if (EccPoint_isZero256(&l_public))
         return 0;
     
@@ -1267,7 +1668,7 @@ static int ecdsa_sign256(const uint8_t p_privateKey[ECC_BYTES_256], const uint8_
     }
     
     /* tmp = k * G */
-    EccPoint_mult256(&p, &curve_G_256, k, NULL);
+    EccPoint_mult_base256(&p, k);
     
     /* r = x1 (mod n) */
     if(vli_cmp256(curve_n_256, p.x) != 1)
@@ -1295,7 +1696,10 @@ static int ecdsa_verify256(const uint8_t p_publicKey[ECC_BYTES_256+1], const uin
 {
     uint64_t u1[NUM_ECC_DIGITS_256], u2[NUM_ECC_DIGITS_256];
     uint64_t z[NUM_ECC_DIGITS_256];
-    EccPoint l_public, l_sum;
+    EccPoint l_public;
+    EccPoint l_table[ECC_WNAF_POINTS];
+    int8_t l_naf1[ECC_BYTES_256 * 8 + 1], l_naf2[ECC_BYTES_256 * 8 + 1];
+    uint l_len1, l_len2, i;
     uint64_t rx[NUM_ECC_DIGITS_256];
     uint64_t ry[NUM_ECC_DIGITS_256];
     uint64_t tx[NUM_ECC_DIGITS_256];
@@ -1324,53 +1728,43 @@ static int ecdsa_verify256(const uint8_t p_publicKey[ECC_BYTES_256+1], const uin
     vli_modMult256(u1, u1, z, curve_n_256); /* u1 = e/s */
     vli_modMult256(u2, l_r, z, curve_n_256); /* u2 = r/s */
     
-    /* Calculate l_sum = G + Q. */
-    vli_set256(l_sum.x, l_public.x);
-    vli_set256(l_sum.y, l_public.y);
-    vli_set256(tx, curve_G_256.x);
-    vli_set256(ty, curve_G_256.y);
-    vli_modSub256(z, l_sum.x, tx, curve_p_256); /* Z = x2 - x1 */
-    XYcZ_add256(tx, ty, l_sum.x, l_sum.y);
-    vli_modInv256(z, z, curve_p_256); /* Z = 1/Z */
-    apply_z256(l_sum.x, l_sum.y, z);
-    
-    /* Use Shamir's trick to calculate u1*G + u2*Q */
-    EccPoint *l_points[4] = {NULL, &curve_G_256, &l_public, &l_sum};
-    uint l_numBits = umax(vli_numBits256(u1), vli_numBits256(u2));
-    
-    EccPoint *l_point = l_points[(!!vli_testBit256(u1, l_numBits-1)) | ((!!vli_testBit256(u2, l_numBits-1)) << 1)];
-    vli_set256(rx, l_point->x);
-    vli_set256(ry, l_point->y);
+    /* Calculate u1*G + u2*Q: interleaved wNAF, sharing the doublings, with odd multiples of
+       G from the context and of Q computed here. Inputs are public, so this needn't be constant time. */
+    EccPoint_odd_multiples256(l_table, &l_public);
+    l_len1 = ecc_wnaf(l_naf1, u1, NUM_ECC_DIGITS_256);
+    l_len2 = ecc_wnaf(l_naf2, u2, NUM_ECC_DIGITS_256);
+    vli_clear256(rx);
+    vli_clear256(ry);
     vli_clear256(z);
-    z[0] = 1;
-
-    int i;
-    for(i = l_numBits - 2; i >= 0; --i)
+    for(i = umax(l_len1, l_len2); i-- > 0; )
     {
         EccPoint_double_jacobian256(rx, ry, z);
-        
-        int l_index = (!!vli_testBit256(u1, i)) | ((!!vli_testBit256(u2, i)) << 1);
-        EccPoint *l_point = l_points[l_index];
-        if(l_point)
+        if(i < l_len1 && l_naf1[i])
+        {
+            EccPoint_add_wnaf256(rx, ry, z, curve_G_256_wnaf, l_naf1[i]);
+        }
+        if(i < l_len2 && l_naf2[i])
         {
-            vli_set256(tx, l_point->x);
-            vli_set256(ty, l_point->y);
-            apply_z256(tx, ty, z);
-            vli_modSub256(tz, rx, tx, curve_p_256); /* Z = x2 - x1 */
-            XYcZ_add256(tx, ty, rx, ry);
-            vli_modMult_fast256(z, z, tz);
+            EccPoint_add_wnaf256(rx, ry, z, l_table, l_naf2[i]);
         }
     }
-
-    vli_modInv256(z, z, curve_p_256); /* Z = 1/Z */
-    apply_z256(rx, ry, z);
-    
-    /* v = x1 (mod n) */
-    if(vli_cmp256(curve_n_256, rx) != 1)
+    if(vli_isZero256(z))
     {
-        vli_sub256(rx, rx, curve_n_256);
+        return 0;
     }
 
-    /* Accept only if v == r. */
-    return (vli_cmp256(rx, l_r) == 0);
+    /* Accept only if x1 (mod n) == r, i.e. x1 == r or x1 == r + n. Compared as X == r * Z^2 in
+       Jacobian form, which spares the inversion. */
+    vli_modSquare_fast256(tz, z);
+    vli_modMult_fast256(tx, l_r, tz);
+    if(vli_cmp256(tx, rx) == 0)
+    {
+        return 1;
+    }
+    if(vli_add256(ty, l_r, curve_n_256) == 0 && vli_cmp256(ty, curve_p_256) < 0)
+    {
+        vli_modMult_fast256(tx, ty, tz);
+        return (vli_cmp256(tx, rx) == 0);
+    }
+    return 0;
 }
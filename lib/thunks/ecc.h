@@ -25,6 +25,21 @@ typedef struct EccPoint
     uint64_t y[NUM_ECC_DIGITS_256];
 } EccPoint;
 
+/* Fixed-base comb: ECC_COMB_TEETH scalar bits per column, ECC_COMB_SPACING_256 columns
+   and one precomputed affine multiple of G per non-zero column value. */
+#ifndef ECC_COMB_TEETH
+    #define ECC_COMB_TEETH 5
+    #define ECC_COMB_POINTS ((1 << ECC_COMB_TEETH) - 1)
+#endif
+#define ECC_COMB_SPACING_256 ((ECC_BYTES_256 * 8 + ECC_COMB_TEETH - 1) / ECC_COMB_TEETH)
+
+/* wNAF digits for ECDSA verify: odd, below 2^(ECC_WNAF_WIDTH - 1) in magnitude, so
+   ECC_WNAF_POINTS odd multiples per point. */
+#ifndef ECC_WNAF_WIDTH
+    #define ECC_WNAF_WIDTH 5
+    #define ECC_WNAF_POINTS (1 << (ECC_WNAF_WIDTH - 2))
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
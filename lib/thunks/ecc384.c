@@ -991,6 +991,264 @@ static void EccPoint_mult384(EccPoint384 *p_result, EccPoint384 *p_point, uint64
     vli_set384(p_result->y, Ry[0]);
 }
 
+/* Doubles in place like EccPoint_double_jacobian384 but without its early exit on Z1 == 0,
+   the point at infinity is doubled as (x1, y1, 1) and gets its zero z back by mask. */
+static void EccPoint_double_masked384(uint64_t *X1, uint64_t *Y1, uint64_t *Z1)
+{
+    uint64_t l_one[NUM_ECC_DIGITS_384];
+    uint64_t l_zero[NUM_ECC_DIGITS_384];
+    uint64_t l_inf = vli_zeroMask384(Z1);
+
+    vli_clear384(l_one);
+    l_one[0] = 1;
+    vli_clear384(l_zero);
+    vli_select384(Z1, l_one, l_inf);
+    EccPoint_double_jacobian384(X1, Y1, Z1);
+    vli_select384(Z1, l_zero, l_inf);
+}
+
+/* Mixed addition (X1, Y1, Z1) += (x2, y2, 1) in Jacobian coordinates. All special cases
+   are folded in with masks so timing does not depend on the points: p_add == 0 leaves P
+   untouched, Z1 == 0 (P at infinity) loads the affine point, P == (x2, y2) takes the
+   doubling that is always computed and P == -(x2, y2) ends with z3 = z1*H = 0. */
+static void EccPoint_add_mixed384(uint64_t *X1, uint64_t *Y1, uint64_t *Z1, EccPoint384 *p_point, uint64_t p_add)
+{
+    uint64_t t1[NUM_ECC_DIGITS_384];
+    uint64_t t2[NUM_ECC_DIGITS_384];
+    uint64_t t3[NUM_ECC_DIGITS_384];
+    uint64_t t4[NUM_ECC_DIGITS_384];
+    uint64_t X3[NUM_ECC_DIGITS_384];
+    uint64_t Y3[NUM_ECC_DIGITS_384];
+    uint64_t X2[NUM_ECC_DIGITS_384];
+    uint64_t Y2[NUM_ECC_DIGITS_384];
+    uint64_t Z2[NUM_ECC_DIGITS_384];
+    uint64_t l_one[NUM_ECC_DIGITS_384];
+    uint64_t l_inf = vli_zeroMask384(Z1);
+    uint64_t l_dbl;
+
+    p_add = (uint64_t)0 - (uint64_t)(p_add != 0);
+
+    vli_modSquare_fast384(t1, Z1);                /* t1 = z1^2 */
+    vli_modMult_fast384(t2, t1, Z1);              /* t2 = z1^3 */
+    vli_modMult_fast384(t1, t1, p_point->x);      /* t1 = x2*z1^2 = U2 */
+    vli_modMult_fast384(t2, t2, p_point->y);      /* t2 = y2*z1^3 = S2 */
+    vli_modSub384(t1, t1, X1, curve_p_384);       /* t1 = U2 - x1 = H */
+    vli_modSub384(t2, t2, Y1, curve_p_384);       /* t2 = S2 - y1 = R */
+
+    l_dbl = ~l_inf & vli_zeroMask384(t1) & vli_zeroMask384(t2);
+    vli_set384(X2, X1);
+    vli_set384(Y2, Y1);
+    vli_set384(Z2, Z1);
+    EccPoint_double_masked384(X2, Y2, Z2);
+
+    vli_modSquare_fast384(t3, t1);                /* t3 = H^2 */
+    vli_modMult_fast384(t4, t3, t1);              /* t4 = H^3 */
+    vli_modMult_fast384(t3, t3, X1);              /* t3 = x1*H^2 = V */
+    vli_modSquare_fast384(X3, t2);                /* x3 = R^2 */
+    vli_modSub384(X3, X3, t4, curve_p_384);       /* x3 = R^2 - H^3 */
+    vli_modSub384(X3, X3, t3, curve_p_384);
+    vli_modSub384(X3, X3, t3, curve_p_384);       /* x3 = R^2 - H^3 - 2*V */
+    vli_modSub384(t3, t3, X3, curve_p_384);       /* t3 = V - x3 */
+    vli_modMult_fast384(Y3, t2, t3);              /* y3 = R*(V - x3) */
+    vli_modMult_fast384(t4, t4, Y1);              /* t4 = y1*H^3 */
+    vli_modSub384(Y3, Y3, t4, curve_p_384);       /* y3 = R*(V - x3) - y1*H^3 */
+    vli_modMult_fast384(t1, t1, Z1);              /* t1 = z1*H = z3 */
+
+    vli_clear384(l_one);
+    l_one[0] = 1;
+    vli_select384(X3, p_point->x, l_inf);
+    vli_select384(Y3, p_point->y, l_inf);
+    vli_select384(t1, l_one, l_inf);
+    vli_select384(X3, X2, l_dbl);
+    vli_select384(Y3, Y2, l_dbl);
+    vli_select384(t1, Z2, l_dbl);
+
+    vli_select384(X1, X3, p_add);
+    vli_select384(Y1, Y3, p_add);
+    vli_select384(Z1, t1, p_add);
+}
+
+/* Copies comb table entry p_index (1..ECC_COMB_POINTS) into p_result, touching every entry. */
+static void EccPoint_comb_select384(EccPoint384 *p_result, uint p_index)
+{
+    uint i;
+    uint64_t l_mask;
+
+    vli_clear384(p_result->x);
+    vli_clear384(p_result->y);
+    for(i = 1; i <= ECC_COMB_POINTS; ++i)
+    {
+        l_mask = (uint64_t)0 - (uint64_t)(i == p_index);
+        vli_select384(p_result->x, curve_G_384_comb[i - 1].x, l_mask);
+        vli_select384(p_result->y, curve_G_384_comb[i - 1].y, l_mask);
+    }
+}
+
+/* Fixed-base multiply p_result = p_scalar * G using the comb table in curve_G_384_comb.
+   Bit j of column i is scalar bit i + j * ECC_COMB_SPACING_384. */
+static void EccPoint_mult_base384(EccPoint384 *p_result, uint64_t *p_scalar)
+{
+    uint64_t X[NUM_ECC_DIGITS_384];
+    uint64_t Y[NUM_ECC_DIGITS_384];
+    uint64_t Z[NUM_ECC_DIGITS_384];
+    EccPoint384 l_point;
+    uint l_index, l_bit;
+    int i, j;
+
+    vli_clear384(X);
+    vli_clear384(Y);
+    vli_clear384(Z);
+    for(i = ECC_COMB_SPACING_384 - 1; i >= 0; --i)
+    {
+        EccPoint_double_masked384(X, Y, Z);
+        l_index = 0;
+        for(j = 0; j < ECC_COMB_TEETH; ++j)
+        {
+            l_bit = i + j * ECC_COMB_SPACING_384;
+            if(l_bit < ECC_BYTES_384 * 8)
+            {
+                l_index |= (uint)((p_scalar[l_bit / 64] >> (l_bit % 64)) & 1) << j;
+            }
+        }
+        EccPoint_comb_select384(&l_point, l_index);
+        EccPoint_add_mixed384(X, Y, Z, &l_point, l_index);
+    }
+
+    /* Back to affine, Z == 0 leaves the point at infinity as (0, 0) */
+    vli_modInv384(Z, Z, curve_p_384);
+    vli_modSquare_fast384(l_point.x, Z);           /* 1/z^2 */
+    vli_modMult_fast384(l_point.y, l_point.x, Z);  /* 1/z^3 */
+    vli_modMult_fast384(p_result->x, X, l_point.x);
+    vli_modMult_fast384(p_result->y, Y, l_point.y);
+}
+
+/* Fills curve_G_384_comb[m - 1] = sum of 2^(j * ECC_COMB_SPACING_384) * G over the bits j of m.
+   Done once when the thunk context is built so the table ships with the rest of the globals. */
+static void ecc_comb_init384(void)
+{
+    uint64_t X[NUM_ECC_DIGITS_384];
+    uint64_t Y[NUM_ECC_DIGITS_384];
+    uint64_t Z[NUM_ECC_DIGITS_384];
+    uint64_t l_zinv[NUM_ECC_DIGITS_384];
+    uint64_t l_tmp[NUM_ECC_DIGITS_384];
+    uint i, j, m;
+
+    vli_set384(X, curve_G_384.x);
+    vli_set384(Y, curve_G_384.y);
+    vli_clear384(Z);
+    Z[0] = 1;
+    for(j = 0; j < ECC_COMB_TEETH; ++j)
+    {
+        vli_modInv384(l_zinv, Z, curve_p_384);
+        vli_modSquare_fast384(l_tmp, l_zinv);
+        vli_modMult_fast384(curve_G_384_comb[(1 << j) - 1].x, X, l_tmp);
+        vli_modMult_fast384(l_tmp, l_tmp, l_zinv);
+        vli_modMult_fast384(curve_G_384_comb[(1 << j) - 1].y, Y, l_tmp);
+        for(i = 0; i < ECC_COMB_SPACING_384; ++i)
+        {
+            EccPoint_double_jacobian384(X, Y, Z);
+        }
+    }
+    for(m = 3; m <= ECC_COMB_POINTS; ++m)
+    {
+        if(!(m & (m - 1)))
+        {
+            continue;
+        }
+        /* m = (m & (m - 1)) + lowest bit of m */
+        vli_set384(X, curve_G_384_comb[(m & (m - 1)) - 1].x);
+        vli_set384(Y, curve_G_384_comb[(m & (m - 1)) - 1].y);
+        vli_clear384(Z);
+        Z[0] = 1;
+        EccPoint_add_mixed384(X, Y, Z, &curve_G_384_comb[(m & (0 - m)) - 1], 1);
+        vli_modInv384(l_zinv, Z, curve_p_384);
+        vli_modSquare_fast384(l_tmp, l_zinv);
+        vli_modMult_fast384(curve_G_384_comb[m - 1].x, X, l_tmp);
+        vli_modMult_fast384(l_tmp, l_tmp, l_zinv);
+        vli_modMult_fast384(curve_G_384_comb[m - 1].y, Y, l_tmp);
+    }
+}
+
+/* p_table[i] = (2i + 1) * p_point in affine coordinates, for the wNAF loop in ecdsa_verify384.
+   2P costs one inversion and the odd multiples share another (Montgomery's trick). */
+static void EccPoint_odd_multiples384(EccPoint384 *p_table, EccPoint384 *p_point)
+{
+    uint64_t X[ECC_WNAF_POINTS][NUM_ECC_DIGITS_384];
+    uint64_t Y[ECC_WNAF_POINTS][NUM_ECC_DIGITS_384];
+    uint64_t Z[ECC_WNAF_POINTS][NUM_ECC_DIGITS_384];
+    uint64_t l_prod[ECC_WNAF_POINTS][NUM_ECC_DIGITS_384];
+    uint64_t l_inv[NUM_ECC_DIGITS_384];
+    uint64_t l_zinv[NUM_ECC_DIGITS_384];
+    uint64_t l_tmp[NUM_ECC_DIGITS_384];
+    EccPoint384 l_twice;
+    uint i;
+
+    vli_set384(X[0], p_point->x);
+    vli_set384(Y[0], p_point->y);
+    vli_clear384(Z[0]);
+    Z[0][0] = 1;
+    EccPoint_double_jacobian384(X[0], Y[0], Z[0]);
+    vli_modInv384(l_zinv, Z[0], curve_p_384);
+    vli_modSquare_fast384(l_tmp, l_zinv);
+    vli_modMult_fast384(l_twice.x, X[0], l_tmp);
+    vli_modMult_fast384(l_tmp, l_tmp, l_zinv);
+    vli_modMult_fast384(l_twice.y, Y[0], l_tmp);
+
+    /* (2i + 1)P = (2i - 1)P + 2P */
+    vli_set384(X[0], p_point->x);
+    vli_set384(Y[0], p_point->y);
+    vli_clear384(Z[0]);
+    Z[0][0] = 1;
+    vli_set384(l_prod[0], Z[0]);
+    for(i = 1; i < ECC_WNAF_POINTS; ++i)
+    {
+        vli_set384(X[i], X[i - 1]);
+        vli_set384(Y[i], Y[i - 1]);
+        vli_set384(Z[i], Z[i - 1]);
+        EccPoint_add_mixed384(X[i], Y[i], Z[i], &l_twice, 1);
+        vli_modMult_fast384(l_prod[i], l_prod[i - 1], Z[i]);
+    }
+
+    /* l_prod[i] = Z[0] * .. * Z[i], so one inversion of the last yields every 1/Z[i] */
+    vli_modInv384(l_inv, l_prod[ECC_WNAF_POINTS - 1], curve_p_384);
+    for(i = ECC_WNAF_POINTS; i-- > 0; )
+    {
+        if(i > 0)
+        {
+            vli_modMult_fast384(l_zinv, l_inv, l_prod[i - 1]);
+            vli_modMult_fast384(l_inv, l_inv, Z[i]);
+        }
+        else
+        {
+            vli_set384(l_zinv, l_inv);
+        }
+        vli_modSquare_fast384(l_tmp, l_zinv);
+        vli_modMult_fast384(p_table[i].x, X[i], l_tmp);
+        vli_modMult_fast384(l_tmp, l_tmp, l_zinv);
+        vli_modMult_fast384(p_table[i].y, Y[i], l_tmp);
+    }
+}
+
+/* (X1, Y1, Z1) += p_digit * P for a non-zero wNAF digit, p_table from EccPoint_odd_multiples384. */
+static void EccPoint_add_wnaf384(uint64_t *X1, uint64_t *Y1, uint64_t *Z1, EccPoint384 *p_table, int p_digit)
+{
+    EccPoint384 l_point;
+
+    vli_set384(l_point.x, p_table[(p_digit < 0 ? -p_digit : p_digit) >> 1].x);
+    vli_set384(l_point.y, p_table[(p_digit < 0 ? -p_digit : p_digit) >> 1].y);
+    if(p_digit < 0)
+    {
+        vli_sub384(l_point.y, curve_p_384, l_point.y);
+    }
+    EccPoint_add_mixed384(X1, Y1, Z1, &l_point, 1);
+}
+
+/* Fills curve_G_384_wnaf with the odd multiples of G. Done once when the thunk context is built. */
+static void ecc_wnaf_init384(void)
+{
+    EccPoint_odd_multiples384(curve_G_384_wnaf, &curve_G_384);
+}
+
 static void ecc_bytes2native384(uint64_t p_native[NUM_ECC_DIGITS_384], const uint8_t p_bytes[ECC_BYTES_384])
 {
     unsigned i;
@@ -1081,7 +1339,7 @@ static int ecc_make_key384(uint8_t p_publicKey[2*ECC_BYTES_384+1], const uint8_t
         vli_sub384(l_private, l_private, curve_n_384);
     }
 
-    EccPoint_mult384(&l_public, &curve_G_384, l_private, NULL);
+    EccPoint_mult_base384(&l_public, l_private);
     if (EccPoint_isZero384(&l_public))
         return 0;
     
@@ -1207,7 +1465,7 @@ static int ecdsa_sign384(const uint8_t p_privateKey[ECC_BYTES_384], const uint8_
     }
     
     /* tmp = k * G */
-    EccPoint_mult384(&p, &curve_G_384, k, NULL);
+    EccPoint_mult_base384(&p, k);
     
     /* r = x1 (mod n) */
     if(vli_cmp384(curve_n_384, p.x) != 1)
@@ -1235,7 +1493,10 @@ static int ecdsa_verify384(const uint8_t p_publicKey[ECC_BYTES_384+1], const uin
 {
     uint64_t u1[NUM_ECC_DIGITS_384], u2[NUM_ECC_DIGITS_384];
     uint64_t z[NUM_ECC_DIGITS_384];
-    EccPoint384 l_public, l_sum;
+    EccPoint384 l_public;
+    EccPoint384 l_table[ECC_WNAF_POINTS];
+    int8_t l_naf1[ECC_BYTES_384 * 8 + 1], l_naf2[ECC_BYTES_384 * 8 + 1];
+    uint l_len1, l_len2, i;
     uint64_t rx[NUM_ECC_DIGITS_384];
     uint64_t ry[NUM_ECC_DIGITS_384];
     uint64_t tx[NUM_ECC_DIGITS_384];
@@ -1264,53 +1525,43 @@ static int ecdsa_verify384(const uint8_t p_publicKey[ECC_BYTES_384+1], const uin
     vli_modMult384(u1, u1, z, curve_n_384); /* u1 = e/s */
     vli_modMult384(u2, l_r, z, curve_n_384); /* u2 = r/s */
     
-    /* Calculate l_sum = G + Q. */
-    vli_set384(l_sum.x, l_public.x);
-    vli_set384(l_sum.y, l_public.y);
-    vli_set384(tx, curve_G_384.x);
-    vli_set384(ty, curve_G_384.y);
-    vli_modSub384(z, l_sum.x, tx, curve_p_384); /* Z = x2 - x1 */
-    XYcZ_add384(tx, ty, l_sum.x, l_sum.y);
-    vli_modInv384(z, z, curve_p_384); /* Z = 1/Z */
-    apply_z384(l_sum.x, l_sum.y, z);
-    
-    /* Use Shamir's trick to calculate u1*G + u2*Q */
-    EccPoint384 *l_points[4] = {NULL, &curve_G_384, &l_public, &l_sum};
-    uint l_numBits = umax384(vli_numBits384(u1), vli_numBits384(u2));
-    
-    EccPoint384 *l_point = l_points[(!!vli_testBit384(u1, l_numBits-1)) | ((!!vli_testBit384(u2, l_numBits-1)) << 1)];
-    vli_set384(rx, l_point->x);
-    vli_set384(ry, l_point->y);
+    /* Calculate u1*G + u2*Q: interleaved wNAF, sharing the doublings, with odd multiples of
+       G from the context and of Q computed here. Inputs are public, so this needn't be constant time. */
+    EccPoint_odd_multiples384(l_table, &l_public);
+    l_len1 = ecc_wnaf(l_naf1, u1, NUM_ECC_DIGITS_384);
+    l_len2 = ecc_wnaf(l_naf2, u2, NUM_ECC_DIGITS_384);
+    vli_clear384(rx);
+    vli_clear384(ry);
     vli_clear384(z);
-    z[0] = 1;
-
-    int i;
-    for(i = l_numBits - 2; i >= 0; --i)
+    for(i = umax384(l_len1, l_len2); i-- > 0; )
     {
         EccPoint_double_jacobian384(rx, ry, z);
-        
-        int l_index = (!!vli_testBit384(u1, i)) | ((!!vli_testBit384(u2, i)) << 1);
-        EccPoint384 *l_point = l_points[l_index];
-        if(l_point)
+        if(i < l_len1 && l_naf1[i])
         {
-            vli_set384(tx, l_point->x);
-            vli_set384(ty, l_point->y);
-            apply_z384(tx, ty, z);
-            vli_modSub384(tz, rx, tx, curve_p_384); /* Z = x2 - x1 */
-            XYcZ_add384(tx, ty, rx, ry);
-            vli_modMult_fast384(z, z, tz);
+            EccPoint_add_wnaf384(rx, ry, z, curve_G_384_wnaf, l_naf1[i]);
+        }
+        if(i < l_len2 && l_naf2[i])
+        {
+            EccPoint_add_wnaf384(rx, ry, z, l_table, l_naf2[i]);
         }
     }
-
-    vli_modInv384(z, z, curve_p_384); /* Z = 1/Z */
-    apply_z384(rx, ry, z);
-    
-    /* v = x1 (mod n) */
-    if(vli_cmp384(curve_n_384, rx) != 1)
+    if(vli_isZero384(z))
     {
-        vli_sub384(rx, rx, curve_n_384);
+        return 0;
     }
 
-    /* Accept only if v == r. */
-    return (vli_cmp384(rx, l_r) == 0);
+    /* Accept only if x1 (mod n) == r, i.e. x1 == r or x1 == r + n. Compared as X == r * Z^2 in
+       Jacobian form, which spares the inversion. */
+    vli_modSquare_fast384(tz, z);
+    vli_modMult_fast384(tx, l_r, tz);
+    if(vli_cmp384(tx, rx) == 0)
+    {
+        return 1;
+    }
+    if(vli_add384(ty, l_r, curve_n_384) == 0 && vli_cmp384(ty, curve_p_384) < 0)
+    {
+        vli_modMult_fast384(tx, ty, tz);
+        return (vli_cmp384(tx, rx) == 0);
+    }
+    return 0;
 }
@@ -14,10 +14,20 @@
 
 typedef void (*cf_gf128_mul_fn)(const cf_gf128 x, const cf_gf128 y, cf_gf128 out);
 
-/* Incremental GHASH computation. */
+/* GHASH key material, derived once per H. With PCLMULQDQ this also holds
+ * H^1..H^8 for the aggregated multi-block path. */
 typedef struct
 {
   cf_gf128 H;
+  cf_gf128 Hpow[CF_GF128_AGGR_BLOCKS];
+  cf_gf128 Hkar[CF_GF128_AGGR_BLOCKS];
+  int use_clmul;
+} ghash_key;
+
+/* Incremental GHASH computation. */
+typedef struct
+{
+  const ghash_key *key;
   cf_gf128 Y;
   uint8_t buffer[16];
   size_t buffer_used;
@@ -37,12 +47,21 @@ static inline int supports_pclmulqdq()
     return (CPUInfo[2] & (1 << 1));
 }
 
-static void ghash_init(ghash_ctx *ctx, uint8_t H[16])
+static void ghash_key_init(ghash_key *key, const uint8_t H[16])
+{
+  memset(key, 0, sizeof *key);
+  cf_gf128_frombytes_be(H, key->H);
+  key->use_clmul = supports_pclmulqdq() != 0;
+  if (key->use_clmul)
+    cf_gf128_powers_fast(key->H, key->Hpow, key->Hkar);
+}
+
+static void ghash_init(ghash_ctx *ctx, const ghash_key *key)
 {
   memset(ctx, 0, sizeof *ctx);
-  cf_gf128_frombytes_be(H, ctx->H);
+  ctx->key = key;
   ctx->state = STATE_AAD;
-  if (supports_pclmulqdq()) {
+  if (key->use_clmul) {
     DECLARE_PFN(cf_gf128_mul_fn,  cf_gf128_mul_fast);
     ctx->gf128_mul = pfn_cf_gf128_mul_fast;
   } else {
@@ -57,11 +76,38 @@ static void ghash_block(void *vctx, const uint8_t *data)
   cf_gf128 gfdata;
   cf_gf128_frombytes_be(data, gfdata);
   cf_gf128_add(gfdata, ctx->Y, ctx->Y);
-  ctx->gf128_mul(ctx->Y, ctx->H, ctx->Y);
+  ctx->gf128_mul(ctx->Y, ctx->key->H, ctx->Y);
 }
 
 static void ghash_add(ghash_ctx *ctx, const uint8_t *buf, size_t n)
 {
+  if (ctx->key->use_clmul)
+  {
+    /* Top up a partial block first, then hash whole blocks in place */
+    if (ctx->buffer_used > 0)
+    {
+      size_t taken = MIN(n, sizeof ctx->buffer - ctx->buffer_used);
+      memcpy(ctx->buffer + ctx->buffer_used, buf, taken);
+      ctx->buffer_used += taken;
+      buf += taken;
+      n -= taken;
+      if (ctx->buffer_used < sizeof ctx->buffer)
+        return;
+      ghash_block(ctx, ctx->buffer);
+      ctx->buffer_used = 0;
+    }
+    if (n >= sizeof ctx->buffer)
+    {
+      size_t nblocks = n / sizeof ctx->buffer;
+      cf_gf128_ghash_fast(ctx->Y, ctx->key->Hpow, ctx->key->Hkar, buf, nblocks);
+      buf += nblocks * sizeof ctx->buffer;
+      n -= nblocks * sizeof ctx->buffer;
+    }
+    memcpy(ctx->buffer, buf, n);
+    ctx->buffer_used = n;
+    return;
+  }
+
   DECLARE_PFN(cf_blockwise_in_fn,  ghash_block);
   cf_blockwise_accumulate(ctx->buffer, &ctx->buffer_used,
                           sizeof ctx->buffer,
@@ -121,20 +167,96 @@ static void ghash_final(ghash_ctx *ctx, uint8_t out[16])
   cf_gf128_tobytes_be(ctx->Y, out);
 }
 
+#ifdef COMPILER_SUPPORTS_AES_NI
+/* AES-NI counter mode over nblocks (a multiple of CF_AES_NI_CTR_BLOCKS)
+ * stitched with GHASH: the aesenc rounds for one group of counter blocks are
+ * interleaved with the carry-less multiplies over the previous group of
+ * ciphertext, so both pipelines stay busy in a single pass over the data. */
+FUNC_ISA GF128_ISA
+static void cf_gcm_ni_encrypt_blocks(const cf_aes_ni_context *ni, const ghash_key *ghkey, cf_gf128 Y,
+                                     uint8_t ctr[16], const uint8_t *in, uint8_t *out, size_t nblocks)
+{
+    const __m128i *keysched = ni->keysched_e;
+    const __m128i base = _mm_loadu_si128((const __m128i*)ctr);
+    uint32_t counter = read32_be(ctr + 12);
+    const uint8_t *prev = 0;
+    __m128i b0, b1, b2, b3, k, x, y, lo, hi, mid;
+    uint32_t r;
+
+    assert(nblocks % CF_AES_NI_CTR_BLOCKS == 0);
+    y = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)Y), _MM_SHUFFLE(0, 1, 2, 3));
+    for (; nblocks > 0; nblocks -= CF_AES_NI_CTR_BLOCKS, counter += CF_AES_NI_CTR_BLOCKS) {
+        k = keysched[0];
+        b0 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter), 3), k);
+        b1 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter + 1), 3), k);
+        b2 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter + 2), 3), k);
+        b3 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter + 3), 3), k);
+        lo = hi = mid = _mm_setzero_si128();
+        for (r = 1; r < ni->rounds; r++) {
+            k = keysched[r];
+            b0 = _mm_aesenc_si128(b0, k);
+            b1 = _mm_aesenc_si128(b1, k);
+            b2 = _mm_aesenc_si128(b2, k);
+            b3 = _mm_aesenc_si128(b3, k);
+            /* one block of the previous group's GHASH per round */
+            if (prev != 0 && r <= CF_AES_NI_CTR_BLOCKS) {
+                x = gfload_be(prev + (r - 1) * 16);
+                if (r == 1)
+                    x = _mm_xor_si128(x, y);
+                gfmul_acc(x, _mm_loadu_si128((const __m128i*)ghkey->Hpow[CF_AES_NI_CTR_BLOCKS - r]),
+                          _mm_loadu_si128((const __m128i*)ghkey->Hkar[CF_AES_NI_CTR_BLOCKS - r]), &lo, &hi, &mid);
+            }
+        }
+        k = keysched[ni->rounds];
+        b0 = _mm_aesenclast_si128(b0, k);
+        b1 = _mm_aesenclast_si128(b1, k);
+        b2 = _mm_aesenclast_si128(b2, k);
+        b3 = _mm_aesenclast_si128(b3, k);
+        _mm_storeu_si128((__m128i*)out, _mm_xor_si128(b0, _mm_loadu_si128((const __m128i*)in)));
+        _mm_storeu_si128((__m128i*)(out + 16), _mm_xor_si128(b1, _mm_loadu_si128((const __m128i*)(in + 16))));
+        _mm_storeu_si128((__m128i*)(out + 32), _mm_xor_si128(b2, _mm_loadu_si128((const __m128i*)(in + 32))));
+        _mm_storeu_si128((__m128i*)(out + 48), _mm_xor_si128(b3, _mm_loadu_si128((const __m128i*)(in + 48))));
+        if (prev != 0)
+            y = gfreduce_acc(lo, hi, mid);
+        prev = out;
+        in += CF_AES_NI_CTR_BLOCKS * 16;
+        out += CF_AES_NI_CTR_BLOCKS * 16;
+    }
+    _mm_storeu_si128((__m128i*)Y, _mm_shuffle_epi32(y, _MM_SHUFFLE(0, 1, 2, 3)));
+    /* drain: hash the last group of ciphertext */
+    if (prev != 0)
+        cf_gf128_ghash_fast(Y, ghkey->Hpow, ghkey->Hkar, prev, CF_AES_NI_CTR_BLOCKS);
+    write32_be(counter, ctr + 12);
+}
+#endif
+
+/* Counter mode over whole blocks with AES-NI when available, the rest
+ * through the generic cf_ctr */
+static void gcm_ctr_cipher(cf_ctr *ctr, const cf_aes_ni_context *ni, const uint8_t *in, uint8_t *out, size_t n)
+{
+  if (ni != 0 && ctr->nkeymat == 0)
+  {
+    size_t nblocks = n / 16;
+    cf_aes_ni_ctr32(ni, ctr->nonce, in, out, nblocks);
+    in += nblocks * 16;
+    out += nblocks * 16;
+    n -= nblocks * 16;
+  }
+  cf_ctr_cipher(ctr, in, out, n);
+}
+
+/* GHASH key for H = E_K(0^128) is derived once per key by the caller and passed in,
+ * ni is the AES-NI context behind prpctx or NULL when the generic cipher is used */
 static
-void cf_gcm_encrypt(const cf_prp *prp, void *prpctx,
+void cf_gcm_encrypt(const cf_prp *prp, void *prpctx, const cf_aes_ni_context *ni, const ghash_key *ghkey,
                     const uint8_t *plain, size_t nplain,
                     const uint8_t *header, size_t nheader,
                     const uint8_t *nonce, size_t nnonce,
                     uint8_t *cipher, /* the same size as nplain */
                     uint8_t *tag, size_t ntag)
 {
-  uint8_t H[16] = { 0 };
   uint8_t Y0[16]; 
 
-  /* H = E_K(0^128) */
-  prp->encrypt(prpctx, H, H);
-
   /* Produce CTR nonce, Y_0:
    *
    * if len(IV) == 96
@@ -150,14 +272,14 @@ void cf_gcm_encrypt(const cf_prp *prp, void *prpctx,
     Y0[15] = 0x01;
   } else {
     ghash_ctx gh;
-    ghash_init(&gh, H);
+    ghash_init(&gh, ghkey);
     ghash_add_cipher(&gh, nonce, nnonce);
     ghash_final(&gh, Y0);
   }
 
   /* Hash AAD */
   ghash_ctx gh;
-  ghash_init(&gh, H);
+  ghash_init(&gh, ghkey);
   ghash_add_aad(&gh, header, nheader);
 
   /* Produce ciphertext */
@@ -166,7 +288,20 @@ void cf_gcm_encrypt(const cf_prp *prp, void *prpctx,
   cf_ctr_init(&ctr, prp, prpctx, Y0);
   cf_ctr_custom_counter(&ctr, 12, 4); /* counter is 2^32 */
   cf_ctr_cipher(&ctr, e_Y0, e_Y0, sizeof e_Y0); /* first block is tag offset */
-  cf_ctr_cipher(&ctr, plain, cipher, nplain);
+#ifdef COMPILER_SUPPORTS_AES_NI
+  if (ni != 0 && ghkey->use_clmul)
+  {
+    /* Stitched CTR + GHASH over whole groups of blocks */
+    size_t nstitched = nplain / (CF_AES_NI_CTR_BLOCKS * 16) * (CF_AES_NI_CTR_BLOCKS * 16);
+    ghash_add_cipher(&gh, cipher, 0);
+    cf_gcm_ni_encrypt_blocks(ni, ghkey, gh.Y, ctr.nonce, plain, cipher, nstitched / 16);
+    gh.len_cipher += nstitched;
+    plain += nstitched;
+    cipher += nstitched;
+    nplain -= nstitched;
+  }
+#endif
+  gcm_ctr_cipher(&ctr, ni, plain, cipher, nplain);
 
   /* Hash ciphertext */
   ghash_add_cipher(&gh, cipher, nplain);
@@ -178,7 +313,6 @@ void cf_gcm_encrypt(const cf_prp *prp, void *prpctx,
   assert(ntag > 1 && ntag <= 16);
   xor_bb(tag, full_tag, e_Y0, ntag);
 
-  mem_clean(H, sizeof H);
   mem_clean(Y0, sizeof Y0);
   mem_clean(e_Y0, sizeof e_Y0);
   mem_clean(full_tag, sizeof full_tag);
@@ -187,19 +321,15 @@ void cf_gcm_encrypt(const cf_prp *prp, void *prpctx,
 }
 
 static
-int cf_gcm_decrypt(const cf_prp *prp, void *prpctx,
+int cf_gcm_decrypt(const cf_prp *prp, void *prpctx, const cf_aes_ni_context *ni, const ghash_key *ghkey,
                    const uint8_t *cipher, size_t ncipher,
                    const uint8_t *header, size_t nheader,
                    const uint8_t *nonce, size_t nnonce,
                    const uint8_t *tag, size_t ntag,
                    uint8_t *plain)
 {
-  uint8_t H[16] = { 0 };
   uint8_t Y0[16]; 
 
-  /* H = E_K(0^128) */
-  prp->encrypt(prpctx, H, H);
-
   /* Produce CTR nonce, Y_0:
    *
    * if len(IV) == 96
@@ -215,14 +345,14 @@ int cf_gcm_decrypt(const cf_prp *prp, void *prpctx,
     Y0[15] = 0x01;
   } else {
     ghash_ctx gh;
-    ghash_init(&gh, H);
+    ghash_init(&gh, ghkey);
     ghash_add_cipher(&gh, nonce, nnonce);
     ghash_final(&gh, Y0);
   }
   
   /* Hash AAD. */
   ghash_ctx gh;
-  ghash_init(&gh, H);
+  ghash_init(&gh, ghkey);
   ghash_add_aad(&gh, header, nheader);
 
   /* Start counter mode, to obtain offset on tag. */
@@ -246,11 +376,10 @@ int cf_gcm_decrypt(const cf_prp *prp, void *prpctx,
     goto x_err;
   
   /* Complete decryption. */
-  cf_ctr_cipher(&ctr, cipher, plain, ncipher);
+  gcm_ctr_cipher(&ctr, ni, cipher, plain, ncipher);
   err = 0;
  
 x_err:
-  mem_clean(H, sizeof H);
   mem_clean(Y0, sizeof Y0);
   mem_clean(e_Y0, sizeof e_Y0);
   mem_clean(full_tag, sizeof full_tag);
@@ -262,9 +391,10 @@ x_err:
 #define AESGCM_IV_SIZE  12
 #define AESGCM_TAG_SIZE 16
 
-static void cf_aes_ex_setup(cf_prp *prp, void **prpctx, 
-                            cf_aes_ni_context *ctxni, cf_aes_context *ctx, 
-                            const uint8_t *k, const size_t klen)
+/* Returns the AES-NI context when hardware AES is used, NULL otherwise */
+static cf_aes_ni_context *cf_aes_ex_setup(cf_prp *prp, void **prpctx, 
+                                          cf_aes_ni_context *ctxni, cf_aes_context *ctx, 
+                                          const uint8_t *k, const size_t klen)
 {
     if (cf_aes_ni_setup(ctxni, k, klen)) {
         DECLARE_PFN(cf_prp_block, cf_aes_ni_encrypt);
@@ -273,6 +403,7 @@ static void cf_aes_ex_setup(cf_prp *prp, void **prpctx,
         prp->encrypt = pfn_cf_aes_ni_encrypt;
         prp->decrypt = pfn_cf_aes_ni_decrypt;
         *prpctx = ctxni;
+        return ctxni;
     }
     else {
         cf_aes_init(ctx, k, klen);
@@ -282,6 +413,7 @@ static void cf_aes_ex_setup(cf_prp *prp, void **prpctx,
         prp->encrypt = pfn_cf_aes_encrypt;
         prp->decrypt = pfn_cf_aes_decrypt;
         *prpctx = ctx;
+        return 0;
     }
 }
 typedef union {
@@ -296,9 +428,17 @@ static void cf_aesgcm_encrypt(uint8_t *c, uint8_t *mac, const uint8_t *m, const
     cf_prp prp;
     void *prpctx;
     cf_aes_ex_context ctx;
-
-    cf_aes_ex_setup(&prp, &prpctx, &ctx.ctxni, &ctx.ctx, k, klen);
-    cf_gcm_encrypt(&prp, prpctx, m, mlen, ad, adlen, npub, AESGCM_IV_SIZE, c, mac, AESGCM_TAG_SIZE);
+    cf_aes_ni_context *ni;
+    uint8_t H[16] = { 0 };
+    ghash_key ghkey;
+
+    ni = cf_aes_ex_setup(&prp, &prpctx, &ctx.ctxni, &ctx.ctx, k, klen);
+    prp.encrypt(prpctx, H, H);
+    ghash_key_init(&ghkey, H);
+    cf_gcm_encrypt(&prp, prpctx, ni, &ghkey, m, mlen, ad, adlen, npub, AESGCM_IV_SIZE, c, mac, AESGCM_TAG_SIZE);
+    mem_clean(H, sizeof H);
+    mem_clean(&ghkey, sizeof ghkey);
+    mem_clean(&ctx, sizeof ctx);
 }
 
 static int cf_aesgcm_decrypt(uint8_t *m, const uint8_t *c, const size_t clen, const uint8_t *mac, 
@@ -308,9 +448,19 @@ static int cf_aesgcm_decrypt(uint8_t *m, const uint8_t *c, const size_t clen, co
     cf_prp prp;
     void *prpctx;
     cf_aes_ex_context ctx;
-
-    cf_aes_ex_setup(&prp, &prpctx, &ctx.ctxni, &ctx.ctx, k, klen);
-    return cf_gcm_decrypt(&prp, prpctx, c, clen, ad, adlen, npub, AESGCM_IV_SIZE, mac, AESGCM_TAG_SIZE, m);
+    cf_aes_ni_context *ni;
+    uint8_t H[16] = { 0 };
+    ghash_key ghkey;
+    int err;
+
+    ni = cf_aes_ex_setup(&prp, &prpctx, &ctx.ctxni, &ctx.ctx, k, klen);
+    prp.encrypt(prpctx, H, H);
+    ghash_key_init(&ghkey, H);
+    err = cf_gcm_decrypt(&prp, prpctx, ni, &ghkey, c, clen, ad, adlen, npub, AESGCM_IV_SIZE, mac, AESGCM_TAG_SIZE, m);
+    mem_clean(H, sizeof H);
+    mem_clean(&ghkey, sizeof ghkey);
+    mem_clean(&ctx, sizeof ctx);
+    return err;
 }
 
 static void cf_aescbc_encrypt(uint8_t *c, const uint8_t *m, const size_t mlen,
@@ -338,3 +488,71 @@ static void cf_aescbc_decrypt(uint8_t *m, const uint8_t *c, const size_t clen,
     cf_cbc_init(&mode, &prp, prpctx, npub);
     cf_cbc_decrypt(&mode, c, m, clen / CF_MAXBLOCK);
 }
+
+/* Persistent per-direction key context for TLS bulk encryption. Key schedule
+ * and GHASH key are expanded once per traffic key by cf_aes_ctx_init and then
+ * reused by every record until cf_aes_ctx_free */
+typedef struct {
+    cf_prp prp;
+    void *prpctx;
+    cf_aes_ex_context aes;
+    cf_aes_ni_context *ni;
+    ghash_key ghkey;
+} cf_aes_bulk_context;
+
+static void *cf_aes_ctx_init(const uint8_t *k, const size_t klen)
+{
+    cf_aes_bulk_context *ctx = (cf_aes_bulk_context *)getContext()->m_CoTaskMemAlloc(sizeof(cf_aes_bulk_context));
+    uint8_t H[16] = { 0 };
+
+    if (ctx == 0)
+        return 0;
+    memset(ctx, 0, sizeof *ctx);
+    ctx->ni = cf_aes_ex_setup(&ctx->prp, &ctx->prpctx, &ctx->aes.ctxni, &ctx->aes.ctx, k, klen);
+    ctx->prp.encrypt(ctx->prpctx, H, H);
+    ghash_key_init(&ctx->ghkey, H);
+    mem_clean(H, sizeof H);
+    return ctx;
+}
+
+static void cf_aes_ctx_free(void *ctx)
+{
+    if (ctx == 0)
+        return;
+    mem_clean(ctx, sizeof(cf_aes_bulk_context));
+    getContext()->m_CoTaskMemFree(ctx);
+}
+
+static void cf_aesgcm_seal(void *vctx, uint8_t *c, uint8_t *mac, const uint8_t *m, const size_t mlen,
+                           const uint8_t *ad, const size_t adlen, const uint8_t *npub)
+{
+    cf_aes_bulk_context *ctx = (cf_aes_bulk_context *)vctx;
+
+    cf_gcm_encrypt(&ctx->prp, ctx->prpctx, ctx->ni, &ctx->ghkey, m, mlen, ad, adlen, npub, AESGCM_IV_SIZE, c, mac, AESGCM_TAG_SIZE);
+}
+
+static int cf_aesgcm_open(void *vctx, uint8_t *m, const uint8_t *c, const size_t clen, const uint8_t *mac,
+                          const uint8_t *ad, const size_t adlen, const uint8_t *npub)
+{
+    cf_aes_bulk_context *ctx = (cf_aes_bulk_context *)vctx;
+
+    return cf_gcm_decrypt(&ctx->prp, ctx->prpctx, ctx->ni, &ctx->ghkey, c, clen, ad, adlen, npub, AESGCM_IV_SIZE, mac, AESGCM_TAG_SIZE, m);
+}
+
+static void cf_aescbc_seal(void *vctx, uint8_t *c, const uint8_t *m, const size_t mlen, const uint8_t *npub)
+{
+    cf_aes_bulk_context *ctx = (cf_aes_bulk_context *)vctx;
+    cf_cbc mode;
+
+    cf_cbc_init(&mode, &ctx->prp, ctx->prpctx, npub);
+    cf_cbc_encrypt(&mode, m, c, mlen / CF_MAXBLOCK);
+}
+
+static void cf_aescbc_open(void *vctx, uint8_t *m, const uint8_t *c, const size_t clen, const uint8_t *npub)
+{
+    cf_aes_bulk_context *ctx = (cf_aes_bulk_context *)vctx;
+    cf_cbc mode;
+
+    cf_cbc_init(&mode, &ctx->prp, ctx->prpctx, npub);
+    cf_cbc_decrypt(&mode, c, m, clen / CF_MAXBLOCK);
+}
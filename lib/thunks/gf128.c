@@ -113,21 +113,24 @@ void cf_gf128_mul(const cf_gf128 x, const cf_gf128 y, cf_gf128 out)
 #    define INLINE
 #endif
 
+/* gcc and clang only emit PCLMULQDQ in functions targeted at it */
+#if defined __GNUC__ || defined __clang__
+#    define GF128_ISA __attribute__ ((target("pclmul")))
+#else
+#    define GF128_ISA
+#endif
+
 /*
  *  From https://www.intel.com/content/www/us/en/processors/carry-less-multiplication-instruction-in-gcm-mode-paper.html
+ *
+ *  Shift the 256-bit carry-less product tmp6:tmp3 left by one bit and reduce it
+ *  modulo x^128 + x^7 + x^2 + x + 1. Both steps are linear so several products
+ *  can be xor-ed together first and reduced once (aggregated reduction).
  */
-static INLINE __m128i gfmul(__m128i a, __m128i b)
+GF128_ISA
+static INLINE __m128i gfreduce(__m128i tmp3, __m128i tmp6)
 {
-    __m128i tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9;
-    tmp3 = _mm_clmulepi64_si128(a, b, 0x00);
-    tmp4 = _mm_clmulepi64_si128(a, b, 0x10);
-    tmp5 = _mm_clmulepi64_si128(a, b, 0x01);
-    tmp6 = _mm_clmulepi64_si128(a, b, 0x11);
-    tmp4 = _mm_xor_si128(tmp4, tmp5);
-    tmp5 = _mm_slli_si128(tmp4, 8);
-    tmp4 = _mm_srli_si128(tmp4, 8);
-    tmp3 = _mm_xor_si128(tmp3, tmp5);
-    tmp6 = _mm_xor_si128(tmp6, tmp4);
+    __m128i tmp2, tmp4, tmp5, tmp7, tmp8, tmp9;
     tmp7 = _mm_srli_epi32(tmp3, 31);
     tmp8 = _mm_srli_epi32(tmp6, 31);
     tmp3 = _mm_slli_epi32(tmp3, 1);
@@ -157,9 +160,100 @@ static INLINE __m128i gfmul(__m128i a, __m128i b)
     return tmp6;
 }
 
+GF128_ISA
+static INLINE __m128i gfmul(__m128i a, __m128i b)
+{
+    __m128i tmp3, tmp4, tmp5, tmp6;
+    tmp3 = _mm_clmulepi64_si128(a, b, 0x00);
+    tmp4 = _mm_clmulepi64_si128(a, b, 0x10);
+    tmp5 = _mm_clmulepi64_si128(a, b, 0x01);
+    tmp6 = _mm_clmulepi64_si128(a, b, 0x11);
+    tmp4 = _mm_xor_si128(tmp4, tmp5);
+    tmp5 = _mm_slli_si128(tmp4, 8);
+    tmp4 = _mm_srli_si128(tmp4, 8);
+    tmp3 = _mm_xor_si128(tmp3, tmp5);
+    tmp6 = _mm_xor_si128(tmp6, tmp4);
+    return gfreduce(tmp3, tmp6);
+}
+
+GF128_ISA
 static void cf_gf128_mul_fast(const cf_gf128 x, const cf_gf128 y, cf_gf128 out)
 {
     const __m128i a = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)x), _MM_SHUFFLE(0, 1, 2, 3));
     const __m128i b = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)y), _MM_SHUFFLE(0, 1, 2, 3));
     _mm_storeu_si128((__m128i*)out, _mm_shuffle_epi32(gfmul(a, b), _MM_SHUFFLE(0, 1, 2, 3)));
 }
+
+#define CF_GF128_AGGR_BLOCKS 8
+
+/* Load a big-endian block in the byte-reflected layout expected by gfmul */
+static INLINE __m128i gfload_be(const uint8_t *data)
+{
+    cf_gf128 block;
+
+    cf_gf128_frombytes_be(data, block);
+    return _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)block), _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+/* Accumulate the unreduced product x * h into lo, hi and the Karatsuba
+ * middle term mid, k holds hi(h) ^ lo(h) */
+GF128_ISA
+static INLINE void gfmul_acc(__m128i x, __m128i h, __m128i k, __m128i *lo, __m128i *hi, __m128i *mid)
+{
+    *lo = _mm_xor_si128(*lo, _mm_clmulepi64_si128(x, h, 0x00));
+    *hi = _mm_xor_si128(*hi, _mm_clmulepi64_si128(x, h, 0x11));
+    x = _mm_xor_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1, 0, 3, 2)));
+    *mid = _mm_xor_si128(*mid, _mm_clmulepi64_si128(x, k, 0x00));
+}
+
+/* Fold middle term of accumulated products into lo/hi and reduce once */
+GF128_ISA
+static INLINE __m128i gfreduce_acc(__m128i lo, __m128i hi, __m128i mid)
+{
+    mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+    lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+    hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+    return gfreduce(lo, hi);
+}
+
+/* out[i] = H^(i+1) for i = 0..CF_GF128_AGGR_BLOCKS-1 in the byte-reflected
+ * layout expected by gfmul, kar[i] holds hi(out[i]) ^ lo(out[i]) so the
+ * Karatsuba middle term needs a single multiply per block. */
+GF128_ISA
+static void cf_gf128_powers_fast(const cf_gf128 H, cf_gf128 out[CF_GF128_AGGR_BLOCKS], cf_gf128 kar[CF_GF128_AGGR_BLOCKS])
+{
+    const __m128i h = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)H), _MM_SHUFFLE(0, 1, 2, 3));
+    __m128i p = h;
+
+    for (int i = 0; i < CF_GF128_AGGR_BLOCKS; i++) {
+        _mm_storeu_si128((__m128i*)out[i], p);
+        _mm_storeu_si128((__m128i*)kar[i], _mm_xor_si128(p, _mm_shuffle_epi32(p, _MM_SHUFFLE(1, 0, 3, 2))));
+        p = gfmul(p, h);
+    }
+}
+
+/* Y = (...((Y + X_1) * H + X_2) * H ... + X_n) * H over nblocks of data,
+ * evaluated as (Y + X_1) * H^n + X_2 * H^(n-1) + ... + X_n * H with up to
+ * CF_GF128_AGGR_BLOCKS products sharing one reduction. */
+GF128_ISA
+static void cf_gf128_ghash_fast(cf_gf128 Y, const cf_gf128 pow[CF_GF128_AGGR_BLOCKS], const cf_gf128 kar[CF_GF128_AGGR_BLOCKS],
+                                const uint8_t *data, size_t nblocks)
+{
+    __m128i y = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)Y), _MM_SHUFFLE(0, 1, 2, 3));
+    __m128i x, lo, hi, mid;
+    size_t n, i;
+
+    while (nblocks > 0) {
+        n = MIN(nblocks, CF_GF128_AGGR_BLOCKS);
+        lo = hi = mid = _mm_setzero_si128();
+        for (i = 0; i < n; i++, data += 16) {
+            x = gfload_be(data);
+            if (i == 0)
+                x = _mm_xor_si128(x, y);
+            gfmul_acc(x, _mm_loadu_si128((const __m128i*)pow[n - 1 - i]), _mm_loadu_si128((const __m128i*)kar[n - 1 - i]), &lo, &hi, &mid);
+        }
+        y = gfreduce_acc(lo, hi, mid);
+        nblocks -= n;
+    }
+    _mm_storeu_si128((__m128i*)Y, _mm_shuffle_epi32(y, _MM_SHUFFLE(0, 1, 2, 3)));
+}
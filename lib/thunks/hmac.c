@@ -0,0 +1,234 @@
+/*
+ * HMAC-SHA2 and TLS 1.3 HKDF-Expand-Label on top of the cifra sha256/sha512
+ * contexts. The hash is selected by its output size (32, 48 or 64 bytes).
+ *
+ * cf_hmac_sha2_init absorbs ipad/opad once, so cf_hmac_sha2 only clones the
+ * two compressed states and runs message + outer finalization per call.
+ */
+
+#define CF_HMAC_SHA2_MAXBLOCKSZ 128
+#define CF_HMAC_SHA2_MAXHASHSZ 64
+#define CF_HKDF_LABEL_PREFIXSZ 6
+
+static const uint8_t g_hkdf_label_prefix[] = "tls13 ";
+
+typedef union
+{
+#ifdef IMPL_SHA256_THUNK
+  cf_sha256_context sha256;
+#endif
+#if defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK)
+  cf_sha512_context sha512;
+#endif
+} cf_hmac_sha2_state;
+
+/* .. c:type:: cf_hmac_sha2_ctx
+ * Precomputed HMAC key state.
+ *
+ * .. c:member:: cf_hmac_sha2_ctx.inner
+ * Hash state after absorbing key ^ ipad.
+ *
+ * .. c:member:: cf_hmac_sha2_ctx.outer
+ * Hash state after absorbing key ^ opad.
+ *
+ * .. c:member:: cf_hmac_sha2_ctx.hashsz
+ * Output size of the selected hash.
+ */
+typedef struct
+{
+  cf_hmac_sha2_state inner;
+  cf_hmac_sha2_state outer;
+  uint32_t hashsz;
+} cf_hmac_sha2_ctx;
+
+static size_t hmac_sha2_blocksz(uint32_t hashsz)
+{
+  switch (hashsz)
+  {
+#ifdef IMPL_SHA256_THUNK
+  case CF_SHA256_HASHSZ:
+    return CF_SHA256_BLOCKSZ;
+#endif
+#ifdef IMPL_SHA384_THUNK
+  case CF_SHA384_HASHSZ:
+    return CF_SHA384_BLOCKSZ;
+#endif
+#ifdef IMPL_SHA512_THUNK
+  case CF_SHA512_HASHSZ:
+    return CF_SHA512_BLOCKSZ;
+#endif
+  }
+  return 0;
+}
+
+static void hmac_sha2_init(uint32_t hashsz, cf_hmac_sha2_state *state)
+{
+  switch (hashsz)
+  {
+#ifdef IMPL_SHA256_THUNK
+  case CF_SHA256_HASHSZ:
+    cf_sha256_init(&state->sha256);
+    break;
+#endif
+#ifdef IMPL_SHA384_THUNK
+  case CF_SHA384_HASHSZ:
+    cf_sha384_init(&state->sha512);
+    break;
+#endif
+#ifdef IMPL_SHA512_THUNK
+  case CF_SHA512_HASHSZ:
+    cf_sha512_init(&state->sha512);
+    break;
+#endif
+  }
+}
+
+static void hmac_sha2_update(uint32_t hashsz, cf_hmac_sha2_state *state, const void *data, size_t nbytes)
+{
+  switch (hashsz)
+  {
+#ifdef IMPL_SHA256_THUNK
+  case CF_SHA256_HASHSZ:
+    cf_sha256_update(&state->sha256, data, nbytes);
+    break;
+#endif
+#ifdef IMPL_SHA384_THUNK
+  case CF_SHA384_HASHSZ:
+    cf_sha384_update(&state->sha512, data, nbytes);
+    break;
+#endif
+#ifdef IMPL_SHA512_THUNK
+  case CF_SHA512_HASHSZ:
+    cf_sha512_update(&state->sha512, data, nbytes);
+    break;
+#endif
+  }
+}
+
+static void hmac_sha2_final(uint32_t hashsz, cf_hmac_sha2_state *state, uint8_t *out)
+{
+  switch (hashsz)
+  {
+#ifdef IMPL_SHA256_THUNK
+  case CF_SHA256_HASHSZ:
+    cf_sha256_digest_final(&state->sha256, out);
+    break;
+#endif
+#ifdef IMPL_SHA384_THUNK
+  case CF_SHA384_HASHSZ:
+    cf_sha384_digest_final(&state->sha512, out);
+    break;
+#endif
+#ifdef IMPL_SHA512_THUNK
+  case CF_SHA512_HASHSZ:
+    cf_sha512_digest_final(&state->sha512, out);
+    break;
+#endif
+  }
+}
+
+/* .. c:function:: $DECL
+ * Precomputes inner and outer pad states for `key`. Keys longer than the
+ * block size are hashed first. Returns 0 if `hashsz` is not supported. */
+static int cf_hmac_sha2_init(cf_hmac_sha2_ctx *ctx, uint32_t hashsz, const uint8_t *key, size_t nkey)
+{
+  uint8_t blk[CF_HMAC_SHA2_MAXBLOCKSZ];
+  size_t blocksz = hmac_sha2_blocksz(hashsz), i;
+
+  if (blocksz == 0)
+    return 0;
+  ctx->hashsz = hashsz;
+  memset(blk, 0, sizeof blk);
+  if (nkey > blocksz)
+  {
+    hmac_sha2_init(hashsz, &ctx->inner);
+    hmac_sha2_update(hashsz, &ctx->inner, key, nkey);
+    hmac_sha2_final(hashsz, &ctx->inner, blk);
+  }
+  else if (nkey > 0)
+    memcpy(blk, key, nkey);
+
+  for (i = 0; i < blocksz; i++)
+    blk[i] ^= 0x36;
+  hmac_sha2_init(hashsz, &ctx->inner);
+  hmac_sha2_update(hashsz, &ctx->inner, blk, blocksz);
+
+  for (i = 0; i < blocksz; i++)
+    blk[i] ^= 0x36 ^ 0x5c;
+  hmac_sha2_init(hashsz, &ctx->outer);
+  hmac_sha2_update(hashsz, &ctx->outer, blk, blocksz);
+
+  memset(blk, 0, sizeof blk);
+  return 1;
+}
+
+static void hmac_sha2_finish(const cf_hmac_sha2_ctx *ctx, cf_hmac_sha2_state *inner, uint8_t *out)
+{
+  uint8_t tmp[CF_HMAC_SHA2_MAXHASHSZ];
+  cf_hmac_sha2_state outer = ctx->outer;
+
+  hmac_sha2_final(ctx->hashsz, inner, tmp);
+  hmac_sha2_update(ctx->hashsz, &outer, tmp, ctx->hashsz);
+  hmac_sha2_final(ctx->hashsz, &outer, out);
+}
+
+/* .. c:function:: $DECL
+ * Computes HMAC(key, data) into `out` (`ctx->hashsz` bytes). `ctx` is not
+ * modified and can be reused for any number of messages. */
+static void cf_hmac_sha2(const cf_hmac_sha2_ctx *ctx, const void *data, size_t ndata, uint8_t *out)
+{
+  cf_hmac_sha2_state inner = ctx->inner;
+
+  hmac_sha2_update(ctx->hashsz, &inner, data, ndata);
+  hmac_sha2_finish(ctx, &inner, out);
+}
+
+/* .. c:function:: $DECL
+ * TLS 1.3 HKDF-Expand-Label (RFC 8446, section 7.1). `label` is without the
+ * "tls13 " prefix. Returns 0 on unsupported hash or out-of-range sizes. */
+static int cf_hkdf_expand_label(uint32_t hashsz, const uint8_t *secret, size_t nsecret,
+                                const char *label, size_t nlabel, const uint8_t *context, size_t ncontext,
+                                uint8_t *out, size_t nout)
+{
+  cf_hmac_sha2_ctx ctx;
+  cf_hmac_sha2_state inner;
+  uint8_t hdr[3], block[CF_HMAC_SHA2_MAXHASHSZ];
+  uint8_t counter, nctx;
+  size_t done;
+
+  if (nlabel > 255 - CF_HKDF_LABEL_PREFIXSZ || ncontext > 255 || nout > 255 * (size_t)hashsz || nout > 0xFFFF)
+    return 0;
+  if (!cf_hmac_sha2_init(&ctx, hashsz, secret, nsecret))
+    return 0;
+  hdr[0] = (uint8_t)(nout >> 8);
+  hdr[1] = (uint8_t)nout;
+  hdr[2] = (uint8_t)(CF_HKDF_LABEL_PREFIXSZ + nlabel);
+  nctx = (uint8_t)ncontext;
+  /* T(i) = HMAC(secret, T(i-1) | HkdfLabel | i) */
+  for (done = 0, counter = 1; done < nout; counter++)
+  {
+    inner = ctx.inner;
+    if (done > 0)
+      hmac_sha2_update(hashsz, &inner, block, hashsz);
+    hmac_sha2_update(hashsz, &inner, hdr, sizeof hdr);
+    hmac_sha2_update(hashsz, &inner, hkdf_label_prefix, CF_HKDF_LABEL_PREFIXSZ);
+    hmac_sha2_update(hashsz, &inner, label, nlabel);
+    hmac_sha2_update(hashsz, &inner, &nctx, 1);
+    hmac_sha2_update(hashsz, &inner, context, ncontext);
+    hmac_sha2_update(hashsz, &inner, &counter, 1);
+    hmac_sha2_finish(&ctx, &inner, block);
+    if (nout - done < hashsz)
+    {
+      memcpy(out + done, block, nout - done);
+      done = nout;
+    }
+    else
+    {
+      memcpy(out + done, block, hashsz);
+      done += hashsz;
+    }
+  }
+  memset(&ctx, 0, sizeof ctx);
+  memset(block, 0, sizeof block);
+  return 1;
+}
@@ -12,174 +12,315 @@
  * <http://creativecommons.org/publicdomain/zero/1.0/>.
  */
 
+/* Accumulator and key in radix 2^26 (5 limbs) on 32-bit builds or radix
+ * 2^44 (3 limbs) on 64-bit builds, in the style of poly1305-donna. Whole
+ * blocks are consumed in pairs as h = (h + m1) * r^2 + m2 * r so two
+ * blocks share a single carry chain. */
+#ifdef _WIN64
+  #include <intrin.h>
+  #define POLY1305_LIMBS 3
+  typedef uint64_t poly1305_limb;
+#else
+  #define POLY1305_LIMBS 5
+  typedef uint32_t poly1305_limb;
+#endif
+
 typedef struct
 {
-  uint32_t h[17];
-  uint32_t r[17];
+  poly1305_limb h[POLY1305_LIMBS];
+  poly1305_limb r[POLY1305_LIMBS];
+  poly1305_limb rr[POLY1305_LIMBS];
   uint8_t s[16];
   uint8_t partial[16];
   size_t npartial;
 } cf_poly1305;
 
-static
-void cf_poly1305_init(cf_poly1305 *ctx,
-                      const uint8_t r[16],
-                      const uint8_t s[16])
+#ifdef _WIN64
+
+typedef struct { uint64_t lo, hi; } poly1305_u128;
+
+static inline void poly1305_mac(poly1305_u128 *d, uint64_t a, uint64_t b)
 {
-  memset(ctx, 0, sizeof *ctx);
+  uint64_t hi, lo = _umul128(a, b, &hi);
+  d->lo += lo;
+  d->hi += hi + (d->lo < lo);
+}
 
-  ctx->r[0]  = r[0];
-  ctx->r[1]  = r[1];
-  ctx->r[2]  = r[2];
-  ctx->r[3]  = r[3] & 0x0f;
-  ctx->r[4]  = r[4] & 0xfc;
-  ctx->r[5]  = r[5];
-  ctx->r[6]  = r[6];
-  ctx->r[7]  = r[7] & 0x0f;
-  ctx->r[8]  = r[8] & 0xfc;
-  ctx->r[9]  = r[9];
-  ctx->r[10] = r[10];
-  ctx->r[11] = r[11] & 0x0f;
-  ctx->r[12] = r[12] & 0xfc;
-  ctx->r[13] = r[13];
-  ctx->r[14] = r[14];
-  ctx->r[15] = r[15] & 0x0f;
-  ctx->r[16] = 0;
+static inline uint64_t poly1305_shr(const poly1305_u128 *d, int n)
+{
+  return (d->lo >> n) | (d->hi << (64 - n));
+}
 
-  memcpy(ctx->s, s, 16);
+static inline void poly1305_add64(poly1305_u128 *d, uint64_t c)
+{
+  d->lo += c;
+  d->hi += (d->lo < c);
 }
 
-static void poly1305_add(uint32_t h[17],
-                         const uint32_t x[17])
+/* d += h * r mod 2^130 - 5 */
+static void poly1305_mulacc(poly1305_u128 d[3], const uint64_t h[3], const uint64_t r[3])
 {
-  uint32_t carry = 0;
+  const uint64_t s1 = r[1] * (5 << 2), s2 = r[2] * (5 << 2);
 
-  for (int i = 0; i < 17; i++)
-  {
-    carry += h[i] + x[i];
-    h[i] = carry & 0xff;
-    carry >>= 8;
-  }
+  poly1305_mac(&d[0], h[0], r[0]); poly1305_mac(&d[0], h[1], s2); poly1305_mac(&d[0], h[2], s1);
+  poly1305_mac(&d[1], h[0], r[1]); poly1305_mac(&d[1], h[1], r[0]); poly1305_mac(&d[1], h[2], s2);
+  poly1305_mac(&d[2], h[0], r[2]); poly1305_mac(&d[2], h[1], r[1]); poly1305_mac(&d[2], h[2], r[0]);
 }
 
-/* Minimal reduction/carry chain. */
-static void poly1305_min_reduce(uint32_t x[17])
+/* Partial reduction of d back into limbs of h */
+static void poly1305_carry(uint64_t h[3], poly1305_u128 d[3])
 {
-  uint32_t carry = 0;
-  for (int i = 0; i < 16; i++)
-  {
-    carry += x[i];
-    x[i] = carry & 0xff;
-    carry >>= 8;
-  }
+  uint64_t c;
+
+  c = poly1305_shr(&d[0], 44); h[0] = d[0].lo & 0xfffffffffff;
+  poly1305_add64(&d[1], c);
+  c = poly1305_shr(&d[1], 44); h[1] = d[1].lo & 0xfffffffffff;
+  poly1305_add64(&d[2], c);
+  c = poly1305_shr(&d[2], 42); h[2] = d[2].lo & 0x3ffffffffff;
+  h[0] += c * 5;
+  c = h[0] >> 44; h[0] &= 0xfffffffffff;
+  h[1] += c;
+}
 
-  /* 2 ** 130 - 5 = 0x3fffffffffffffffffffffffffffffffb
-   *                  ^
-   * So 2 bits of carry are put into top word.
-   * Remaining bits get multiplied by 5 and carried back
-   * into bottom */
-  carry += x[16];
-  x[16] = carry & 0x03;
-  carry = 5 * (carry >> 2);
+static void poly1305_mul(uint64_t out[3], const uint64_t a[3], const uint64_t b[3])
+{
+  poly1305_u128 d[3];
 
-  for (int i = 0; i < 16; i++)
-  {
-    carry += x[i];
-    x[i] = carry & 0xff;
-    carry >>= 8;
-  }
+  memset(d, 0, sizeof d);
+  poly1305_mulacc(d, a, b);
+  poly1305_carry(out, d);
+}
+
+static void poly1305_load(uint64_t x[3], const uint8_t m[16], uint64_t hibit)
+{
+  const uint64_t t0 = read32_le(m) | ((uint64_t)read32_le(m + 4) << 32),
+                 t1 = read32_le(m + 8) | ((uint64_t)read32_le(m + 12) << 32);
 
-  x[16] += carry;
+  x[0] = t0 & 0xfffffffffff;
+  x[1] = ((t0 >> 44) | (t1 << 20)) & 0xfffffffffff;
+  x[2] = ((t1 >> 24) & 0x3ffffffffff) | (hibit << 40);
 }
 
-/* This is - 2 ** 130 - 5 in twos complement. */
-static const uint32_t g_negative_1305[17] = {
-  0x05, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0xfc
-};
+static void poly1305_clamp(uint64_t r[3], const uint8_t key[16])
+{
+  const uint64_t t0 = read32_le(key) | ((uint64_t)read32_le(key + 4) << 32),
+                 t1 = read32_le(key + 8) | ((uint64_t)read32_le(key + 12) << 32);
+
+  r[0] = t0 & 0xffc0fffffff;
+  r[1] = ((t0 >> 44) | (t1 << 20)) & 0xfffffc0ffff;
+  r[2] = (t1 >> 24) & 0x00ffffffc0f;
+}
 
-static void poly1305_full_reduce(uint32_t x[17])
+static void poly1305_blocks(cf_poly1305 *ctx, const uint8_t *m, size_t nblocks, uint64_t hibit)
 {
-  uint32_t xsub[17];
+  uint64_t *h = ctx->h, x[3];
+  poly1305_u128 d[3];
+
+  for (; nblocks >= 2; nblocks -= 2, m += 32)
+  {
+    poly1305_load(x, m, hibit);
+    h[0] += x[0]; h[1] += x[1]; h[2] += x[2];
+    poly1305_load(x, m + 16, hibit);
+    memset(d, 0, sizeof d);
+    poly1305_mulacc(d, h, ctx->rr);
+    poly1305_mulacc(d, x, ctx->r);
+    poly1305_carry(h, d);
+  }
+  if (nblocks)
+  {
+    poly1305_load(x, m, hibit);
+    h[0] += x[0]; h[1] += x[1]; h[2] += x[2];
+    memset(d, 0, sizeof d);
+    poly1305_mulacc(d, h, ctx->r);
+    poly1305_carry(h, d);
+  }
+}
 
-  for (size_t i = 0; i < 17; i++)
-    xsub[i] = x[i];
+/* Fully carry h, reduce mod 2^130 - 5 in constant time and return h + s mod 2^128 */
+static void poly1305_final(uint64_t h[3], const uint8_t s[16], uint8_t out[16])
+{
+  uint64_t c, g0, g1, g2, mask, t0, t1;
+
+  c = h[1] >> 44; h[1] &= 0xfffffffffff;
+  h[2] += c; c = h[2] >> 42; h[2] &= 0x3ffffffffff;
+  h[0] += c * 5; c = h[0] >> 44; h[0] &= 0xfffffffffff;
+  h[1] += c; c = h[1] >> 44; h[1] &= 0xfffffffffff;
+  h[2] += c; c = h[2] >> 42; h[2] &= 0x3ffffffffff;
+  h[0] += c * 5; c = h[0] >> 44; h[0] &= 0xfffffffffff;
+  h[1] += c;
+
+  /* g = h + -p */
+  g0 = h[0] + 5; c = g0 >> 44; g0 &= 0xfffffffffff;
+  g1 = h[1] + c; c = g1 >> 44; g1 &= 0xfffffffffff;
+  g2 = h[2] + c - ((uint64_t)1 << 42);
+
+  /* select h if h < p, or h + -p if h >= p */
+  mask = (g2 >> 63) - 1;
+  g0 &= mask; g1 &= mask; g2 &= mask;
+  mask = ~mask;
+  h[0] = (h[0] & mask) | g0;
+  h[1] = (h[1] & mask) | g1;
+  h[2] = (h[2] & mask) | g2;
+
+  /* h = (h + s) % 2^128 */
+  t0 = read32_le(s) | ((uint64_t)read32_le(s + 4) << 32);
+  t1 = read32_le(s + 8) | ((uint64_t)read32_le(s + 12) << 32);
+  h[0] += t0 & 0xfffffffffff; c = h[0] >> 44; h[0] &= 0xfffffffffff;
+  h[1] += (((t0 >> 44) | (t1 << 20)) & 0xfffffffffff) + c; c = h[1] >> 44; h[1] &= 0xfffffffffff;
+  h[2] += ((t1 >> 24) & 0x3ffffffffff) + c;
+
+  t0 = h[0] | (h[1] << 44);
+  t1 = (h[1] >> 20) | (h[2] << 24);
+  write32_le((uint32_t)t0, out);
+  write32_le((uint32_t)(t0 >> 32), out + 4);
+  write32_le((uint32_t)t1, out + 8);
+  write32_le((uint32_t)(t1 >> 32), out + 12);
+}
 
-  poly1305_add(xsub, negative_1305);
+#else /* _WIN64 */
 
-  /* If x - (2 ** 130 - 5) is negative, then
-   * x didn't need reduction: we discard the results.
-   * Do this in a side-channel silent way. */
-  uint32_t negative_mask = mask_u32(xsub[16] & 0x80, 0x80);
-  uint32_t positive_mask = negative_mask ^ 0xffffffff;
+/* d += h * r mod 2^130 - 5 */
+static void poly1305_mulacc(uint64_t d[5], const uint32_t h[5], const uint32_t r[5])
+{
+  const uint32_t s1 = r[1] * 5, s2 = r[2] * 5, s3 = r[3] * 5, s4 = r[4] * 5;
 
-  for (size_t i = 0; i < 17; i++)
-    x[i] = (x[i] & negative_mask) | (xsub[i] & positive_mask);
+  d[0] += (uint64_t)h[0] * r[0] + (uint64_t)h[1] * s4 + (uint64_t)h[2] * s3 + (uint64_t)h[3] * s2 + (uint64_t)h[4] * s1;
+  d[1] += (uint64_t)h[0] * r[1] + (uint64_t)h[1] * r[0] + (uint64_t)h[2] * s4 + (uint64_t)h[3] * s3 + (uint64_t)h[4] * s2;
+  d[2] += (uint64_t)h[0] * r[2] + (uint64_t)h[1] * r[1] + (uint64_t)h[2] * r[0] + (uint64_t)h[3] * s4 + (uint64_t)h[4] * s3;
+  d[3] += (uint64_t)h[0] * r[3] + (uint64_t)h[1] * r[2] + (uint64_t)h[2] * r[1] + (uint64_t)h[3] * r[0] + (uint64_t)h[4] * s4;
+  d[4] += (uint64_t)h[0] * r[4] + (uint64_t)h[1] * r[3] + (uint64_t)h[2] * r[2] + (uint64_t)h[3] * r[1] + (uint64_t)h[4] * r[0];
 }
 
-static void poly1305_mul(uint32_t x[17],
-                         const uint32_t y[17])
+/* Partial reduction of d back into limbs of h */
+static void poly1305_carry(uint32_t h[5], uint64_t d[5])
 {
-  uint32_t r[17];
+  uint32_t c;
+
+  c = (uint32_t)(d[0] >> 26); h[0] = (uint32_t)d[0] & 0x3ffffff;
+  d[1] += c; c = (uint32_t)(d[1] >> 26); h[1] = (uint32_t)d[1] & 0x3ffffff;
+  d[2] += c; c = (uint32_t)(d[2] >> 26); h[2] = (uint32_t)d[2] & 0x3ffffff;
+  d[3] += c; c = (uint32_t)(d[3] >> 26); h[3] = (uint32_t)d[3] & 0x3ffffff;
+  d[4] += c; c = (uint32_t)(d[4] >> 26); h[4] = (uint32_t)d[4] & 0x3ffffff;
+  h[0] += c * 5;
+  c = h[0] >> 26; h[0] &= 0x3ffffff;
+  h[1] += c;
+}
 
-  for (int i = 0; i < 17; i++)
-  {
-    uint32_t accum = 0;
-
-    for (int j = 0; j <= i; j++)
-      accum += x[j] * y[i - j];
-
-    /* Add in carries.  These get shifted 130 bits
-     * to the right, with a combination of byte indexing
-     * and shifting (136 bits right, then 6 bits left).
-     *
-     * nb. 5 << 6 is made up of two parts:
-     *   5: reduction of 2 ** 130 leaves a multiple 5
-     *   shift 6 places left
-     *     17 * 8: byte indexing shift (136 bits)
-     *     130: desired shift
-     */
-    for (int j = i + 1; j < 17; j++)
-      accum += (5 << 6) * x[j] * y[i + 17 - j];
-
-    r[i] = accum;
-  }
+static void poly1305_mul(uint32_t out[5], const uint32_t a[5], const uint32_t b[5])
+{
+  uint64_t d[5];
 
-  poly1305_min_reduce(r);
+  memset(d, 0, sizeof d);
+  poly1305_mulacc(d, a, b);
+  poly1305_carry(out, d);
+}
 
-  for (size_t i = 0; i < 17; i++)
-    x[i] = r[i];
+static void poly1305_load(uint32_t x[5], const uint8_t m[16], uint32_t hibit)
+{
+  x[0] = (read32_le(m + 0)) & 0x3ffffff;
+  x[1] = (read32_le(m + 3) >> 2) & 0x3ffffff;
+  x[2] = (read32_le(m + 6) >> 4) & 0x3ffffff;
+  x[3] = (read32_le(m + 9) >> 6) & 0x3ffffff;
+  x[4] = (read32_le(m + 12) >> 8) | (hibit << 24);
 }
 
-static void poly1305_block(cf_poly1305 *ctx,
-                           const uint32_t c[17])
+static void poly1305_clamp(uint32_t r[5], const uint8_t key[16])
 {
-  poly1305_add(ctx->h, c);
-  poly1305_mul(ctx->h, ctx->r);
+  r[0] = (read32_le(key + 0)) & 0x3ffffff;
+  r[1] = (read32_le(key + 3) >> 2) & 0x3ffff03;
+  r[2] = (read32_le(key + 6) >> 4) & 0x3ffc0ff;
+  r[3] = (read32_le(key + 9) >> 6) & 0x3f03fff;
+  r[4] = (read32_le(key + 12) >> 8) & 0x00fffff;
 }
 
-static void poly1305_whole_block(void *vctx,
-                                 const uint8_t *buf)
+static void poly1305_blocks(cf_poly1305 *ctx, const uint8_t *m, size_t nblocks, uint32_t hibit)
 {
-  cf_poly1305 *ctx = (cf_poly1305 *)vctx;
-  uint32_t c[17];
+  uint32_t *h = ctx->h, x[5];
+  uint64_t d[5];
 
-  for (int i = 0; i < 16; i++)
-    c[i] = buf[i];
+  for (; nblocks >= 2; nblocks -= 2, m += 32)
+  {
+    poly1305_load(x, m, hibit);
+    h[0] += x[0]; h[1] += x[1]; h[2] += x[2]; h[3] += x[3]; h[4] += x[4];
+    poly1305_load(x, m + 16, hibit);
+    memset(d, 0, sizeof d);
+    poly1305_mulacc(d, h, ctx->rr);
+    poly1305_mulacc(d, x, ctx->r);
+    poly1305_carry(h, d);
+  }
+  if (nblocks)
+  {
+    poly1305_load(x, m, hibit);
+    h[0] += x[0]; h[1] += x[1]; h[2] += x[2]; h[3] += x[3]; h[4] += x[4];
+    memset(d, 0, sizeof d);
+    poly1305_mulacc(d, h, ctx->r);
+    poly1305_carry(h, d);
+  }
+}
 
-  c[16] = 1;
-  poly1305_block(ctx, c);
+/* Fully carry h, reduce mod 2^130 - 5 in constant time and return h + s mod 2^128 */
+static void poly1305_final(uint32_t h[5], const uint8_t s[16], uint8_t out[16])
+{
+  uint32_t c, g0, g1, g2, g3, g4, mask;
+  uint64_t f;
+
+  c = h[1] >> 26; h[1] &= 0x3ffffff;
+  h[2] += c; c = h[2] >> 26; h[2] &= 0x3ffffff;
+  h[3] += c; c = h[3] >> 26; h[3] &= 0x3ffffff;
+  h[4] += c; c = h[4] >> 26; h[4] &= 0x3ffffff;
+  h[0] += c * 5; c = h[0] >> 26; h[0] &= 0x3ffffff;
+  h[1] += c;
+
+  /* g = h + -p */
+  g0 = h[0] + 5; c = g0 >> 26; g0 &= 0x3ffffff;
+  g1 = h[1] + c; c = g1 >> 26; g1 &= 0x3ffffff;
+  g2 = h[2] + c; c = g2 >> 26; g2 &= 0x3ffffff;
+  g3 = h[3] + c; c = g3 >> 26; g3 &= 0x3ffffff;
+  g4 = h[4] + c - (1 << 26);
+
+  /* select h if h < p, or h + -p if h >= p */
+  mask = (g4 >> 31) - 1;
+  g0 &= mask; g1 &= mask; g2 &= mask; g3 &= mask; g4 &= mask;
+  mask = ~mask;
+  h[0] = (h[0] & mask) | g0;
+  h[1] = (h[1] & mask) | g1;
+  h[2] = (h[2] & mask) | g2;
+  h[3] = (h[3] & mask) | g3;
+  h[4] = (h[4] & mask) | g4;
+
+  /* h = h % 2^128 in 4 words */
+  h[0] = (h[0]) | (h[1] << 26);
+  h[1] = (h[1] >> 6) | (h[2] << 20);
+  h[2] = (h[2] >> 12) | (h[3] << 14);
+  h[3] = (h[3] >> 18) | (h[4] << 8);
+
+  /* out = (h + s) % 2^128 */
+  f = (uint64_t)h[0] + read32_le(s + 0);             write32_le((uint32_t)f, out + 0);
+  f = (uint64_t)h[1] + read32_le(s + 4) + (f >> 32); write32_le((uint32_t)f, out + 4);
+  f = (uint64_t)h[2] + read32_le(s + 8) + (f >> 32); write32_le((uint32_t)f, out + 8);
+  f = (uint64_t)h[3] + read32_le(s + 12) + (f >> 32); write32_le((uint32_t)f, out + 12);
 }
 
-static void poly1305_last_block(cf_poly1305 *ctx)
+#endif /* _WIN64 */
+
+static
+void cf_poly1305_init(cf_poly1305 *ctx,
+                      const uint8_t r[16],
+                      const uint8_t s[16])
 {
-  uint32_t c[17] = { 0 };
+  memset(ctx, 0, sizeof *ctx);
+  poly1305_clamp(ctx->r, r);
 
-  for (size_t i = 0; i < ctx->npartial; i++)
-    c[i] = ctx->partial[i];
+  /* rr = r^2, for consuming two blocks per reduction */
+  poly1305_mul(ctx->rr, ctx->r, ctx->r);
 
-  c[ctx->npartial] = 1;
-  poly1305_block(ctx, c);
+  memcpy(ctx->s, s, 16);
+}
+
+static void poly1305_whole_block(void *vctx,
+                                 const uint8_t *buf)
+{
+  poly1305_blocks((cf_poly1305 *)vctx, buf, 1, 1);
 }
 
 static
@@ -187,31 +328,43 @@ void cf_poly1305_update(cf_poly1305 *ctx,
                         const uint8_t *buf,
                         size_t nbytes)
 {
-  DECLARE_PFN(cf_blockwise_in_fn, poly1305_whole_block);
-  cf_blockwise_accumulate(ctx->partial, &ctx->npartial,
-                          sizeof ctx->partial,
-                          buf, nbytes,
-                          pfn_poly1305_whole_block,
-                          ctx);
+  /* Top up a partial block first, then hash whole blocks in place */
+  if (ctx->npartial)
+  {
+    size_t taken = MIN(nbytes, sizeof ctx->partial - ctx->npartial);
+    memcpy(ctx->partial + ctx->npartial, buf, taken);
+    ctx->npartial += taken;
+    buf += taken;
+    nbytes -= taken;
+    if (ctx->npartial < sizeof ctx->partial)
+      return;
+    poly1305_whole_block(ctx, ctx->partial);
+    ctx->npartial = 0;
+  }
+
+  if (nbytes >= 16)
+  {
+    poly1305_blocks(ctx, buf, nbytes / 16, 1);
+    buf += nbytes & ~(size_t)15;
+    nbytes &= 15;
+  }
+
+  memcpy(ctx->partial, buf, nbytes);
+  ctx->npartial = nbytes;
 }
 
 static
 void cf_poly1305_finish(cf_poly1305 *ctx,
                         uint8_t out[16])
 {
+  /* Last partial block is padded with a single 1 bit and no high bit */
   if (ctx->npartial)
-    poly1305_last_block(ctx);
-
-  uint32_t s[17];
-  for (size_t i = 0; i < 16; i++)
-    s[i] = ctx->s[i];
-  s[16] = 0;
-
-  poly1305_full_reduce(ctx->h);
-  poly1305_add(ctx->h, s);
-
-  for (size_t i = 0; i < 16; i++)
-    out[i] = ctx->h[i];
+  {
+    memset(ctx->partial + ctx->npartial, 0, sizeof ctx->partial - ctx->npartial);
+    ctx->partial[ctx->npartial] = 1;
+    poly1305_blocks(ctx, ctx->partial, 1, 0);
+  }
 
+  poly1305_final(ctx->h, ctx->s, out);
   mem_clean(ctx, sizeof *ctx);
 }
@@ -141,4 +141,162 @@ static void rsa_crt_modexp(const uint32_t maxbytes, const uint8_t *base_in, cons
     freebn(ret);
 }
 
+/*
+ * Private key context for repeated CRT operations with the same key.
+ * Montgomery constants of p and q, the reduced exponents and a scratch
+ * arena are set up once by rsa_crt_ctx_init, so rsa_crt_ctx_modexp
+ * never allocates.
+ */
+typedef struct {
+    uint32_t maxbytes;
+    uint8_t *mod;                      /* n, to range check the base */
+    bn_monty mp, mq;
+    Bignum pexp, qexp;                 /* exp mod (p-1), exp mod (q-1) */
+    BignumInt *q;                      /* len words */
+    BignumInt *iqmp_rr;                /* iqmp * r^2 mod p, len words */
+    BignumInt *scratch;
+    int scratchlen;
+} rsa_crt_ctx;
+
+static void rsa_crt_ctx_free(void *vctx)
+{
+    rsa_crt_ctx *ctx = (rsa_crt_ctx *)vctx;
+
+    if (ctx == 0)
+        return;
+    bn_monty_free(&ctx->mp);
+    bn_monty_free(&ctx->mq);
+    if (ctx->pexp)
+        freebn(ctx->pexp);
+    if (ctx->qexp)
+        freebn(ctx->qexp);
+    if (ctx->scratch) {
+        smemclr(ctx->scratch, ctx->scratchlen * sizeof(*ctx->scratch));
+        sfree(ctx->scratch);
+    }
+    if (ctx->mod)
+        sfree(ctx->mod);
+    smemclr(ctx, sizeof(*ctx));
+    sfree(ctx);
+}
+
+/*
+ * Returns 0 if the key doesn't suit the cached path (p and q must be odd
+ * and of the same word length), in which case use rsa_crt_modexp.
+ */
+static void *rsa_crt_ctx_init(const uint32_t maxbytes, const uint8_t *exp_in, const uint8_t *mod_in,
+                              const uint8_t *p_in, const uint8_t *q_in, const uint8_t *iqmp_in)
+{
+    rsa_crt_ctx *ctx = 0;
+    Bignum exp, p, q, iqmp, pm1, qm1, r, rr, t;
+    int len, j;
+
+    exp = bignum_from_bytes(exp_in, maxbytes);
+    p = bignum_from_bytes(p_in, maxbytes / 2);
+    q = bignum_from_bytes(q_in, maxbytes / 2);
+    iqmp = bignum_from_bytes(iqmp_in, maxbytes / 2);
+    len = p[0];
+    if (!(p[1] & 1) || !(q[1] & 1) || (int)q[0] != len)
+        goto QH;
+
+    ctx = snew(rsa_crt_ctx);
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->maxbytes = maxbytes;
+    ctx->mod = snewn(maxbytes, uint8_t);
+    memcpy(ctx->mod, mod_in, maxbytes);
+    bn_monty_init(&ctx->mp, p);
+    bn_monty_init(&ctx->mq, q);
+
+    pm1 = copybn(p);
+    decbn(pm1);
+    qm1 = copybn(q);
+    decbn(qm1);
+    ctx->pexp = bigmod(exp, pm1);
+    ctx->qexp = bigmod(exp, qm1);
+    freebn(pm1);
+    freebn(qm1);
+
+    /*
+     * iqmp premultiplied by r^2, so that a single Montgomery multiply
+     * of it with a value in r^{-1} form gives a plain product mod p.
+     */
+    r = bn_power_2(BIGNUM_INT_BITS * len);
+    rr = modmul(r, r, p);
+    t = modmul(iqmp, rr, p);
+    freebn(r);
+    freebn(rr);
+
+    ctx->scratchlen = 8*len + bn_monty_scratch(len);
+    ctx->scratch = snewn(ctx->scratchlen, BignumInt);
+    ctx->q = ctx->scratch;
+    ctx->iqmp_rr = ctx->scratch + len;
+    for (j = 0; j < len; j++) {
+        ctx->q[len - 1 - j] = q[j + 1];
+        ctx->iqmp_rr[len - 1 - j] = (j < (int)t[0] ? t[j + 1] : 0);
+    }
+    freebn(t);
+QH:
+    freebn(exp);
+    freebn(p);
+    freebn(q);
+    freebn(iqmp);
+    return ctx;
+}
+
+/*
+ * Compute (base ^ exp) % mod with a context from rsa_crt_ctx_init.
+ * Returns 0 if base is not below mod.
+ */
+static int rsa_crt_ctx_modexp(void *vctx, const uint8_t *base_in, uint8_t *ret_out)
+{
+    rsa_crt_ctx *ctx = (rsa_crt_ctx *)vctx;
+    BignumInt *xp, *xq, *y, *tmp;
+    int len = ctx->mp.len, j;
+
+    for (j = 0; j < (int)ctx->maxbytes && base_in[j] == ctx->mod[j]; j++)
+        ;
+    if (j == (int)ctx->maxbytes || base_in[j] > ctx->mod[j])
+        return 0;
+
+    /*
+     * Both primes have len words, so n < r^2 and base fits the 2*len
+     * word input of both modpows.
+     */
+    xp = ctx->scratch + 2*len;
+    xq = xp + 2*len;
+    y = xq + 2*len;
+    tmp = y + 2*len;
+    internal_from_bytes(xp, 2*len, base_in, ctx->maxbytes);
+    for (j = 0; j < 2*len; j++)
+        xq[j] = xp[j];
+    bn_monty_modpow(&ctx->mp, xp, ctx->pexp, tmp);
+    bn_monty_modpow(&ctx->mq, xq, ctx->qexp, tmp);
+
+    /*
+     * Recombine as in rsa_crt_modexp: ret = qresult + q * h with
+     * h = (presult - qresult) * iqmp mod p. Reducing both results mod
+     * p takes them to r^{-1} form, and iqmp_rr puts the difference
+     * back into plain form. qresult < q < r, so that reduction is
+     * valid too.
+     */
+    monty_reduce(xp, ctx->mp.n, ctx->mp.mninv, tmp, len);
+    for (j = 0; j < 2*len; j++)
+        y[j] = xq[j];
+    monty_reduce(y, ctx->mp.n, ctx->mp.mninv, tmp, len);
+    for (j = 0; j < len && xp[len + j] == y[len + j]; j++)
+        ;
+    if (j < len && xp[len + j] < y[len + j])
+        internal_add(xp + len, ctx->mp.n, xp + len, len);
+    internal_sub(xp + len, y + len, xp + len, len);
+    internal_mul(xp + len, ctx->iqmp_rr, y, len, tmp);
+    monty_reduce(y, ctx->mp.n, ctx->mp.mninv, tmp, len);
+
+    internal_mul(ctx->q, y + len, xp, len, tmp);
+    internal_add(xp, xq, xp, 2*len);
+    internal_to_bytes(xp, 2*len, ret_out, ctx->maxbytes);
+
+    smemclr(ctx->scratch + 2*len, (ctx->scratchlen - 2*len) * sizeof(*ctx->scratch));
+    return 1;
+}
+
 #endif // IMPL_SSHRSA_THUNK
\ No newline at end of file
@@ -47,6 +47,9 @@
  *
  * .. c:member:: cf_sha256_context.blocks
  * Number of full blocks processed.
+ *
+ * .. c:member:: cf_sha256_context.impl
+ * Compression function picked by init, one of SHA256_IMPL_*.
  */
 typedef struct
 {
@@ -54,6 +57,7 @@ typedef struct
   uint8_t partial[CF_SHA256_BLOCKSZ]; /* Partial block of input. */
   uint32_t blocks;                    /* Number of full blocks processed into H. */
   size_t npartial;                    /* Number of bytes in prefix of partial. */
+  int impl;                           /* Compression function in use. */
 } cf_sha256_context;
 
 void cf_sha256_digest_final(cf_sha256_context *ctx, uint8_t hash[CF_SHA256_HASHSZ]);
@@ -84,6 +88,59 @@ static const uint32_t g_K256[64] = {
 #define SSIG0(x) (rotr32((x), 7) ^ rotr32((x), 18) ^ ((x) >> 3))
 #define SSIG1(x) (rotr32((x), 17) ^ rotr32((x), 19) ^ ((x) >> 10))
 
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/* gcc and clang only emit SSSE3/SHA instructions in functions targeted at them */
+#if defined(__clang__) || defined(__GNUC__)
+#define SHA256_ISA_SSSE3 __attribute__((target("ssse3")))
+#define SHA256_ISA_SHANI __attribute__((target("sha,sse4.1,ssse3")))
+#else
+#define SHA256_ISA_SSSE3
+#define SHA256_ISA_SHANI
+#endif
+
+/* Compression functions: plain C, SSSE3 message schedule with scalar
+ * rounds, or the SHA extensions. Byte swaps use shifts and 16-bit shuffles
+ * as a pshufb mask would be a constant outside the thunk. */
+#define SHA256_IMPL_C     0
+#define SHA256_IMPL_SSSE3 1
+#define SHA256_IMPL_SHANI 2
+
+static int sha256_impl_detect()
+{
+  int CPUInfo[4];
+  int ecx1;
+
+  __cpuid(CPUInfo, 0);
+  if (CPUInfo[0] < 1)
+    return SHA256_IMPL_C;
+  __cpuid(CPUInfo, 1);
+  ecx1 = CPUInfo[2];
+  __cpuid(CPUInfo, 0);
+  if (CPUInfo[0] >= 7)
+  {
+    __cpuidex(CPUInfo, 7, 0);
+    /* SHA, plus SSE4.1 for the state blend */
+    if ((CPUInfo[1] & (1 << 29)) && (ecx1 & (1 << 19)))
+      return SHA256_IMPL_SHANI;
+  }
+  if (ecx1 & (1 << 9))
+    return SHA256_IMPL_SSSE3;
+  return SHA256_IMPL_C;
+}
+
+/* CPUID is slow (and traps under hypervisors) so it runs once per process,
+ * racing threads store the same value. */
+static int sha256_impl_level()
+{
+  if (sha256_impl == 0)
+    sha256_impl = sha256_impl_detect() + 1;
+  return sha256_impl - 1;
+}
+
 static
 void cf_sha256_init(cf_sha256_context *ctx)
 {
@@ -96,6 +153,7 @@ void cf_sha256_init(cf_sha256_context *ctx)
   ctx->H[5] = 0x9b05688c;
   ctx->H[6] = 0x1f83d9ab;
   ctx->H[7] = 0x5be0cd19;
+  ctx->impl = sha256_impl_level();
 }
 
 static
@@ -110,14 +168,98 @@ void cf_sha224_init(cf_sha256_context *ctx)
   ctx->H[5] = 0x68581511;
   ctx->H[6] = 0x64f98fa7;
   ctx->H[7] = 0xbefa4fa4;
+  ctx->impl = sha256_impl_level();
+}
+
+static inline __m128i sha256_bswap32(__m128i x)
+{
+  x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+  x = _mm_shufflelo_epi16(x, 0xB1);
+  return _mm_shufflehi_epi16(x, 0xB1);
+}
+
+#define ROTR_V(x, n) _mm_or_si128(_mm_srli_epi32((x), (n)), _mm_slli_epi32((x), 32 - (n)))
+#define SSIG0_V(x) _mm_xor_si128(_mm_xor_si128(ROTR_V((x), 7), ROTR_V((x), 18)), _mm_srli_epi32((x), 3))
+#define SSIG1_V(x) _mm_xor_si128(_mm_xor_si128(ROTR_V((x), 17), ROTR_V((x), 19)), _mm_srli_epi32((x), 10))
+
+/* Full W[0..64] four words at a time. The two SSIG1 terms that depend on
+ * words of the same group are done in a second half-vector pass. */
+SHA256_ISA_SSSE3
+static void sha256_schedule_ssse3(const uint8_t *inp, uint32_t W[64])
+{
+  __m128i X[4], w15, w7, t;
+
+  for (int i = 0; i < 4; i++)
+  {
+    X[i] = sha256_bswap32(_mm_loadu_si128((const __m128i *)(inp + 16 * i)));
+    _mm_storeu_si128((__m128i *)(W + 4 * i), X[i]);
+  }
+
+  for (int i = 4; i < 16; i++)
+  {
+    w15 = _mm_alignr_epi8(X[(i + 1) % 4], X[i % 4], 4);
+    w7 = _mm_alignr_epi8(X[(i + 3) % 4], X[(i + 2) % 4], 4);
+    t = _mm_add_epi32(_mm_add_epi32(X[i % 4], SSIG0_V(w15)), w7);
+    t = _mm_add_epi32(t, SSIG1_V(_mm_srli_si128(X[(i + 3) % 4], 8)));
+    t = _mm_add_epi32(t, SSIG1_V(_mm_slli_si128(t, 8)));
+    X[i % 4] = t;
+    _mm_storeu_si128((__m128i *)(W + 4 * i), t);
+  }
+}
+
+/* SHA extensions, state kept as ABEF/CDGH. Message group g is finished
+ * (msg2) in round group g - 1 and started (msg1) in round group g - 3. */
+SHA256_ISA_SHANI
+static void sha256_update_block_shani(cf_sha256_context *ctx, const uint8_t *inp)
+{
+  __m128i state0, state1, abef, cdgh, msg, tmp, M[4];
+
+  tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&ctx->H[0]), 0xB1); /* CDAB */
+  state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&ctx->H[4]), 0x1B); /* EFGH */
+  state0 = _mm_alignr_epi8(tmp, state1, 8);    /* ABEF */
+  state1 = _mm_blend_epi16(state1, tmp, 0xF0); /* CDGH */
+  abef = state0;
+  cdgh = state1;
+
+  for (int g = 0; g < 16; g++)
+  {
+    if (g < 4)
+      M[g] = sha256_bswap32(_mm_loadu_si128((const __m128i *)(inp + 16 * g)));
+    msg = _mm_add_epi32(M[g % 4], _mm_loadu_si128((const __m128i *)(K256 + 4 * g)));
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+    if (g >= 3 && g < 15)
+    {
+      tmp = _mm_alignr_epi8(M[g % 4], M[(g + 3) % 4], 4);
+      M[(g + 1) % 4] = _mm_sha256msg2_epu32(_mm_add_epi32(M[(g + 1) % 4], tmp), M[g % 4]);
+    }
+    msg = _mm_shuffle_epi32(msg, 0x0E);
+    state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+    if (g >= 1 && g < 13)
+      M[(g + 3) % 4] = _mm_sha256msg1_epu32(M[(g + 3) % 4], M[g % 4]);
+  }
+
+  state0 = _mm_add_epi32(state0, abef);
+  state1 = _mm_add_epi32(state1, cdgh);
+  tmp = _mm_shuffle_epi32(state0, 0x1B);       /* FEBA */
+  state1 = _mm_shuffle_epi32(state1, 0xB1);    /* DCHG */
+  state0 = _mm_blend_epi16(tmp, state1, 0xF0); /* DCBA */
+  state1 = _mm_alignr_epi8(state1, tmp, 8);    /* HGFE */
+  _mm_storeu_si128((__m128i *)&ctx->H[0], state0);
+  _mm_storeu_si128((__m128i *)&ctx->H[4], state1);
 }
 
 static void sha256_update_block(void *vctx, const uint8_t *inp)
 {
   cf_sha256_context *ctx = (cf_sha256_context *)vctx;
 
-  /* This is a 16-word window into the whole W array. */
-  uint32_t W[16];
+  if (ctx->impl == SHA256_IMPL_SHANI)
+  {
+    sha256_update_block_shani(ctx, inp);
+    ctx->blocks++;
+    return;
+  }
+
+  uint32_t W[64];
 
   uint32_t a = ctx->H[0],
            b = ctx->H[1],
@@ -126,31 +268,25 @@ static void sha256_update_block(void *vctx, const uint8_t *inp)
            e = ctx->H[4],
            f = ctx->H[5],
            g = ctx->H[6],
-           h = ctx->H[7],
-           Wt;
+           h = ctx->H[7];
 
-  for (size_t t = 0; t < 64; t++)
+  if (ctx->impl == SHA256_IMPL_SSSE3)
   {
-    /* For W[0..16] we process the input into W.
-     * For W[16..64] we compute the next W value:
-     *
-     * W[t] = SSIG1(W[t - 2]) + W[t - 7] + SSIG0(W[t - 15]) + W[t - 16];
-     *
-     * But all W indices are reduced mod 16 into our window.
-     */
-    if (t < 16)
+    sha256_schedule_ssse3(inp, W);
+  } else {
+    /* W[t] = SSIG1(W[t - 2]) + W[t - 7] + SSIG0(W[t - 15]) + W[t - 16]; */
+    for (size_t t = 0; t < 16; t++)
     {
-      W[t] = Wt = read32_be(inp);
+      W[t] = read32_be(inp);
       inp += 4;
-    } else {
-      Wt = SSIG1(W[(t - 2) % 16]) +
-           W[(t - 7) % 16] +
-           SSIG0(W[(t - 15) % 16]) +
-           W[(t - 16) % 16];
-      W[t % 16] = Wt;
     }
+    for (size_t t = 16; t < 64; t++)
+      W[t] = SSIG1(W[t - 2]) + W[t - 7] + SSIG0(W[t - 15]) + W[t - 16];
+  }
 
-    uint32_t T1 = h + BSIG1(e) + CH(e, f, g) + K256[t] + Wt;
+  for (size_t t = 0; t < 64; t++)
+  {
+    uint32_t T1 = h + BSIG1(e) + CH(e, f, g) + K256[t] + W[t];
     uint32_t T2 = BSIG0(a) + MAJ(a, b, c);
     h = g;
     g = f;
@@ -267,3 +403,6 @@ void cf_sha224_digest_final(cf_sha256_context *ctx, uint8_t hash[CF_SHA224_HASHS
 #undef BSIG1
 #undef SSIG0
 #undef SSIG1
+#undef ROTR_V
+#undef SSIG0_V
+#undef SSIG1_V
@@ -265,6 +265,65 @@ static int cf_aes_ni_setup(cf_aes_ni_context *ctx, const unsigned char *key, int
     return 1;
 }
 
+/*
+ * Counter mode with a 32-bit big-endian counter in the last word of `ctr',
+ * as used by GCM. Keeps CF_AES_NI_CTR_BLOCKS blocks in flight so aesenc
+ * latency is hidden, `ctr' is advanced past the last block used.
+ */
+#define CF_AES_NI_CTR_BLOCKS 4
+
+INLINE static uint32_t cf_aes_ni_bswap32(uint32_t x)
+{
+    return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+
+FUNC_ISA
+static void cf_aes_ni_ctr32(const cf_aes_ni_context *ctx, uint8_t ctr[AES_BLOCKSZ],
+                            const uint8_t *in, uint8_t *out, size_t nblocks)
+{
+    const __m128i *keysched = ctx->keysched_e;
+    const __m128i base = _mm_loadu_si128((const __m128i*)ctr);
+    uint32_t counter = read32_be(ctr + 12);
+    __m128i b0, b1, b2, b3, k;
+    uint32_t r;
+
+    for (; nblocks >= CF_AES_NI_CTR_BLOCKS; nblocks -= CF_AES_NI_CTR_BLOCKS, counter += CF_AES_NI_CTR_BLOCKS) {
+        k = keysched[0];
+        b0 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter), 3), k);
+        b1 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter + 1), 3), k);
+        b2 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter + 2), 3), k);
+        b3 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter + 3), 3), k);
+        for (r = 1; r < ctx->rounds; r++) {
+            k = keysched[r];
+            b0 = _mm_aesenc_si128(b0, k);
+            b1 = _mm_aesenc_si128(b1, k);
+            b2 = _mm_aesenc_si128(b2, k);
+            b3 = _mm_aesenc_si128(b3, k);
+        }
+        k = keysched[ctx->rounds];
+        b0 = _mm_aesenclast_si128(b0, k);
+        b1 = _mm_aesenclast_si128(b1, k);
+        b2 = _mm_aesenclast_si128(b2, k);
+        b3 = _mm_aesenclast_si128(b3, k);
+        _mm_storeu_si128((__m128i*)out, _mm_xor_si128(b0, _mm_loadu_si128((const __m128i*)in)));
+        _mm_storeu_si128((__m128i*)(out + 16), _mm_xor_si128(b1, _mm_loadu_si128((const __m128i*)(in + 16))));
+        _mm_storeu_si128((__m128i*)(out + 32), _mm_xor_si128(b2, _mm_loadu_si128((const __m128i*)(in + 32))));
+        _mm_storeu_si128((__m128i*)(out + 48), _mm_xor_si128(b3, _mm_loadu_si128((const __m128i*)(in + 48))));
+        in += CF_AES_NI_CTR_BLOCKS * AES_BLOCKSZ;
+        out += CF_AES_NI_CTR_BLOCKS * AES_BLOCKSZ;
+    }
+    for (; nblocks > 0; nblocks--, counter++) {
+        b0 = _mm_xor_si128(_mm_insert_epi32(base, cf_aes_ni_bswap32(counter), 3), keysched[0]);
+        for (r = 1; r < ctx->rounds; r++)
+            b0 = _mm_aesenc_si128(b0, keysched[r]);
+        b0 = _mm_aesenclast_si128(b0, keysched[ctx->rounds]);
+        _mm_storeu_si128((__m128i*)out, _mm_xor_si128(b0, _mm_loadu_si128((const __m128i*)in)));
+        in += AES_BLOCKSZ;
+        out += AES_BLOCKSZ;
+    }
+    write32_be(counter, ctr + 12);
+}
+
 #else /* COMPILER_SUPPORTS_AES_NI */
 
 FUNC_ISA
@@ -293,6 +352,12 @@ static int supports_aes_ni()
     return 0;
 }
 
+static void cf_aes_ni_ctr32(const cf_aes_ni_context *ctx, uint8_t ctr[AES_BLOCKSZ],
+                            const uint8_t *in, uint8_t *out, size_t nblocks)
+{
+    assert(0);
+}
+
 #endif /* COMPILER_SUPPORTS_AES_NI */
 
 #undef INLINE
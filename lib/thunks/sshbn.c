@@ -484,6 +484,59 @@ static void internal_mul_low(const BignumInt *a, const BignumInt *b,
     }
 }
 
+/*
+ * Compute c = a * a. Same conventions as internal_mul. Below the
+ * Karatsuba threshold each cross product a_i a_j (i < j) is computed
+ * once and doubled, which is nearly half the multiplies of the general
+ * case.
+ */
+static void internal_sqr(const BignumInt *a, BignumInt *c, int len,
+                         BignumInt *scratch)
+{
+    if (len > KARATSUBA_THRESHOLD) {
+        internal_mul(a, a, c, len, scratch);
+    } else {
+        int i, j;
+        BignumInt carry, hi, lo;
+        BignumCarry cc;
+
+        /* Index least significant word first */
+#define SQR_A(i) a[len - 1 - (i)]
+#define SQR_C(i) c[2*len - 1 - (i)]
+
+        for (i = 0; i < 2*len; i++)
+            c[i] = 0;
+
+        /* Cross products; row i ends at word i + len, still unwritten */
+        for (i = 0; i < len; i++) {
+            carry = 0;
+            for (j = i + 1; j < len; j++)
+                BignumMULADD2(carry, SQR_C(i + j), SQR_A(i), SQR_A(j),
+                              SQR_C(i + j), carry);
+            SQR_C(i + len) = carry;
+        }
+
+        /* Double them */
+        carry = 0;
+        for (i = 0; i < 2*len; i++) {
+            lo = SQR_C(i);
+            SQR_C(i) = (lo << 1) | carry;
+            carry = lo >> (BIGNUM_INT_BITS - 1);
+        }
+
+        /* And add the squares on the diagonal */
+        cc = 0;
+        for (i = 0; i < len; i++) {
+            BignumMUL(hi, lo, SQR_A(i), SQR_A(i));
+            BignumADC(SQR_C(2*i), cc, SQR_C(2*i), lo, cc);
+            BignumADC(SQR_C(2*i + 1), cc, SQR_C(2*i + 1), hi, cc);
+        }
+
+#undef SQR_A
+#undef SQR_C
+    }
+}
+
 /*
  * Montgomery reduction. Expects x to be a big-endian array of 2*len
  * BignumInts whose value satisfies 0 <= x < rn (where r = 2^(len *
@@ -501,9 +554,36 @@ static void internal_mul_low(const BignumInt *a, const BignumInt *b,
 static void monty_reduce(BignumInt *x, const BignumInt *n,
                          const BignumInt *mninv, BignumInt *tmp, int len)
 {
-    int i;
+    int i, j;
     BignumInt carry;
 
+    if (len <= KARATSUBA_THRESHOLD) {
+        /*
+         * Below the Karatsuba threshold, clear x one word at a time
+         * from the bottom instead, adding u n for u = x_i (-n)^{-1}
+         * mod 2^BIGNUM_INT_BITS. That's len^2 multiplies against the
+         * 1.5 len^2 of the two multiplies below, and it ends in the
+         * same place: (mn+x)/r in the top half, the carry off the top
+         * in 'carry'.
+         */
+        BignumInt n0inv = mninv[len - 1], u, c;
+        BignumCarry cc = 0, cout;
+
+        for (i = 2*len - 1; i >= len; i--) {
+            u = x[i] * n0inv;
+            c = 0;
+            for (j = len - 1; j >= 0; j--)
+                BignumMULADD2(c, x[i - (len - 1 - j)], u, n[j],
+                              x[i - (len - 1 - j)], c);
+            BignumADC(x[i - len], cout, x[i - len], c, cc);
+            cc = cout;
+        }
+        carry = cc;
+        for (i = 0; i < len; i++)
+            x[len + i] = x[i], x[i] = 0;
+        goto reduce;
+    }
+
     /*
      * Multiply x by (-n)^{-1} mod r. This gives us a value m such
      * that mn is congruent to -x mod r. Hence, mn+x is an exact
@@ -525,6 +605,7 @@ static void monty_reduce(BignumInt *x, const BignumInt *n,
     for (i = 0; i < len; i++)
         x[len + i] = x[i], x[i] = 0;
 
+  reduce:
     /*
      * Reduce t mod n. This doesn't require a full-on division by n,
      * but merely a test and single optional subtraction, since we can
@@ -1057,7 +1138,7 @@ static Bignum modpow_simple(Bignum base_in, Bignum exp, Bignum mod)
     /* Main computation */
     while (i < (int)exp[0]) {
 	while (j >= 0) {
-	    internal_mul(a + mlen, a + mlen, b, mlen, scratch);
+	    internal_sqr(a + mlen, b, mlen, scratch);
 	    internal_mod(b, mlen * 2, m, mlen, NULL, recip, rshift);
 	    if ((exp[exp[0] - i] & ((BignumInt)1 << j)) != 0) {
 		internal_mul(b + mlen, n, a, mlen, scratch);
@@ -1098,15 +1179,231 @@ static Bignum modpow_simple(Bignum base_in, Bignum exp, Bignum mod)
     return result;
 }
 
+/*
+ * Convert between big-endian byte strings and big-endian arrays of
+ * 'len' BignumInts. Bytes that don't fit are dropped on the way in and
+ * zero-filled on the way out.
+ */
+static void internal_from_bytes(BignumInt *x, int len,
+                                const unsigned char *data, int nbytes)
+{
+    int i;
+
+    for (i = 0; i < len; i++)
+        x[i] = 0;
+    for (i = 0; i < nbytes && i < len * BIGNUM_INT_BYTES; i++)
+        x[len - 1 - i / BIGNUM_INT_BYTES] |=
+            (BignumInt)data[nbytes - 1 - i] << (8 * (i % BIGNUM_INT_BYTES));
+}
+
+static void internal_to_bytes(const BignumInt *x, int len,
+                              unsigned char *data, int nbytes)
+{
+    int i;
+
+    for (i = 0; i < nbytes; i++)
+        data[nbytes - 1 - i] = (i >= len * BIGNUM_INT_BYTES ? 0 :
+            (unsigned char)(x[len - 1 - i / BIGNUM_INT_BYTES] >> (8 * (i % BIGNUM_INT_BYTES))));
+}
+
+/*
+ * Montgomery constants for a fixed odd modulus, i.e. everything modpow
+ * would otherwise recompute on each call. All arrays are big-endian
+ * 'len' BignumInts in a single allocation owned by 'n'.
+ */
+typedef struct {
+    int len;
+    BignumInt *n;                      /* the modulus */
+    BignumInt *mninv;                  /* -n^{-1} mod r */
+    BignumInt *rn;                     /* r mod n, i.e. Montgomerified 1 */
+    BignumInt *rrr;                    /* r^3 mod n */
+} bn_monty;
+
+static void bn_monty_init(bn_monty *m, Bignum mod)
+{
+    Bignum r, inv, rn, rr, rrr;
+    int len, j;
+
+    /*
+     * The most significant word of mod needs to be non-zero, and mod
+     * must be odd for r to be invertible.
+     */
+    assert(mod[mod[0]] != 0);
+    assert(mod[1] & 1);
+
+    len = mod[0];
+    r = bn_power_2(BIGNUM_INT_BITS * len);
+    inv = modinv(mod, r);
+    assert(inv); /* cannot fail, since mod is odd and r is a power of 2 */
+    rn = bigmod(r, mod);
+    rr = modmul(rn, rn, mod);
+    rrr = modmul(rr, rn, mod);
+    freebn(r);
+    freebn(rr);
+
+    m->len = len;
+    m->n = snewn(4 * len, BignumInt);
+    m->mninv = m->n + len;
+    m->rn = m->n + 2 * len;
+    m->rrr = m->n + 3 * len;
+    for (j = 0; j < len; j++) {
+        m->n[len - 1 - j] = mod[j + 1];
+        m->mninv[len - 1 - j] = (j < (int)inv[0] ? inv[j + 1] : 0);
+        m->rn[len - 1 - j] = 0;
+    }
+    /* Negate mninv mod r, so it's the inverse of -n rather than +n. */
+    internal_sub(m->rn, m->mninv, m->mninv, len);
+    for (j = 0; j < len; j++) {
+        m->rn[len - 1 - j] = (j < (int)rn[0] ? rn[j + 1] : 0);
+        m->rrr[len - 1 - j] = (j < (int)rrr[0] ? rrr[j + 1] : 0);
+    }
+    freebn(inv);
+    freebn(rn);
+    freebn(rrr);
+}
+
+static void bn_monty_free(bn_monty *m)
+{
+    if (m->n) {
+        smemclr(m->n, 4 * m->len * sizeof(*m->n));
+        sfree(m->n);
+        m->n = 0;
+    }
+}
+
+/*
+ * Fixed window exponentiation: BN_MONTY_WINDOW exponent bits per step,
+ * with a table of all 2^BN_MONTY_WINDOW powers of the base. Every window
+ * costs the same squarings, one multiply and a full table scan, so the
+ * running time doesn't depend on the exponent bits.
+ */
+#define BN_MONTY_WINDOW 5
+#define BN_MONTY_TABLE (1 << BN_MONTY_WINDOW)
+
+/*
+ * Size in BignumInts of the scratch space bn_monty_modpow needs.
+ */
+static int bn_monty_scratch(int len)
+{
+    return (5 + BN_MONTY_TABLE)*len + 3*len + mul_compute_scratch(len);
+}
+
+/*
+ * Copy table entry 'w' to 'sel', touching every entry.
+ */
+static void bn_monty_select(BignumInt *sel, const BignumInt *table,
+                            int w, int len)
+{
+    int i, j;
+    BignumInt mask;
+
+    for (j = 0; j < len; j++)
+        sel[j] = 0;
+    for (i = 0; i < BN_MONTY_TABLE; i++) {
+        mask = (BignumInt)0 - (BignumInt)(((unsigned)(i ^ w) - 1) >> 31);
+        for (j = 0; j < len; j++)
+            sel[j] |= table[i*len + j] & mask;
+    }
+}
+
+/*
+ * Compute x^exp mod n without allocating. On entry 'x' is a big-endian
+ * array of 2*len BignumInts holding a value below rn; on exit the top
+ * half is zero and the bottom half is the result, 0 <= result < n.
+ * 'scratch' is bn_monty_scratch(len) BignumInts and is left dirty.
+ */
+static void bn_monty_modpow(const bn_monty *m, BignumInt *x, Bignum exp,
+                            BignumInt *scratch)
+{
+    BignumInt *a, *b, *t, *sel, *table, *tmp;
+    int len, nwin, i, j, w;
+
+    len = m->len;
+    a = scratch;
+    b = scratch + 2*len;
+    sel = scratch + 4*len;
+    table = scratch + 5*len;
+    tmp = table + BN_MONTY_TABLE*len;
+
+    /*
+     * Get the base into Montgomery representation: reducing x gives
+     * x r^{-1}, and a Montgomery multiply by r^3 turns that into x r.
+     * table[i] is then base^i in the same representation.
+     */
+    monty_reduce(x, m->n, m->mninv, tmp, len);
+    internal_mul(x + len, m->rrr, a, len, tmp);
+    monty_reduce(a, m->n, m->mninv, tmp, len);
+    for (j = 0; j < len; j++) {
+        table[j] = m->rn[j];
+        table[len + j] = a[len + j];
+    }
+    for (i = 2; i < BN_MONTY_TABLE; i++) {
+        internal_mul(table + (i-1)*len, table + len, a, len, tmp);
+        monty_reduce(a, m->n, m->mninv, tmp, len);
+        for (j = 0; j < len; j++)
+            table[i*len + j] = a[len + j];
+    }
+
+    /*
+     * Main computation, top window first. The accumulator lives in the
+     * bottom half of 'a' with the top half zero, as monty_reduce
+     * leaves it.
+     */
+    nwin = ((int)exp[0] * BIGNUM_INT_BITS + BN_MONTY_WINDOW - 1) / BN_MONTY_WINDOW;
+    for (i = nwin; i-- > 0;) {
+        w = 0;
+        for (j = BN_MONTY_WINDOW; j-- > 0;)
+            w = (w << 1) | bignum_bit(exp, i*BN_MONTY_WINDOW + j);
+        bn_monty_select(sel, table, w, len);
+        if (i == nwin - 1) {
+            for (j = 0; j < len; j++) {
+                a[j] = 0;
+                a[len + j] = sel[j];
+            }
+            continue;
+        }
+        for (j = 0; j < BN_MONTY_WINDOW; j++) {
+            internal_sqr(a + len, b, len, tmp);
+            monty_reduce(b, m->n, m->mninv, tmp, len);
+            t = a;
+            a = b;
+            b = t;
+        }
+        internal_mul(a + len, sel, b, len, tmp);
+        monty_reduce(b, m->n, m->mninv, tmp, len);
+        t = a;
+        a = b;
+        b = t;
+    }
+    if (nwin == 0) {
+        for (j = 0; j < len; j++) {
+            a[j] = 0;
+            a[len + j] = m->rn[j];
+        }
+    }
+
+    /*
+     * Final monty_reduce to get back from the adjusted Montgomery
+     * representation.
+     */
+    monty_reduce(a, m->n, m->mninv, tmp, len);
+    for (j = 0; j < 2*len; j++)
+        x[j] = a[j];
+}
+
+#undef BN_MONTY_TABLE
+
 /*
  * Compute (base ^ exp) % mod. Uses the Montgomery multiplication
  * technique where possible, falling back to modpow_simple otherwise.
  */
+#define BN_SHORT_EXP_BITS 64
 static Bignum modpow(Bignum base_in, Bignum exp, Bignum mod)
 {
-    BignumInt *a, *b, *x, *n, *mninv, *scratch;
+    BignumInt *x, *scratch;
     int len, scratchlen, i, j;
-    Bignum base, base2, r, rn, inv, result;
+    Bignum base, result;
+    bn_monty m;
 
     /*
      * The most significant word of mod needs to be non-zero. It
@@ -1116,9 +1413,11 @@ static Bignum modpow(Bignum base_in, Bignum exp, Bignum mod)
 
     /*
      * mod had better be odd, or we can't do Montgomery multiplication
-     * using a power of two at all.
+     * using a power of two at all. Short (public) exponents don't pay
+     * back the Montgomery setup either, which costs a modinv and
+     * several full divisions.
      */
-    if (!(mod[1] & 1))
+    if (!(mod[1] & 1) || bignum_bitcount(exp) <= BN_SHORT_EXP_BITS)
         return modpow_simple(base_in, exp, mod);
 
     /*
@@ -1127,119 +1426,35 @@ static Bignum modpow(Bignum base_in, Bignum exp, Bignum mod)
      */
     base = bigmod(base_in, mod);
 
-    /*
-     * Compute the inverse of n mod r, for monty_reduce. (In fact we
-     * want the inverse of _minus_ n mod r, but we'll sort that out
-     * below.)
-     */
-    len = mod[0];
-    r = bn_power_2(BIGNUM_INT_BITS * len);
-    inv = modinv(mod, r);
-    assert(inv); /* cannot fail, since mod is odd and r is a power of 2 */
+    bn_monty_init(&m, mod);
+    len = m.len;
 
-    /*
-     * Multiply the base by r mod n, to get it into Montgomery
-     * representation.
-     */
-    base2 = modmul(base, r, mod);
-    freebn(base);
-    base = base2;
-
-    rn = bigmod(r, mod);               /* r mod n, i.e. Montgomerified 1 */
-
-    freebn(r);                         /* won't need this any more */
-
-    /*
-     * Set up internal arrays of the right lengths, in big-endian
-     * format, containing the base, the modulus, and the modulus's
-     * inverse.
-     */
-    n = snewn(len, BignumInt);
-    for (j = 0; j < len; j++)
-	n[len - 1 - j] = mod[j + 1];
-
-    mninv = snewn(len, BignumInt);
-    for (j = 0; j < len; j++)
-	mninv[len - 1 - j] = (j < (int)inv[0] ? inv[j + 1] : 0);
-    freebn(inv);         /* we don't need this copy of it any more */
-    /* Now negate mninv mod r, so it's the inverse of -n rather than +n. */
-    x = snewn(len, BignumInt);
-    for (j = 0; j < len; j++)
+    x = snewn(2*len, BignumInt);
+    for (j = 0; j < len; j++) {
         x[j] = 0;
-    internal_sub(x, mninv, mninv, len);
-
-    /* x = snewn(len, BignumInt); */ /* already done above */
-    for (j = 0; j < len; j++)
-	x[len - 1 - j] = (j < (int)base[0] ? base[j + 1] : 0);
+	x[2*len - 1 - j] = (j < (int)base[0] ? base[j + 1] : 0);
+    }
     freebn(base);        /* we don't need this copy of it any more */
 
-    a = snewn(2*len, BignumInt);
-    b = snewn(2*len, BignumInt);
-    for (j = 0; j < len; j++)
-	a[2*len - 1 - j] = (j < (int)rn[0] ? rn[j + 1] : 0);
-    freebn(rn);
-
     /* Scratch space for multiplies */
-    scratchlen = 3*len + mul_compute_scratch(len);
+    scratchlen = bn_monty_scratch(len);
     scratch = snewn(scratchlen, BignumInt);
 
-    /* Skip leading zero bits of exp. */
-    i = 0;
-    j = BIGNUM_INT_BITS-1;
-    while (i < (int)exp[0] && (exp[exp[0] - i] & ((BignumInt)1 << j)) == 0) {
-	j--;
-	if (j < 0) {
-	    i++;
-	    j = BIGNUM_INT_BITS-1;
-	}
-    }
-
-    /* Main computation */
-    while (i < (int)exp[0]) {
-	while (j >= 0) {
-	    internal_mul(a + len, a + len, b, len, scratch);
-            monty_reduce(b, n, mninv, scratch, len);
-	    if ((exp[exp[0] - i] & ((BignumInt)1 << j)) != 0) {
-                internal_mul(b + len, x, a, len,  scratch);
-                monty_reduce(a, n, mninv, scratch, len);
-	    } else {
-		BignumInt *t;
-		t = a;
-		a = b;
-		b = t;
-	    }
-	    j--;
-	}
-	i++;
-	j = BIGNUM_INT_BITS-1;
-    }
-
-    /*
-     * Final monty_reduce to get back from the adjusted Montgomery
-     * representation.
-     */
-    monty_reduce(a, n, mninv, scratch, len);
+    bn_monty_modpow(&m, x, exp, scratch);
 
     /* Copy result to buffer */
     result = newbn(mod[0]);
     for (i = 0; i < len; i++)
-	result[result[0] - i] = a[i + len];
+	result[result[0] - i] = x[i + len];
     while (result[0] > 1 && result[result[0]] == 0)
 	result[0]--;
 
     /* Free temporary arrays */
     smemclr(scratch, scratchlen * sizeof(*scratch));
     sfree(scratch);
-    smemclr(a, 2 * len * sizeof(*a));
-    sfree(a);
-    smemclr(b, 2 * len * sizeof(*b));
-    sfree(b);
-    smemclr(mninv, len * sizeof(*mninv));
-    sfree(mninv);
-    smemclr(n, len * sizeof(*n));
-    sfree(n);
-    smemclr(x, len * sizeof(*x));
+    smemclr(x, 2 * len * sizeof(*x));
     sfree(x);
+    bn_monty_free(&m);
 
     return result;
 }
@@ -4,12 +4,14 @@
 #define IMPL_SHA256_THUNK
 #define IMPL_SHA384_THUNK
 #define IMPL_SHA512_THUNK
+#define IMPL_HMAC_THUNK
 #define IMPL_CHACHA20_THUNK
 #define IMPL_AESGCM_THUNK
 #define IMPL_AESCBC_THUNK
 //#define IMPL_GMPRSA_THUNK
 #define IMPL_SSHRSA_THUNK
-//#define IMPL_TINF_THUNK
+#define IMPL_TINF_THUNK
+#define IMPL_CRYPTO_JOB_THUNK
 
 #include <stdio.h>
 #include <string.h>
@@ -47,6 +49,12 @@ static LPWSTR __stdcall GetCurrentDateTime()
 #define abort() { }
 #define MIN(x, y) ((x) < (y) ? (x) : (y))
 
+#ifdef IMPL_CURVE25519
+    // fixed-base comb for cf_curve25519_mul_base: 5 teeth, 51 columns
+    #define CURVE25519_COMB_TEETH 5
+    #define CURVE25519_COMB_SPACING 51
+    #define CURVE25519_COMB_POINTS ((1 << CURVE25519_COMB_TEETH) - 1)
+#endif
 #ifdef IMPL_ECC256_THUNK
     #include "ecc.h"
 #endif
@@ -61,33 +69,44 @@ typedef LPVOID (__stdcall *CoTaskMemRealloc_t)(LPVOID pv, SIZE_T cb);
 typedef void (__stdcall *CoTaskMemFree_t)(LPVOID pv);
 
 typedef struct {
-#if defined(IMPL_SSHRSA_THUNK) || defined (IMPL_GMPRSA_THUNK)
+#if defined(IMPL_SSHRSA_THUNK) || defined (IMPL_GMPRSA_THUNK) || defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK) || defined(IMPL_CRYPTO_JOB_THUNK)
     CoTaskMemAlloc_t m_CoTaskMemAlloc;
     CoTaskMemRealloc_t m_CoTaskMemRealloc;
     CoTaskMemFree_t m_CoTaskMemFree;
 #endif
+#ifdef IMPL_CURVE25519
+    uint32_t m_curve25519_comb[CURVE25519_COMB_POINTS][24]; // packed y+x, y-x, 2dxy
+#endif
 #ifdef IMPL_ECC256_THUNK
     uint64_t m_curve_p_256[NUM_ECC_DIGITS_256];
     uint64_t m_curve_b_256[NUM_ECC_DIGITS_256];
     EccPoint m_curve_G_256;
+    EccPoint m_curve_G_256_comb[ECC_COMB_POINTS];
+    EccPoint m_curve_G_256_wnaf[ECC_WNAF_POINTS];
     uint64_t m_curve_n_256[NUM_ECC_DIGITS_256];
 #endif
 #ifdef IMPL_ECC384_THUNK
     uint64_t m_curve_p_384[NUM_ECC_DIGITS_384];
     uint64_t m_curve_b_384[NUM_ECC_DIGITS_384];
     EccPoint384 m_curve_G_384;
+    EccPoint384 m_curve_G_384_comb[ECC_COMB_POINTS];
+    EccPoint384 m_curve_G_384_wnaf[ECC_WNAF_POINTS];
     uint64_t m_curve_n_384[NUM_ECC_DIGITS_384];
 #endif
 #ifdef IMPL_SHA256_THUNK
     uint32_t m_K256[64];
+    int m_sha256_impl;          // detected level + 1, filled on first init
 #endif
 #if defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK)
     uint64_t m_K512[80];
 #endif
+#ifdef IMPL_HMAC_THUNK
+    uint8_t m_hkdf_label_prefix[7]; // "tls13 "
+#endif
 #ifdef IMPL_CHACHA20_THUNK
     uint8_t m_chacha20_tau[17];  // "expand 16-byte k";
     uint8_t m_chacha20_sigma[17]; // "expand 32-byte k";
-    uint32_t m_negative_1305[17];
+    int m_chacha20_simd;        // detected level + 1, filled on first init
 #endif
 #if defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK)
     uint8_t m_S[256];
@@ -98,26 +117,45 @@ typedef struct {
     BignumInt m_bnZero[1];
     BignumInt m_bnOne[2];
 #endif
+#ifdef IMPL_TINF_THUNK
+    uint8_t m_tinf_clcidx[19];
+    uint8_t m_tinf_length_bits[30];
+    uint16_t m_tinf_length_base[30];
+    uint8_t m_tinf_dist_bits[30];
+    uint16_t m_tinf_dist_base[30];
+#endif
 } thunk_context_t;
 
+#define curve25519_comb (getContext()->m_curve25519_comb)
 #define curve_p_256 (getContext()->m_curve_p_256)
 #define curve_b_256 (getContext()->m_curve_b_256)
 #define curve_G_256 (getContext()->m_curve_G_256)
+#define curve_G_256_comb (getContext()->m_curve_G_256_comb)
+#define curve_G_256_wnaf (getContext()->m_curve_G_256_wnaf)
 #define curve_n_256 (getContext()->m_curve_n_256)
 #define curve_p_384 (getContext()->m_curve_p_384)
 #define curve_b_384 (getContext()->m_curve_b_384)
 #define curve_G_384 (getContext()->m_curve_G_384)
+#define curve_G_384_comb (getContext()->m_curve_G_384_comb)
+#define curve_G_384_wnaf (getContext()->m_curve_G_384_wnaf)
 #define curve_n_384 (getContext()->m_curve_n_384)
 #define K256 (getContext()->m_K256)
+#define sha256_impl (getContext()->m_sha256_impl)
 #define K512 (getContext()->m_K512)
+#define hkdf_label_prefix (getContext()->m_hkdf_label_prefix)
 #define chacha20_tau (getContext()->m_chacha20_tau)
 #define chacha20_sigma (getContext()->m_chacha20_sigma)
-#define negative_1305 (getContext()->m_negative_1305)
+#define chacha20_simd (getContext()->m_chacha20_simd)
 #define S (getContext()->m_S)
 #define Rcon (getContext()->m_Rcon)
 #define S_inv (getContext()->m_S_inv)
 #define bnZero (getContext()->m_bnZero)
 #define bnOne (getContext()->m_bnOne)
+#define tinf_clcidx (getContext()->m_tinf_clcidx)
+#define tinf_length_bits (getContext()->m_tinf_length_bits)
+#define tinf_length_base (getContext()->m_tinf_length_base)
+#define tinf_dist_bits (getContext()->m_tinf_dist_bits)
+#define tinf_dist_base (getContext()->m_tinf_dist_base)
 
 #pragma code_seg(push, r1, ".mythunk")
 
@@ -135,7 +173,8 @@ static int beginOfThunk(int i) {
 
 API_NAKED static thunk_context_t *getContext() {
 #ifdef _WIN64
-    return 0;
+    // x64 addresses beginOfThunk RIP-relative, so this holds wherever the thunk is copied
+    return *(thunk_context_t * volatile *)beginOfThunk;
 #else
     __asm {
         call    _next
@@ -151,7 +190,7 @@ _next:
 
 API_NAKED static uint8_t *getThunk() {
 #ifdef _WIN64
-    return 0;
+    return (uint8_t *)beginOfThunk;
 #else
     __asm {
         call    _next
@@ -172,7 +211,7 @@ extern "C" {
 
 #include "cf_inlines.h"
 #include "win32_crt.cpp"
-#if defined(IMPL_CURVE25519) || defined(IMPL_ECC256_THUNK) || defined(IMPL_ECC384_THUNK) || defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK)
+#if defined(IMPL_CURVE25519) || defined(IMPL_ECC256_THUNK) || defined(IMPL_ECC384_THUNK) || defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK) || defined(IMPL_CHACHA20_THUNK)
     #include "win32_crt_float.cpp"
 #endif
 #ifdef IMPL_CURVE25519
@@ -191,6 +230,9 @@ extern "C" {
 #if defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK)
     #include "sha512.c"
 #endif
+#ifdef IMPL_HMAC_THUNK
+    #include "hmac.c"
+#endif
 #ifdef IMPL_CHACHA20_THUNK
     #include "chacha20.c"
     #include "poly1305.c"
@@ -214,6 +256,9 @@ extern "C" {
 #ifdef IMPL_TINF_THUNK
     #include "tinflate.c"
 #endif
+#ifdef IMPL_CRYPTO_JOB_THUNK
+    #include "cryptojob.c"
+#endif
 
 #ifdef __cplusplus
 }
@@ -257,6 +302,13 @@ static int endOfThunk() { return 0; }
     typedef void (*cf_sha512_update_t)(cf_sha512_context *ctx, const void *data, size_t nbytes);
     typedef void (*cf_sha512_digest_final_t)(cf_sha512_context *ctx, uint8_t hash[CF_SHA512_HASHSZ]);
 #endif
+#ifdef IMPL_HMAC_THUNK
+    typedef int (*cf_hmac_sha2_init_t)(cf_hmac_sha2_ctx *ctx, uint32_t hashsz, const uint8_t *key, size_t nkey);
+    typedef void (*cf_hmac_sha2_t)(const cf_hmac_sha2_ctx *ctx, const void *data, size_t ndata, uint8_t *out);
+    typedef int (*cf_hkdf_expand_label_t)(uint32_t hashsz, const uint8_t *secret, size_t nsecret,
+                                          const char *label, size_t nlabel, const uint8_t *context, size_t ncontext,
+                                          uint8_t *out, size_t nout);
+#endif
 #ifdef IMPL_CHACHA20_THUNK
     typedef void (*cf_chacha20poly1305_encrypt_t)(const uint8_t key[32], const uint8_t nonce[12], const uint8_t *header, size_t nheader,
                                                   const uint8_t *plaintext, size_t nbytes, uint8_t *ciphertext, uint8_t tag[16]);
@@ -275,11 +327,33 @@ static int endOfThunk() { return 0; }
     typedef int (*cf_aescbc_decrypt_t)(uint8_t *m, const uint8_t *c, const size_t clen, 
                                        const uint8_t *npub, const uint8_t *k, const size_t klen);
 #endif
+#if defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK)
+    typedef void *(*cf_aes_ctx_init_t)(const uint8_t *k, const size_t klen);
+    typedef void (*cf_aes_ctx_free_t)(void *ctx);
+    typedef void (*cf_aesgcm_seal_t)(void *ctx, uint8_t *c, uint8_t *mac, const uint8_t *m, const size_t mlen, 
+                                     const uint8_t *ad, const size_t adlen, const uint8_t *npub);
+    typedef int (*cf_aesgcm_open_t)(void *ctx, uint8_t *m, const uint8_t *c, const size_t clen, const uint8_t *mac, 
+                                    const uint8_t *ad, const size_t adlen, const uint8_t *npub);
+    typedef void (*cf_aescbc_seal_t)(void *ctx, uint8_t *c, const uint8_t *m, const size_t mlen, const uint8_t *npub);
+    typedef void (*cf_aescbc_open_t)(void *ctx, uint8_t *m, const uint8_t *c, const size_t clen, const uint8_t *npub);
+#endif
 #if defined(IMPL_GMPRSA_THUNK) || defined(IMPL_SSHRSA_THUNK)
     typedef void (*rsa_modexp_t)(const uint32_t maxbytes, const uint8_t *base_in, const uint8_t *exp_in, const uint8_t *mod_in, uint8_t *ret_out);
     typedef void (*rsa_crt_modexp_t)(const uint32_t maxbytes, const uint8_t *base_in, const uint8_t *exp_in, const uint8_t *mod_in, 
                                      const uint8_t *p_in, const uint8_t *q_in, const uint8_t *iqmp_in, uint8_t *ret_out);
 #endif
+#ifdef IMPL_SSHRSA_THUNK
+    typedef void *(*rsa_crt_ctx_init_t)(const uint32_t maxbytes, const uint8_t *exp_in, const uint8_t *mod_in,
+                                        const uint8_t *p_in, const uint8_t *q_in, const uint8_t *iqmp_in);
+    typedef void (*rsa_crt_ctx_free_t)(void *ctx);
+    typedef int (*rsa_crt_ctx_modexp_t)(void *ctx, const uint8_t *base_in, uint8_t *ret_out);
+#endif
+#ifdef IMPL_TINF_THUNK
+    typedef int (*tinf_uncompress_t)(void *dest, unsigned int *destLen, const void *source, unsigned int sourceLen);
+#endif
+#ifdef IMPL_CRYPTO_JOB_THUNK
+    typedef DWORD (__stdcall *crypto_job_run_t)(void *param);
+#endif
 
 typedef struct _RSA_PUBLIC_KEY_XX
 {
@@ -289,19 +363,10 @@ typedef struct _RSA_PUBLIC_KEY_XX
     BYTE RsaModulus[ANYSIZE_ARRAY];
 } RSA_PUBLIC_KEY_XX;
 
-void __cdecl main()
+static thunk_context_t *initContext()
 {
-#ifdef IMPL_SHA256_THUNK
-    printf("sizeof(cf_sha256_context)=%d\n", sizeof cf_sha256_context);
-#endif
-#if defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK)
-    printf("sizeof(cf_sha512_context)=%d\n", sizeof cf_sha512_context);
-#endif
-#ifdef IMPL_CHACHA20_THUNK
-    printf("sizeof(g_chacha20_tau)=%d\n", sizeof g_chacha20_tau);
-#endif
     static thunk_context_t ctx;
-#if defined(IMPL_SSHRSA_THUNK) || defined (IMPL_GMPRSA_THUNK)
+#if defined(IMPL_SSHRSA_THUNK) || defined (IMPL_GMPRSA_THUNK) || defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK) || defined(IMPL_CRYPTO_JOB_THUNK)
     ctx.m_CoTaskMemAlloc = (CoTaskMemAlloc_t)GetProcAddress(GetModuleHandle(L"ole32"), "CoTaskMemAlloc");
     ctx.m_CoTaskMemRealloc = (CoTaskMemRealloc_t)GetProcAddress(GetModuleHandle(L"ole32"), "CoTaskMemRealloc");
     ctx.m_CoTaskMemFree = (CoTaskMemFree_t)GetProcAddress(GetModuleHandle(L"ole32"), "CoTaskMemFree");
@@ -324,10 +389,12 @@ void __cdecl main()
 #if defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK)
     memcpy(&ctx.m_K512, &g_K512, sizeof g_K512);
 #endif
+#ifdef IMPL_HMAC_THUNK
+    memcpy(&ctx.m_hkdf_label_prefix, &g_hkdf_label_prefix, sizeof g_hkdf_label_prefix);
+#endif
 #ifdef IMPL_CHACHA20_THUNK
     memcpy(&ctx.m_chacha20_tau, &g_chacha20_tau, sizeof g_chacha20_tau);
     memcpy(&ctx.m_chacha20_sigma, &g_chacha20_sigma, sizeof g_chacha20_sigma);
-    memcpy(&ctx.m_negative_1305, &g_negative_1305, sizeof g_negative_1305);
 #endif
 #if defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK)
     memcpy(&ctx.m_S, &g_S, sizeof g_S);
@@ -338,11 +405,48 @@ void __cdecl main()
     memcpy(&ctx.m_bnZero, &g_bnZero, sizeof g_bnZero);
     memcpy(&ctx.m_bnOne, &g_bnOne, sizeof g_bnOne);
 #endif
+#ifdef IMPL_TINF_THUNK
+    memcpy(&ctx.m_tinf_clcidx, &g_tinf_clcidx, sizeof g_tinf_clcidx);
+    memcpy(&ctx.m_tinf_length_bits, &g_tinf_length_bits, sizeof g_tinf_length_bits);
+    memcpy(&ctx.m_tinf_length_base, &g_tinf_length_base, sizeof g_tinf_length_base);
+    memcpy(&ctx.m_tinf_dist_bits, &g_tinf_dist_bits, sizeof g_tinf_dist_bits);
+    memcpy(&ctx.m_tinf_dist_base, &g_tinf_dist_base, sizeof g_tinf_dist_base);
+#endif
 
     CoInitialize(0);
     DWORD dwDummy;
     VirtualProtect(beginOfThunk, 1024, PAGE_EXECUTE_READWRITE, &dwDummy);
     ((void **)beginOfThunk)[0] = &ctx;
+#ifdef IMPL_CURVE25519
+    cf_curve25519_comb_init();
+#endif
+#ifdef IMPL_ECC256_THUNK
+    ecc_comb_init256();
+    ecc_wnaf_init256();
+#endif
+#ifdef IMPL_ECC384_THUNK
+    ecc_comb_init384();
+    ecc_wnaf_init384();
+#endif
+    return &ctx;
+}
+
+#ifndef THUNKS_NO_MAIN
+void __cdecl main()
+{
+#ifdef IMPL_SHA256_THUNK
+    printf("sizeof(cf_sha256_context)=%d\n", sizeof cf_sha256_context);
+#endif
+#if defined(IMPL_SHA384_THUNK) || defined(IMPL_SHA512_THUNK)
+    printf("sizeof(cf_sha512_context)=%d\n", sizeof cf_sha512_context);
+#endif
+#ifdef IMPL_HMAC_THUNK
+    printf("sizeof(cf_hmac_sha2_ctx)=%d\n", sizeof cf_hmac_sha2_ctx);
+#endif
+#ifdef IMPL_CHACHA20_THUNK
+    printf("sizeof(g_chacha20_tau)=%d\n", sizeof g_chacha20_tau);
+#endif
+    thunk_context_t &ctx = *initContext();
 
     size_t thunkSize = THUNK_SIZE;
     while(thunkSize > 4 && ((uint8_t *)beginOfThunk)[thunkSize - 4] == 0)
@@ -375,6 +479,11 @@ void __cdecl main()
     DECLARE_PFN(cf_sha512_update_t, cf_sha512_update);
     DECLARE_PFN(cf_sha512_digest_final_t, cf_sha512_digest_final);
 #endif
+#ifdef IMPL_HMAC_THUNK
+    DECLARE_PFN(cf_hmac_sha2_init_t, cf_hmac_sha2_init);
+    DECLARE_PFN(cf_hmac_sha2_t, cf_hmac_sha2);
+    DECLARE_PFN(cf_hkdf_expand_label_t, cf_hkdf_expand_label);
+#endif
 #ifdef IMPL_CHACHA20_THUNK
     DECLARE_PFN(cf_chacha20poly1305_encrypt_t, cf_chacha20poly1305_encrypt);
     DECLARE_PFN(cf_chacha20poly1305_decrypt_t, cf_chacha20poly1305_decrypt);
@@ -387,12 +496,28 @@ void __cdecl main()
     DECLARE_PFN(cf_aescbc_encrypt_t, cf_aescbc_encrypt);
     DECLARE_PFN(cf_aescbc_decrypt_t, cf_aescbc_decrypt);
 #endif
+#if defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK)
+    DECLARE_PFN(cf_aes_ctx_init_t, cf_aes_ctx_init);
+    DECLARE_PFN(cf_aes_ctx_free_t, cf_aes_ctx_free);
+    DECLARE_PFN(cf_aesgcm_seal_t, cf_aesgcm_seal);
+    DECLARE_PFN(cf_aesgcm_open_t, cf_aesgcm_open);
+#endif
 #ifdef IMPL_GMPRSA_THUNK
     DECLARE_PFN(rsa_modexp_t, gmp_rsa_public_encrypt);
 #endif
 #ifdef IMPL_SSHRSA_THUNK
     DECLARE_PFN(rsa_modexp_t, rsa_modexp);
     DECLARE_PFN(rsa_crt_modexp_t, rsa_crt_modexp);
+    DECLARE_PFN(rsa_crt_ctx_init_t, rsa_crt_ctx_init);
+    DECLARE_PFN(rsa_crt_ctx_free_t, rsa_crt_ctx_free);
+    DECLARE_PFN(rsa_crt_ctx_modexp_t, rsa_crt_ctx_modexp);
+#endif
+#ifdef IMPL_TINF_THUNK
+    DECLARE_PFN(tinf_uncompress_t, tinf_uncompress);
+    DECLARE_PFN(tinf_uncompress_t, tinf_zlib_uncompress);
+#endif
+#ifdef IMPL_CRYPTO_JOB_THUNK
+    DECLARE_PFN(crypto_job_run_t, crypto_job_run);
 #endif
 
 #ifdef IMPL_ECC256_THUNK
@@ -421,6 +546,14 @@ void __cdecl main()
     pfn_cf_sha384_init(&sha384_ctx);
     pfn_cf_sha384_update(&sha384_ctx, "123456", 6);
     pfn_cf_sha384_digest_final(&sha384_ctx, hash384);
+#endif
+#ifdef IMPL_HMAC_THUNK
+    cf_hmac_sha2_ctx hmac_ctx = { 0 };
+    uint8_t hmac256[CF_SHA256_HASHSZ] = { 0 };
+    uint8_t hkdf384[CF_SHA384_HASHSZ] = { 0 };
+    pfn_cf_hmac_sha2_init(&hmac_ctx, CF_SHA256_HASHSZ, (const uint8_t *)"key", 3);
+    pfn_cf_hmac_sha2(&hmac_ctx, "The quick brown fox jumps over the lazy dog", 43, hmac256);
+    pfn_cf_hkdf_expand_label(CF_SHA384_HASHSZ, hash384, sizeof hash384, "derived", 7, hash384, sizeof hash384, hkdf384, sizeof hkdf384);
 #endif
     uint8_t key[32] = { 1, 2, 3, 4 };
     uint8_t nonce[12] = { 1, 2, 3, 4 };
@@ -440,6 +573,10 @@ void __cdecl main()
     uint8_t *lbuf = (uint8_t *)malloc(lsize + AESGCM_TAG_SIZE);
     mac = lbuf + lsize;
     pfn_cf_aesgcm_encrypt(lbuf, mac, lbuf, lsize, aad, sizeof aad, nonce, key, sizeof key);
+    void *aes_ctx = pfn_cf_aes_ctx_init(key, sizeof key);
+    pfn_cf_aesgcm_seal(aes_ctx, lbuf, mac, lbuf, lsize, aad, sizeof aad, nonce);
+    pfn_cf_aesgcm_open(aes_ctx, lbuf, lbuf, lsize, mac, aad, sizeof aad, nonce);
+    pfn_cf_aes_ctx_free(aes_ctx);
 #endif
 #ifdef IMPL_AESCBC_THUNK
     uint8_t plaintext_padded[64] = "this is a test 1234567890 this is a test 12345678paddingpadding";
@@ -472,11 +609,50 @@ void __cdecl main()
     e[BUFFER_SIZE-1] = 2;
     from[BUFFER_SIZE-1] = 123;
     pfn_rsa_modexp(BUFFER_SIZE, from, e, m, to);
+    // 65^2753 mod 61*53 = 588
+    uint8_t d[BUFFER_SIZE] = { 0 }, p[BUFFER_SIZE / 2] = { 0 }, q[BUFFER_SIZE / 2] = { 0 }, iqmp[BUFFER_SIZE / 2] = { 0 };
+    m[BUFFER_SIZE-2] = 3233 >> 8, m[BUFFER_SIZE-1] = 3233 & 0xFF;
+    d[BUFFER_SIZE-2] = 2753 >> 8, d[BUFFER_SIZE-1] = 2753 & 0xFF;
+    p[BUFFER_SIZE/2-1] = 61, q[BUFFER_SIZE/2-1] = 53, iqmp[BUFFER_SIZE/2-1] = 38;
+    from[BUFFER_SIZE-1] = 65;
+    void *rsa_ctx = pfn_rsa_crt_ctx_init(BUFFER_SIZE, d, m, p, q, iqmp);
+    pfn_rsa_crt_ctx_modexp(rsa_ctx, from, to);
+    pfn_rsa_crt_modexp(BUFFER_SIZE, from, d, m, p, q, iqmp, to2);
+    pfn_rsa_crt_ctx_free(rsa_ctx);
+    }
+#endif
+#ifdef IMPL_TINF_THUNK
+    {
+    // zlib.compress(b"hello hello hello")
+    uint8_t src[] = { 0x78, 0x9C, 0xCB, 0x48, 0xCD, 0xC9, 0xC9, 0x57, 0xC8, 0x40, 0x90, 0x00, 0x3A, 0x2E, 0x06, 0x7D };
+    uint8_t dst[32] = { 0 };
+    unsigned int dstLen = sizeof dst;
+    int res = pfn_tinf_zlib_uncompress(dst, &dstLen, src, sizeof src);
+    printf("tinf_zlib_uncompress=%d, dstLen=%d\n", res, dstLen);
+    }
+#endif
+#if defined(IMPL_CRYPTO_JOB_THUNK) && defined(IMPL_ECC256_THUNK)
+    {
+    // run synchronously, completion message lands in this thread's queue
+    uint8_t sig256[2*ECC_BYTES_256] = { 0 };
+    uint64_t k256[NUM_ECC_DIGITS_256] = { 0 };
+    crypto_job *job = (crypto_job *)CoTaskMemAlloc(sizeof(crypto_job));
+    memset(job, 0, sizeof *job);
+    _getRandomNumber256(k256);
+    job->op = CRYPTO_JOB_ECDSA_SIGN256;
+    job->size = ECC_BYTES_256;
+    job->nalloc = sizeof(crypto_job);
+    job->msg = WM_NULL;
+    job->post_message = PostMessageW;
+    job->args[0] = privkey, job->args[1] = secret, job->args[2] = (uint8_t *)k256, job->args[3] = sig256;
+    pfn_crypto_job_run(job);
+    printf("crypto_job_run=%d, state=%d\n", job->result, job->state);
+    CoTaskMemFree(job);
     }
 #endif
 
-    // init offsets at beginning of thunk
-    int idx = 1;
+    // init offsets at beginning of thunk, right after context pointer
+    int idx = sizeof(void *) / sizeof(int);
 #ifdef IMPL_CURVE25519
     ((int *)hThunk)[idx++] = ((uint8_t *)cf_curve25519_mul - (uint8_t *)beginOfThunk);
     ((int *)hThunk)[idx++] = ((uint8_t *)cf_curve25519_mul_base - (uint8_t *)beginOfThunk);
@@ -528,14 +704,43 @@ void __cdecl main()
 #ifdef IMPL_SSHRSA_THUNK
     ((int *)hThunk)[idx++] = ((uint8_t *)rsa_modexp - (uint8_t *)beginOfThunk);
     ((int *)hThunk)[idx++] = ((uint8_t *)rsa_crt_modexp - (uint8_t *)beginOfThunk);    
+#endif
+    // exports added after the first release go below, in UcsThunkPfnIndexEnum order
+#if defined(IMPL_AESGCM_THUNK) || defined(IMPL_AESCBC_THUNK)
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_aes_ctx_init - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_aes_ctx_free - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_aesgcm_seal - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_aesgcm_open - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_aescbc_seal - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_aescbc_open - (uint8_t *)beginOfThunk);
+#endif
+#ifdef IMPL_SSHRSA_THUNK
+    ((int *)hThunk)[idx++] = ((uint8_t *)rsa_crt_ctx_init - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)rsa_crt_ctx_free - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)rsa_crt_ctx_modexp - (uint8_t *)beginOfThunk);
+#endif
+#ifdef IMPL_HMAC_THUNK
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_hmac_sha2_init - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_hmac_sha2 - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)cf_hkdf_expand_label - (uint8_t *)beginOfThunk);
 #endif
 #ifdef IMPL_TINF_THUNK
     ((int *)hThunk)[idx++] = ((uint8_t *)tinf_uncompress - (uint8_t *)beginOfThunk);
+    ((int *)hThunk)[idx++] = ((uint8_t *)tinf_zlib_uncompress - (uint8_t *)beginOfThunk);
+#endif
+#ifdef IMPL_CRYPTO_JOB_THUNK
+    ((int *)hThunk)[idx++] = ((uint8_t *)crypto_job_run - (uint8_t *)beginOfThunk);
 #endif
     printf("i=%d, needed=0x%02X, allocated=0x%02X\n", idx, (idx*4 + 15) & -16, ((uint8_t *)getContext) - ((uint8_t *)beginOfThunk));
 
     WCHAR szBuffer[100000] = { 0 }, *pBuffer;
     DWORD dwBufSize, i, j, l;
+#ifdef IMPL_SHA256_THUNK
+    ctx.m_sha256_impl = 0; // detected on target machine
+#endif
+#ifdef IMPL_CHACHA20_THUNK
+    ctx.m_chacha20_simd = 0;
+#endif
     dwBufSize = _countof(szBuffer);
     CryptBinaryToString((BYTE *)&ctx, sizeof ctx, CRYPT_STRING_BASE64, szBuffer, &dwBufSize);
     for(i = 0, j = 0; (szBuffer[j] = szBuffer[i]) != 0; ) {
@@ -566,6 +771,7 @@ void __cdecl main()
     }
     printf("Private Const STR_THUNK%d                As String = \"%S\" ' %d, %S\n", l / 14 + 1, pBuffer, thunkSize, GetCurrentDateTime());
 }
+#endif
 
 #if defined(IMPL_ECC256_THUNK)
 static int _getRandomNumber256(uint64_t *p_vli)
@@ -61,6 +61,40 @@ struct tinf_data {
 	struct tinf_tree dtree; /* Distance tree */
 };
 
+/* -- Constant tables (copied to thunk context, see thunks.cpp) -- */
+
+/* Special ordering of code length codes */
+static const unsigned char g_tinf_clcidx[19] = {
+	16, 17, 18, 0,  8, 7,  9, 6, 10, 5,
+	11,  4, 12, 3, 13, 2, 14, 1, 15
+};
+
+/* Extra bits and base tables for length codes */
+static const unsigned char g_tinf_length_bits[30] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+	1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+	4, 4, 4, 4, 5, 5, 5, 5, 0, 127
+};
+
+static const unsigned short g_tinf_length_base[30] = {
+	 3,  4,  5,   6,   7,   8,   9,  10,  11,  13,
+	15, 17, 19,  23,  27,  31,  35,  43,  51,  59,
+	67, 83, 99, 115, 131, 163, 195, 227, 258,   0
+};
+
+/* Extra bits and base tables for distance codes */
+static const unsigned char g_tinf_dist_bits[30] = {
+	0, 0,  0,  0,  1,  1,  2,  2,  3,  3,
+	4, 4,  5,  5,  6,  6,  7,  7,  8,  8,
+	9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+static const unsigned short g_tinf_dist_base[30] = {
+	   1,    2,    3,    4,    5,    7,    9,    13,    17,    25,
+	  33,   49,   65,   97,  129,  193,  257,   385,   513,   769,
+	1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+
 /* -- Utility functions -- */
 
 static unsigned int read_le16(const unsigned char *p)
@@ -271,12 +305,6 @@ static int tinf_decode_trees(struct tinf_data *d, struct tinf_tree *lt,
 {
 	unsigned char lengths[288 + 32];
 
-	/* Special ordering of code length codes */
-	static const unsigned char clcidx[19] = {
-		16, 17, 18, 0,  8, 7,  9, 6, 10, 5,
-		11,  4, 12, 3, 13, 2, 14, 1, 15
-	};
-
 	unsigned int hlit, hdist, hclen;
 	unsigned int i, num, length;
 	int res;
@@ -312,7 +340,7 @@ static int tinf_decode_trees(struct tinf_data *d, struct tinf_tree *lt,
 		/* Get 3 bits code length (0-7) */
 		unsigned int clen = tinf_getbits(d, 3);
 
-		lengths[clcidx[i]] = clen;
+		lengths[tinf_clcidx[i]] = clen;
 	}
 
 	/* Build code length tree (in literal/length tree to save space) */
@@ -396,32 +424,6 @@ static int tinf_decode_trees(struct tinf_data *d, struct tinf_tree *lt,
 static int tinf_inflate_block_data(struct tinf_data *d, struct tinf_tree *lt,
                                    struct tinf_tree *dt)
 {
-	/* Extra bits and base tables for length codes */
-	static const unsigned char length_bits[30] = {
-		0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
-		1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
-		4, 4, 4, 4, 5, 5, 5, 5, 0, 127
-	};
-
-	static const unsigned short length_base[30] = {
-		 3,  4,  5,   6,   7,   8,   9,  10,  11,  13,
-		15, 17, 19,  23,  27,  31,  35,  43,  51,  59,
-		67, 83, 99, 115, 131, 163, 195, 227, 258,   0
-	};
-
-	/* Extra bits and base tables for distance codes */
-	static const unsigned char dist_bits[30] = {
-		0, 0,  0,  0,  1,  1,  2,  2,  3,  3,
-		4, 4,  5,  5,  6,  6,  7,  7,  8,  8,
-		9, 9, 10, 10, 11, 11, 12, 12, 13, 13
-	};
-
-	static const unsigned short dist_base[30] = {
-		   1,    2,    3,    4,    5,    7,    9,    13,    17,    25,
-		  33,   49,   65,   97,  129,  193,  257,   385,   513,   769,
-		1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
-	};
-
 	for (;;) {
 		int sym = tinf_decode_symbol(d, lt);
 
@@ -453,8 +455,8 @@ static int tinf_inflate_block_data(struct tinf_data *d, struct tinf_tree *lt,
 			sym -= 257;
 
 			/* Possibly get more bits from length code */
-			length = tinf_getbits_base(d, length_bits[sym],
-			                           length_base[sym]);
+			length = tinf_getbits_base(d, tinf_length_bits[sym],
+			                           tinf_length_base[sym]);
 
 			dist = tinf_decode_symbol(d, dt);
 
@@ -464,8 +466,8 @@ static int tinf_inflate_block_data(struct tinf_data *d, struct tinf_tree *lt,
 			}
 
 			/* Possibly get more bits from distance code */
-			offs = tinf_getbits_base(d, dist_bits[dist],
-			                         dist_base[dist]);
+			offs = tinf_getbits_base(d, tinf_dist_bits[dist],
+			                         tinf_dist_base[dist]);
 
 			if (offs > d->dest - d->dest_start) {
 				return TINF_DATA_ERROR;
@@ -560,15 +562,16 @@ void tinf_init(void)
 }
 
 /* Inflate stream from source to dest */
-int tinf_uncompress(void *dest, unsigned int *destLen,
-                    const void *source, unsigned int sourceLen)
+/* Inflate stream, on success sourceLen is set to number of bytes consumed */
+static int tinf_uncompress_stream(void *dest, unsigned int *destLen,
+                                  const void *source, unsigned int *sourceLen)
 {
 	struct tinf_data d;
 	int bfinal;
 
 	/* Initialise data */
 	d.source = (const unsigned char *) source;
-	d.source_end = d.source + sourceLen;
+	d.source_end = d.source + *sourceLen;
 	d.tag = 0;
 	d.bitcount = 0;
 	d.overflow = 0;
@@ -618,6 +621,82 @@ int tinf_uncompress(void *dest, unsigned int *destLen,
 
 	*destLen = d.dest - d.dest_start;
 
+	/* Whole bytes still in tag were read ahead but not consumed */
+	*sourceLen = (d.source - (const unsigned char *) source) - d.bitcount / 8;
+
+	return TINF_OK;
+}
+
+int tinf_uncompress(void *dest, unsigned int *destLen,
+                    const void *source, unsigned int sourceLen)
+{
+	return tinf_uncompress_stream(dest, destLen, source, &sourceLen);
+}
+
+static unsigned int read_be32(const unsigned char *p)
+{
+	return ((unsigned int) p[0] << 24)
+	     | ((unsigned int) p[1] << 16)
+	     | ((unsigned int) p[2] << 8)
+	     | ((unsigned int) p[3]);
+}
+
+static unsigned int tinf_adler32(const void *data, unsigned int length)
+{
+	const unsigned char *buf = (const unsigned char *) data;
+	unsigned int s1 = 1;
+	unsigned int s2 = 0;
+
+	while (length > 0) {
+		/* 5552 is the largest n so that 255n(n+1)/2 + (n+1)(65520) < 2^32 */
+		unsigned int k = length < 5552 ? length : 5552;
+
+		length -= k;
+		while (k-- > 0) {
+			s1 += *buf++;
+			s2 += s1;
+		}
+		s1 %= 65521;
+		s2 %= 65521;
+	}
+
+	return (s2 << 16) | s1;
+}
+
+/* Inflate zlib (RFC 1950) stream from source to dest */
+int tinf_zlib_uncompress(void *dest, unsigned int *destLen,
+                         const void *source, unsigned int sourceLen)
+{
+	const unsigned char *src = (const unsigned char *) source;
+	unsigned int cmf, flg, dlen;
+
+	if (sourceLen < 6) {
+		return TINF_DATA_ERROR;
+	}
+
+	cmf = src[0];
+	flg = src[1];
+
+	/* Check header: checksum, method deflate, window <= 32K, no preset dictionary */
+	if ((256 * cmf + flg) % 31 || (cmf & 0x0F) != 8 || (cmf >> 4) > 7 || (flg & 0x20)) {
+		return TINF_DATA_ERROR;
+	}
+
+	dlen = sourceLen - 6;
+
+	if (tinf_uncompress_stream(dest, destLen, src + 2, &dlen) != TINF_OK) {
+		return TINF_DATA_ERROR;
+	}
+
+	/* Deflate stream has to end right before adler32 trailer */
+	if (dlen != sourceLen - 6) {
+		return TINF_DATA_ERROR;
+	}
+
+	if (read_be32(&src[sourceLen - 4]) != tinf_adler32(dest, *destLen)) {
+		return TINF_DATA_ERROR;
+	}
+
 	return TINF_OK;
 }
 
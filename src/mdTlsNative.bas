@@ -16,6 +16,7 @@ Private Const MODULE_NAME As String = "mdTlsNative"
 #Const ImplUseShared = (ASYNCSOCKET_USE_SHARED <> 0)
 #Const ImplUseDebugLog = (USE_DEBUG_LOG <> 0)
 #Const ImplCaptureTraffic = CLng(ASYNCSOCKET_CAPTURE_TRAFFIC) '--- bitmask: 1 - traffic
+#Const ImplUseStats = (ASYNCSOCKET_USE_STATS <> 0)
 
 '=========================================================================
 ' API
@@ -328,6 +329,7 @@ End Type
 Private Const STR_VL_ALERTS                 As String = "0|Close notify|10|Unexpected message|20|Bad record mac|21|Decryption failed|22|Record overflow|30|Decompression failure|40|Handshake failure|41|No certificate|42|Bad certificate|43|Unsupported certificate|44|Certificate revoked|45|Certificate expired|46|Certificate unknown|47|Illegal parameter|48|Unknown certificate authority|50|Decode error|51|Decrypt error|70|Protocol version|71|Insufficient security|80|Internal error|90|User canceled|100|No renegotiation|109|Missing extension|110|Unsupported expension|112|Unrecognized name|116|Certificate required|120|No application protocol"
 Private Const STR_UNKNOWN                   As String = "Unknown (%1)"
 Private Const STR_FORMAT_ALERT              As String = "%1."
+Private Const STR_STATS_NAMES               As String = "HandshakeTime|KeyExchangeTime|CertValidationTime|SignatureTime|BulkCryptoTime|RecordsIn|RecordsOut|BytesIn|BytesOut|ReceiveCalls|SendCalls|Reallocations|SendQueueHighWater"
 '--- errors
 Private Const ERR_UNEXPECTED_RESULT         As String = "Unexpected result from %1 (%2)"
 Private Const ERR_CONNECTION_CLOSED         As String = "Connection closed"
@@ -390,6 +392,29 @@ Private Enum UcsOsVersionEnum
 End Enum
 #End If
 
+#If ImplUseStats Then
+Public Enum UcsTlsStatsEnum '--- sync w/ STR_STATS_NAMES, times (in seconds) go before ucsTlsStatRecordsIn
+    ucsTlsStatHandshakeTime
+    ucsTlsStatKeyExchangeTime
+    ucsTlsStatCertValidationTime
+    ucsTlsStatSignatureTime
+    ucsTlsStatBulkCryptoTime
+    ucsTlsStatRecordsIn
+    ucsTlsStatRecordsOut
+    ucsTlsStatBytesIn
+    ucsTlsStatBytesOut
+    ucsTlsStatReceiveCalls
+    ucsTlsStatSendCalls
+    ucsTlsStatReallocations
+    ucsTlsStatSendQueueHighWater                    '--- max instead of sum
+    [_ucsTlsStatMax]
+End Enum
+
+Public Type UcsTlsStats
+    Value(0 To [_ucsTlsStatMax] - 1) As Double
+End Type
+#End If
+
 Public Type UcsTlsContext
     '--- config
     IsServer            As Boolean
@@ -425,6 +450,9 @@ Public Type UcsTlsContext
 #If ImplCaptureTraffic <> 0 Then
     TrafficDump         As Collection
 #End If
+#If ImplUseStats Then
+    Stats               As UcsTlsStats
+#End If
 End Type
 
 Private Type UcsKeyInfo
@@ -434,6 +462,10 @@ Private Type UcsKeyInfo
 End Type
 
 Public g_oRequestSocket             As Object
+Public g_cCertCache                 As Collection
+#If ImplUseStats Then
+    Private m_uStats                As UcsTlsStats
+#End If
 
 '=========================================================================
 ' Properties
@@ -455,6 +487,11 @@ Public Property Get TlsIsShutdown(uCtx As UcsTlsContext) As Boolean
     TlsIsShutdown = (uCtx.State = ucsTlsStateShutdown)
 End Property
 
+Public Property Get TlsIsAsyncPending(uCtx As UcsTlsContext) As Boolean
+    '--- see TlsSetAsyncNotify
+    TlsIsAsyncPending = False
+End Property
+
 '=========================================================================
 ' TLS support
 '=========================================================================
@@ -810,6 +847,15 @@ EH:
     Resume QH
 End Function
 
+Public Function TlsSetEarlyData(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long) As Boolean
+    '--- 0-RTT not supported, caller sends data after handshake
+    TlsSetEarlyData = False
+End Function
+
+Public Sub TlsSetAsyncNotify(uCtx As UcsTlsContext, ByVal hWnd As Long, ByVal MsgID As Long, ByVal wParam As Long, ByVal lParam As Long)
+    '--- Schannel signs inline, TlsHandshake never waits on a worker thread
+End Sub
+
 Public Function TlsReceive(uCtx As UcsTlsContext, baInput() As Byte, ByVal lSize As Long, baPlainText() As Byte, lPos As Long, baOutput() As Byte, lOutputPos As Long) As Boolean
     Const FUNC_NAME     As String = "TlsReceive"
     Dim hResult         As Long
@@ -818,6 +864,9 @@ Public Function TlsReceive(uCtx As UcsTlsContext, baInput() As Byte, ByVal lSize
     Dim baEmpty()       As Byte
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        TlsAddStats uCtx, ucsTlsStatReceiveCalls, 1
+    #End If
     With uCtx
         If .State = ucsTlsStateClosed Then
             pvTlsSetLastError uCtx, vbObjectError, MODULE_NAME & "." & FUNC_NAME, ERR_CONNECTION_CLOSED
@@ -907,29 +956,37 @@ EH:
     Resume QH
 End Function
 
-Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long, baOutput() As Byte, lOutputPos As Long) As Boolean
+Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long, baOutput() As Byte, lOutputPos As Long, Optional ByVal MaxRecordSize As Long) As Boolean
     Const FUNC_NAME     As String = "TlsSend"
     Dim hResult         As Long
     Dim lBufPos         As Long
     Dim lBufSize        As Long
     Dim lPos            As Long
     Dim lIdx            As Long
+    Dim lRecordSize     As Long
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        TlsAddStats uCtx, ucsTlsStatSendCalls, 1
+    #End If
     With uCtx
         If .State = ucsTlsStateClosed Then
             pvTlsSetLastError uCtx, vbObjectError, MODULE_NAME & "." & FUNC_NAME, ERR_CONNECTION_CLOSED
             GoTo QH
         End If
         pvTlsClearLastError uCtx
+        lRecordSize = .TlsSizes.cbMaximumMessage
+        If MaxRecordSize > 0 And MaxRecordSize < lRecordSize Then
+            lRecordSize = MaxRecordSize
+        End If
         '--- figure out upper bound of total output and reserve space in baOutput
-        lIdx = (lSize + .TlsSizes.cbMaximumMessage - 1) \ .TlsSizes.cbMaximumMessage
+        lIdx = (lSize + lRecordSize - 1) \ lRecordSize
         pvWriteReserved baOutput, lOutputPos, .TlsSizes.cbHeader * lIdx + lSize + .TlsSizes.cbTrailer * lIdx
-        For lPos = 0 To lSize - 1 Step .TlsSizes.cbMaximumMessage
+        For lPos = 0 To lSize - 1 Step lRecordSize
             lBufPos = lOutputPos
             lBufSize = lSize - lPos
-            If lBufSize > .TlsSizes.cbMaximumMessage Then
-                lBufSize = .TlsSizes.cbMaximumMessage
+            If lBufSize > lRecordSize Then
+                lBufSize = lRecordSize
             End If
             pvWriteReserved baOutput, lOutputPos, .TlsSizes.cbHeader + lBufSize + .TlsSizes.cbTrailer
             pvInitSecBuffer .InBuffers(0), SECBUFFER_STREAM_HEADER, VarPtr(baOutput(lBufPos)), .TlsSizes.cbHeader
@@ -1066,6 +1123,53 @@ Public Function TlsGetLastError(uCtx As UcsTlsContext, Optional LastErrNumber As
     End If
 End Function
 
+#If ImplUseStats Then
+Public Function TlsGetStats(uCtx As UcsTlsContext, Optional ByVal Aggregate As Boolean) As Collection
+    Dim uStats          As UcsTlsStats
+    Dim vElem           As Variant
+    Dim lIdx            As Long
+    
+    If Aggregate Then
+        uStats = m_uStats
+    Else
+        uStats = uCtx.Stats
+    End If
+    Set TlsGetStats = New Collection
+    For Each vElem In Split(STR_STATS_NAMES, "|")
+        '--- times in ms
+        TlsGetStats.Add uStats.Value(lIdx) * IIf(lIdx < ucsTlsStatRecordsIn, 1000, 1), vElem
+        lIdx = lIdx + 1
+    Next
+End Function
+
+Public Sub TlsAddStats(uCtx As UcsTlsContext, ByVal eStat As UcsTlsStatsEnum, ByVal dValue As Double)
+    pvTlsStatsAdd uCtx.Stats, eStat, dValue
+    pvTlsStatsAdd m_uStats, eStat, dValue
+End Sub
+
+Private Sub pvTlsStatsAdd(uStats As UcsTlsStats, ByVal eStat As UcsTlsStatsEnum, ByVal dValue As Double)
+    If eStat = ucsTlsStatSendQueueHighWater Then
+        If dValue > uStats.Value(eStat) Then
+            uStats.Value(eStat) = dValue
+        End If
+    Else
+        uStats.Value(eStat) = uStats.Value(eStat) + dValue
+    End If
+End Sub
+#End If
+
+Public Property Get TlsKeyPoolSize() As Long
+    '--- Schannel generates its own key shares
+End Property
+
+Public Property Let TlsKeyPoolSize(ByVal lValue As Long)
+    '--- no key pool, size is ignored
+End Property
+
+Public Function TlsKeyPoolRefill(Optional ByVal Timeout As Long, Optional LastError As String) As Boolean
+    TlsKeyPoolRefill = True
+End Function
+
 Private Sub pvTlsClearLastError(uCtx As UcsTlsContext)
     With uCtx
         .LastErrNumber = 0
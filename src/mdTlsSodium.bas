@@ -18,6 +18,7 @@ Private Const MODULE_NAME As String = "mdTlsSodium"
 #Const ImplUseShared = (ASYNCSOCKET_USE_SHARED <> 0)
 #Const ImplUseDebugLog = (USE_DEBUG_LOG <> 0)
 #Const ImplCaptureTraffic = CLng(ASYNCSOCKET_CAPTURE_TRAFFIC) '--- bitmask: 1 - traffic
+#Const ImplUseStats = (ASYNCSOCKET_USE_STATS <> 0)
 
 '=========================================================================
 ' API
@@ -218,6 +219,7 @@ Private Const STR_VL_EXTENSION_NAMES                    As String = "0|server_na
                                                                     "50|signature_algorithms_cert|51|key_share|52|transparency_info|53|connection_id|55|external_id_hash|56|external_session_id"
 Private Const STR_UNKNOWN                               As String = "Unknown (%1)"
 Private Const STR_FORMAT_ALERT                          As String = "%1."
+Private Const STR_STATS_NAMES                           As String = "HandshakeTime|KeyExchangeTime|CertValidationTime|SignatureTime|BulkCryptoTime|RecordsIn|RecordsOut|BytesIn|BytesOut|ReceiveCalls|SendCalls|Reallocations|SendQueueHighWater"
 '--- TLS
 Private Const TLS_PROTOCOL_VERSION_TLS12                As Long = &H303
 Private Const TLS_PROTOCOL_VERSION_TLS13                As Long = &H304
@@ -354,6 +356,10 @@ Private Const MAX_RSA_KEY                               As Long = 8192 '--- in b
 Private m_uData                     As UcsCryptoData
 Private m_baHelloRetryRandom()      As Byte
 Public g_oRequestSocket             As Object
+Public g_cCertCache                 As Collection
+#If ImplUseStats Then
+    Private m_uStats                As UcsTlsStats
+#End If
 
 Private Enum UcsTlsLocalFeaturesEnum '--- bitmask
     ucsTlsSupportTls12 = 2 ^ 0
@@ -423,6 +429,29 @@ Private Enum UcsTlsAlertDescriptionsEnum
     uscTlsAlertNoApplicationProtocol = 120
 End Enum
 
+#If ImplUseStats Then
+Public Enum UcsTlsStatsEnum '--- sync w/ STR_STATS_NAMES, times (in seconds) go before ucsTlsStatRecordsIn
+    ucsTlsStatHandshakeTime
+    ucsTlsStatKeyExchangeTime
+    ucsTlsStatCertValidationTime
+    ucsTlsStatSignatureTime
+    ucsTlsStatBulkCryptoTime
+    ucsTlsStatRecordsIn
+    ucsTlsStatRecordsOut
+    ucsTlsStatBytesIn
+    ucsTlsStatBytesOut
+    ucsTlsStatReceiveCalls
+    ucsTlsStatSendCalls
+    ucsTlsStatReallocations
+    ucsTlsStatSendQueueHighWater                    '--- max instead of sum
+    [_ucsTlsStatMax]
+End Enum
+
+Public Type UcsTlsStats
+    Value(0 To [_ucsTlsStatMax] - 1) As Double
+End Type
+#End If
+
 Private Type UcsBuffer
     Data()              As Byte
     Pos                 As Long
@@ -522,6 +551,9 @@ Public Type UcsTlsContext
 #If ImplCaptureTraffic <> 0 Then
     TrafficDump         As Collection
 #End If
+#If ImplUseStats Then
+    Stats               As UcsTlsStats
+#End If
 End Type
 
 Private Type UcsKeyInfo
@@ -556,6 +588,11 @@ Public Property Get TlsIsShutdown(uCtx As UcsTlsContext) As Boolean
     TlsIsShutdown = (uCtx.State = ucsTlsStateShutdown)
 End Property
 
+Public Property Get TlsIsAsyncPending(uCtx As UcsTlsContext) As Boolean
+    '--- see TlsSetAsyncNotify
+    TlsIsAsyncPending = False
+End Property
+
 '=========================================================================
 ' TLS support
 '=========================================================================
@@ -686,10 +723,22 @@ EH:
     Resume QH
 End Function
 
+Public Function TlsSetEarlyData(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long) As Boolean
+    '--- 0-RTT not supported, caller sends data after handshake
+    TlsSetEarlyData = False
+End Function
+
+Public Sub TlsSetAsyncNotify(uCtx As UcsTlsContext, ByVal hWnd As Long, ByVal MsgID As Long, ByVal wParam As Long, ByVal lParam As Long)
+    '--- libsodium signs inline, TlsHandshake never waits on a worker thread
+End Sub
+
 Public Function TlsReceive(uCtx As UcsTlsContext, baInput() As Byte, ByVal lSize As Long, baPlainText() As Byte, lPos As Long, baOutput() As Byte, lOutputPos As Long) As Boolean
     Const FUNC_NAME     As String = "TlsReceive"
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        TlsAddStats uCtx, ucsTlsStatReceiveCalls, 1
+    #End If
     With uCtx
         #If (ImplCaptureTraffic And 1) <> 0 Then
             If lSize <> 0 Then
@@ -746,11 +795,19 @@ EH:
     Resume QH
 End Function
 
-Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long, baOutput() As Byte, lOutputPos As Long) As Boolean
+Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long, baOutput() As Byte, lOutputPos As Long, Optional ByVal MaxRecordSize As Long) As Boolean
     Const FUNC_NAME     As String = "TlsSend"
     Dim lPos            As Long
+    Dim lRecordSize     As Long
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        TlsAddStats uCtx, ucsTlsStatSendCalls, 1
+    #End If
+    lRecordSize = TLS_MAX_PLAINTEXT_RECORD_SIZE
+    If MaxRecordSize > 0 And MaxRecordSize < lRecordSize Then
+        lRecordSize = MaxRecordSize
+    End If
     With uCtx
         If lSize < 0 Then
             lSize = pvArraySize(baPlainText)
@@ -763,8 +820,8 @@ Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSiz
         '--- swap-in
         pvArraySwap .SendBuffer.Data, .SendBuffer.Size, baOutput, lOutputPos
         Do While lPos < lSize
-            pvTlsBuildApplicationData uCtx, .SendBuffer, baPlainText, lPos, Clamp(lSize - lPos, 0, TLS_MAX_PLAINTEXT_RECORD_SIZE), TLS_CONTENT_TYPE_APPDATA
-            lPos = lPos + TLS_MAX_PLAINTEXT_RECORD_SIZE
+            pvTlsBuildApplicationData uCtx, .SendBuffer, baPlainText, lPos, Clamp(lSize - lPos, 0, lRecordSize), TLS_CONTENT_TYPE_APPDATA
+            lPos = lPos + lRecordSize
         Loop
         '--- success
         TlsSend = True
@@ -822,6 +879,53 @@ Public Function TlsGetLastError(uCtx As UcsTlsContext, Optional LastErrNumber As
     End If
 End Function
 
+#If ImplUseStats Then
+Public Function TlsGetStats(uCtx As UcsTlsContext, Optional ByVal Aggregate As Boolean) As Collection
+    Dim uStats          As UcsTlsStats
+    Dim vElem           As Variant
+    Dim lIdx            As Long
+    
+    If Aggregate Then
+        uStats = m_uStats
+    Else
+        uStats = uCtx.Stats
+    End If
+    Set TlsGetStats = New Collection
+    For Each vElem In Split(STR_STATS_NAMES, "|")
+        '--- times in ms
+        TlsGetStats.Add uStats.Value(lIdx) * IIf(lIdx < ucsTlsStatRecordsIn, 1000, 1), vElem
+        lIdx = lIdx + 1
+    Next
+End Function
+
+Public Sub TlsAddStats(uCtx As UcsTlsContext, ByVal eStat As UcsTlsStatsEnum, ByVal dValue As Double)
+    pvTlsStatsAdd uCtx.Stats, eStat, dValue
+    pvTlsStatsAdd m_uStats, eStat, dValue
+End Sub
+
+Private Sub pvTlsStatsAdd(uStats As UcsTlsStats, ByVal eStat As UcsTlsStatsEnum, ByVal dValue As Double)
+    If eStat = ucsTlsStatSendQueueHighWater Then
+        If dValue > uStats.Value(eStat) Then
+            uStats.Value(eStat) = dValue
+        End If
+    Else
+        uStats.Value(eStat) = uStats.Value(eStat) + dValue
+    End If
+End Sub
+#End If
+
+Public Property Get TlsKeyPoolSize() As Long
+    '--- key pool not implemented, key shares are generated on handshake
+End Property
+
+Public Property Let TlsKeyPoolSize(ByVal lValue As Long)
+    '--- no key pool, size is ignored
+End Property
+
+Public Function TlsKeyPoolRefill(Optional ByVal Timeout As Long, Optional LastError As String) As Boolean
+    TlsKeyPoolRefill = True
+End Function
+
 Private Function pvTlsGetLastAlert(uCtx As UcsTlsContext, Optional AlertCode As UcsTlsAlertDescriptionsEnum) As String
     Static vTexts       As Variant
     
@@ -41,6 +41,7 @@ Private Const MODULE_NAME As String = "mdTlsThunks"
 #Const ImplUseShared = (ASYNCSOCKET_USE_SHARED <> 0)
 #Const ImplUseDebugLog = (USE_DEBUG_LOG <> 0)
 #Const ImplCaptureTraffic = CLng(ASYNCSOCKET_CAPTURE_TRAFFIC) '--- bitmask: 1 - traffic, 2 - derived secrets
+#Const ImplUseStats = (ASYNCSOCKET_USE_STATS <> 0)
 #Const ImplExoticCiphers = False
 
 '=========================================================================
@@ -49,7 +50,10 @@ Private Const MODULE_NAME As String = "mdTlsThunks"
 
 '--- for thunks
 Private Const MEM_COMMIT                                As Long = &H1000
+Private Const PAGE_READWRITE                            As Long = &H4
+Private Const PAGE_EXECUTE_READ                         As Long = &H20
 Private Const PAGE_EXECUTE_READWRITE                    As Long = &H40
+Private Const LNG_PAGE_SIZE                             As Long = &H1000
 '--- for CryptAcquireContext
 Private Const PROV_RSA_FULL                             As Long = 1
 Private Const CRYPT_VERIFYCONTEXT                       As Long = &HF0000000
@@ -85,9 +89,21 @@ Private Declare Function GetProcAddress Lib "kernel32" (ByVal hModule As Long, B
 Private Declare Function lstrlen Lib "kernel32" Alias "lstrlenA" (ByVal lpString As Long) As Long
 Private Declare Function LocalFree Lib "kernel32" (ByVal hMem As Long) As Long
 Private Declare Function GetEnvironmentVariable Lib "kernel32" Alias "GetEnvironmentVariableA" (ByVal lpName As String, ByVal lpBuffer As String, ByVal nSize As Long) As Long
+Private Declare Function SetEnvironmentVariable Lib "kernel32" Alias "SetEnvironmentVariableA" (ByVal lpName As String, ByVal lpValue As String) As Long
+Private Declare Function GetCurrentProcessId Lib "kernel32" () As Long
+Private Declare Function GetTickCount Lib "kernel32" () As Long
+Private Declare Function QueueUserWorkItem Lib "kernel32" (ByVal lpFunction As Long, ByVal lpContext As Long, ByVal dwFlags As Long) As Long
+Private Declare Function InterlockedCompareExchange Lib "kernel32" (ByVal lpDestination As Long, ByVal lExchange As Long, ByVal lComperand As Long) As Long
+#If ImplUseStats Then
+    Private Declare Function QueryPerformanceCounter Lib "kernel32" (lpPerformanceCount As Currency) As Long
+    Private Declare Function QueryPerformanceFrequency Lib "kernel32" (lpFrequency As Currency) As Long
+#End If
 '--- msvbvm60
 Private Declare Function ArrPtr Lib "msvbvm60" Alias "VarPtr" (Ptr() As Any) As Long
 Private Declare Function vbaObjSetAddref Lib "msvbvm60" Alias "__vbaObjSetAddref" (oDest As Any, ByVal lSrcPtr As Long) As Long
+'--- ole32
+Private Declare Function CoTaskMemAlloc Lib "ole32" (ByVal cb As Long) As Long
+Private Declare Sub CoTaskMemFree Lib "ole32" (ByVal pv As Long)
 '--- advapi32
 Private Declare Function CryptAcquireContext Lib "advapi32" Alias "CryptAcquireContextW" (phProv As Long, ByVal pszContainer As Long, ByVal pszProvider As Long, ByVal dwProvType As Long, ByVal dwFlags As Long) As Long
 Private Declare Function CryptReleaseContext Lib "advapi32" (ByVal hProv As Long, ByVal dwFlags As Long) As Long
@@ -149,7 +165,9 @@ Private Const STR_VL_MESSAGE_NAMES                      As String = "1|client_he
 Private Const STR_VL_EXTENSION_NAMES                    As String = "0|server_name|1|max_fragment_length|2|client_certificate_url|3|trusted_ca_keys|4|truncated_hmac|5|status_request|6|user_mapping|7|client_authz|8|server_authz|9|cert_type|10|supported_groups|11|ec_point_formats|12|srp|13|signature_algorithms|14|use_srtp|15|heartbeat|16|application_layer_protocol_negotiation|17|status_request_v2|18|signed_certificate_timestamp|19|client_certificate_type|20|server_certificate_type|21|padding|22|encrypt_then_mac|23|extended_master_secret|24|token_binding|25|cached_info|26|tls_lts|27|compress_certificate|28|record_size_limit|29|pwd_protect|30|pwd_clear|31|password_salt|32|ticket_pinning|33|tls_cert_with_extern_psk|34|delegated_credentials|35|session_ticket|41|pre_shared_key|42|early_data|43|supported_versions|44|cookie|45|psk_key_exchange_modes|47|certificate_authorities|48|oid_filters|49|post_handshake_auth|" & _
                                                                     "50|signature_algorithms_cert|51|key_share|52|transparency_info|53|connection_id|55|external_id_hash|56|external_session_id"
 Private Const STR_UNKNOWN                               As String = "Unknown (%1)"
+Private Const STR_THUNK_GLOBAL_KEY                      As String = "TlsCryptoThunk"
 Private Const STR_FORMAT_ALERT                          As String = "%1."
+Private Const STR_STATS_NAMES                           As String = "HandshakeTime|KeyExchangeTime|CertValidationTime|SignatureTime|BulkCryptoTime|RecordsIn|RecordsOut|BytesIn|BytesOut|ReceiveCalls|SendCalls|Reallocations|SendQueueHighWater"
 '--- TLS
 Private Const TLS_PROTOCOL_VERSION_TLS12                As Long = &H303
 Private Const TLS_PROTOCOL_VERSION_TLS13                As Long = &H304
@@ -165,7 +183,7 @@ Private Const TLS_HANDSHAKE_HELLO_REQUEST               As Long = 0
 Private Const TLS_HANDSHAKE_CLIENT_HELLO                As Long = 1
 Private Const TLS_HANDSHAKE_SERVER_HELLO                As Long = 2
 Private Const TLS_HANDSHAKE_NEW_SESSION_TICKET          As Long = 4
-'Private Const TLS_HANDSHAKE_END_OF_EARLY_DATA           As Long = 5
+Private Const TLS_HANDSHAKE_END_OF_EARLY_DATA           As Long = 5
 Private Const TLS_HANDSHAKE_ENCRYPTED_EXTENSIONS        As Long = 8
 Private Const TLS_HANDSHAKE_CERTIFICATE                 As Long = 11
 Private Const TLS_HANDSHAKE_SERVER_KEY_EXCHANGE         As Long = 12
@@ -176,7 +194,7 @@ Private Const TLS_HANDSHAKE_CLIENT_KEY_EXCHANGE         As Long = 16
 Private Const TLS_HANDSHAKE_FINISHED                    As Long = 20
 Private Const TLS_HANDSHAKE_CERTIFICATE_STATUS          As Long = 22
 Private Const TLS_HANDSHAKE_KEY_UPDATE                  As Long = 24
-'Private Const TLS_HANDSHAKE_COMPRESSED_CERTIFICATE      As Long = 25
+Private Const TLS_HANDSHAKE_COMPRESSED_CERTIFICATE      As Long = 25
 Private Const TLS_HANDSHAKE_MESSAGE_HASH                As Long = 254
 '--- TLS Extensions from https://www.iana.org/assignments/tls-extensiontype-values/tls-extensiontype-values.xhtml
 Private Const TLS_EXTENSION_SERVER_NAME                 As Long = 0
@@ -187,13 +205,14 @@ Private Const TLS_EXTENSION_SIGNATURE_ALGORITHMS        As Long = 13
 Private Const TLS_EXTENSION_ALPN                        As Long = 16
 Private Const TLS_EXTENSION_ENCRYPT_THEN_MAC            As Long = 22
 Private Const TLS_EXTENSION_EXTENDED_MASTER_SECRET      As Long = 23
-'Private Const TLS_EXTENSION_COMPRESS_CERTIFICATE        As Long = 27
+Private Const TLS_EXTENSION_COMPRESS_CERTIFICATE        As Long = 27
+Private Const TLS_EXTENSION_RECORD_SIZE_LIMIT           As Long = 28
 Private Const TLS_EXTENSION_SESSION_TICKET              As Long = 35
-'Private Const TLS_EXTENSION_PRE_SHARED_KEY              As Long = 41
-'Private Const TLS_EXTENSION_EARLY_DATA                  As Long = 42
+Private Const TLS_EXTENSION_PRE_SHARED_KEY              As Long = 41
+Private Const TLS_EXTENSION_EARLY_DATA                  As Long = 42
 Private Const TLS_EXTENSION_SUPPORTED_VERSIONS          As Long = 43
 Private Const TLS_EXTENSION_COOKIE                      As Long = 44
-'Private Const TLS_EXTENSION_PSK_KEY_EXCHANGE_MODES      As Long = 45
+Private Const TLS_EXTENSION_PSK_KEY_EXCHANGE_MODES      As Long = 45
 Private Const TLS_EXTENSION_CERTIFICATE_AUTHORITIES     As Long = 47
 Private Const TLS_EXTENSION_POST_HANDSHAKE_AUTH         As Long = 49
 Private Const TLS_EXTENSION_SIGNATURE_ALGORITHMS_CERT   As Long = 50
@@ -256,13 +275,20 @@ Private Const TLS_COMPRESS_NULL                         As Long = 0
 Private Const TLS_SERVER_NAME_TYPE_HOSTNAME             As Long = 0
 Private Const TLS_MAX_PLAINTEXT_RECORD_SIZE             As Long = 16384
 Private Const TLS_MAX_ENCRYPTED_RECORD_SIZE             As Long = (TLS_MAX_PLAINTEXT_RECORD_SIZE + 1 + 255) '-- 1 byte content type + 255 bytes AEAD padding
+Private Const TLS_MIN_RECORD_SIZE_LIMIT                 As Long = 64
 Private Const TLS_HELLO_RANDOM_SIZE                     As Long = 32
 Private Const TLS_LEGACY_SECRET_SIZE                    As Long = 48
 Private Const TLS_LEGACY_SESSIONID_SIZE                 As Long = 32
 Private Const TLS_AAD_SIZE                              As Long = 5     '--- size of additional authenticated data for TLS 1.3
 Private Const TLS_LEGACY_AAD_SIZE                       As Long = 13    '--- for TLS 1.2
 Private Const TLS_VERIFY_DATA_SIZE                      As Long = 12
-'Private Const TLS_PSK_KE_MODE_PSK_DHE                   As Long = 1
+Private Const TLS_PSK_KE_MODE_PSK_DHE                   As Long = 1
+Private Const TLS_SESSION_TICKET_LIFETIME               As Long = 7200  '--- in seconds
+Private Const TLS_MAX_TICKET_LIFETIME                   As Long = 604800 '--- 7 days
+Private Const TLS_MAX_CACHED_TICKETS                    As Long = 4     '--- per remote host
+Private Const TLS_MAX_CACHED_HOSTS                      As Long = 64
+Private Const TLS_CERT_COMPRESS_ZLIB                    As Long = 1
+Private Const TLS_MAX_CERT_UNCOMPRESSED_SIZE            As Long = &H100000  '--- 1 MB
 '--- crypto constants
 Private Const LNG_X25519_KEYSZ                          As Long = 32
 Private Const LNG_SECP256R1_KEYSZ                       As Long = 32
@@ -292,6 +318,8 @@ Private Const LNG_ANS1_TYPE_SEQUENCE                    As Long = &H30
 Private Const LNG_ANS1_TYPE_INTEGER                     As Long = &H2
 Private Const LNG_HMAC_INNER_PAD                        As Long = &H36
 Private Const LNG_HMAC_OUTER_PAD                        As Long = &H5C
+Private Const LNG_HMAC_SHA2_CONTEXTSZ                   As Long = 408
+Private Const LNG_THUNK_PFN_COUNT                       As Long = 44 '--- pfn offsets in embedded thunk image, sync w/ pvGetThunkData
 '--- errors
 Private Const ERR_CONNECTION_CLOSED                     As String = "Connection closed"
 Private Const ERR_GENER_KEYPAIR_FAILED                  As String = "Failed generating key pair (%1)"
@@ -338,14 +366,32 @@ Private Const ERR_UNSUPPORTED_REQUEST_UPDATE            As String = "Unsupported
 Private Const ERR_INVALID_COMPRESSION                   As String = "Invalid compression (%1)"
 Private Const ERR_INVALID_SERVER_NAME                   As String = "Invalid server name (%1)"
 Private Const ERR_MISSING_TRAFFIC_KEYS                  As String = "Missing remote traffic keys"
+Private Const ERR_INVALID_PSK_BINDER                    As String = "Invalid pre-shared key binder"
+Private Const ERR_EARLY_DATA_MISMATCH                   As String = "Early data accepted with different %1 than ticket"
 '--- numeric
 Private Const LNG_FACILITY_WIN32                        As Long = &H80070000
+'--- crypto_job in thunk
+Private Const LNG_CRYPTO_JOB_QUEUED                     As Long = 0
+Private Const LNG_CRYPTO_JOB_DONE                       As Long = 1
+Private Const LNG_CRYPTO_JOB_ABANDONED                  As Long = 2
+Private Const LNG_CRYPTO_JOB_RSA_CRT_MODEXP             As Long = 1
+Private Const LNG_CRYPTO_JOB_ECDSA_SIGN256              As Long = 2
+Private Const LNG_CRYPTO_JOB_ECDSA_SIGN384              As Long = 3
 
 Private m_baBuffer()                As Byte
 Private m_lBuffIdx                  As Long
 Private m_uData                     As UcsCryptoData
 Private m_baHelloRetryRandom()      As Byte
+Private m_cSessionTickets           As Collection
+Private m_baTicketKey()             As Byte
 Public g_oRequestSocket             As Object
+Public g_cCertCache                 As Collection
+Private m_uKeyPool(0 To 2)          As UcsKeyPool
+Private m_lKeyPoolSize              As Long
+#If ImplUseStats Then
+    Private m_uStats                As UcsTlsStats
+    Private m_cStatsFreq            As Currency
+#End If
 
 Private Enum UcsTlsLocalFeaturesEnum '--- bitmask
     ucsTlsSupportTls10 = 2 ^ 0
@@ -422,6 +468,43 @@ Private Enum UcsTlsAlertDescriptionsEnum
     uscTlsAlertNoApplicationProtocol = 120
 End Enum
 
+Private Enum UcsTlsTicketItemsEnum '--- items of client session cache entry
+    ucsTlsTicketData = 0
+    ucsTlsTicketPsk
+    ucsTlsTicketDigestAlgo
+    ucsTlsTicketAgeAdd
+    ucsTlsTicketReceived
+    ucsTlsTicketLifetime
+    ucsTlsTicketCertificates
+    ucsTlsTicketCertStatuses
+    ucsTlsTicketCipherSuite
+    ucsTlsTicketAlpn
+    ucsTlsTicketMaxEarlyData
+End Enum
+
+#If ImplUseStats Then
+Public Enum UcsTlsStatsEnum '--- sync w/ STR_STATS_NAMES, times (in seconds) go before ucsTlsStatRecordsIn
+    ucsTlsStatHandshakeTime
+    ucsTlsStatKeyExchangeTime
+    ucsTlsStatCertValidationTime
+    ucsTlsStatSignatureTime
+    ucsTlsStatBulkCryptoTime
+    ucsTlsStatRecordsIn
+    ucsTlsStatRecordsOut
+    ucsTlsStatBytesIn
+    ucsTlsStatBytesOut
+    ucsTlsStatReceiveCalls
+    ucsTlsStatSendCalls
+    ucsTlsStatReallocations
+    ucsTlsStatSendQueueHighWater                    '--- max instead of sum
+    [_ucsTlsStatMax]
+End Enum
+
+Public Type UcsTlsStats
+    Value(0 To [_ucsTlsStatMax] - 1) As Double
+End Type
+#End If
+
 Private Type UcsBuffer
     Data()              As Byte
     Pos                 As Long
@@ -445,6 +528,7 @@ Public Type UcsTlsContext
     BlocksStack         As Collection
     AlpnNegotiated      As String
     SniRequested        As String
+    RemoteRecordSizeLimit As Long                       '--- from record_size_limit extension, 0 if not sent
     PrevRecordType      As Long
     '--- handshake
     ProtocolVersion     As Long
@@ -484,13 +568,17 @@ Public Type UcsTlsContext
     DigestSize          As Long
     UseRsaKeyTransport  As Boolean
     '--- bulk secrets
-    HandshakeMessages   As UcsBuffer                    '--- ToDo: reduce to HandshakeHash only
+    HandshakeMessages   As UcsBuffer                    '--- raw transcript for TLS 1.2 CertificateVerify and PSK binders
+    HandshakeHashCtx()  As Byte                         '--- running transcript hash of HandshakeMessages
+    HandshakeHashAlgo   As UcsTlsCryptoAlgorithmsEnum
+    HandshakeHashPos    As Long                         '--- bytes of HandshakeMessages already absorbed
     HandshakeSecret()   As Byte
     MasterSecret()      As Byte
     LocalMacKey()       As Byte                         '--- not used w/ AEAD ciphers
     RemoteMacKey()      As Byte                         '--- not used w/ AEAD ciphers
     RemoteTrafficSecret() As Byte
     RemoteTrafficKey()  As Byte
+    RemoteTrafficCtx    As Long                         '--- expanded key schedule, owned by thunk
     RemoteTrafficIV()   As Byte
     RemoteTrafficSeqNo  As Long
     RemoteEncryptThenMac As Boolean
@@ -499,6 +587,7 @@ Public Type UcsTlsContext
     RemoteLegacyNextTrafficIV() As Byte
     LocalTrafficSecret() As Byte
     LocalTrafficKey()   As Byte
+    LocalTrafficCtx     As Long                         '--- expanded key schedule, owned by thunk
     LocalTrafficIV()    As Byte
     LocalTrafficSeqNo   As Long
     LocalEncryptThenMac As Boolean
@@ -510,10 +599,28 @@ Public Type UcsTlsContext
     HelloRetryCipherSuite As Long
     HelloRetryExchGroup As Long
     HelloRetryCookie()  As Byte
+    '--- session resumption
+    ResumptionSecret()  As Byte
+    PreSharedKey()      As Byte
+    PskSelected         As Boolean
+    PskIdentity         As Long
+    PskTicket           As Variant                      '--- session cache entry offered by client
+    '--- 0-RTT
+    EarlyData()         As Byte                         '--- pending until sent as early data or after handshake
+    EarlyDataSent       As Boolean
+    EarlyDataAccepted   As Boolean
+    EarlyTrafficSecret() As Byte
+    EarlyTrafficSeqNo   As Long
     '--- client certificate request
     CertRequestContext() As Byte
     CertRequestSignatureScheme As Long
     CertRequestCaDn     As Collection
+    '--- async handshake
+    AsyncHwnd           As Long                         '--- completion is posted here, 0 to sign inline
+    AsyncMsgID          As Long
+    AsyncWParam         As Long
+    AsyncLParam         As Long
+    AsyncJob            As Long                         '--- pending crypto_job, owned by worker thread until done
     '--- I/O buffers
     RecvBuffer          As UcsBuffer
     DecrBuffer          As UcsBuffer
@@ -522,6 +629,18 @@ Public Type UcsTlsContext
 #If ImplCaptureTraffic <> 0 Then
     TrafficDump         As Collection
 #End If
+#If ImplUseStats Then
+    Stats               As UcsTlsStats
+#End If
+End Type
+
+Private Type UcsKeyPool
+    ExchGroup           As Long
+    Requested           As Boolean                      '--- keep stocked on refill
+    Count               As Long
+    PrivateSize         As Long
+    PublicSize          As Long
+    Data()              As Byte                         '--- Count slots of private key followed by public key
 End Type
 
 Private Type UcsKeyInfo
@@ -536,6 +655,20 @@ Private Type UcsKeyInfo
     PrivExp()           As Byte
 End Type
 
+Private Type UcsCryptoJob                               '--- sync w/ crypto_job in thunk
+    State               As Long
+    Op                  As Long
+    Result              As Long
+    Size                As Long
+    AllocSize           As Long
+    hWnd                As Long
+    MsgID               As Long
+    wParam              As Long
+    lParam              As Long
+    PfnPostMessage      As Long
+    Args(0 To 6)        As Long
+End Type
+
 Private Enum UcsThunkPfnIndexEnum
     [_ucsPfnNotUsed]
     ucsPfnCurve25519ScalarMultiply
@@ -567,17 +700,38 @@ Private Enum UcsThunkPfnIndexEnum
     ucsPfnAesCbcDecrypt
     ucsPfnRsaModExp
     ucsPfnRsaCrtModExp
+    '--- note: new exports are appended only, offsets of existing ones are part of the thunk ABI
+    ucsPfnAesCtxInit
+    ucsPfnAesCtxFree
+    ucsPfnAesGcmSeal
+    ucsPfnAesGcmOpen
+    ucsPfnAesCbcSeal
+    ucsPfnAesCbcOpen
+    ucsPfnRsaCrtCtxInit
+    ucsPfnRsaCrtCtxFree
+    ucsPfnRsaCrtCtxModExp
+    ucsPfnHmacSha2Init
+    ucsPfnHmacSha2
+    ucsPfnHkdfExpandLabel
+    ucsPfnTinfUncompress
+    ucsPfnTinfZlibUncompress
+    ucsPfnCryptoJobRun
     [_ucsPfnMax]
 End Enum
 
 Private Type UcsCryptoData
     Thunk               As Long
-    Glob()              As Byte
     Pfn(1 To [_ucsPfnMax] - 1) As Long
     HashCtx(0 To LNG_SHA384_CONTEXTSZ - 1) As Byte
     HashPad(0 To LNG_SHA512_BLOCKSZ - 1) As Byte
     HashFinal(0 To LNG_SHA512_HASHSZ - 1) As Byte
+    HmacCtx(0 To LNG_HMAC_SHA2_CONTEXTSZ - 1) As Byte
+    HmacHashSize        As Long
+    HmacKey()           As Byte
     hRandomProv         As Long
+    RsaKeyCtx           As Long
+    RsaKeyModulus()     As Byte
+    RsaKeyExp()         As Byte
 End Type
 
 '=========================================================================
@@ -600,6 +754,10 @@ Public Property Get TlsIsShutdown(uCtx As UcsTlsContext) As Boolean
     TlsIsShutdown = (uCtx.State = ucsTlsStateShutdown)
 End Property
 
+Public Property Get TlsIsAsyncPending(uCtx As UcsTlsContext) As Boolean
+    TlsIsAsyncPending = (uCtx.AsyncJob <> 0)
+End Property
+
 '=========================================================================
 ' TLS support
 '=========================================================================
@@ -627,6 +785,7 @@ Public Function TlsInitClient( _
             Set .TrafficDump = New Collection
         #End If
     End With
+    pvTlsClearTrafficCtx uCtx
     uCtx = uEmpty
     '--- success
     TlsInitClient = True
@@ -666,6 +825,7 @@ Public Function TlsInitServer( _
             Set .TrafficDump = New Collection
         #End If
     End With
+    pvTlsClearTrafficCtx uCtx
     uCtx = uEmpty
     '--- success
     TlsInitServer = True
@@ -679,12 +839,19 @@ End Function
 
 Public Function TlsTerminate(uCtx As UcsTlsContext)
     uCtx.State = ucsTlsStateClosed
+    pvTlsClearTrafficCtx uCtx
 End Function
 
 Public Function TlsHandshake(uCtx As UcsTlsContext, baInput() As Byte, ByVal lSize As Long, baOutput() As Byte, lOutputPos As Long) As Boolean
     Const FUNC_NAME     As String = "TlsHandshake"
+    #If ImplUseStats Then
+        Dim uSnapshot       As UcsTlsStats
+    #End If
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        uSnapshot = m_uStats
+    #End If
     With uCtx
         If .State = ucsTlsStateClosed Then
             pvTlsSetLastError uCtx, vbObjectError, MODULE_NAME & "." & FUNC_NAME, ERR_CONNECTION_CLOSED
@@ -709,6 +876,10 @@ Public Function TlsHandshake(uCtx As UcsTlsContext, baInput() As Byte, ByVal lSi
                 pvTlsSetLastError uCtx, vbObjectError, MODULE_NAME & "." & FUNC_NAME, .LastError, .LastAlertCode
                 GoTo QH
             End If
+            If .State = ucsTlsStatePostHandshake And pvArraySize(.EarlyData) > 0 Then
+                '--- early data not sent or rejected by server so send w/ application traffic keys
+                pvTlsBuildEarlyData uCtx, .SendBuffer, Rejected:=True
+            End If
         End If
         '--- success
         TlsHandshake = True
@@ -721,17 +892,59 @@ QH:
                 .TrafficDump.Add FUNC_NAME & ".Output" & vbCrLf & TlsDesignDumpArray(baOutput, Size:=lOutputPos)
             End If
         #End If
+        #If ImplUseStats Then
+            pvTlsStatsCollect uCtx, uSnapshot
+        #End If
+    End With
+    Exit Function
+EH:
+    pvTlsSetLastError uCtx, Err.Number, Err.Source, Err.Description
+    Resume QH
+End Function
+
+Public Function TlsSetEarlyData(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long) As Boolean
+    On Error GoTo EH
+    With uCtx
+        If .State <> ucsTlsStateHandshakeStart Or .IsServer Then
+            GoTo QH
+        End If
+        If lSize < 0 Then
+            lSize = pvArraySize(baPlainText)
+        End If
+        '--- sent in first flight if session ticket allows, otherwise right after handshake
+        .EarlyData = baPlainText
+        pvArrayReallocate .EarlyData, lSize, "TlsSetEarlyData.EarlyData"
+        '--- success
+        TlsSetEarlyData = True
     End With
+QH:
     Exit Function
 EH:
     pvTlsSetLastError uCtx, Err.Number, Err.Source, Err.Description
     Resume QH
 End Function
 
+Public Sub TlsSetAsyncNotify(uCtx As UcsTlsContext, ByVal hWnd As Long, ByVal MsgID As Long, ByVal wParam As Long, ByVal lParam As Long)
+    '--- server CertificateVerify is signed on a thread pool thread and TlsHandshake resumes on this message
+    With uCtx
+        .AsyncHwnd = hWnd
+        .AsyncMsgID = MsgID
+        .AsyncWParam = wParam
+        .AsyncLParam = lParam
+    End With
+End Sub
+
 Public Function TlsReceive(uCtx As UcsTlsContext, baInput() As Byte, ByVal lSize As Long, baPlainText() As Byte, lPos As Long, baOutput() As Byte, lOutputPos As Long) As Boolean
     Const FUNC_NAME     As String = "TlsReceive"
+    #If ImplUseStats Then
+        Dim uSnapshot       As UcsTlsStats
+    #End If
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        TlsAddStats uCtx, ucsTlsStatReceiveCalls, 1
+        uSnapshot = m_uStats
+    #End If
     With uCtx
         If lSize < 0 Then
             lSize = pvArraySize(baInput)
@@ -781,6 +994,9 @@ QH:
                 .TrafficDump.Add FUNC_NAME & ".Output (encrypted)" & vbCrLf & TlsDesignDumpArray(baOutput, Size:=lOutputPos)
             End If
         #End If
+        #If ImplUseStats Then
+            pvTlsStatsCollect uCtx, uSnapshot
+        #End If
     End With
     Exit Function
 EH:
@@ -788,15 +1004,24 @@ EH:
     Resume QH
 End Function
 
-Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long, baOutput() As Byte, lOutputPos As Long) As Boolean
+Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSize As Long, baOutput() As Byte, lOutputPos As Long, Optional ByVal MaxRecordSize As Long) As Boolean
     Const FUNC_NAME     As String = "TlsSend"
     Dim lPos            As Long
+    Dim lRecordSize     As Long
+    #If ImplUseStats Then
+        Dim uSnapshot       As UcsTlsStats
+    #End If
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        TlsAddStats uCtx, ucsTlsStatSendCalls, 1
+        uSnapshot = m_uStats
+    #End If
     With uCtx
         If lSize < 0 Then
             lSize = pvArraySize(baPlainText)
         End If
+        lRecordSize = pvTlsGetSendRecordSize(uCtx, MaxRecordSize)
         If .State = ucsTlsStateClosed Then
             pvTlsSetLastError uCtx, vbObjectError, MODULE_NAME & "." & FUNC_NAME, ERR_CONNECTION_CLOSED
             Exit Function
@@ -805,8 +1030,8 @@ Public Function TlsSend(uCtx As UcsTlsContext, baPlainText() As Byte, ByVal lSiz
         '--- swap-in
         pvArraySwap .SendBuffer.Data, .SendBuffer.Size, baOutput, lOutputPos
         Do While lPos < lSize
-            pvTlsBuildApplicationData uCtx, .SendBuffer, baPlainText, lPos, Clamp(lSize - lPos, 0, TLS_MAX_PLAINTEXT_RECORD_SIZE), TLS_CONTENT_TYPE_APPDATA
-            lPos = lPos + TLS_MAX_PLAINTEXT_RECORD_SIZE
+            pvTlsBuildApplicationData uCtx, .SendBuffer, baPlainText, lPos, Clamp(lSize - lPos, 0, lRecordSize), TLS_CONTENT_TYPE_APPDATA
+            lPos = lPos + lRecordSize
         Loop
         '--- success
         TlsSend = True
@@ -819,6 +1044,9 @@ QH:
                 .TrafficDump.Add FUNC_NAME & ".Output (encrypted)" & vbCrLf & TlsDesignDumpArray(baOutput, Size:=lOutputPos)
             End If
         #End If
+        #If ImplUseStats Then
+            pvTlsStatsCollect uCtx, uSnapshot
+        #End If
     End With
     Exit Function
 EH:
@@ -827,7 +1055,14 @@ EH:
 End Function
 
 Public Function TlsShutdown(uCtx As UcsTlsContext, baOutput() As Byte, lOutputPos As Long) As Boolean
+    #If ImplUseStats Then
+        Dim uSnapshot       As UcsTlsStats
+    #End If
+    
     On Error GoTo EH
+    #If ImplUseStats Then
+        uSnapshot = m_uStats
+    #End If
     With uCtx
         If .State = ucsTlsStateClosed Then
             Exit Function
@@ -843,6 +1078,9 @@ QH:
         '--- swap-out
         pvArraySwap baOutput, lOutputPos, .SendBuffer.Data, .SendBuffer.Size
         pvArrayWriteEOF baOutput, lOutputPos
+        #If ImplUseStats Then
+            pvTlsStatsCollect uCtx, uSnapshot
+        #End If
     End With
     Exit Function
 EH:
@@ -864,6 +1102,113 @@ Public Function TlsGetLastError(uCtx As UcsTlsContext, Optional LastErrNumber As
     End If
 End Function
 
+#If ImplUseStats Then
+Public Function TlsGetStats(uCtx As UcsTlsContext, Optional ByVal Aggregate As Boolean) As Collection
+    Dim uStats          As UcsTlsStats
+    Dim vElem           As Variant
+    Dim lIdx            As Long
+    
+    If Aggregate Then
+        uStats = m_uStats
+    Else
+        uStats = uCtx.Stats
+    End If
+    Set TlsGetStats = New Collection
+    For Each vElem In Split(STR_STATS_NAMES, "|")
+        '--- times in ms
+        TlsGetStats.Add uStats.Value(lIdx) * IIf(lIdx < ucsTlsStatRecordsIn, 1000, 1), vElem
+        lIdx = lIdx + 1
+    Next
+End Function
+
+Public Sub TlsAddStats(uCtx As UcsTlsContext, ByVal eStat As UcsTlsStatsEnum, ByVal dValue As Double)
+    pvTlsStatsAdd uCtx.Stats, eStat, dValue
+    pvTlsStatsAdd m_uStats, eStat, dValue
+End Sub
+#End If
+
+Public Property Get TlsKeyPoolSize() As Long
+    TlsKeyPoolSize = m_lKeyPoolSize
+End Property
+
+Public Property Let TlsKeyPoolSize(ByVal lValue As Long)
+    Dim lIdx            As Long
+    
+    If m_uKeyPool(0).ExchGroup = 0 Then
+        m_uKeyPool(0).ExchGroup = TLS_GROUP_X25519
+        m_uKeyPool(0).Requested = True                  '--- preferred key share in ClientHello
+        m_uKeyPool(1).ExchGroup = TLS_GROUP_SECP256R1
+        m_uKeyPool(2).ExchGroup = TLS_GROUP_SECP384R1
+    End If
+    m_lKeyPoolSize = IIf(lValue > 0, lValue, 0)
+    For lIdx = 0 To UBound(m_uKeyPool)
+        With m_uKeyPool(lIdx)
+            If .Count > m_lKeyPoolSize Then
+                Call FillMemory(.Data(m_lKeyPoolSize * (.PrivateSize + .PublicSize)), (.Count - m_lKeyPoolSize) * (.PrivateSize + .PublicSize), 0)
+                .Count = m_lKeyPoolSize
+            End If
+        End With
+    Next
+End Property
+
+'--- call in idle-time (e.g. from a timer or the message loop) to take key generation off the handshake path,
+'--- returns True when all requested pools are full, False on timeout or failure (w/ LastError set)
+Public Function TlsKeyPoolRefill(Optional ByVal Timeout As Long, Optional LastError As String) As Boolean
+    Const FUNC_NAME     As String = "TlsKeyPoolRefill"
+    Dim lIdx            As Long
+    Dim dStart          As Double
+    Dim dElapsed        As Double
+    Dim baPrivate()     As Byte
+    Dim baPublic()      As Byte
+    Dim lPos            As Long
+    
+    On Error GoTo EH
+    LastError = vbNullString
+    If m_lKeyPoolSize > 0 Then
+        If Not pvCryptoInit() Then
+            GoTo QH
+        End If
+        dStart = GetTickCount()
+        For lIdx = 0 To UBound(m_uKeyPool)
+            With m_uKeyPool(lIdx)
+                Do While .Requested And .Count < m_lKeyPoolSize
+                    If Timeout > 0 Then
+                        dElapsed = GetTickCount() - dStart
+                        If dElapsed < 0 Then
+                            dElapsed = dElapsed + 4294967296#
+                        End If
+                        If dElapsed >= Timeout Then
+                            GoTo QH
+                        End If
+                    End If
+                    pvTlsMakeExchKey .ExchGroup, baPrivate, baPublic
+                    If .Count = 0 Then
+                        .PrivateSize = pvArraySize(baPrivate)
+                        .PublicSize = pvArraySize(baPublic)
+                    End If
+                    If pvArraySize(.Data) < m_lKeyPoolSize * (.PrivateSize + .PublicSize) Then
+                        pvArrayReallocate .Data, m_lKeyPoolSize * (.PrivateSize + .PublicSize), FUNC_NAME & ".Data"
+                    End If
+                    lPos = .Count * (.PrivateSize + .PublicSize)
+                    Call CopyMemory(.Data(lPos), baPrivate(0), .PrivateSize)
+                    Call CopyMemory(.Data(lPos + .PrivateSize), baPublic(0), .PublicSize)
+                    .Count = .Count + 1
+                    pvArrayWipe baPrivate
+                Loop
+            End With
+        Next
+    End If
+    '--- success
+    TlsKeyPoolRefill = True
+QH:
+    Exit Function
+EH:
+    '--- no connection context here so error is returned to caller's idle-time handler
+    LastError = Err.Description & " [" & Err.Source & "]"
+    pvArrayWipe baPrivate
+    Resume QH
+End Function
+
 Private Function pvTlsGetLastAlert(uCtx As UcsTlsContext, Optional AlertCode As UcsTlsAlertDescriptionsEnum) As String
     Static vTexts       As Variant
     
@@ -933,8 +1278,24 @@ Private Sub pvTlsBuildClientHello(uCtx As UcsTlsContext, uOutput As UcsBuffer)
     Dim lMessagePos     As Long
     Dim vElem           As Variant
     Dim baTemp()        As Byte
+    Dim lBindersPos     As Long
+    Dim baPsk()         As Byte
     
     With uCtx
+        If .State = ucsTlsStateHandshakeStart Then
+            .PskTicket = Empty
+            If (.LocalFeatures And ucsTlsSupportTls13) <> 0 And LenB(.RemoteHostName) <> 0 Then
+                '--- session tickets are single-use so remove from cache
+                pvTlsTicketCacheGet .RemoteHostName, .PskTicket
+            End If
+        ElseIf Not .HelloRetryRequest Then
+            .PskTicket = Empty
+        ElseIf Not IsEmpty(.PskTicket) Then
+            '--- on HelloRetryRequest keep offering ticket only if compatible w/ negotiated hash
+            If .PskTicket(ucsTlsTicketDigestAlgo) <> .DigestAlgo Then
+                .PskTicket = Empty
+            End If
+        End If
         If (.LocalFeatures And ucsTlsSupportTls13) <> 0 And .ExchGroup = 0 Then
             '--- populate preferred .ExchGroup and .LocalExchPublic
             If pvCryptoIsSupported(ucsTlsAlgoExchX25519) Then
@@ -1025,6 +1386,16 @@ Private Sub pvTlsBuildClientHello(uCtx As UcsTlsContext, uOutput As UcsBuffer)
                     '--- Extension - OCSP Status Request
                     pvArrayByte baTemp, 0, TLS_EXTENSION_STATUS_REQUEST, 0, 5, 1, 0, 0, 0, 0
                     pvBufferWriteArray uOutput, baTemp
+                    '--- Extension - Record Size Limit (TLS 1.3 value includes content type)
+                    pvBufferWriteLong uOutput, TLS_EXTENSION_RECORD_SIZE_LIMIT, Size:=2
+                    pvBufferWriteBlockStart uOutput, Size:=2
+                        pvBufferWriteLong uOutput, TLS_MAX_PLAINTEXT_RECORD_SIZE + IIf((.LocalFeatures And ucsTlsSupportTls13) <> 0, 1, 0), Size:=2
+                    pvBufferWriteBlockEnd uOutput
+                    If (.LocalFeatures And ucsTlsSupportTls13) <> 0 And m_uData.Pfn(ucsPfnTinfZlibUncompress) <> 0 Then
+                        '--- Extension - Compress Certificate (only if thunk image has inflate)
+                        pvArrayByte baTemp, 0, TLS_EXTENSION_COMPRESS_CERTIFICATE, 0, 3, 2, 0, TLS_CERT_COMPRESS_ZLIB
+                        pvBufferWriteArray uOutput, baTemp      '--- zlib only
+                    End If
                     If (.LocalFeatures And ucsTlsSupportTls12) <> 0 Then
                         '--- Extension - EC Point Formats
                         pvArrayByte baTemp, 0, TLS_EXTENSION_EC_POINT_FORMAT, 0, 2, 1, 0
@@ -1122,15 +1493,87 @@ Private Sub pvTlsBuildClientHello(uCtx As UcsTlsContext, uOutput As UcsBuffer)
                                 pvBufferWriteBlockEnd uOutput
                             pvBufferWriteBlockEnd uOutput
                         End If
+                        '--- Extension - PSK Key Exchange Modes
+                        pvArrayByte baTemp, 0, TLS_EXTENSION_PSK_KEY_EXCHANGE_MODES, 0, 2, 1, TLS_PSK_KE_MODE_PSK_DHE
+                        pvBufferWriteArray uOutput, baTemp
+                        If Not IsEmpty(.PskTicket) And .State = ucsTlsStateHandshakeStart And pvArraySize(.EarlyData) > 0 Then
+                            If .PskTicket(ucsTlsTicketMaxEarlyData) >= pvArraySize(.EarlyData) Then
+                                '--- Extension - Early Data
+                                pvArrayByte baTemp, 0, TLS_EXTENSION_EARLY_DATA, 0, 0
+                                pvBufferWriteArray uOutput, baTemp
+                                .EarlyDataSent = True
+                            End If
+                        End If
+                        If Not IsEmpty(.PskTicket) Then
+                            '--- Extension - Pre-Shared Key (must be last)
+                            pvBufferWriteLong uOutput, TLS_EXTENSION_PRE_SHARED_KEY, Size:=2
+                            pvBufferWriteBlockStart uOutput, Size:=2
+                                pvBufferWriteBlockStart uOutput, Size:=2
+                                    pvBufferWriteBlockStart uOutput, Size:=2
+                                        baTemp = .PskTicket(ucsTlsTicketData)
+                                        pvBufferWriteArray uOutput, baTemp
+                                    pvBufferWriteBlockEnd uOutput
+                                    pvBufferWriteLong uOutput, pvTlsGetObfuscatedTicketAge(.PskTicket), Size:=4
+                                pvBufferWriteBlockEnd uOutput
+                                lBindersPos = uOutput.Size
+                                pvBufferWriteBlockStart uOutput, Size:=2
+                                    pvBufferWriteBlockStart uOutput
+                                        '--- placeholder, calculated on complete message below
+                                        pvBufferWriteBlob uOutput, 0, pvTlsDigestHashSize(.PskTicket(ucsTlsTicketDigestAlgo))
+                                    pvBufferWriteBlockEnd uOutput
+                                pvBufferWriteBlockEnd uOutput
+                            pvBufferWriteBlockEnd uOutput
+                        End If
                     End If
                 pvBufferWriteBlockEnd uOutput
             pvBufferWriteBlockEnd uOutput
+            If lBindersPos > 0 Then
+                '--- binder is over ClientHello truncated before binders list
+                baPsk = .PskTicket(ucsTlsTicketPsk)
+                pvTlsGetPskBinder uCtx, baTemp, .PskTicket(ucsTlsTicketDigestAlgo), baPsk, uOutput.Data, lMessagePos, lBindersPos - lMessagePos
+                Call CopyMemory(uOutput.Data(lBindersPos + 3), baTemp(0), pvArraySize(baTemp))
+            End If
             pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
         pvBufferWriteRecordEnd uOutput, uCtx
+        If .EarlyDataSent And .State = ucsTlsStateHandshakeStart Then
+            pvTlsBuildEarlyData uCtx, uOutput
+        End If
     End With
 QH:
 End Sub
 
+Private Sub pvTlsBuildEarlyData(uCtx As UcsTlsContext, uOutput As UcsBuffer, Optional ByVal Rejected As Boolean)
+    Dim lProtocolVersion As Long
+    Dim lPos            As Long
+    Dim lSize           As Long
+    Dim lRecordSize     As Long
+    
+    With uCtx
+        If Not Rejected Then
+            '--- early data is protected w/ the cipher suite of the session ticket
+            pvTlsSetupCipherSuite uCtx, .PskTicket(ucsTlsTicketCipherSuite)
+            .PreSharedKey = .PskTicket(ucsTlsTicketPsk)
+            pvTlsDeriveEarlySecrets uCtx
+            lProtocolVersion = .ProtocolVersion
+            .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13
+        End If
+        lSize = pvArraySize(.EarlyData)
+        lRecordSize = pvTlsGetSendRecordSize(uCtx, 0)
+        Do While lPos < lSize
+            pvTlsBuildApplicationData uCtx, uOutput, .EarlyData, lPos, Clamp(lSize - lPos, 0, lRecordSize), TLS_CONTENT_TYPE_APPDATA
+            lPos = lPos + lRecordSize
+        Loop
+        If Rejected Then
+            Erase .EarlyData
+        Else
+            .ProtocolVersion = lProtocolVersion
+            '--- keep sequence for EndOfEarlyData and send next ClientHello (if HRR) unprotected
+            .EarlyTrafficSeqNo = .LocalTrafficSeqNo
+            Erase .LocalTrafficKey
+        End If
+    End With
+End Sub
+
 Private Sub pvTlsBuildClientLegacyKeyExchange(uCtx As UcsTlsContext, uOutput As UcsBuffer)
     Dim lMessagePos     As Long
     Dim baHandshakeHash() As Byte
@@ -1197,6 +1640,7 @@ Private Sub pvTlsBuildClientLegacyKeyExchange(uCtx As UcsTlsContext, uOutput As
         '--- commit next epoch local secrets
         .LocalMacKey = .LocalLegacyNextMacKey
         .LocalTrafficKey = .LocalLegacyNextTrafficKey
+        pvTlsSetupTrafficCtx .LocalTrafficCtx, .BulkAlgo, .LocalTrafficKey
         .LocalTrafficIV = .LocalLegacyNextTrafficIV
         .LocalTrafficSeqNo = 0
         .LocalEncryptThenMac = (.MacSize > 0) And SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_ENCRYPT_THEN_MAC)
@@ -1231,6 +1675,24 @@ Private Sub pvTlsBuildClientHandshakeFinished(uCtx As UcsTlsContext, uOutput As
     Dim baEmpty()       As Byte
     
     With uCtx
+        If .EarlyDataAccepted And pvArraySize(.EarlyTrafficSecret) > 0 Then
+            '--- End Of Early Data is protected w/ client early traffic keys
+            baTemp = .LocalTrafficSecret
+            pvTlsSetLocalTrafficSecret uCtx, .EarlyTrafficSecret, .EarlyTrafficSeqNo
+            Erase .EarlyTrafficSecret
+            '--- Record Header
+            pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_APPDATA, uCtx
+                lMessagePos = uOutput.Size
+                pvBufferWriteLong uOutput, TLS_HANDSHAKE_END_OF_EARLY_DATA
+                pvBufferWriteBlockStart uOutput, Size:=3
+                    '--- empty
+                pvBufferWriteBlockEnd uOutput
+                pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
+                '--- Record Type
+                pvBufferWriteLong uOutput, TLS_CONTENT_TYPE_HANDSHAKE
+            pvBufferWriteRecordEnd uOutput, uCtx
+            pvTlsSetLocalTrafficSecret uCtx, baTemp, 0
+        End If
         If .CertRequestSignatureScheme <> 0 Then
             '--- Record Header
             pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_APPDATA, uCtx
@@ -1283,6 +1745,7 @@ Private Sub pvTlsBuildClientHandshakeFinished(uCtx As UcsTlsContext, uOutput As
         '--- Record Header
         pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_APPDATA, uCtx
             '--- Client Handshake Finished
+            lMessagePos = uOutput.Size
             pvBufferWriteLong uOutput, TLS_HANDSHAKE_FINISHED
             pvBufferWriteBlockStart uOutput, Size:=3
                 pvTlsGetHandshakeHash uCtx, baHandshakeHash
@@ -1290,6 +1753,7 @@ Private Sub pvTlsBuildClientHandshakeFinished(uCtx As UcsTlsContext, uOutput As
                 pvTlsHkdfExtract uVerify.Data, .DigestAlgo, baTemp, baHandshakeHash
                 pvBufferWriteArray uOutput, uVerify.Data
             pvBufferWriteBlockEnd uOutput
+            pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
             '--- Record Type
             pvBufferWriteLong uOutput, TLS_CONTENT_TYPE_HANDSHAKE
         pvBufferWriteRecordEnd uOutput, uCtx
@@ -1363,6 +1827,13 @@ Private Sub pvTlsBuildServerHello(uCtx As UcsTlsContext, uOutput As UcsBuffer)
                                 pvBufferWriteBlockEnd uOutput
                             pvBufferWriteBlockEnd uOutput
                         End If
+                        If .PskSelected And Not .HelloRetryRequest Then
+                            '--- Extension - Pre-Shared Key
+                            pvBufferWriteLong uOutput, TLS_EXTENSION_PRE_SHARED_KEY, Size:=2
+                            pvBufferWriteBlockStart uOutput, Size:=2
+                                pvBufferWriteLong uOutput, .PskIdentity, Size:=2
+                            pvBufferWriteBlockEnd uOutput
+                        End If
                     End If
                     If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS12 Then
                         If SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_EXTENDED_MASTER_SECRET) Then
@@ -1377,6 +1848,12 @@ Private Sub pvTlsBuildServerHello(uCtx As UcsTlsContext, uOutput As UcsBuffer)
                             pvArrayByte baTemp, 0, TLS_EXTENSION_EC_POINT_FORMAT, 0, 2, 1, 0
                             pvBufferWriteArray uOutput, baTemp      '--- uncompressed only
                         End If
+                        If .RemoteRecordSizeLimit <> 0 Then
+                            pvBufferWriteLong uOutput, TLS_EXTENSION_RECORD_SIZE_LIMIT, Size:=2
+                            pvBufferWriteBlockStart uOutput, Size:=2
+                                pvBufferWriteLong uOutput, TLS_MAX_PLAINTEXT_RECORD_SIZE, Size:=2
+                            pvBufferWriteBlockEnd uOutput
+                        End If
                         If SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_RENEGOTIATION_INFO) Then
                             pvBufferWriteLong uOutput, TLS_EXTENSION_RENEGOTIATION_INFO, Size:=2
                             pvBufferWriteBlockStart uOutput, Size:=2
@@ -1479,14 +1956,11 @@ Private Sub pvTlsBuildServerLegacyKeyExchange(uCtx As UcsTlsContext, uOutput As
 End Sub
 
 Private Sub pvTlsBuildServerHandshakeFinished(uCtx As UcsTlsContext, uOutput As UcsBuffer)
-    Dim baHandshakeHash() As Byte
     Dim lMessagePos     As Long
-    Dim uVerify         As UcsBuffer
     Dim lIdx            As Long
     Dim baCert()        As Byte
     Dim baSignature()   As Byte
-    Dim baTemp()        As Byte
-    Dim baEmpty()       As Byte
+    Dim baVerifyData()  As Byte
     
     With uCtx
         '--- Record Header
@@ -1506,78 +1980,178 @@ Private Sub pvTlsBuildServerHandshakeFinished(uCtx As UcsTlsContext, uOutput As
                             pvBufferWriteBlockEnd uOutput
                         pvBufferWriteBlockEnd uOutput
                     End If
-                pvBufferWriteBlockEnd uOutput
-            pvBufferWriteBlockEnd uOutput
-            '--- Server Certificate
-            pvBufferWriteLong uOutput, TLS_HANDSHAKE_CERTIFICATE
-            pvBufferWriteBlockStart uOutput, Size:=3
-                '--- certificate request context
-                pvBufferWriteBlockStart uOutput
-                    '--- empty
-                pvBufferWriteBlockEnd uOutput
-                pvBufferWriteBlockStart uOutput, Size:=3
-                    For lIdx = 1 To pvCollectionCount(.LocalCertificates)
-                        pvBufferWriteBlockStart uOutput, Size:=3
-                            baCert = .LocalCertificates.Item(lIdx)
-                            pvBufferWriteArray uOutput, baCert
-                        pvBufferWriteBlockEnd uOutput
-                        '--- certificate extensions
+                    If .RemoteRecordSizeLimit <> 0 Then
+                        pvBufferWriteLong uOutput, TLS_EXTENSION_RECORD_SIZE_LIMIT, Size:=2
                         pvBufferWriteBlockStart uOutput, Size:=2
-                            '--- empty
+                            pvBufferWriteLong uOutput, TLS_MAX_PLAINTEXT_RECORD_SIZE + 1, Size:=2
                         pvBufferWriteBlockEnd uOutput
-                    Next
+                    End If
                 pvBufferWriteBlockEnd uOutput
             pvBufferWriteBlockEnd uOutput
             pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
+            If Not .PskSelected Then
+                '--- Server Certificate
+                lMessagePos = uOutput.Size
+                pvBufferWriteLong uOutput, TLS_HANDSHAKE_CERTIFICATE
+                pvBufferWriteBlockStart uOutput, Size:=3
+                    '--- certificate request context
+                    pvBufferWriteBlockStart uOutput
+                        '--- empty
+                    pvBufferWriteBlockEnd uOutput
+                    pvBufferWriteBlockStart uOutput, Size:=3
+                        For lIdx = 1 To pvCollectionCount(.LocalCertificates)
+                            pvBufferWriteBlockStart uOutput, Size:=3
+                                baCert = .LocalCertificates.Item(lIdx)
+                                pvBufferWriteArray uOutput, baCert
+                            pvBufferWriteBlockEnd uOutput
+                            '--- certificate extensions
+                            pvBufferWriteBlockStart uOutput, Size:=2
+                                '--- empty
+                            pvBufferWriteBlockEnd uOutput
+                        Next
+                    pvBufferWriteBlockEnd uOutput
+                pvBufferWriteBlockEnd uOutput
+                pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
+                pvTlsGetServerVerifyData uCtx, baVerifyData
+                If pvTlsSignatureQueue(uCtx, .LocalPrivateKey, .SignatureScheme, baVerifyData) Then
+                    '--- send EncryptedExtensions and Certificate now, rest of flight follows on completion
+                    pvBufferWriteLong uOutput, TLS_CONTENT_TYPE_HANDSHAKE
+                    pvBufferWriteRecordEnd uOutput, uCtx
+                    Exit Sub
+                End If
+                pvTlsSignatureSign baSignature, .LocalPrivateKey, .SignatureScheme, baVerifyData
+            End If
+            pvTlsBuildServerVerifyFinished uCtx, uOutput, baSignature
+            '--- Record Type
+            pvBufferWriteLong uOutput, TLS_CONTENT_TYPE_HANDSHAKE
+        pvBufferWriteRecordEnd uOutput, uCtx
+    End With
+End Sub
+
+Private Sub pvTlsBuildServerVerifyFinished(uCtx As UcsTlsContext, uOutput As UcsBuffer, baSignature() As Byte)
+    Dim baHandshakeHash() As Byte
+    Dim lMessagePos     As Long
+    Dim baVerifyData()  As Byte
+    Dim baTemp()        As Byte
+    Dim baEmpty()       As Byte
+    
+    With uCtx
+        If Not .PskSelected Then
             '--- Server Certificate Verify
             lMessagePos = uOutput.Size
             pvBufferWriteLong uOutput, TLS_HANDSHAKE_CERTIFICATE_VERIFY
             pvBufferWriteBlockStart uOutput, Size:=3
                 pvBufferWriteLong uOutput, .SignatureScheme, Size:=2
                 pvBufferWriteBlockStart uOutput, Size:=2
-                    pvTlsGetHandshakeHash uCtx, baHandshakeHash
-                    pvBufferWriteString uVerify, Space$(64) & "TLS 1.3, server CertificateVerify" & Chr$(0)
-                    pvBufferWriteArray uVerify, baHandshakeHash
-                    pvBufferWriteEOF uVerify
-                    pvTlsSignatureSign baSignature, .LocalPrivateKey, .SignatureScheme, uVerify.Data
                     pvBufferWriteArray uOutput, baSignature
                 pvBufferWriteBlockEnd uOutput
             pvBufferWriteBlockEnd uOutput
             pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
-            '--- Server Handshake Finished
-            lMessagePos = uOutput.Size
-            pvBufferWriteLong uOutput, TLS_HANDSHAKE_FINISHED
-            pvBufferWriteBlockStart uOutput, Size:=3
-                pvTlsGetHandshakeHash uCtx, baHandshakeHash
-                pvTlsHkdfExpandLabel baTemp, .DigestAlgo, .LocalTrafficSecret, "finished", baEmpty, .DigestSize
-                pvTlsHkdfExtract uVerify.Data, .DigestAlgo, baTemp, baHandshakeHash
-                pvBufferWriteArray uOutput, uVerify.Data
-            pvBufferWriteBlockEnd uOutput
-            pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
+        End If
+        '--- Server Handshake Finished
+        lMessagePos = uOutput.Size
+        pvBufferWriteLong uOutput, TLS_HANDSHAKE_FINISHED
+        pvBufferWriteBlockStart uOutput, Size:=3
+            pvTlsGetHandshakeHash uCtx, baHandshakeHash
+            pvTlsHkdfExpandLabel baTemp, .DigestAlgo, .LocalTrafficSecret, "finished", baEmpty, .DigestSize
+            pvTlsHkdfExtract baVerifyData, .DigestAlgo, baTemp, baHandshakeHash
+            pvBufferWriteArray uOutput, baVerifyData
+        pvBufferWriteBlockEnd uOutput
+        pvTlsAppendHandshakeHash uCtx, uOutput.Data, lMessagePos, uOutput.Size - lMessagePos
+    End With
+End Sub
+
+Private Function pvTlsResumeServerHandshake(uCtx As UcsTlsContext, uOutput As UcsBuffer) As Boolean
+    Dim baSignature()   As Byte
+    Dim baVerifyData()  As Byte
+    
+    With uCtx
+        If Not pvTlsSignatureComplete(uCtx, baSignature) Then
+            GoTo QH
+        End If
+        If pvArraySize(baSignature) = 0 Then
+            '--- worker failed (e.g. ECDSA nonce out of range) so retry inline
+            pvTlsGetServerVerifyData uCtx, baVerifyData
+            pvTlsSignatureSign baSignature, .LocalPrivateKey, .SignatureScheme, baVerifyData
+        End If
+        '--- Record Header
+        pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_APPDATA, uCtx
+            pvTlsBuildServerVerifyFinished uCtx, uOutput, baSignature
             '--- Record Type
             pvBufferWriteLong uOutput, TLS_CONTENT_TYPE_HANDSHAKE
         pvBufferWriteRecordEnd uOutput, uCtx
     End With
-End Sub
+    '--- success
+    pvTlsResumeServerHandshake = True
+QH:
+End Function
 
-Private Sub pvTlsBuildServerLegacyFinished(uCtx As UcsTlsContext, uOutput As UcsBuffer)
+Private Sub pvTlsGetServerVerifyData(uCtx As UcsTlsContext, baRetVal() As Byte)
     Dim baHandshakeHash() As Byte
     Dim uVerify         As UcsBuffer
     
+    pvTlsGetHandshakeHash uCtx, baHandshakeHash
+    pvBufferWriteString uVerify, Space$(64) & "TLS 1.3, server CertificateVerify" & Chr$(0)
+    pvBufferWriteArray uVerify, baHandshakeHash
+    pvBufferWriteEOF uVerify
+    baRetVal = uVerify.Data
+End Sub
+
+Private Sub pvTlsBuildServerNewSessionTicket(uCtx As UcsTlsContext, uOutput As UcsBuffer)
+    Dim lAgeAdd         As Long
+    Dim baNonce()       As Byte
+    Dim baPsk()         As Byte
+    Dim baTicket()      As Byte
+    
     With uCtx
-        '--- Change Cipher Spec
-        pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_CHANGE_CIPHER_SPEC, uCtx
-            pvBufferWriteLong uOutput, 1
-        pvBufferWriteRecordEnd uOutput, uCtx
-        '--- commit next epoch local secrets
-        .LocalMacKey = .LocalLegacyNextMacKey
-        .LocalTrafficKey = .LocalLegacyNextTrafficKey
-        .LocalTrafficIV = .LocalLegacyNextTrafficIV
-        .LocalTrafficSeqNo = 0
-        .LocalEncryptThenMac = (.MacSize > 0) And SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_ENCRYPT_THEN_MAC)
+        pvTlsGetRandom baNonce, 4
+        Call CopyMemory(lAgeAdd, baNonce(0), 4)
+        pvTlsGetRandom baNonce, 8
+        pvTlsHkdfExpandLabel baPsk, .DigestAlgo, .ResumptionSecret, "resumption", baNonce, .DigestSize
+        pvTlsTicketEncrypt uCtx, baPsk, lAgeAdd, baTicket
         '--- Record Header
-        pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_HANDSHAKE, uCtx
-            '--- Server Handshake Finished
+        pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_APPDATA, uCtx
+            '--- New Session Ticket
+            pvBufferWriteLong uOutput, TLS_HANDSHAKE_NEW_SESSION_TICKET
+            pvBufferWriteBlockStart uOutput, Size:=3
+                pvBufferWriteLong uOutput, TLS_SESSION_TICKET_LIFETIME, Size:=4
+                pvBufferWriteLong uOutput, lAgeAdd, Size:=4
+                pvBufferWriteBlockStart uOutput
+                    pvBufferWriteArray uOutput, baNonce
+                pvBufferWriteBlockEnd uOutput
+                pvBufferWriteBlockStart uOutput, Size:=2
+                    pvBufferWriteArray uOutput, baTicket
+                pvBufferWriteBlockEnd uOutput
+                '--- extensions
+                pvBufferWriteBlockStart uOutput, Size:=2
+                    '--- empty
+                pvBufferWriteBlockEnd uOutput
+            pvBufferWriteBlockEnd uOutput
+            '--- Record Type
+            pvBufferWriteLong uOutput, TLS_CONTENT_TYPE_HANDSHAKE
+        pvBufferWriteRecordEnd uOutput, uCtx
+    End With
+End Sub
+
+Private Sub pvTlsBuildServerLegacyFinished(uCtx As UcsTlsContext, uOutput As UcsBuffer)
+    Dim baHandshakeHash() As Byte
+    Dim uVerify         As UcsBuffer
+    
+    With uCtx
+        '--- Change Cipher Spec
+        pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_CHANGE_CIPHER_SPEC, uCtx
+            pvBufferWriteLong uOutput, 1
+        pvBufferWriteRecordEnd uOutput, uCtx
+        '--- commit next epoch local secrets
+        .LocalMacKey = .LocalLegacyNextMacKey
+        .LocalTrafficKey = .LocalLegacyNextTrafficKey
+        pvTlsSetupTrafficCtx .LocalTrafficCtx, .BulkAlgo, .LocalTrafficKey
+        .LocalTrafficIV = .LocalLegacyNextTrafficIV
+        .LocalTrafficSeqNo = 0
+        .LocalEncryptThenMac = (.MacSize > 0) And SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_ENCRYPT_THEN_MAC)
+        '--- Record Header
+        pvBufferWriteRecordStart uOutput, TLS_CONTENT_TYPE_HANDSHAKE, uCtx
+            '--- Server Handshake Finished
             pvBufferWriteLong uOutput, TLS_HANDSHAKE_FINISHED
             pvBufferWriteBlockStart uOutput, Size:=3
                 pvTlsGetHandshakeHash uCtx, baHandshakeHash
@@ -1606,6 +2180,19 @@ Private Sub pvTlsBuildApplicationData(uCtx As UcsTlsContext, uOutput As UcsBuffe
     End With
 End Sub
 
+Private Function pvTlsGetSendRecordSize(uCtx As UcsTlsContext, ByVal lMaxSize As Long) As Long
+    With uCtx
+        pvTlsGetSendRecordSize = TLS_MAX_PLAINTEXT_RECORD_SIZE
+        If .RemoteRecordSizeLimit > 0 Then
+            '--- TLS 1.3 limit includes inner content type
+            pvTlsGetSendRecordSize = Clamp(.RemoteRecordSizeLimit - IIf(.ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13, 1, 0), 1, TLS_MAX_PLAINTEXT_RECORD_SIZE)
+        End If
+        If lMaxSize > 0 And lMaxSize < pvTlsGetSendRecordSize Then
+            pvTlsGetSendRecordSize = lMaxSize
+        End If
+    End With
+End Function
+
 Private Sub pvTlsBuildAlert(uCtx As UcsTlsContext, uOutput As UcsBuffer, ByVal eAlertDesc As UcsTlsAlertDescriptionsEnum, ByVal lAlertLevel As Long)
     Dim baHandshakeHash() As Byte
     Dim baTemp()        As Byte
@@ -1636,23 +2223,31 @@ End Sub
 
 Private Function pvTlsParsePayload(uCtx As UcsTlsContext, baInput() As Byte, lSize As Long, sError As String, eAlertCode As UcsTlsAlertDescriptionsEnum) As Boolean
     Dim lNewSize        As Long
+    Dim bParse          As Boolean
     
     On Error GoTo EH
-    If lSize > 0 Then
     With uCtx
-        pvBufferWriteBlob .RecvBuffer, VarPtr(baInput(0)), lSize
-        If Not pvTlsParseRecord(uCtx, .RecvBuffer, sError, eAlertCode) Then
-            GoTo QH
+        If lSize > 0 Then
+            pvBufferWriteBlob .RecvBuffer, VarPtr(baInput(0)), lSize
+            bParse = True
+        End If
+        If .AsyncJob <> 0 Then
+            '--- input stays buffered until the worker thread is done w/ CertificateVerify
+            bParse = pvTlsResumeServerHandshake(uCtx, .SendBuffer)
         End If
-        lNewSize = .RecvBuffer.Size - .RecvBuffer.Pos
-        If lNewSize > 0 Then
-            Debug.Assert pvArraySize(.RecvBuffer.Data) >= .RecvBuffer.Pos + lNewSize
-            Call CopyMemory(.RecvBuffer.Data(0), .RecvBuffer.Data(.RecvBuffer.Pos), lNewSize)
+        If bParse Then
+            If Not pvTlsParseRecord(uCtx, .RecvBuffer, sError, eAlertCode) Then
+                GoTo QH
+            End If
+            lNewSize = .RecvBuffer.Size - .RecvBuffer.Pos
+            If lNewSize > 0 Then
+                Debug.Assert pvArraySize(.RecvBuffer.Data) >= .RecvBuffer.Pos + lNewSize
+                Call CopyMemory(.RecvBuffer.Data(0), .RecvBuffer.Data(.RecvBuffer.Pos), lNewSize)
+            End If
+            .RecvBuffer.Pos = 0
+            .RecvBuffer.Size = IIf(lNewSize > 0, lNewSize, 0)
         End If
-        .RecvBuffer.Pos = 0
-        .RecvBuffer.Size = IIf(lNewSize > 0, lNewSize, 0)
     End With
-    End If
     '--- success
     pvTlsParsePayload = True
 QH:
@@ -1678,7 +2273,7 @@ Private Function pvTlsParseRecord(uCtx As UcsTlsContext, uInput As UcsBuffer, sE
     
     On Error GoTo EH
     With uCtx
-    Do While uInput.Pos + 4 < uInput.Size
+    Do While uInput.Pos + 4 < uInput.Size And .AsyncJob = 0
         lRecordPos = uInput.Pos
         pvBufferReadLong uInput, lRecordType
         If lRecordType < TLS_CONTENT_TYPE_CHANGE_CIPHER_SPEC Or lRecordType > TLS_CONTENT_TYPE_APPDATA Then
@@ -1692,6 +2287,9 @@ Private Function pvTlsParseRecord(uCtx As UcsTlsContext, uInput As UcsBuffer, sE
                 uInput.Pos = lRecordPos
                 Exit Do
             End If
+            #If ImplUseStats Then
+                pvTlsStatsAdd m_uStats, ucsTlsStatRecordsIn, 1
+            #End If
             '--- try to decrypt record
             If pvArraySize(.RemoteTrafficKey) > 0 Then
                 '--- check ciphertext size
@@ -1711,7 +2309,7 @@ Private Function pvTlsParseRecord(uCtx As UcsTlsContext, uInput As UcsBuffer, sE
                     If lRecordType <> TLS_CONTENT_TYPE_APPDATA Then
                         GoTo UnexpectedRecordType
                     End If
-                    bResult = pvTlsBulkDecrypt(.BulkAlgo, baRemoteIV, .RemoteTrafficKey, uInput.Data, lRecordPos, TLS_AAD_SIZE, uInput.Data, uInput.Pos, lRecordSize)
+                    bResult = pvTlsBulkDecrypt(.BulkAlgo, baRemoteIV, .RemoteTrafficKey, .RemoteTrafficCtx, uInput.Data, lRecordPos, TLS_AAD_SIZE, uInput.Data, uInput.Pos, lRecordSize)
                 ElseIf .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS12 Then
                     If .IvExplicitSize > 0 Then '--- AES in TLS 1.2
                         pvArrayWriteBlob baRemoteIV, .IvSize - .IvExplicitSize, VarPtr(uInput.Data(uInput.Pos)), .IvExplicitSize
@@ -1730,7 +2328,7 @@ Private Function pvTlsParseRecord(uCtx As UcsTlsContext, uInput As UcsBuffer, sE
                         pvBufferWriteLong uAad, lEnd - uInput.Pos + .IvExplicitSize, Size:=2
                         pvBufferWriteBlob uAad, VarPtr(uInput.Data(uInput.Pos - .IvExplicitSize)), lEnd - uInput.Pos + .IvExplicitSize
                     End If
-                    bResult = pvTlsBulkDecrypt(.BulkAlgo, baRemoteIV, .RemoteTrafficKey, uAad.Data, 0, uAad.Size, uInput.Data, uInput.Pos, lEnd - uInput.Pos + .TagSize)
+                    bResult = pvTlsBulkDecrypt(.BulkAlgo, baRemoteIV, .RemoteTrafficKey, .RemoteTrafficCtx, uAad.Data, 0, uAad.Size, uInput.Data, uInput.Pos, lEnd - uInput.Pos + .TagSize)
                 End If
                 If Not bResult Then
                     GoTo DecryptionFailed
@@ -1774,7 +2372,7 @@ Private Function pvTlsParseRecord(uCtx As UcsTlsContext, uInput As UcsBuffer, sE
                     pvTlsGetHmac baHmac, .MacAlgo, .RemoteMacKey, uAad.Data, 0, uAad.Size
                     pvArrayAllocate baRemoteIV, .MacSize, FUNC_NAME & ".baRemoteIV"
                     Call CopyMemory(baRemoteIV(0), ByVal VarPtr(uInput.Data(lEnd)), .MacSize)
-                    If Not pvArrayEqual(baHmac, baRemoteIV) Then
+                    If Not pvArrayEqualConstTime(baHmac, baRemoteIV) Then
                         GoTo RecordMacFailed
                     End If
                     If .RemoteEncryptThenMac Then
@@ -1814,6 +2412,7 @@ Unencrypted:
                     '--- commit next epoch remote secrets
                     .RemoteMacKey = .RemoteLegacyNextMacKey
                     .RemoteTrafficKey = .RemoteLegacyNextTrafficKey
+                    pvTlsSetupTrafficCtx .RemoteTrafficCtx, .BulkAlgo, .RemoteTrafficKey
                     .RemoteTrafficIV = .RemoteLegacyNextTrafficIV
                     .RemoteTrafficSeqNo = 0
                     .RemoteEncryptThenMac = (.MacSize > 0) And SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_ENCRYPT_THEN_MAC)
@@ -1926,7 +2525,6 @@ Private Function pvTlsParseHandshake(uCtx As UcsTlsContext, uInput As UcsBuffer,
     Dim baSignature()   As Byte
     Dim baCert()        As Byte
     Dim lCertSize       As Long
-    Dim lCertEnd        As Long
     Dim lSignPos        As Long
     Dim lSignSize       As Long
     Dim baTemp()        As Byte
@@ -1967,7 +2565,7 @@ Private Function pvTlsParseHandshake(uCtx As UcsTlsContext, uInput As UcsBuffer,
                     If .HelloRetryRequest Then
                         '--- on HelloRetryRequest replace HandshakeMessages w/ 'synthetic handshake message'
                         pvTlsGetHandshakeHash uCtx, baHandshakeHash
-                        .HandshakeMessages.Size = 0
+                        pvTlsResetHandshakeHash uCtx
                         pvBufferWriteLong .HandshakeMessages, TLS_HANDSHAKE_MESSAGE_HASH
                         pvBufferWriteLong .HandshakeMessages, .DigestSize, Size:=3
                         pvBufferWriteArray .HandshakeMessages, baHandshakeHash
@@ -2019,6 +2617,23 @@ Private Function pvTlsParseHandshake(uCtx As UcsTlsContext, uInput As UcsBuffer,
                                         pvBufferReadString uInput, .AlpnNegotiated, lStringSize
                                     pvBufferReadBlockEnd uInput
                                 pvBufferReadBlockEnd uInput
+                            Case TLS_EXTENSION_EARLY_DATA
+                                If Not .EarlyDataSent Or Not .PskSelected Then
+                                    GoTo UnexpectedExtension
+                                End If
+                                If lExtSize <> 0 Then
+                                    GoTo InvalidSize
+                                End If
+                                .EarlyDataAccepted = True
+                                Erase .EarlyData
+                            Case TLS_EXTENSION_RECORD_SIZE_LIMIT
+                                If lExtSize <> 2 Then
+                                    GoTo InvalidSize
+                                End If
+                                pvBufferReadLong uInput, .RemoteRecordSizeLimit, Size:=2
+                                If .RemoteRecordSizeLimit < TLS_MIN_RECORD_SIZE_LIMIT Then
+                                    GoTo InvalidSize
+                                End If
                             Case TLS_EXTENSION_SUPPORTED_GROUPS
                                 If lExtSize < 2 Then
                                     GoTo InvalidSize
@@ -2034,69 +2649,35 @@ Private Function pvTlsParseHandshake(uCtx As UcsTlsContext, uInput As UcsBuffer,
                         pvBufferReadBlockEnd uInput
                     Loop
                     pvBufferReadBlockEnd uInput
+                    If .EarlyDataAccepted Then
+                        '--- RFC 8446 4.2.10: early data needs same cipher suite and ALPN as the ticket
+                        If .CipherSuite <> .PskTicket(ucsTlsTicketCipherSuite) Then
+                            sError = Replace(ERR_EARLY_DATA_MISMATCH, "%1", "cipher suite")
+                            GoTo EarlyDataMismatch
+                        End If
+                        If .AlpnNegotiated <> .PskTicket(ucsTlsTicketAlpn) Then
+                            sError = Replace(ERR_EARLY_DATA_MISMATCH, "%1", "ALPN")
+                            GoTo EarlyDataMismatch
+                        End If
+                    End If
                 Case TLS_HANDSHAKE_CERTIFICATE
-                    If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
-                        pvBufferReadBlockStart uInput, BlockSize:=lCertSize
-                            If uInput.Pos + lCertSize > lMessageEnd Then
-                                GoTo InvalidSize
-                            End If
-                            uInput.Pos = uInput.Pos + lCertSize '--- skip RemoteCertReqContext
-                        pvBufferReadBlockEnd uInput
+                    If .PskSelected Then
+                        GoTo UnexpectedMessageType
                     End If
-                    Set .RemoteCertificates = New Collection
-                    If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
-                        Set .RemoteCertStatuses = New Collection
+                    If Not pvTlsParseHandshakeCertificate(uCtx, uInput, lMessageEnd, sError, eAlertCode) Then
+                        GoTo QH
                     End If
-                    If uInput.Pos + 3 > lMessageEnd Then
-                        GoTo InvalidSize
+                Case IIf(.ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13, TLS_HANDSHAKE_COMPRESSED_CERTIFICATE, -1)
+                    If .PskSelected Then
+                        GoTo UnexpectedMessageType
+                    End If
+                    If Not pvTlsParseHandshakeCompressedCertificate(uCtx, uInput, lMessageEnd, sError, eAlertCode) Then
+                        GoTo QH
                     End If
-                    pvBufferReadBlockStart uInput, Size:=3, BlockSize:=lCertSize
-                        lCertEnd = uInput.Pos + lCertSize
-                        If lCertEnd <> lMessageEnd Then
-                            GoTo InvalidSize
-                        End If
-                        Do While uInput.Pos + 2 < lCertEnd
-                            pvBufferReadBlockStart uInput, Size:=3, BlockSize:=lCertSize
-                                If uInput.Pos + lCertSize > lCertEnd Then
-                                    GoTo InvalidSize
-                                End If
-                                pvBufferReadArray uInput, baCert, lCertSize
-                                .RemoteCertificates.Add baCert
-                            pvBufferReadBlockEnd uInput
-                            If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
-                                baCert = vbNullString
-                                If uInput.Pos + 2 > lCertEnd Then
-                                    GoTo InvalidSize
-                                End If
-                                pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
-                                lBlockEnd = uInput.Pos + lBlockSize
-                                If lBlockEnd > lCertEnd Then
-                                    GoTo InvalidSize
-                                End If
-                                Do While uInput.Pos + 1 < lBlockEnd
-                                    pvBufferReadLong uInput, lExtType, Size:=2
-                                    #If ImplUseDebugLog Then
-'                                        DebugLog MODULE_NAME, FUNC_NAME, "CertificateExtensions " & pvTlsGetExtensionName(lExtType)
-                                    #End If
-                                    pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lExtSize
-                                        lExtEnd = uInput.Pos + lExtSize
-                                        If lExtEnd > lBlockEnd Then
-                                            GoTo InvalidSize
-                                        End If
-                                        Select Case lExtType
-                                        Case TLS_EXTENSION_STATUS_REQUEST
-                                            pvBufferReadArray uInput, baCert, lExtSize
-                                        Case Else
-                                            uInput.Pos = uInput.Pos + lExtSize
-                                        End Select
-                                    pvBufferReadBlockEnd uInput
-                                Loop
-                                pvBufferReadBlockEnd uInput
-                                .RemoteCertStatuses.Add baCert
-                            End If
-                        Loop
-                    pvBufferReadBlockEnd uInput
                 Case TLS_HANDSHAKE_CERTIFICATE_VERIFY
+                    If .PskSelected Then
+                        GoTo UnexpectedMessageType
+                    End If
                     If uInput.Pos + 2 > lMessageEnd Then
                         GoTo InvalidSize
                     End If
@@ -2122,7 +2703,7 @@ Private Function pvTlsParseHandshake(uCtx As UcsTlsContext, uInput As UcsBuffer,
                     pvTlsGetHandshakeHash uCtx, baHandshakeHash
                     pvTlsHkdfExpandLabel baTemp, .DigestAlgo, .RemoteTrafficSecret, "finished", baEmpty, .DigestSize
                     pvTlsHkdfExtract uVerify.Data, .DigestAlgo, baTemp, baHandshakeHash
-                    If Not pvArrayEqual(uVerify.Data, baMessage) Then
+                    If Not pvArrayEqualConstTime(uVerify.Data, baMessage) Then
                         GoTo ServerHandshakeFailed
                     End If
                     .State = ucsTlsStatePostHandshake
@@ -2233,6 +2814,7 @@ Private Function pvTlsParseHandshake(uCtx As UcsTlsContext, uInput As UcsBuffer,
                     pvTlsGetHandshakeHash uCtx, baHandshakeHash
                     pvTlsBuildClientHandshakeFinished uCtx, .SendBuffer
                     pvTlsDeriveApplicationSecrets uCtx, baHandshakeHash
+                    pvTlsDeriveResumptionSecret uCtx
                     pvTlsResetHandshakeHash uCtx
                 End If
             Case ucsTlsStateExpectServerFinished
@@ -2246,7 +2828,7 @@ Private Function pvTlsParseHandshake(uCtx As UcsTlsContext, uInput As UcsBuffer,
                     pvBufferReadArray uInput, baMessage, lMessageSize
                     pvTlsGetHandshakeHash uCtx, baHandshakeHash
                     pvTlsKdfLegacyPrf uVerify.Data, .DigestAlgo, .MasterSecret, "server finished", baHandshakeHash, TLS_VERIFY_DATA_SIZE
-                    If Not pvArrayEqual(uVerify.Data, baMessage) Then
+                    If Not pvArrayEqualConstTime(uVerify.Data, baMessage) Then
                         GoTo ServerHandshakeFailed
                     End If
                     '--- save for secure renegotiation check
@@ -2335,7 +2917,7 @@ RenegotiateClientHello:
                 If .HelloRetryRequest Then
                     '--- on HelloRetryRequest replace HandshakeMessages w/ 'synthetic handshake message'
                     pvTlsGetHandshakeHash uCtx, baHandshakeHash
-                    .HandshakeMessages.Size = 0
+                    pvTlsResetHandshakeHash uCtx
                     pvBufferWriteLong .HandshakeMessages, TLS_HANDSHAKE_MESSAGE_HASH
                     pvBufferWriteLong .HandshakeMessages, .DigestSize, Size:=3
                     pvBufferWriteArray .HandshakeMessages, baHandshakeHash
@@ -2404,7 +2986,7 @@ RenegotiateClientHello:
                             .RemoteLegacyVerifyData = uVerify.Data
                         End If
                     End If
-                    If Not pvArrayEqual(uVerify.Data, baMessage) Then
+                    If Not pvArrayEqualConstTime(uVerify.Data, baMessage) Then
                         GoTo ServerHandshakeFailed
                     End If
                     .State = ucsTlsStatePostHandshake
@@ -2421,8 +3003,13 @@ RenegotiateClientHello:
                     If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
                         pvTlsGetHandshakeHash uCtx, baHandshakeHash
                         pvTlsDeriveApplicationSecrets uCtx, baHandshakeHash
+                        pvTlsAppendHandshakeHash uCtx, uInput.Data, lMessagePos, lMessageSize + 4
+                        pvTlsDeriveResumptionSecret uCtx
                         pvTlsResetHandshakeHash uCtx
                         Set .RemoteTickets = New Collection
+                        If SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_PSK_KEY_EXCHANGE_MODES) Then
+                            pvTlsBuildServerNewSessionTicket uCtx, .SendBuffer
+                        End If
                     Else
                         Debug.Assert .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS12
                         pvTlsBuildServerLegacyFinished uCtx, .SendBuffer
@@ -2464,9 +3051,15 @@ RenegotiateClientHello:
                     GoTo RenegotiateClientHello
 #End If
                 Case TLS_HANDSHAKE_NEW_SESSION_TICKET
-                    pvBufferReadArray uInput, baMessage, lMessageSize
-                    If Not .RemoteTickets Is Nothing Then
-                        .RemoteTickets.Add baMessage
+                    If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 And Not .IsServer Then
+                        If Not pvTlsParseHandshakeNewSessionTicket(uCtx, uInput, lMessageEnd, sError, eAlertCode) Then
+                            GoTo QH
+                        End If
+                    Else
+                        pvBufferReadArray uInput, baMessage, lMessageSize
+                        If Not .RemoteTickets Is Nothing Then
+                            .RemoteTickets.Add baMessage
+                        End If
                     End If
                 Case TLS_HANDSHAKE_KEY_UPDATE
                     #If ImplUseDebugLog Then
@@ -2552,6 +3145,13 @@ MissingTrafficKeys:
     sError = ERR_MISSING_TRAFFIC_KEYS
     eAlertCode = uscTlsAlertUnexpectedMessage
     GoTo QH
+UnexpectedExtension:
+    sError = Replace(ERR_UNEXPECTED_EXTENSION, "%1", pvTlsGetExtensionName(lExtType))
+    eAlertCode = uscTlsAlertIllegalParameter
+    GoTo QH
+EarlyDataMismatch:
+    eAlertCode = uscTlsAlertIllegalParameter
+    GoTo QH
 EH:
     sError = Err.Description & " [" & Err.Source & "]"
     eAlertCode = uscTlsAlertInternalError
@@ -2570,6 +3170,7 @@ Private Function pvTlsParseHandshakeServerHello(uCtx As UcsTlsContext, uInput As
     Dim lPublicSize     As Long
     Dim lNameSize       As Long
     Dim lCookieSize     As Long
+    Dim lSelectedIdentity As Long
     
     On Error GoTo EH
     lExtType = -1
@@ -2578,6 +3179,7 @@ Private Function pvTlsParseHandshakeServerHello(uCtx As UcsTlsContext, uInput As
     End If
     With uCtx
         .ProtocolVersion = IIf(lRecordProtocol <= TLS_PROTOCOL_VERSION_TLS12, TLS_PROTOCOL_VERSION_TLS12, TLS_PROTOCOL_VERSION_TLS13)
+        .PskSelected = False
         pvBufferReadLong uInput, .RemoteProtocolVersion, Size:=2
         pvBufferReadArray uInput, .RemoteExchRandom, TLS_HELLO_RANDOM_SIZE
         If .HelloRetryRequest Then
@@ -2663,6 +3265,22 @@ Private Function pvTlsParseHandshakeServerHello(uCtx As UcsTlsContext, uInput As
                                 End If
                                 pvBufferReadArray uInput, .HelloRetryCookie, lCookieSize
                             pvBufferReadBlockEnd uInput
+                        Case IIf((.LocalFeatures And ucsTlsSupportTls13) <> 0, TLS_EXTENSION_PRE_SHARED_KEY, -1)
+                            If lExtSize <> 2 Then
+                                GoTo InvalidSize
+                            End If
+                            pvBufferReadLong uInput, lSelectedIdentity, Size:=2
+                            If IsEmpty(.PskTicket) Or lSelectedIdentity <> 0 Then
+                                GoTo UnexpectedExtension
+                            End If
+                            If .PskTicket(ucsTlsTicketDigestAlgo) <> .DigestAlgo Then
+                                GoTo UnexpectedExtension
+                            End If
+                            .PreSharedKey = .PskTicket(ucsTlsTicketPsk)
+                            .PskSelected = True
+                            '--- server is not sending certificates on resumption so restore from original handshake
+                            Set .RemoteCertificates = .PskTicket(ucsTlsTicketCertificates)
+                            Set .RemoteCertStatuses = .PskTicket(ucsTlsTicketCertStatuses)
                         Case TLS_EXTENSION_ALPN
                             If lExtSize < 2 Then
                                 GoTo InvalidSize
@@ -2688,6 +3306,14 @@ Private Function pvTlsParseHandshakeServerHello(uCtx As UcsTlsContext, uInput As
                                 End If
                                 pvBufferReadArray uInput, .RemoteLegacyRenegInfo, lNameSize
                             pvBufferReadBlockEnd uInput
+                        Case TLS_EXTENSION_RECORD_SIZE_LIMIT
+                            If lExtSize <> 2 Then
+                                GoTo InvalidSize
+                            End If
+                            pvBufferReadLong uInput, .RemoteRecordSizeLimit, Size:=2
+                            If .RemoteRecordSizeLimit < TLS_MIN_RECORD_SIZE_LIMIT Then
+                                GoTo InvalidSize
+                            End If
                         Case Else
                             uInput.Pos = uInput.Pos + lExtSize
                         End Select
@@ -2697,6 +3323,11 @@ Private Function pvTlsParseHandshakeServerHello(uCtx As UcsTlsContext, uInput As
                     pvBufferReadBlockEnd uInput
                 Loop
             pvBufferReadBlockEnd uInput
+            '--- TLS 1.3 server sends record_size_limit in EncryptedExtensions only (RFC 8449, section 4)
+            If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 And SearchCollection(.RemoteExtensions, "#" & TLS_EXTENSION_RECORD_SIZE_LIMIT) Then
+                lExtType = TLS_EXTENSION_RECORD_SIZE_LIMIT
+                GoTo UnexpectedExtension
+            End If
         End If
     End With
     '--- success
@@ -2750,12 +3381,26 @@ Private Function pvTlsParseHandshakeClientHello(uCtx As UcsTlsContext, uInput As
     Dim lAlpnPref       As Long
     Dim lCompression    As Long
     Dim cPrevRemoteExt  As Collection
+    Dim lMessagePos     As Long
+    Dim lBlockEnd       As Long
+    Dim lPskMode        As Long
+    Dim bPskDhe         As Boolean
+    Dim cPskIdentities  As Collection
+    Dim cPskBinders     As Collection
+    Dim lBindersPos     As Long
+    Dim baTicket()      As Byte
+    Dim baPsk()         As Byte
+    Dim baBinder()      As Byte
     
     On Error GoTo EH
     lExtType = -1
+    '--- handshake header already consumed
+    lMessagePos = uInput.Pos - 4
     With uCtx
         Set cPrevRemoteExt = .RemoteExtensions
         Set .RemoteExtensions = New Collection
+        .PskSelected = False
+        Erase .PreSharedKey
         If SearchCollection(.LocalPrivateKey, 1, RetVal:=baPrivKey) Then
             If Not pvAsn1DecodePrivateKey(baPrivKey, uKeyInfo) Then
                 GoTo UnsupportedCertificate
@@ -3078,6 +3723,72 @@ Private Function pvTlsParseHandshakeClientHello(uCtx As UcsTlsContext, uInput As
                             If lExtSize <> 0 Then
                                 GoTo InvalidSize
                             End If
+                        Case TLS_EXTENSION_RECORD_SIZE_LIMIT
+                            If lExtSize <> 2 Then
+                                GoTo InvalidSize
+                            End If
+                            pvBufferReadLong uInput, .RemoteRecordSizeLimit, Size:=2
+                            If .RemoteRecordSizeLimit < TLS_MIN_RECORD_SIZE_LIMIT Then
+                                GoTo InvalidSize
+                            End If
+                        Case IIf((.LocalFeatures And ucsTlsSupportTls13) <> 0, TLS_EXTENSION_PSK_KEY_EXCHANGE_MODES, -1)
+                            If lExtSize < 1 Then
+                                GoTo InvalidSize
+                            End If
+                            pvBufferReadBlockStart uInput, BlockSize:=lBlockSize
+                                If uInput.Pos + lBlockSize <> lExtEnd Or lBlockSize = 0 Then
+                                    GoTo InvalidSize
+                                End If
+                                Do While uInput.Pos < lExtEnd
+                                    pvBufferReadLong uInput, lPskMode
+                                    If lPskMode = TLS_PSK_KE_MODE_PSK_DHE Then
+                                        bPskDhe = True
+                                    End If
+                                Loop
+                            pvBufferReadBlockEnd uInput
+                        Case IIf((.LocalFeatures And ucsTlsSupportTls13) <> 0, TLS_EXTENSION_PRE_SHARED_KEY, -1)
+                            If lExtEnd <> lEnd Then
+                                GoTo UnexpectedExtension '--- must be last
+                            End If
+                            If lExtSize < 2 Then
+                                GoTo InvalidSize
+                            End If
+                            Set cPskIdentities = New Collection
+                            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+                                lBlockEnd = uInput.Pos + lBlockSize
+                                If lBlockEnd + 2 > lExtEnd Or lBlockSize = 0 Then
+                                    GoTo InvalidSize
+                                End If
+                                Do While uInput.Pos < lBlockEnd
+                                    pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lNameSize
+                                        If uInput.Pos + lNameSize + 4 > lBlockEnd Or lNameSize = 0 Then
+                                            GoTo InvalidSize
+                                        End If
+                                        pvBufferReadArray uInput, baTicket, lNameSize
+                                    pvBufferReadBlockEnd uInput
+                                    uInput.Pos = uInput.Pos + 4 '--- skip obfuscated_ticket_age
+                                    cPskIdentities.Add baTicket
+                                Loop
+                            pvBufferReadBlockEnd uInput
+                            lBindersPos = uInput.Pos
+                            Set cPskBinders = New Collection
+                            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+                                If uInput.Pos + lBlockSize <> lExtEnd Or lBlockSize = 0 Then
+                                    GoTo InvalidSize
+                                End If
+                                Do While uInput.Pos < lExtEnd
+                                    pvBufferReadBlockStart uInput, BlockSize:=lNameSize
+                                        If uInput.Pos + lNameSize > lExtEnd Or lNameSize = 0 Then
+                                            GoTo InvalidSize
+                                        End If
+                                        pvBufferReadArray uInput, baBinder, lNameSize
+                                    pvBufferReadBlockEnd uInput
+                                    cPskBinders.Add baBinder
+                                Loop
+                            pvBufferReadBlockEnd uInput
+                            If cPskBinders.Count <> cPskIdentities.Count Then
+                                GoTo InvalidSize
+                            End If
                         Case Else
                             If .HelloRetryRequest Then
                                 If Not SearchCollection(cPrevRemoteExt, "#" & lExtType) Then
@@ -3123,6 +3834,26 @@ Private Function pvTlsParseHandshakeClientHello(uCtx As UcsTlsContext, uInput As
             If Not SearchCollection(.RemoteExtensions, "#" & lExtType) Then
                 GoTo NoExtension
             End If
+            '--- resume on first valid ticket unless HelloRetryRequest is needed (only psk_dhe_ke mode supported)
+            If Not cPskIdentities Is Nothing And bPskDhe And .ExchGroup <> 0 Then
+                For lIdx = 1 To cPskIdentities.Count
+                    baTicket = cPskIdentities.Item(lIdx)
+                    If pvTlsTicketDecrypt(uCtx, baTicket, baPsk) Then
+                        baBinder = cPskBinders.Item(lIdx)
+                        pvTlsGetPskBinder uCtx, baTicket, .DigestAlgo, baPsk, uInput.Data, lMessagePos, lBindersPos - lMessagePos
+                        If Not pvArrayEqualConstTime(baTicket, baBinder) Then
+                            GoTo InvalidPskBinder
+                        End If
+                        .PreSharedKey = baPsk
+                        .PskSelected = True
+                        .PskIdentity = lIdx - 1
+                        #If ImplUseDebugLog Then
+                            DebugLog MODULE_NAME, FUNC_NAME, "Resuming session w/ ticket " & lIdx - 1
+                        #End If
+                        Exit For
+                    End If
+                Next
+            End If
         Else
             lExtType = TLS_EXTENSION_EXTENDED_MASTER_SECRET
             If SearchCollection(cPrevRemoteExt, "#" & lExtType) Then
@@ -3200,89 +3931,304 @@ SecureRenegotiationFailed:
     sError = ERR_SECURE_RENEGOTIATION_FAILED
     eAlertCode = uscTlsAlertHandshakeFailure
     GoTo QH
+InvalidPskBinder:
+    sError = ERR_INVALID_PSK_BINDER
+    eAlertCode = uscTlsAlertDecryptError
+    GoTo QH
 EH:
     sError = Err.Description & " [" & Err.Source & "]"
     eAlertCode = uscTlsAlertInternalError
 End Function
 
-Private Function pvTlsParseHandshakeCertificateRequest(uCtx As UcsTlsContext, uInput As UcsBuffer, sError As String, eAlertCode As UcsTlsAlertDescriptionsEnum) As Boolean
-    Dim lSignatureScheme As Long
-    Dim lSize           As Long
-    Dim lEnd            As Long
+Private Function pvTlsParseHandshakeCertificate(uCtx As UcsTlsContext, uInput As UcsBuffer, ByVal lInputEnd As Long, sError As String, eAlertCode As UcsTlsAlertDescriptionsEnum) As Boolean
+    Const FUNC_NAME     As String = "pvTlsParseHandshakeCertificate"
+    Dim baCert()        As Byte
+    Dim lCertSize       As Long
+    Dim lCertEnd        As Long
     Dim lBlockSize      As Long
     Dim lBlockEnd       As Long
     Dim lExtType        As Long
     Dim lExtSize        As Long
     Dim lExtEnd         As Long
-    Dim uKeyInfo        As UcsKeyInfo
-    Dim baDName()       As Byte
-    Dim lDnSize         As Long
-    Dim baPrivKey()     As Byte
-    Dim baSignatureSchemes() As Byte
-    Dim lSigPos         As Long
-    Dim oCallback       As Object
-    Dim bConfirmed      As Boolean
     
     On Error GoTo EH
-    lExtType = -1
     With uCtx
         If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
-            If uInput.Pos + 1 > uInput.Size Then
-                GoTo InvalidSize
-            End If
-            pvBufferReadBlockStart uInput, Size:=1, BlockSize:=lSize
-                If uInput.Pos + lSize > uInput.Size Then
+            pvBufferReadBlockStart uInput, BlockSize:=lCertSize
+                If uInput.Pos + lCertSize > lInputEnd Then
                     GoTo InvalidSize
                 End If
-                pvBufferReadArray uInput, .CertRequestContext, lSize
+                uInput.Pos = uInput.Pos + lCertSize '--- skip RemoteCertReqContext
             pvBufferReadBlockEnd uInput
-            If uInput.Pos + 2 > uInput.Size Then
+        End If
+        Set .RemoteCertificates = New Collection
+        If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
+            Set .RemoteCertStatuses = New Collection
+        End If
+        If uInput.Pos + 3 > lInputEnd Then
+            GoTo InvalidSize
+        End If
+        pvBufferReadBlockStart uInput, Size:=3, BlockSize:=lCertSize
+            lCertEnd = uInput.Pos + lCertSize
+            If lCertEnd <> lInputEnd Then
                 GoTo InvalidSize
             End If
-            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lSize
-                lEnd = uInput.Pos + lSize
-                If lEnd > uInput.Size Then
-                    GoTo InvalidSize
-                End If
-                Do While uInput.Pos + 3 < lEnd
-                    pvBufferReadLong uInput, lExtType, Size:=2
-                    pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lExtSize
-                        lExtEnd = uInput.Pos + lExtSize
-                        If lExtEnd > lEnd Then
-                            GoTo InvalidSize
-                        End If
-                        Select Case lExtType
-                        Case TLS_EXTENSION_SIGNATURE_ALGORITHMS
-                            If lExtSize < 2 Then
-                                GoTo InvalidSize
-                            End If
-                            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
-                                If uInput.Pos + lBlockSize <> lExtEnd Or lBlockSize = 0 Then
-                                    GoTo InvalidSize
-                                End If
-                                pvBufferReadArray uInput, baSignatureSchemes, lBlockSize
-                            pvBufferReadBlockEnd uInput
-                        Case TLS_EXTENSION_CERTIFICATE_AUTHORITIES
-                            If lExtSize < 2 Then
+            Do While uInput.Pos + 2 < lCertEnd
+                pvBufferReadBlockStart uInput, Size:=3, BlockSize:=lCertSize
+                    If uInput.Pos + lCertSize > lCertEnd Then
+                        GoTo InvalidSize
+                    End If
+                    pvBufferReadArray uInput, baCert, lCertSize
+                    .RemoteCertificates.Add baCert
+                pvBufferReadBlockEnd uInput
+                If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
+                    baCert = vbNullString
+                    If uInput.Pos + 2 > lCertEnd Then
+                        GoTo InvalidSize
+                    End If
+                    pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+                    lBlockEnd = uInput.Pos + lBlockSize
+                    If lBlockEnd > lCertEnd Then
+                        GoTo InvalidSize
+                    End If
+                    Do While uInput.Pos + 1 < lBlockEnd
+                        pvBufferReadLong uInput, lExtType, Size:=2
+                        #If ImplUseDebugLog Then
+'                           DebugLog MODULE_NAME, FUNC_NAME, "CertificateExtensions " & pvTlsGetExtensionName(lExtType)
+                        #End If
+                        pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lExtSize
+                            lExtEnd = uInput.Pos + lExtSize
+                            If lExtEnd > lBlockEnd Then
                                 GoTo InvalidSize
                             End If
-                            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
-                                lBlockEnd = uInput.Pos + lBlockSize
-                                If lBlockEnd <> lExtEnd Or lBlockSize = 0 Or lBlockSize Mod 2 <> 0 Then
-                                    GoTo InvalidSize
-                                End If
-                                Set .CertRequestCaDn = New Collection
-                                Do While uInput.Pos + 1 < lBlockEnd
-                                    pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lDnSize
-                                        If uInput.Pos + lDnSize > lBlockEnd Or lDnSize = 0 Then
-                                            GoTo InvalidSize
-                                        End If
-                                        pvBufferReadArray uInput, baDName, lDnSize
-                                        .CertRequestCaDn.Add baDName
-                                    pvBufferReadBlockEnd uInput
-                                Loop
-                            pvBufferReadBlockEnd uInput
-                        Case Else
+                            Select Case lExtType
+                            Case TLS_EXTENSION_STATUS_REQUEST
+                                pvBufferReadArray uInput, baCert, lExtSize
+                            Case Else
+                                uInput.Pos = uInput.Pos + lExtSize
+                            End Select
+                        pvBufferReadBlockEnd uInput
+                    Loop
+                    pvBufferReadBlockEnd uInput
+                    .RemoteCertStatuses.Add baCert
+                End If
+            Loop
+        pvBufferReadBlockEnd uInput
+    End With
+    '--- success
+    pvTlsParseHandshakeCertificate = True
+QH:
+    Exit Function
+InvalidSize:
+    sError = ERR_INVALID_SIZE
+    eAlertCode = uscTlsAlertDecodeError
+    GoTo QH
+EH:
+    sError = Err.Description & " [" & Err.Source & "]"
+    eAlertCode = uscTlsAlertInternalError
+End Function
+
+Private Function pvTlsParseHandshakeCompressedCertificate(uCtx As UcsTlsContext, uInput As UcsBuffer, ByVal lInputEnd As Long, sError As String, eAlertCode As UcsTlsAlertDescriptionsEnum) As Boolean
+    Dim lAlgorithm      As Long
+    Dim lSize           As Long
+    Dim lBlockSize      As Long
+    Dim uCert           As UcsBuffer
+    
+    On Error GoTo EH
+    If uInput.Pos + 8 > lInputEnd Then
+        GoTo InvalidSize
+    End If
+    pvBufferReadLong uInput, lAlgorithm, Size:=2
+    pvBufferReadLong uInput, lSize, Size:=3
+    pvBufferReadBlockStart uInput, Size:=3, BlockSize:=lBlockSize
+        If uInput.Pos + lBlockSize <> lInputEnd Then
+            GoTo InvalidSize
+        End If
+        '--- only zlib is offered in ClientHello
+        If lAlgorithm <> TLS_CERT_COMPRESS_ZLIB Or lSize > TLS_MAX_CERT_UNCOMPRESSED_SIZE Then
+            GoTo InvalidCompression
+        End If
+        If Not pvCryptoZlibUncompress(uCert.Data, lSize, uInput.Data, uInput.Pos, lBlockSize) Then
+            GoTo InvalidCompression
+        End If
+        uInput.Pos = uInput.Pos + lBlockSize
+    pvBufferReadBlockEnd uInput
+    '--- note: handshake hash is calculated over the compressed message as received
+    If Not pvTlsParseHandshakeCertificate(uCtx, uCert, lSize, sError, eAlertCode) Then
+        GoTo QH
+    End If
+    '--- success
+    pvTlsParseHandshakeCompressedCertificate = True
+QH:
+    Exit Function
+InvalidSize:
+    sError = ERR_INVALID_SIZE
+    eAlertCode = uscTlsAlertDecodeError
+    GoTo QH
+InvalidCompression:
+    sError = Replace(ERR_INVALID_COMPRESSION, "%1", lAlgorithm)
+    eAlertCode = uscTlsAlertBadCertificate
+    GoTo QH
+EH:
+    sError = Err.Description & " [" & Err.Source & "]"
+    eAlertCode = uscTlsAlertInternalError
+End Function
+
+Private Function pvTlsParseHandshakeNewSessionTicket(uCtx As UcsTlsContext, uInput As UcsBuffer, ByVal lInputEnd As Long, sError As String, eAlertCode As UcsTlsAlertDescriptionsEnum) As Boolean
+    Dim lLifetime       As Long
+    Dim lAgeAdd         As Long
+    Dim lBlockSize      As Long
+    Dim baNonce()       As Byte
+    Dim baTicket()      As Byte
+    Dim baPsk()         As Byte
+    Dim lExtType        As Long
+    Dim lExtSize        As Long
+    Dim lMaxEarlyData   As Long
+    
+    On Error GoTo EH
+    With uCtx
+        If uInput.Pos + 9 > lInputEnd Then
+            GoTo InvalidSize
+        End If
+        pvBufferReadLong uInput, lLifetime, Size:=4
+        pvBufferReadLong uInput, lAgeAdd, Size:=4
+        pvBufferReadBlockStart uInput, BlockSize:=lBlockSize
+            If uInput.Pos + lBlockSize + 2 > lInputEnd Then
+                GoTo InvalidSize
+            End If
+            pvBufferReadArray uInput, baNonce, lBlockSize
+        pvBufferReadBlockEnd uInput
+        pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+            If uInput.Pos + lBlockSize + 2 > lInputEnd Or lBlockSize = 0 Then
+                GoTo InvalidSize
+            End If
+            pvBufferReadArray uInput, baTicket, lBlockSize
+        pvBufferReadBlockEnd uInput
+        pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+            If uInput.Pos + lBlockSize <> lInputEnd Then
+                GoTo InvalidSize
+            End If
+            Do While uInput.Pos + 3 < lInputEnd
+                pvBufferReadLong uInput, lExtType, Size:=2
+                pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lExtSize
+                    If uInput.Pos + lExtSize > lInputEnd Then
+                        GoTo InvalidSize
+                    End If
+                    If lExtType = TLS_EXTENSION_EARLY_DATA And lExtSize = 4 Then
+                        pvBufferReadLong uInput, lMaxEarlyData, Size:=4
+                    Else
+                        uInput.Pos = uInput.Pos + lExtSize
+                    End If
+                pvBufferReadBlockEnd uInput
+            Loop
+            If uInput.Pos <> lInputEnd Then
+                GoTo InvalidSize
+            End If
+        pvBufferReadBlockEnd uInput
+        '--- lifetime of zero means ticket must not be cached
+        If lLifetime <> 0 And LenB(.RemoteHostName) <> 0 And pvArraySize(.ResumptionSecret) > 0 Then
+            If lLifetime < 0 Or lLifetime > TLS_MAX_TICKET_LIFETIME Then
+                lLifetime = TLS_MAX_TICKET_LIFETIME
+            End If
+            pvTlsHkdfExpandLabel baPsk, .DigestAlgo, .ResumptionSecret, "resumption", baNonce, .DigestSize
+            If lMaxEarlyData < 0 Then
+                lMaxEarlyData = TLS_MAX_PLAINTEXT_RECORD_SIZE
+            End If
+            pvTlsTicketCacheAdd .RemoteHostName, Array(baTicket, baPsk, .DigestAlgo, lAgeAdd, GetTickCount(), lLifetime, .RemoteCertificates, .RemoteCertStatuses, _
+                .CipherSuite, .AlpnNegotiated, lMaxEarlyData)
+        End If
+    End With
+    '--- success
+    pvTlsParseHandshakeNewSessionTicket = True
+QH:
+    Exit Function
+InvalidSize:
+    sError = ERR_INVALID_SIZE
+    eAlertCode = uscTlsAlertDecodeError
+    GoTo QH
+EH:
+    sError = Err.Description & " [" & Err.Source & "]"
+    eAlertCode = uscTlsAlertInternalError
+End Function
+
+Private Function pvTlsParseHandshakeCertificateRequest(uCtx As UcsTlsContext, uInput As UcsBuffer, sError As String, eAlertCode As UcsTlsAlertDescriptionsEnum) As Boolean
+    Dim lSignatureScheme As Long
+    Dim lSize           As Long
+    Dim lEnd            As Long
+    Dim lBlockSize      As Long
+    Dim lBlockEnd       As Long
+    Dim lExtType        As Long
+    Dim lExtSize        As Long
+    Dim lExtEnd         As Long
+    Dim uKeyInfo        As UcsKeyInfo
+    Dim baDName()       As Byte
+    Dim lDnSize         As Long
+    Dim baPrivKey()     As Byte
+    Dim baSignatureSchemes() As Byte
+    Dim lSigPos         As Long
+    Dim oCallback       As Object
+    Dim bConfirmed      As Boolean
+    
+    On Error GoTo EH
+    lExtType = -1
+    With uCtx
+        If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
+            If uInput.Pos + 1 > uInput.Size Then
+                GoTo InvalidSize
+            End If
+            pvBufferReadBlockStart uInput, Size:=1, BlockSize:=lSize
+                If uInput.Pos + lSize > uInput.Size Then
+                    GoTo InvalidSize
+                End If
+                pvBufferReadArray uInput, .CertRequestContext, lSize
+            pvBufferReadBlockEnd uInput
+            If uInput.Pos + 2 > uInput.Size Then
+                GoTo InvalidSize
+            End If
+            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lSize
+                lEnd = uInput.Pos + lSize
+                If lEnd > uInput.Size Then
+                    GoTo InvalidSize
+                End If
+                Do While uInput.Pos + 3 < lEnd
+                    pvBufferReadLong uInput, lExtType, Size:=2
+                    pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lExtSize
+                        lExtEnd = uInput.Pos + lExtSize
+                        If lExtEnd > lEnd Then
+                            GoTo InvalidSize
+                        End If
+                        Select Case lExtType
+                        Case TLS_EXTENSION_SIGNATURE_ALGORITHMS
+                            If lExtSize < 2 Then
+                                GoTo InvalidSize
+                            End If
+                            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+                                If uInput.Pos + lBlockSize <> lExtEnd Or lBlockSize = 0 Then
+                                    GoTo InvalidSize
+                                End If
+                                pvBufferReadArray uInput, baSignatureSchemes, lBlockSize
+                            pvBufferReadBlockEnd uInput
+                        Case TLS_EXTENSION_CERTIFICATE_AUTHORITIES
+                            If lExtSize < 2 Then
+                                GoTo InvalidSize
+                            End If
+                            pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+                                lBlockEnd = uInput.Pos + lBlockSize
+                                If lBlockEnd <> lExtEnd Or lBlockSize = 0 Or lBlockSize Mod 2 <> 0 Then
+                                    GoTo InvalidSize
+                                End If
+                                Set .CertRequestCaDn = New Collection
+                                Do While uInput.Pos + 1 < lBlockEnd
+                                    pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lDnSize
+                                        If uInput.Pos + lDnSize > lBlockEnd Or lDnSize = 0 Then
+                                            GoTo InvalidSize
+                                        End If
+                                        pvBufferReadArray uInput, baDName, lDnSize
+                                        .CertRequestCaDn.Add baDName
+                                    pvBufferReadBlockEnd uInput
+                                Loop
+                            pvBufferReadBlockEnd uInput
+                        Case Else
                             uInput.Pos = uInput.Pos + lExtSize
                         End Select
                     pvBufferReadBlockEnd uInput
@@ -3475,33 +4421,92 @@ End Function
 
 Private Sub pvTlsSetupExchGroup(uCtx As UcsTlsContext, ByVal lExchGroup As Long)
     Const FUNC_NAME     As String = "pvTlsSetupExchGroup"
+    #If ImplUseStats Then
+        Dim dStart          As Double
+    #End If
     
     With uCtx
         If .ExchGroup <> lExchGroup Then
+            #If ImplUseStats Then
+                dStart = pvTlsStatsTimer
+            #End If
             .ExchGroup = lExchGroup
             Select Case lExchGroup
             Case TLS_GROUP_X25519
                 .ExchAlgo = ucsTlsAlgoExchX25519
-                If Not pvCryptoEcdhCurve25519MakeKey(.LocalExchPrivate, .LocalExchPublic) Then
-                    Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_GENER_KEYPAIR_FAILED, "%1", "Curve25519")
-                End If
             Case TLS_GROUP_SECP256R1
                 .ExchAlgo = ucsTlsAlgoExchSecp256r1
-                If Not pvCryptoEcdhSecp256r1MakeKey(.LocalExchPrivate, .LocalExchPublic) Then
-                    Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_GENER_KEYPAIR_FAILED, "%1", "secp256r1")
-                End If
             Case TLS_GROUP_SECP384R1
                 .ExchAlgo = ucsTlsAlgoExchSecp384r1
-                If Not pvCryptoEcdhSecp384r1MakeKey(.LocalExchPrivate, .LocalExchPublic) Then
-                    Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_GENER_KEYPAIR_FAILED, "%1", "secp384r1")
-                End If
             Case Else
                 Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_UNSUPPORTED_EXCH_GROUP, "%1", pvTlsGetExchGroupName(.ExchGroup))
             End Select
+            '--- key share from previous group (on HelloRetryRequest) is never used
+            pvArrayWipe .LocalExchPrivate
+            If Not pvTlsKeyPoolGet(lExchGroup, .LocalExchPrivate, .LocalExchPublic) Then
+                pvTlsMakeExchKey lExchGroup, .LocalExchPrivate, .LocalExchPublic
+            End If
+            #If ImplUseStats Then
+                pvTlsStatsAdd m_uStats, ucsTlsStatKeyExchangeTime, pvTlsStatsTimer - dStart
+            #End If
         End If
     End With
 End Sub
 
+Private Sub pvTlsMakeExchKey(ByVal lExchGroup As Long, baPrivate() As Byte, baPublic() As Byte)
+    Const FUNC_NAME     As String = "pvTlsMakeExchKey"
+    
+    Select Case lExchGroup
+    Case TLS_GROUP_X25519
+        If Not pvCryptoEcdhCurve25519MakeKey(baPrivate, baPublic) Then
+            Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_GENER_KEYPAIR_FAILED, "%1", "Curve25519")
+        End If
+    Case TLS_GROUP_SECP256R1
+        If Not pvCryptoEcdhSecp256r1MakeKey(baPrivate, baPublic) Then
+            Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_GENER_KEYPAIR_FAILED, "%1", "secp256r1")
+        End If
+    Case TLS_GROUP_SECP384R1
+        If Not pvCryptoEcdhSecp384r1MakeKey(baPrivate, baPublic) Then
+            Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_GENER_KEYPAIR_FAILED, "%1", "secp384r1")
+        End If
+    Case Else
+        Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_UNSUPPORTED_EXCH_GROUP, "%1", pvTlsGetExchGroupName(lExchGroup))
+    End Select
+End Sub
+
+Private Function pvTlsKeyPoolGet(ByVal lExchGroup As Long, baPrivate() As Byte, baPublic() As Byte) As Boolean
+    Const FUNC_NAME     As String = "pvTlsKeyPoolGet"
+    Dim lIdx            As Long
+    Dim lPos            As Long
+    
+    If m_lKeyPoolSize = 0 Then
+        GoTo QH
+    End If
+    For lIdx = 0 To UBound(m_uKeyPool)
+        With m_uKeyPool(lIdx)
+            If .ExchGroup = lExchGroup Then
+                If .Count = 0 Then
+                    '--- seen demand for this group so keep it stocked from now on
+                    .Requested = True
+                    GoTo QH
+                End If
+                .Count = .Count - 1
+                lPos = .Count * (.PrivateSize + .PublicSize)
+                pvArrayAllocate baPrivate, .PrivateSize, FUNC_NAME & ".baPrivate"
+                pvArrayAllocate baPublic, .PublicSize, FUNC_NAME & ".baPublic"
+                Call CopyMemory(baPrivate(0), .Data(lPos), .PrivateSize)
+                Call CopyMemory(baPublic(0), .Data(lPos + .PrivateSize), .PublicSize)
+                '--- each key pair is handed out exactly once
+                Call FillMemory(.Data(lPos), .PrivateSize + .PublicSize, 0)
+                '--- success
+                pvTlsKeyPoolGet = True
+                GoTo QH
+            End If
+        End With
+    Next
+QH:
+End Function
+
 Private Sub pvTlsSetupExchRsaCertificate(uCtx As UcsTlsContext, baCert() As Byte)
     Const FUNC_NAME     As String = "pvTlsSetupExchRsaCertificate"
     Dim uCertInfo       As UcsKeyInfo
@@ -3839,6 +4844,37 @@ Private Sub pvTlsSetLastError( _
     End With
 End Sub
 
+#If ImplUseStats Then
+Private Property Get pvTlsStatsTimer() As Double
+    Dim cValue          As Currency
+    
+    If m_cStatsFreq = 0 Then
+        Call QueryPerformanceFrequency(m_cStatsFreq)
+    End If
+    Call QueryPerformanceCounter(cValue)
+    pvTlsStatsTimer = cValue / m_cStatsFreq
+End Property
+
+Private Sub pvTlsStatsAdd(uStats As UcsTlsStats, ByVal eStat As UcsTlsStatsEnum, ByVal dValue As Double)
+    If eStat = ucsTlsStatSendQueueHighWater Then
+        If dValue > uStats.Value(eStat) Then
+            uStats.Value(eStat) = dValue
+        End If
+    Else
+        uStats.Value(eStat) = uStats.Value(eStat) + dValue
+    End If
+End Sub
+
+Private Sub pvTlsStatsCollect(uCtx As UcsTlsContext, uSnapshot As UcsTlsStats)
+    Dim lIdx            As Long
+    
+    '--- leaf functions only bump global counters, attribute the delta since entry-point to this connection
+    For lIdx = 0 To ucsTlsStatSendQueueHighWater - 1
+        uCtx.Stats.Value(lIdx) = uCtx.Stats.Value(lIdx) + m_uStats.Value(lIdx) - uSnapshot.Value(lIdx)
+    Next
+End Sub
+#End If
+
 '= HMAC-based key derivation functions ===================================
 
 Private Sub pvTlsDeriveHandshakeSecrets(uCtx As UcsTlsContext)
@@ -3857,18 +4893,25 @@ Private Sub pvTlsDeriveHandshakeSecrets(uCtx As UcsTlsContext)
         End If
         pvTlsGetHandshakeHash uCtx, baHandshakeHash
         pvArrayAllocate baZeroes, .DigestSize, FUNC_NAME & ".baZeroes"
-        pvTlsHkdfExtract baEarlySecret, .DigestAlgo, baZeroes, baZeroes
+        If .PskSelected Then
+            pvTlsHkdfExtract baEarlySecret, .DigestAlgo, baZeroes, .PreSharedKey
+        Else
+            pvTlsHkdfExtract baEarlySecret, .DigestAlgo, baZeroes, baZeroes
+        End If
         pvTlsGetHash baEmptyHash, .DigestAlgo, baEmpty
         pvTlsHkdfExpandLabel baDerivedSecret, .DigestAlgo, baEarlySecret, "derived", baEmptyHash, .DigestSize
         pvTlsGetSharedSecret baSharedSecret, .ExchAlgo, .LocalExchPrivate, .RemoteExchPublic
+        pvArrayWipe .LocalExchPrivate
         pvTlsHkdfExtract .HandshakeSecret, .DigestAlgo, baDerivedSecret, baSharedSecret
         pvTlsHkdfExpandLabel .RemoteTrafficSecret, .DigestAlgo, .HandshakeSecret, IIf(.IsServer, "c", "s") & " hs traffic", baHandshakeHash, .DigestSize
         pvTlsHkdfExpandLabel .RemoteTrafficKey, .DigestAlgo, .RemoteTrafficSecret, "key", baEmpty, .KeySize
+        pvTlsSetupTrafficCtx .RemoteTrafficCtx, .BulkAlgo, .RemoteTrafficKey
         pvTlsHkdfExpandLabel .RemoteTrafficIV, .DigestAlgo, .RemoteTrafficSecret, "iv", baEmpty, .IvSize
         .RemoteTrafficSeqNo = 0
         pvTlsLogSecret uCtx, IIf(.IsServer, "CLIENT", "SERVER") & "_HANDSHAKE_TRAFFIC_SECRET", .RemoteTrafficSecret
         pvTlsHkdfExpandLabel .LocalTrafficSecret, .DigestAlgo, .HandshakeSecret, IIf(.IsServer, "s", "c") & " hs traffic", baHandshakeHash, .DigestSize
         pvTlsHkdfExpandLabel .LocalTrafficKey, .DigestAlgo, .LocalTrafficSecret, "key", baEmpty, .KeySize
+        pvTlsSetupTrafficCtx .LocalTrafficCtx, .BulkAlgo, .LocalTrafficKey
         pvTlsHkdfExpandLabel .LocalTrafficIV, .DigestAlgo, .LocalTrafficSecret, "iv", baEmpty, .IvSize
         .LocalTrafficSeqNo = 0
         pvTlsLogSecret uCtx, IIf(.IsServer, "SERVER", "CLIENT") & "_HANDSHAKE_TRAFFIC_SECRET", .LocalTrafficSecret
@@ -3892,17 +4935,89 @@ Private Sub pvTlsDeriveApplicationSecrets(uCtx As UcsTlsContext, baHandshakeHash
         pvTlsHkdfExtract .MasterSecret, .DigestAlgo, baDerivedSecret, baZeroes
         pvTlsHkdfExpandLabel .RemoteTrafficSecret, .DigestAlgo, .MasterSecret, IIf(.IsServer, "c", "s") & " ap traffic", baHandshakeHash, .DigestSize
         pvTlsHkdfExpandLabel .RemoteTrafficKey, .DigestAlgo, .RemoteTrafficSecret, "key", baEmpty, .KeySize
+        pvTlsSetupTrafficCtx .RemoteTrafficCtx, .BulkAlgo, .RemoteTrafficKey
         pvTlsHkdfExpandLabel .RemoteTrafficIV, .DigestAlgo, .RemoteTrafficSecret, "iv", baEmpty, .IvSize
         .RemoteTrafficSeqNo = 0
         pvTlsLogSecret uCtx, IIf(.IsServer, "CLIENT", "SERVER") & "_TRAFFIC_SECRET_0", .RemoteTrafficSecret
         pvTlsHkdfExpandLabel .LocalTrafficSecret, .DigestAlgo, .MasterSecret, IIf(.IsServer, "s", "c") & " ap traffic", baHandshakeHash, .DigestSize
         pvTlsHkdfExpandLabel .LocalTrafficKey, .DigestAlgo, .LocalTrafficSecret, "key", baEmpty, .KeySize
+        pvTlsSetupTrafficCtx .LocalTrafficCtx, .BulkAlgo, .LocalTrafficKey
         pvTlsHkdfExpandLabel .LocalTrafficIV, .DigestAlgo, .LocalTrafficSecret, "iv", baEmpty, .IvSize
         .LocalTrafficSeqNo = 0
         pvTlsLogSecret uCtx, IIf(.IsServer, "SERVER", "CLIENT") & "_TRAFFIC_SECRET_0", .LocalTrafficSecret
     End With
 End Sub
 
+Private Sub pvTlsDeriveEarlySecrets(uCtx As UcsTlsContext)
+    Const FUNC_NAME     As String = "pvTlsDeriveEarlySecrets"
+    Dim baHandshakeHash() As Byte
+    Dim baEarlySecret() As Byte
+    Dim baZeroes()      As Byte
+    
+    With uCtx
+        If .HandshakeMessages.Size = 0 Then
+            Err.Raise vbObjectError, FUNC_NAME, ERR_NO_HANDSHAKE_MESSAGES
+        End If
+        pvTlsGetHandshakeHash uCtx, baHandshakeHash
+        pvArrayAllocate baZeroes, .DigestSize, FUNC_NAME & ".baZeroes"
+        pvTlsHkdfExtract baEarlySecret, .DigestAlgo, baZeroes, .PreSharedKey
+        pvTlsHkdfExpandLabel .EarlyTrafficSecret, .DigestAlgo, baEarlySecret, "c e traffic", baHandshakeHash, .DigestSize
+        pvTlsSetLocalTrafficSecret uCtx, .EarlyTrafficSecret, 0
+        pvTlsLogSecret uCtx, "CLIENT_EARLY_TRAFFIC_SECRET", .EarlyTrafficSecret
+    End With
+End Sub
+
+Private Sub pvTlsSetLocalTrafficSecret(uCtx As UcsTlsContext, baSecret() As Byte, ByVal lSeqNo As Long)
+    Dim baEmpty()       As Byte
+    
+    With uCtx
+        .LocalTrafficSecret = baSecret
+        pvTlsHkdfExpandLabel .LocalTrafficKey, .DigestAlgo, .LocalTrafficSecret, "key", baEmpty, .KeySize
+        pvTlsSetupTrafficCtx .LocalTrafficCtx, .BulkAlgo, .LocalTrafficKey
+        pvTlsHkdfExpandLabel .LocalTrafficIV, .DigestAlgo, .LocalTrafficSecret, "iv", baEmpty, .IvSize
+        .LocalTrafficSeqNo = lSeqNo
+    End With
+End Sub
+
+Private Sub pvTlsDeriveResumptionSecret(uCtx As UcsTlsContext)
+    Dim baHandshakeHash() As Byte
+    
+    With uCtx
+        pvTlsGetHandshakeHash uCtx, baHandshakeHash
+        pvTlsHkdfExpandLabel .ResumptionSecret, .DigestAlgo, .MasterSecret, "res master", baHandshakeHash, .DigestSize
+    End With
+End Sub
+
+Private Sub pvTlsGetPskBinder(uCtx As UcsTlsContext, baRetVal() As Byte, ByVal eHash As UcsTlsCryptoAlgorithmsEnum, baPsk() As Byte, baHello() As Byte, ByVal lPos As Long, ByVal lSize As Long)
+    Const FUNC_NAME     As String = "pvTlsGetPskBinder"
+    Dim lHashSize       As Long
+    Dim baZeroes()      As Byte
+    Dim baEmpty()       As Byte
+    Dim baEmptyHash()   As Byte
+    Dim baEarlySecret() As Byte
+    Dim baBinderKey()   As Byte
+    Dim baFinishedKey() As Byte
+    Dim baHandshakeHash() As Byte
+    Dim uInput          As UcsBuffer
+    
+    lHashSize = pvTlsDigestHashSize(eHash)
+    pvArrayAllocate baZeroes, lHashSize, FUNC_NAME & ".baZeroes"
+    pvTlsHkdfExtract baEarlySecret, eHash, baZeroes, baPsk
+    pvTlsGetHash baEmptyHash, eHash, baEmpty
+    pvTlsHkdfExpandLabel baBinderKey, eHash, baEarlySecret, "res binder", baEmptyHash, lHashSize
+    pvTlsHkdfExpandLabel baFinishedKey, eHash, baBinderKey, "finished", baEmpty, lHashSize
+    '--- transcript is previous handshake messages (after HelloRetryRequest) + truncated ClientHello
+    With uCtx.HandshakeMessages
+        If .Size > 0 Then
+            pvBufferWriteBlob uInput, VarPtr(.Data(0)), .Size
+        End If
+    End With
+    pvBufferWriteBlob uInput, VarPtr(baHello(lPos)), lSize
+    pvBufferWriteEOF uInput
+    pvTlsGetHash baHandshakeHash, eHash, uInput.Data
+    pvTlsGetHmac baRetVal, eHash, baFinishedKey, baHandshakeHash
+End Sub
+
 Private Sub pvTlsDeriveKeyUpdate(uCtx As UcsTlsContext, ByVal bLocalUpdate As Boolean)
     Const FUNC_NAME     As String = "pvTlsDeriveKeyUpdate"
     Dim baEmpty()       As Byte
@@ -3913,6 +5028,7 @@ Private Sub pvTlsDeriveKeyUpdate(uCtx As UcsTlsContext, ByVal bLocalUpdate As Bo
         End If
         pvTlsHkdfExpandLabel .RemoteTrafficSecret, .DigestAlgo, .RemoteTrafficSecret, "traffic upd", baEmpty, .DigestSize
         pvTlsHkdfExpandLabel .RemoteTrafficKey, .DigestAlgo, .RemoteTrafficSecret, "key", baEmpty, .KeySize
+        pvTlsSetupTrafficCtx .RemoteTrafficCtx, .BulkAlgo, .RemoteTrafficKey
         pvTlsHkdfExpandLabel .RemoteTrafficIV, .DigestAlgo, .RemoteTrafficSecret, "iv", baEmpty, .IvSize
         .RemoteTrafficSeqNo = 0
         pvTlsLogSecret uCtx, IIf(.IsServer, "CLIENT", "SERVER") & "_TRAFFIC_SECRET_0", .RemoteTrafficSecret
@@ -3922,6 +5038,7 @@ Private Sub pvTlsDeriveKeyUpdate(uCtx As UcsTlsContext, ByVal bLocalUpdate As Bo
             End If
             pvTlsHkdfExpandLabel .LocalTrafficSecret, .DigestAlgo, .LocalTrafficSecret, "traffic upd", baEmpty, .DigestSize
             pvTlsHkdfExpandLabel .LocalTrafficKey, .DigestAlgo, .LocalTrafficSecret, "key", baEmpty, .KeySize
+            pvTlsSetupTrafficCtx .LocalTrafficCtx, .BulkAlgo, .LocalTrafficKey
             pvTlsHkdfExpandLabel .LocalTrafficIV, .DigestAlgo, .LocalTrafficSecret, "iv", baEmpty, .IvSize
             .LocalTrafficSeqNo = 0
             pvTlsLogSecret uCtx, IIf(.IsServer, "SERVER", "CLIENT") & "_TRAFFIC_SECRET_0", .LocalTrafficSecret
@@ -3931,34 +5048,11 @@ End Sub
 
 Private Sub pvTlsHkdfExpandLabel(baRetVal() As Byte, ByVal eHash As UcsTlsCryptoAlgorithmsEnum, baKey() As Byte, ByVal sLabel As String, baContext() As Byte, ByVal lSize As Long)
     Const FUNC_NAME     As String = "pvTlsHkdfExpandLabel"
-    Dim uOutput         As UcsBuffer
-    Dim uInfo           As UcsBuffer
-    Dim uInput          As UcsBuffer
-    Dim lIdx            As Long
-    Dim baLast()        As Byte
     
-    sLabel = "tls13 " & sLabel
-    pvArrayAllocate uInfo.Data, 3 + Len(sLabel) + 1 + pvArraySize(baContext), FUNC_NAME & ".uInfo"
-    pvBufferWriteLong uInfo, lSize, Size:=2
-    pvBufferWriteLong uInfo, Len(sLabel)
-    pvBufferWriteString uInfo, sLabel
-    pvBufferWriteLong uInfo, pvArraySize(baContext)
-    pvBufferWriteArray uInfo, baContext
-    pvBufferWriteEOF uInfo
-    lIdx = 1
-    Do While uOutput.Size < lSize
-        uInput.Size = 0
-        pvBufferWriteArray uInput, baLast
-        pvBufferWriteArray uInput, uInfo.Data
-        pvBufferWriteLong uInput, lIdx
-        pvBufferWriteEOF uInput
-        pvTlsGetHmac baLast, eHash, baKey, uInput.Data
-        pvBufferWriteArray uOutput, baLast
-        lIdx = lIdx + 1
-    Loop
-    uOutput.Size = lSize
-    pvBufferWriteEOF uOutput
-    baRetVal = uOutput.Data
+    '--- note: "tls13 " prefix and HkdfLabel framing are done in the thunk
+    If Not pvCryptoHkdfExpandLabel(baRetVal, pvTlsDigestHashSize(eHash), baKey, StrConv(sLabel, vbFromUnicode), baContext, lSize) Then
+        Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_CALL_FAILED, "%1", "CryptoHkdfExpandLabel")
+    End If
 End Sub
 
 Private Sub pvTlsHkdfExtract(baRetVal() As Byte, ByVal eHash As UcsTlsCryptoAlgorithmsEnum, baKey() As Byte, baInput() As Byte)
@@ -3979,6 +5073,7 @@ Private Sub pvTlsDeriveLegacySecrets(uCtx As UcsTlsContext)
             Err.Raise vbObjectError, FUNC_NAME, ERR_NO_REMOTE_RANDOM
         End If
         pvTlsGetSharedSecret baPreMasterSecret, .ExchAlgo, .LocalExchPrivate, .RemoteExchPublic
+        pvArrayWipe .LocalExchPrivate
         #If (ImplCaptureTraffic And 2) <> 0 Then
             .TrafficDump.Add FUNC_NAME & ".baPreMasterSecret" & vbCrLf & TlsDesignDumpArray(baPreMasterSecret)
         #End If
@@ -4042,6 +5137,7 @@ Private Sub pvTlsDeriveLegacySecrets(uCtx As UcsTlsContext)
 End Sub
 
 Private Sub pvTlsKdfLegacyPrf(baRetVal() As Byte, ByVal eHash As UcsTlsCryptoAlgorithmsEnum, baKey() As Byte, ByVal sLabel As String, baContext() As Byte, ByVal lSize As Long)
+    Const FUNC_NAME     As String = "pvTlsKdfLegacyPrf"
     Dim uOutput         As UcsBuffer
     Dim uSeed           As UcsBuffer
     Dim uInput          As UcsBuffer
@@ -4054,15 +5150,32 @@ Private Sub pvTlsKdfLegacyPrf(baRetVal() As Byte, ByVal eHash As UcsTlsCryptoAlg
     pvBufferWriteArray uSeed, baContext
     pvBufferWriteEOF uSeed
     baLast = uSeed.Data
-    Do While uOutput.Size < lSize
-        baTemp = baLast
-        pvTlsGetHmac baLast, eHash, baKey, baTemp
-        pvBufferWriteArray uInput, baLast
-        pvBufferWriteArray uInput, uSeed.Data
-        pvBufferWriteEOF uInput
-        pvTlsGetHmac baHmac, eHash, baKey, uInput.Data
-        pvBufferWriteArray uOutput, baHmac
-    Loop
+    Select Case eHash
+    Case ucsTlsAlgoDigestSha256, ucsTlsAlgoDigestSha384
+        '--- pad states of secret are computed once for all iterations
+        If Not pvCryptoHmacSha2Init(pvTlsDigestHashSize(eHash), baKey) Then
+            Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_CALL_FAILED, "%1", "CryptoHmacSha2Init")
+        End If
+        Do While uOutput.Size < lSize
+            baTemp = baLast
+            pvCryptoHmacSha2 baLast, baTemp
+            uInput.Size = 0
+            pvBufferWriteArray uInput, baLast
+            pvBufferWriteArray uInput, uSeed.Data
+            pvCryptoHmacSha2 baHmac, uInput.Data, Size:=uInput.Size
+            pvBufferWriteArray uOutput, baHmac
+        Loop
+    Case Else
+        Do While uOutput.Size < lSize
+            baTemp = baLast
+            pvTlsGetHmac baLast, eHash, baKey, baTemp
+            pvBufferWriteArray uInput, baLast
+            pvBufferWriteArray uInput, uSeed.Data
+            pvBufferWriteEOF uInput
+            pvTlsGetHmac baHmac, eHash, baKey, uInput.Data
+            pvBufferWriteArray uOutput, baHmac
+        Loop
+    End Select
     uOutput.Size = lSize
     pvBufferWriteEOF uOutput
     baRetVal = uOutput.Data
@@ -4072,7 +5185,27 @@ Private Sub pvTlsGetHandshakeHash(uCtx As UcsTlsContext, baRetVal() As Byte)
     Const FUNC_NAME     As String = "pvTlsGetHandshakeHash"
     
     With uCtx
-        pvTlsGetHash baRetVal, .DigestAlgo, .HandshakeMessages.Data, Size:=.HandshakeMessages.Size
+        Select Case .DigestAlgo
+        Case ucsTlsAlgoDigestSha256, ucsTlsAlgoDigestSha384, ucsTlsAlgoDigestSha512
+            If .HandshakeHashAlgo <> .DigestAlgo Then
+                '--- digest negotiated after first messages or transcript reset -> restart running hash
+                Erase .HandshakeHashCtx
+                .HandshakeHashAlgo = .DigestAlgo
+                .HandshakeHashPos = 0
+            End If
+            '--- absorb only messages appended since last snapshot
+            If .HandshakeHashPos < .HandshakeMessages.Size Then
+                If Not pvCryptoHashSha2Update(.HandshakeHashCtx, .DigestSize, VarPtr(.HandshakeMessages.Data(.HandshakeHashPos)), .HandshakeMessages.Size - .HandshakeHashPos) Then
+                    Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_CALL_FAILED, "%1", "CryptoHashSha2Update")
+                End If
+                .HandshakeHashPos = .HandshakeMessages.Size
+            End If
+            If Not pvCryptoHashSha2Snapshot(baRetVal, .HandshakeHashCtx, .DigestSize) Then
+                Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_CALL_FAILED, "%1", "CryptoHashSha2Snapshot")
+            End If
+        Case Else
+            pvTlsGetHash baRetVal, .DigestAlgo, .HandshakeMessages.Data, Size:=.HandshakeMessages.Size
+        End Select
         #If (ImplCaptureTraffic And 2) <> 0 Then
             .TrafficDump.Add FUNC_NAME & ".baRetVal" & vbCrLf & TlsDesignDumpArray(baRetVal)
         #End If
@@ -4094,6 +5227,9 @@ Private Sub pvTlsResetHandshakeHash(uCtx As UcsTlsContext)
     With uCtx
         .HandshakeMessages.Size = 0
         pvBufferWriteEOF .HandshakeMessages
+        Erase .HandshakeHashCtx
+        .HandshakeHashAlgo = 0
+        .HandshakeHashPos = 0
     End With
 End Sub
 
@@ -4117,6 +5253,157 @@ Private Sub pvTlsLogSecret(uCtx As UcsTlsContext, sLabel As String, baSecret() A
 EH:
 End Sub
 
+'= session tickets =======================================================
+
+Private Function pvTlsTicketCacheGet(sHostName As String, vRetVal As Variant) As Boolean
+    Dim sKey            As String
+    Dim vTickets        As Variant
+    Dim cTickets        As Collection
+    Dim vTicket         As Variant
+    Dim dAge            As Double
+    
+    sKey = "#" & LCase$(sHostName)
+    If Not SearchCollection(m_cSessionTickets, sKey, RetVal:=vTickets) Then
+        GoTo QH
+    End If
+    Set cTickets = vTickets
+    Do While cTickets.Count > 0
+        '--- newest first
+        vTicket = cTickets.Item(cTickets.Count)
+        cTickets.Remove cTickets.Count
+        dAge = GetTickCount() - CDbl(vTicket(ucsTlsTicketReceived))
+        If dAge < 0 Then
+            dAge = dAge + 4294967296#
+        End If
+        If dAge < vTicket(ucsTlsTicketLifetime) * 1000# Then
+            vRetVal = vTicket
+            '--- success
+            pvTlsTicketCacheGet = True
+            Exit Do
+        End If
+    Loop
+    If cTickets.Count = 0 Then
+        m_cSessionTickets.Remove sKey
+    End If
+QH:
+End Function
+
+Private Sub pvTlsTicketCacheAdd(sHostName As String, vTicket As Variant)
+    Dim sKey            As String
+    Dim vTickets        As Variant
+    Dim cTickets        As Collection
+    
+    sKey = "#" & LCase$(sHostName)
+    If m_cSessionTickets Is Nothing Then
+        Set m_cSessionTickets = New Collection
+    End If
+    If SearchCollection(m_cSessionTickets, sKey, RetVal:=vTickets) Then
+        Set cTickets = vTickets
+    Else
+        If m_cSessionTickets.Count >= TLS_MAX_CACHED_HOSTS Then
+            m_cSessionTickets.Remove 1
+        End If
+        Set cTickets = New Collection
+        m_cSessionTickets.Add cTickets, sKey
+    End If
+    If cTickets.Count >= TLS_MAX_CACHED_TICKETS Then
+        cTickets.Remove 1
+    End If
+    cTickets.Add vTicket
+End Sub
+
+Private Function pvTlsGetObfuscatedTicketAge(vTicket As Variant) As Long
+    Dim dAge            As Double
+    
+    dAge = GetTickCount() - CDbl(vTicket(ucsTlsTicketReceived))
+    If dAge < 0 Then
+        dAge = dAge + 4294967296#
+    End If
+    '--- (ticket_age + ticket_age_add) mod 2^32
+    dAge = dAge + vTicket(ucsTlsTicketAgeAdd)
+    dAge = dAge - Int(dAge / 4294967296#) * 4294967296#
+    If dAge >= 2147483648# Then
+        dAge = dAge - 4294967296#
+    End If
+    pvTlsGetObfuscatedTicketAge = dAge
+End Function
+
+Private Sub pvTlsTicketEncrypt(uCtx As UcsTlsContext, baPsk() As Byte, ByVal lAgeAdd As Long, baRetVal() As Byte)
+    Dim uTicket         As UcsBuffer
+    Dim baNonce()       As Byte
+    Dim lSize           As Long
+    
+    If pvArraySize(m_baTicketKey) = 0 Then
+        pvTlsGetRandom m_baTicketKey, LNG_CHACHA20_KEYSZ
+    End If
+    With uCtx
+        '--- stateless ticket is nonce || AEAD(key, nonce, state) w/ per-process key
+        pvTlsGetRandom baNonce, LNG_CHACHA20POLY1305_IVSZ
+        pvBufferWriteArray uTicket, baNonce
+        pvBufferWriteLong uTicket, .DigestAlgo
+        pvBufferWriteLong uTicket, GetTickCount(), Size:=4
+        pvBufferWriteLong uTicket, lAgeAdd, Size:=4
+        pvBufferWriteBlockStart uTicket
+            pvBufferWriteArray uTicket, baPsk
+        pvBufferWriteBlockEnd uTicket
+        pvBufferWriteBlockStart uTicket, Size:=2
+            pvBufferWriteString uTicket, .SniRequested
+        pvBufferWriteBlockEnd uTicket
+        lSize = uTicket.Size - LNG_CHACHA20POLY1305_IVSZ
+        pvBufferWriteBlob uTicket, 0, LNG_CHACHA20POLY1305_TAGSZ
+        pvBufferWriteEOF uTicket
+        pvTlsBulkEncrypt ucsTlsAlgoBulkChacha20Poly1305, baNonce, m_baTicketKey, 0, baNonce, 0, LNG_CHACHA20POLY1305_IVSZ, uTicket.Data, LNG_CHACHA20POLY1305_IVSZ, lSize
+        baRetVal = uTicket.Data
+    End With
+End Sub
+
+Private Function pvTlsTicketDecrypt(uCtx As UcsTlsContext, baTicket() As Byte, baPsk() As Byte) As Boolean
+    Dim uInput          As UcsBuffer
+    Dim baNonce()       As Byte
+    Dim lSize           As Long
+    Dim lDigestAlgo     As Long
+    Dim lIssued         As Long
+    Dim lAgeAdd         As Long
+    Dim lBlockSize      As Long
+    Dim sName           As String
+    Dim dAge            As Double
+    
+    With uCtx
+        lSize = pvArraySize(baTicket) - LNG_CHACHA20POLY1305_IVSZ
+        If lSize < 12 + LNG_CHACHA20POLY1305_TAGSZ Or pvArraySize(m_baTicketKey) = 0 Then
+            GoTo QH
+        End If
+        uInput.Data = baTicket
+        pvBufferReadArray uInput, baNonce, LNG_CHACHA20POLY1305_IVSZ
+        If Not pvTlsBulkDecrypt(ucsTlsAlgoBulkChacha20Poly1305, baNonce, m_baTicketKey, 0, baNonce, 0, LNG_CHACHA20POLY1305_IVSZ, uInput.Data, LNG_CHACHA20POLY1305_IVSZ, lSize) Then
+            GoTo QH
+        End If
+        '--- authenticated so trust sizes
+        pvBufferReadLong uInput, lDigestAlgo
+        pvBufferReadLong uInput, lIssued, Size:=4
+        pvBufferReadLong uInput, lAgeAdd, Size:=4
+        pvBufferReadBlockStart uInput, BlockSize:=lBlockSize
+            pvBufferReadArray uInput, baPsk, lBlockSize
+        pvBufferReadBlockEnd uInput
+        pvBufferReadBlockStart uInput, Size:=2, BlockSize:=lBlockSize
+            pvBufferReadString uInput, sName, lBlockSize
+        pvBufferReadBlockEnd uInput
+        If lDigestAlgo <> .DigestAlgo Or sName <> .SniRequested Then
+            GoTo QH
+        End If
+        dAge = GetTickCount() - CDbl(lIssued)
+        If dAge < 0 Then
+            dAge = dAge + 4294967296#
+        End If
+        If dAge >= TLS_SESSION_TICKET_LIFETIME * 1000# Then
+            GoTo QH
+        End If
+    End With
+    '--- success
+    pvTlsTicketDecrypt = True
+QH:
+End Function
+
 '= crypto wrappers =======================================================
 
 Private Sub pvTlsGetRandom(baRetVal() As Byte, ByVal lSize As Long)
@@ -4176,20 +5463,63 @@ Private Sub pvTlsGetHelloRetryRandom(baRetVal() As Byte)
     pvArrayByte baRetVal, &HCF, &H21, &HAD, &H74, &HE5, &H9A, &H61, &H11, &HBE, &H1D, &H8C, &H2, &H1E, &H65, &HB8, &H91, &HC2, &HA2, &H11, &H16, &H7A, &HBB, &H8C, &H5E, &H7, &H9E, &H9, &HE2, &HC8, &HA8, &H33, &H9C
 End Sub
 
-Private Function pvTlsBulkDecrypt(ByVal eBulk As UcsTlsCryptoAlgorithmsEnum, baRemoteIV() As Byte, baRemoteKey() As Byte, baAad() As Byte, ByVal lAadPos As Long, ByVal lAadSize As Long, baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long) As Boolean
+Private Sub pvTlsSetupTrafficCtx(lCtx As Long, ByVal eBulk As UcsTlsCryptoAlgorithmsEnum, baKey() As Byte)
+    Const FUNC_NAME     As String = "pvTlsSetupTrafficCtx"
+    
+    If lCtx <> 0 Then
+        pvCryptoBulkAesCtxFree lCtx
+        lCtx = 0
+    End If
+    If m_uData.Pfn(ucsPfnAesCtxInit) = 0 Then
+        '--- no key schedule contexts in thunk image -> bulk functions expand key per record
+        Exit Sub
+    End If
+    Select Case eBulk
+    Case ucsTlsAlgoBulkAesGcm128, ucsTlsAlgoBulkAesGcm256, ucsTlsAlgoBulkAesCbc128, ucsTlsAlgoBulkAesCbc256
+        lCtx = pvCryptoBulkAesCtxInit(baKey)
+        If lCtx = 0 Then
+            Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_CALL_FAILED, "%1", "CryptoBulkAesCtxInit")
+        End If
+    End Select
+End Sub
+
+Private Sub pvTlsClearTrafficCtx(uCtx As UcsTlsContext)
+    With uCtx
+        If .AsyncJob <> 0 Then
+            pvCryptoJobAbandon .AsyncJob
+            .AsyncJob = 0
+        End If
+        If .RemoteTrafficCtx <> 0 Then
+            pvCryptoBulkAesCtxFree .RemoteTrafficCtx
+            .RemoteTrafficCtx = 0
+        End If
+        If .LocalTrafficCtx <> 0 Then
+            pvCryptoBulkAesCtxFree .LocalTrafficCtx
+            .LocalTrafficCtx = 0
+        End If
+    End With
+End Sub
+
+Private Function pvTlsBulkDecrypt(ByVal eBulk As UcsTlsCryptoAlgorithmsEnum, baRemoteIV() As Byte, baRemoteKey() As Byte, ByVal lRemoteCtx As Long, baAad() As Byte, ByVal lAadPos As Long, ByVal lAadSize As Long, baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long) As Boolean
     Const FUNC_NAME     As String = "pvTlsBulkDecrypt"
+    #If ImplUseStats Then
+        Dim dStart          As Double
+    #End If
     
+    #If ImplUseStats Then
+        dStart = pvTlsStatsTimer
+    #End If
     Select Case eBulk
     Case ucsTlsAlgoBulkChacha20Poly1305
         If Not pvCryptoBulkChacha20Poly1305Decrypt(baRemoteIV, baRemoteKey, baAad, lAadPos, lAadSize, baBuffer, lPos, lSize) Then
             GoTo QH
         End If
     Case ucsTlsAlgoBulkAesGcm128, ucsTlsAlgoBulkAesGcm256
-        If Not pvCryptoBulkAesGcmDecrypt(baRemoteIV, baRemoteKey, baAad, lAadPos, lAadSize, baBuffer, lPos, lSize) Then
+        If Not pvCryptoBulkAesGcmDecrypt(baRemoteIV, baRemoteKey, lRemoteCtx, baAad, lAadPos, lAadSize, baBuffer, lPos, lSize) Then
             GoTo QH
         End If
     Case ucsTlsAlgoBulkAesCbc128, ucsTlsAlgoBulkAesCbc256
-        If Not pvCryptoBulkAesCbcDecrypt(baRemoteIV, baRemoteKey, baBuffer, lPos, lSize) Then
+        If Not pvCryptoBulkAesCbcDecrypt(baRemoteIV, baRemoteKey, lRemoteCtx, baBuffer, lPos, lSize) Then
             GoTo QH
         End If
     Case Else
@@ -4198,32 +5528,50 @@ Private Function pvTlsBulkDecrypt(ByVal eBulk As UcsTlsCryptoAlgorithmsEnum, baR
     '--- success
     pvTlsBulkDecrypt = True
 QH:
+    #If ImplUseStats Then
+        pvTlsStatsAdd m_uStats, ucsTlsStatBulkCryptoTime, pvTlsStatsTimer - dStart
+    #End If
 End Function
 
-Private Sub pvTlsBulkEncrypt(ByVal eBulk As UcsTlsCryptoAlgorithmsEnum, baLocalIV() As Byte, baLocalKey() As Byte, baAad() As Byte, ByVal lAadPos As Long, ByVal lAadSize As Long, baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long)
+Private Sub pvTlsBulkEncrypt(ByVal eBulk As UcsTlsCryptoAlgorithmsEnum, baLocalIV() As Byte, baLocalKey() As Byte, ByVal lLocalCtx As Long, baAad() As Byte, ByVal lAadPos As Long, ByVal lAadSize As Long, baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long)
     Const FUNC_NAME     As String = "pvTlsBulkEncrypt"
+    #If ImplUseStats Then
+        Dim dStart          As Double
+    #End If
     
+    #If ImplUseStats Then
+        dStart = pvTlsStatsTimer
+    #End If
     Select Case eBulk
     Case ucsTlsAlgoBulkChacha20Poly1305
         If Not pvCryptoBulkChacha20Poly1305Encrypt(baLocalIV, baLocalKey, baAad, lAadPos, lAadSize, baBuffer, lPos, lSize) Then
             Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_ENCRYPTION_FAILED, "%1", "CryptoBulkChacha20Poly1305Encrypt")
         End If
     Case ucsTlsAlgoBulkAesGcm128, ucsTlsAlgoBulkAesGcm256
-        If Not pvCryptoBulkAesGcmEncrypt(baLocalIV, baLocalKey, baAad, lAadPos, lAadSize, baBuffer, lPos, lSize) Then
+        If Not pvCryptoBulkAesGcmEncrypt(baLocalIV, baLocalKey, lLocalCtx, baAad, lAadPos, lAadSize, baBuffer, lPos, lSize) Then
             Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_ENCRYPTION_FAILED, "%1", "CryptoBulkAesGcmEncrypt")
         End If
     Case ucsTlsAlgoBulkAesCbc128, ucsTlsAlgoBulkAesCbc256
-        If Not pvCryptoBulkAesCbcEncrypt(baLocalIV, baLocalKey, baBuffer, lPos, lSize) Then
+        If Not pvCryptoBulkAesCbcEncrypt(baLocalIV, baLocalKey, lLocalCtx, baBuffer, lPos, lSize) Then
             Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_ENCRYPTION_FAILED, "%1", "CryptoBulkAesCbcEncrypt")
         End If
     Case Else
         Err.Raise vbObjectError, FUNC_NAME, "Unsupported bulk type " & eBulk
     End Select
+    #If ImplUseStats Then
+        pvTlsStatsAdd m_uStats, ucsTlsStatBulkCryptoTime, pvTlsStatsTimer - dStart
+    #End If
 End Sub
 
 Private Sub pvTlsGetSharedSecret(baRetVal() As Byte, ByVal eKeyX As UcsTlsCryptoAlgorithmsEnum, baPriv() As Byte, baPub() As Byte)
     Const FUNC_NAME     As String = "pvTlsGetSharedSecret"
+    #If ImplUseStats Then
+        Dim dStart          As Double
+    #End If
     
+    #If ImplUseStats Then
+        dStart = pvTlsStatsTimer
+    #End If
     Select Case eKeyX
     Case ucsTlsAlgoExchX25519
         If Not pvCryptoEcdhCurve25519SharedSecret(baRetVal, baPriv, baPub) Then
@@ -4242,6 +5590,9 @@ Private Sub pvTlsGetSharedSecret(baRetVal() As Byte, ByVal eKeyX As UcsTlsCrypto
     Case Else
         Err.Raise vbObjectError, FUNC_NAME, "Unsupported exchange " & eKeyX
     End Select
+    #If ImplUseStats Then
+        pvTlsStatsAdd m_uStats, ucsTlsStatKeyExchangeTime, pvTlsStatsTimer - dStart
+    #End If
 End Sub
 
 Private Function pvTlsGetExchGroupName(ByVal lExchGroup As Long) As String
@@ -4358,7 +5709,13 @@ Private Sub pvTlsSignatureSign(baRetVal() As Byte, cPrivKey As Collection, ByVal
     Dim baEnc()         As Byte
     Dim baVerifyHash()  As Byte
     Dim baPrivKey()     As Byte
+    #If ImplUseStats Then
+        Dim dStart          As Double
+    #End If
         
+    #If ImplUseStats Then
+        dStart = pvTlsStatsTimer
+    #End If
     #If ImplUseDebugLog Then
         DebugLog MODULE_NAME, FUNC_NAME, "Signing with " & pvTlsGetSignatureName(lSignatureScheme) & " signature"
     #End If
@@ -4415,8 +5772,118 @@ Private Sub pvTlsSignatureSign(baRetVal() As Byte, cPrivKey As Collection, ByVal
     If pvArraySize(baRetVal) = 0 Then
         Err.Raise vbObjectError, FUNC_NAME, Replace(ERR_SIGNATURE_FAILED, "%1", pvTlsGetSignatureName(lSignatureScheme))
     End If
+    #If ImplUseStats Then
+        pvTlsStatsAdd m_uStats, ucsTlsStatSignatureTime, pvTlsStatsTimer - dStart
+    #End If
 End Sub
 
+Private Function pvTlsSignatureQueue(uCtx As UcsTlsContext, cPrivKey As Collection, ByVal lSignatureScheme As Long, baVerifyData() As Byte) As Boolean
+    Const FUNC_NAME     As String = "pvTlsSignatureQueue"
+    Dim uKeyInfo        As UcsKeyInfo
+    Dim lHashSize       As Long
+    Dim baEnc()         As Byte
+    Dim baVerifyHash()  As Byte
+    Dim baPrivKey()     As Byte
+    Dim baRandom()      As Byte
+    
+    With uCtx
+        If .AsyncHwnd = 0 Then
+            GoTo QH
+        End If
+        If Not SearchCollection(cPrivKey, 1, RetVal:=baPrivKey) Then
+            GoTo QH
+        End If
+        If Not pvAsn1DecodePrivateKey(baPrivKey, uKeyInfo) Then
+            GoTo QH
+        End If
+        lHashSize = pvTlsSignatureHashSize(lSignatureScheme)
+        '--- anything unsupported here is left to pvTlsSignatureSign to fail inline
+        Select Case lSignatureScheme
+        Case TLS_SIGNATURE_RSA_PKCS1_SHA1, TLS_SIGNATURE_RSA_PKCS1_SHA224, TLS_SIGNATURE_RSA_PKCS1_SHA256, TLS_SIGNATURE_RSA_PKCS1_SHA384, TLS_SIGNATURE_RSA_PKCS1_SHA512
+            If Not pvCryptoEmsaPkcs1Encode(baEnc, baVerifyData, uKeyInfo.BitLen, lHashSize) Then
+                GoTo QH
+            End If
+        Case TLS_SIGNATURE_RSA_PSS_RSAE_SHA256, TLS_SIGNATURE_RSA_PSS_RSAE_SHA384, TLS_SIGNATURE_RSA_PSS_RSAE_SHA512, _
+                TLS_SIGNATURE_RSA_PSS_PSS_SHA256, TLS_SIGNATURE_RSA_PSS_PSS_SHA384, TLS_SIGNATURE_RSA_PSS_PSS_SHA512
+            If Not pvCryptoEmsaPssEncode(baEnc, baVerifyData, uKeyInfo.BitLen, lHashSize, lHashSize) Then
+                GoTo QH
+            End If
+        Case TLS_SIGNATURE_ECDSA_SECP256R1_SHA256
+            If uKeyInfo.AlgoObjId <> szOID_ECC_CURVE_P256 Then
+                GoTo QH
+            End If
+            If Not pvCryptoHashSha256(baVerifyHash, baVerifyData) Then
+                GoTo QH
+            End If
+            pvArrayAllocate baRandom, LNG_SECP256R1_KEYSZ, FUNC_NAME & ".baRandom"
+            pvCryptoRandomBytes VarPtr(baRandom(0)), LNG_SECP256R1_KEYSZ
+            .AsyncJob = pvCryptoJobQueue(LNG_CRYPTO_JOB_ECDSA_SIGN256, LNG_SECP256R1_KEYSZ, 2 * LNG_SECP256R1_KEYSZ, .AsyncHwnd, .AsyncMsgID, .AsyncWParam, .AsyncLParam, _
+                uKeyInfo.KeyBlob, baVerifyHash, baRandom)
+        Case TLS_SIGNATURE_ECDSA_SECP384R1_SHA384
+            If uKeyInfo.AlgoObjId <> szOID_ECC_CURVE_P384 Then
+                GoTo QH
+            End If
+            If Not pvCryptoHashSha384(baVerifyHash, baVerifyData) Then
+                GoTo QH
+            End If
+            pvArrayAllocate baRandom, LNG_SECP384R1_KEYSZ, FUNC_NAME & ".baRandom"
+            pvCryptoRandomBytes VarPtr(baRandom(0)), LNG_SECP384R1_KEYSZ
+            .AsyncJob = pvCryptoJobQueue(LNG_CRYPTO_JOB_ECDSA_SIGN384, LNG_SECP384R1_KEYSZ, 2 * LNG_SECP384R1_KEYSZ, .AsyncHwnd, .AsyncMsgID, .AsyncWParam, .AsyncLParam, _
+                uKeyInfo.KeyBlob, baVerifyHash, baRandom)
+        End Select
+        If pvArraySize(baEnc) > 0 Then
+            .AsyncJob = pvCryptoJobQueue(LNG_CRYPTO_JOB_RSA_CRT_MODEXP, UBound(baEnc) + 1, UBound(baEnc) + 1, .AsyncHwnd, .AsyncMsgID, .AsyncWParam, .AsyncLParam, _
+                baEnc, uKeyInfo.PrivExp, uKeyInfo.Modulus, uKeyInfo.Prime1, uKeyInfo.Prime2, uKeyInfo.Coefficient)
+        End If
+        pvArrayWipe baRandom
+        If .AsyncJob = 0 Then
+            GoTo QH
+        End If
+        #If ImplUseDebugLog Then
+            DebugLog MODULE_NAME, FUNC_NAME, "Queued " & pvTlsGetSignatureName(lSignatureScheme) & " signature"
+        #End If
+    End With
+    '--- success
+    pvTlsSignatureQueue = True
+QH:
+End Function
+
+Private Function pvTlsSignatureComplete(uCtx As UcsTlsContext, baRetVal() As Byte) As Boolean
+    Const FUNC_NAME     As String = "pvTlsSignatureComplete"
+    Dim uJob            As UcsCryptoJob
+    Dim lIdx            As Long
+    Dim baTemp()        As Byte
+    
+    With uCtx
+        If Not pvCryptoJobPoll(.AsyncJob, uJob) Then
+            GoTo QH
+        End If
+        If uJob.Result <> 0 Then
+            '--- output is last argument
+            For lIdx = UBound(uJob.Args) To 1 Step -1
+                If uJob.Args(lIdx) <> 0 Then
+                    Exit For
+                End If
+            Next
+            If uJob.Op = LNG_CRYPTO_JOB_RSA_CRT_MODEXP Then
+                pvArrayAllocate baRetVal, uJob.Size, FUNC_NAME & ".baRetVal"
+                Call CopyMemory(baRetVal(0), ByVal uJob.Args(lIdx), uJob.Size)
+            Else
+                pvArrayAllocate baTemp, 2 * uJob.Size, FUNC_NAME & ".baTemp"
+                Call CopyMemory(baTemp(0), ByVal uJob.Args(lIdx), 2 * uJob.Size)
+                If Not pvAsn1EncodeEcdsaSignature(baRetVal, baTemp, uJob.Size) Then
+                    Erase baRetVal
+                End If
+            End If
+        End If
+        pvCryptoJobFree .AsyncJob
+        .AsyncJob = 0
+    End With
+    '--- success
+    pvTlsSignatureComplete = True
+QH:
+End Function
+
 Private Function pvTlsSignatureVerify(baCert() As Byte, ByVal lSignatureScheme As Long, baVerifyData() As Byte, baSignature() As Byte, sError As String, eAlertCode As UcsTlsAlertDescriptionsEnum) As Boolean
     Const FUNC_NAME     As String = "pvTlsSignatureVerify"
     Dim uCertInfo       As UcsKeyInfo
@@ -4428,8 +5895,14 @@ Private Function pvTlsSignatureVerify(baCert() As Byte, ByVal lSignatureScheme A
     Dim baTemp()        As Byte
     Dim bDeprecated     As Boolean
     Dim baDecr()        As Byte
+    #If ImplUseStats Then
+        Dim dStart          As Double
+    #End If
     
     On Error GoTo EH
+    #If ImplUseStats Then
+        dStart = pvTlsStatsTimer
+    #End If
     If Not pvAsn1DecodeCertificate(baCert, uCertInfo) Then
         GoTo UnsupportedCertificate
     End If
@@ -4489,6 +5962,9 @@ Private Function pvTlsSignatureVerify(baCert() As Byte, ByVal lSignatureScheme A
     '--- success
     pvTlsSignatureVerify = True
 QH:
+    #If ImplUseStats Then
+        pvTlsStatsAdd m_uStats, ucsTlsStatSignatureTime, pvTlsStatsTimer - dStart
+    #End If
     #If ImplUseDebugLog Then
         DebugLog MODULE_NAME, FUNC_NAME, IIf(pvTlsSignatureVerify, IIf(bSkip, "Skipping ", IIf(bDeprecated, "Deprecated ", "Valid ")), "Invalid ") & pvTlsGetSignatureName(lSignatureScheme) & " signature" & IIf(bDeprecated, " (lCurveSize=" & lCurveSize & " from server's public key)", vbNullString)
     #End If
@@ -4615,6 +6091,9 @@ Private Sub pvBufferWriteRecordEnd(uOutput As UcsBuffer, uCtx As UcsTlsContext)
     Dim baHmac()        As Byte
     Dim lPadding        As Long
     
+    #If ImplUseStats Then
+        pvTlsStatsAdd m_uStats, ucsTlsStatRecordsOut, 1
+    #End If
     With uCtx
         If pvArraySize(.LocalTrafficKey) > 0 Then
                 '--- . . . continues from start-of-record
@@ -4656,9 +6135,9 @@ Private Sub pvBufferWriteRecordEnd(uOutput As UcsBuffer, uCtx As UcsTlsContext)
                 End If
             #End If
             If .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS13 Then
-                pvTlsBulkEncrypt .BulkAlgo, baLocalIV, .LocalTrafficKey, uOutput.Data, lRecordPos, TLS_AAD_SIZE, uOutput.Data, lMessagePos, lMessageSize
+                pvTlsBulkEncrypt .BulkAlgo, baLocalIV, .LocalTrafficKey, .LocalTrafficCtx, uOutput.Data, lRecordPos, TLS_AAD_SIZE, uOutput.Data, lMessagePos, lMessageSize
             ElseIf .ProtocolVersion = TLS_PROTOCOL_VERSION_TLS12 Then
-                pvTlsBulkEncrypt .BulkAlgo, baLocalIV, .LocalTrafficKey, uAad.Data, 0, uAad.Size, uOutput.Data, lMessagePos, lMessageSize
+                pvTlsBulkEncrypt .BulkAlgo, baLocalIV, .LocalTrafficKey, .LocalTrafficCtx, uAad.Data, 0, uAad.Size, uOutput.Data, lMessagePos, lMessageSize
                 If .LocalEncryptThenMac Then
                     uAad.Size = uAad.Size - 2
                     pvBufferWriteLong uAad, lMessageSize + .IvExplicitSize, Size:=2
@@ -4873,6 +6352,9 @@ Private Sub pvArrayReallocate(baArray() As Byte, ByVal lSize As Long, sFuncName
     Else
         baArray = vbNullString
     End If
+    #If ImplUseStats Then
+        pvTlsStatsAdd m_uStats, ucsTlsStatReallocations, 1
+    #End If
     Debug.Assert RedimStats(MODULE_NAME & "." & sFuncName, UBound(baArray) + 1)
 End Sub
 
@@ -4898,6 +6380,12 @@ Private Sub pvArrayXor(baRetVal() As Byte, baArray() As Byte, ByVal lSeqNo As Lo
     Loop
 End Sub
 
+Private Sub pvArrayWipe(baArray() As Byte)
+    If pvArraySize(baArray) > 0 Then
+        Call FillMemory(baArray(0), pvArraySize(baArray), 0)
+    End If
+End Sub
+
 Private Sub pvArraySwap(baBuffer() As Byte, lBufferPos As Long, baInput() As Byte, lInputPos As Long)
     Dim lTemp           As Long
     
@@ -5001,6 +6489,23 @@ Private Function pvArrayEqual(baFirst() As Byte, baSecond() As Byte) As Boolean
     End If
 End Function
 
+Private Function pvArrayEqualConstTime(baFirst() As Byte, baSecond() As Byte) As Boolean
+    Dim lSize           As Long
+    Dim lIdx            As Long
+    Dim lDiff           As Long
+    
+    '--- note: compares every byte so timing does not leak position of first mismatch in MACs
+    lSize = pvArraySize(baFirst)
+    If lSize <> pvArraySize(baSecond) Then
+        GoTo QH
+    End If
+    For lIdx = 0 To lSize - 1
+        lDiff = lDiff Or (baFirst(lIdx) Xor baSecond(lIdx))
+    Next
+    pvArrayEqualConstTime = (lDiff = 0)
+QH:
+End Function
+
 Private Function pvToString(ByVal lPtr As Long) As String
     If lPtr <> 0 Then
         pvToString = String$(lstrlen(lPtr), 0)
@@ -5602,6 +7107,9 @@ Private Function pvCryptoInit() As Boolean
     Dim lOffset         As Long
     Dim lIdx            As Long
     Dim baThunk()       As Byte
+    Dim baGlob()        As Byte
+    Dim lThunkSize      As Long
+    Dim lGlob           As Long
     Dim hResult         As Long
     Dim sApiSource      As String
     
@@ -5614,18 +7122,41 @@ Private Function pvCryptoInit() As Boolean
             End If
         End If
         If m_uData.Thunk = 0 Then
-            '--- prepare thunk/context in executable memory
+            '--- thunk image is read-only once initialized so is shared by all threads in the process
+            .Thunk = pvThunkGlobalData(STR_THUNK_GLOBAL_KEY & [_ucsPfnMax])
+        End If
+        If m_uData.Thunk = 0 Then
+            '--- prepare thunk in executable memory and context on separate pages right after it
             pvGetThunkData baThunk
-            .Thunk = VirtualAlloc(0, UBound(baThunk) + 1, MEM_COMMIT, PAGE_EXECUTE_READWRITE)
+            pvGetGlobData baGlob
+            lThunkSize = (UBound(baThunk) + 1 + LNG_PAGE_SIZE - 1) And -LNG_PAGE_SIZE
+            .Thunk = VirtualAlloc(0, lThunkSize + UBound(baGlob) + 1, MEM_COMMIT, PAGE_READWRITE)
             If .Thunk = 0 Then
                 hResult = Err.LastDllError
                 sApiSource = "VirtualAlloc"
                 GoTo QH
             End If
+            lGlob = UnsignedAdd(.Thunk, lThunkSize)
             Call CopyMemory(ByVal .Thunk, baThunk(0), UBound(baThunk) + 1)
-            pvGetGlobData .Glob
+            Call CopyMemory(ByVal lGlob, baGlob(0), UBound(baGlob) + 1)
+            '--- init thunk's first 4 bytes -> global data in C/C++
+            Call CopyMemory(ByVal .Thunk, lGlob, 4)
+            Call CopyMemory(ByVal lGlob, GetProcAddress(GetModuleHandle("ole32"), "CoTaskMemAlloc"), 4)
+            Call CopyMemory(ByVal UnsignedAdd(lGlob, 4), GetProcAddress(GetModuleHandle("ole32"), "CoTaskMemRealloc"), 4)
+            Call CopyMemory(ByVal UnsignedAdd(lGlob, 8), GetProcAddress(GetModuleHandle("ole32"), "CoTaskMemFree"), 4)
+            If VirtualProtect(.Thunk, lThunkSize, PAGE_EXECUTE_READ, 0) = 0 Then
+                hResult = Err.LastDllError
+                sApiSource = "VirtualProtect"
+                GoTo QH
+            End If
+            '--- note: context stays writable as thunk caches CPU feature levels there on first use
+            '--- note: on a race both images are valid, the loser's one is just leaked
+            pvThunkGlobalData(STR_THUNK_GLOBAL_KEY & [_ucsPfnMax]) = .Thunk
+        End If
+        If .Pfn(1) = 0 Then
             '--- init pfns from thunk addr + offsets stored at beginning of it
-            For lIdx = LBound(.Pfn) To UBound(.Pfn)
+            '--- note: exports past the image's offset table stay 0 and callers fall back to older ones
+            For lIdx = LBound(.Pfn) To LNG_THUNK_PFN_COUNT
                 Call CopyMemory(lOffset, ByVal UnsignedAdd(.Thunk, 4 * lIdx), 4)
                 .Pfn(lIdx) = UnsignedAdd(.Thunk, lOffset)
             Next
@@ -5640,19 +7171,27 @@ Private Function pvCryptoInit() As Boolean
             Call pvPatchTrampoline(AddressOf pvCallSha2Init)
             Call pvPatchTrampoline(AddressOf pvCallSha2Update)
             Call pvPatchTrampoline(AddressOf pvCallSha2Final)
+            Call pvPatchTrampoline(AddressOf pvCallHmacSha2Init)
+            Call pvPatchTrampoline(AddressOf pvCallHmacSha2)
+            Call pvPatchTrampoline(AddressOf pvCallHkdfExpandLabel)
             Call pvPatchTrampoline(AddressOf pvCallChacha20Poly1305Encrypt)
             Call pvPatchTrampoline(AddressOf pvCallChacha20Poly1305Decrypt)
             Call pvPatchTrampoline(AddressOf pvCallAesGcmEncrypt)
             Call pvPatchTrampoline(AddressOf pvCallAesGcmDecrypt)
             Call pvPatchTrampoline(AddressOf pvCallAesCbcEncrypt)
             Call pvPatchTrampoline(AddressOf pvCallAesCbcDecrypt)
+            Call pvPatchTrampoline(AddressOf pvCallAesCtxInit)
+            Call pvPatchTrampoline(AddressOf pvCallAesCtxFree)
+            Call pvPatchTrampoline(AddressOf pvCallAesGcmSeal)
+            Call pvPatchTrampoline(AddressOf pvCallAesGcmOpen)
+            Call pvPatchTrampoline(AddressOf pvCallAesCbcSeal)
+            Call pvPatchTrampoline(AddressOf pvCallAesCbcOpen)
             Call pvPatchTrampoline(AddressOf pvCallRsaModExp)
             Call pvPatchTrampoline(AddressOf pvCallRsaCrtModExp)
-            '--- init thunk's first 4 bytes -> global data in C/C++
-            Call CopyMemory(ByVal .Thunk, VarPtr(.Glob(0)), 4)
-            Call CopyMemory(.Glob(0), GetProcAddress(GetModuleHandle("ole32"), "CoTaskMemAlloc"), 4)
-            Call CopyMemory(.Glob(4), GetProcAddress(GetModuleHandle("ole32"), "CoTaskMemRealloc"), 4)
-            Call CopyMemory(.Glob(8), GetProcAddress(GetModuleHandle("ole32"), "CoTaskMemFree"), 4)
+            Call pvPatchTrampoline(AddressOf pvCallRsaCrtCtxInit)
+            Call pvPatchTrampoline(AddressOf pvCallRsaCrtCtxFree)
+            Call pvPatchTrampoline(AddressOf pvCallRsaCrtCtxModExp)
+            Call pvPatchTrampoline(AddressOf pvCallTinfUncompress)
         End If
     End With
     '--- success
@@ -6009,6 +7548,62 @@ Private Function pvCryptoHashSha512(baRetVal() As Byte, baInput() As Byte, Optio
     pvCryptoHashSha512 = True
 End Function
 
+Private Function pvCryptoHashSha2Update(baCtx() As Byte, ByVal lHashSize As Long, ByVal lPtr As Long, ByVal lSize As Long) As Boolean
+    Const FUNC_NAME     As String = "CryptoHashSha2Update"
+    Dim ePfn            As UcsThunkPfnIndexEnum
+    
+    ePfn = pvCryptoGetSha2PfnInit(lHashSize)
+    If ePfn = 0 Then
+        GoTo QH
+    End If
+    With m_uData
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Init)
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Update)
+        If pvArraySize(baCtx) = 0 Then
+            pvArrayAllocate baCtx, LNG_SHA384_CONTEXTSZ, FUNC_NAME & ".baCtx"
+            pvCallSha2Init .Pfn(ePfn), VarPtr(baCtx(0))
+        End If
+        If lSize > 0 Then
+            pvCallSha2Update .Pfn(ePfn + 1), VarPtr(baCtx(0)), lPtr, lSize
+        End If
+    End With
+    '--- success
+    pvCryptoHashSha2Update = True
+QH:
+End Function
+
+Private Function pvCryptoHashSha2Snapshot(baRetVal() As Byte, baCtx() As Byte, ByVal lHashSize As Long) As Boolean
+    Const FUNC_NAME     As String = "CryptoHashSha2Snapshot"
+    Dim ePfn            As UcsThunkPfnIndexEnum
+    
+    If Not pvCryptoHashSha2Update(baCtx, lHashSize, 0, 0) Then
+        GoTo QH
+    End If
+    ePfn = pvCryptoGetSha2PfnInit(lHashSize)
+    pvArrayAllocate baRetVal, lHashSize, FUNC_NAME & ".baRetVal"
+    With m_uData
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Final)
+        '--- finalize a copy so running context can keep absorbing messages
+        Call CopyMemory(.HashCtx(0), baCtx(0), LNG_SHA384_CONTEXTSZ)
+        pvCallSha2Final .Pfn(ePfn + 2), VarPtr(.HashCtx(0)), baRetVal(0)
+    End With
+    '--- success
+    pvCryptoHashSha2Snapshot = True
+QH:
+End Function
+
+Private Function pvCryptoGetSha2PfnInit(ByVal lHashSize As Long) As UcsThunkPfnIndexEnum
+    '--- note: init, update and final exports are consecutive
+    Select Case lHashSize
+    Case LNG_SHA256_HASHSZ
+        pvCryptoGetSha2PfnInit = ucsPfnSha256Init
+    Case LNG_SHA384_HASHSZ
+        pvCryptoGetSha2PfnInit = ucsPfnSha384Init
+    Case LNG_SHA512_HASHSZ
+        pvCryptoGetSha2PfnInit = ucsPfnSha512Init
+    End Select
+End Function
+
 Private Function pvCryptoHmacSha1(baRetVal() As Byte, baKey() As Byte, baInput() As Byte, Optional ByVal Pos As Long, Optional ByVal Size As Long = -1) As Boolean
     Const FUNC_NAME     As String = "CryptoHmacSha1"
     Dim lPtr            As Long
@@ -6072,56 +7667,64 @@ QH:
 End Function
 
 Private Function pvCryptoHmacSha256(baRetVal() As Byte, baKey() As Byte, baInput() As Byte, Optional ByVal Pos As Long, Optional ByVal Size As Long = -1) As Boolean
-    Const FUNC_NAME     As String = "CryptoHmacSha256"
-    Dim lCtxPtr         As Long
-    Dim lPtr            As Long
-    Dim lIdx            As Long
-    
-    Debug.Assert UBound(baKey) < LNG_SHA256_BLOCKSZ
-    If Size < 0 Then
-        Size = pvArraySize(baInput) - Pos
-    Else
-        Debug.Assert pvArraySize(baInput) >= Pos + Size
+    If Not pvCryptoHmacSha2Init(LNG_SHA256_HASHSZ, baKey) Then
+        GoTo QH
     End If
-    If Size > 0 Then
-        lPtr = VarPtr(baInput(Pos))
+    If Not pvCryptoHmacSha2(baRetVal, baInput, Pos, Size) Then
+        GoTo QH
     End If
-    With m_uData
-        lCtxPtr = VarPtr(.HashCtx(0))
-        pvArrayAllocate baRetVal, LNG_SHA256_HASHSZ, FUNC_NAME & ".baRetVal"
-        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Init)
-        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Update)
-        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Final)
-        '-- inner hash
-        Call FillMemory(.HashPad(0), LNG_SHA256_BLOCKSZ, LNG_HMAC_INNER_PAD)
-        For lIdx = 0 To UBound(baKey)
-            .HashPad(lIdx) = baKey(lIdx) Xor LNG_HMAC_INNER_PAD
-        Next
-        pvCallSha2Init .Pfn(ucsPfnSha256Init), lCtxPtr
-        pvCallSha2Update .Pfn(ucsPfnSha256Update), lCtxPtr, VarPtr(.HashPad(0)), LNG_SHA256_BLOCKSZ
-        pvCallSha2Update .Pfn(ucsPfnSha256Update), lCtxPtr, lPtr, Size
-        pvCallSha2Final .Pfn(ucsPfnSha256Final), lCtxPtr, .HashFinal(0)
-        '-- outer hash
-        Call FillMemory(.HashPad(0), LNG_SHA256_BLOCKSZ, LNG_HMAC_OUTER_PAD)
-        For lIdx = 0 To UBound(baKey)
-            .HashPad(lIdx) = baKey(lIdx) Xor LNG_HMAC_OUTER_PAD
-        Next
-        pvCallSha2Init .Pfn(ucsPfnSha256Init), lCtxPtr
-        pvCallSha2Update .Pfn(ucsPfnSha256Update), lCtxPtr, VarPtr(.HashPad(0)), LNG_SHA256_BLOCKSZ
-        pvCallSha2Update .Pfn(ucsPfnSha256Update), lCtxPtr, VarPtr(.HashFinal(0)), LNG_SHA256_HASHSZ
-        pvCallSha2Final .Pfn(ucsPfnSha256Final), lCtxPtr, baRetVal(0)
-    End With
     '--- success
     pvCryptoHmacSha256 = True
+QH:
 End Function
 
 Private Function pvCryptoHmacSha384(baRetVal() As Byte, baKey() As Byte, baInput() As Byte, Optional ByVal Pos As Long, Optional ByVal Size As Long = -1) As Boolean
-    Const FUNC_NAME     As String = "CryptoHmacSha384"
-    Dim lCtxPtr         As Long
+    If Not pvCryptoHmacSha2Init(LNG_SHA384_HASHSZ, baKey) Then
+        GoTo QH
+    End If
+    If Not pvCryptoHmacSha2(baRetVal, baInput, Pos, Size) Then
+        GoTo QH
+    End If
+    '--- success
+    pvCryptoHmacSha384 = True
+QH:
+End Function
+
+Private Function pvCryptoHmacSha2Init(ByVal lHashSize As Long, baKey() As Byte) As Boolean
+    Dim lKeyPtr         As Long
+    Dim lKeySize        As Long
+    
+    lKeySize = pvArraySize(baKey)
+    If lKeySize > 0 Then
+        lKeyPtr = VarPtr(baKey(0))
+    End If
+    With m_uData
+        If .Pfn(ucsPfnHmacSha2Init) = 0 Then
+            '--- no native HMAC in thunk image -> keep key for pvCryptoHmacSha2
+            Debug.Assert lKeySize <= LNG_SHA384_BLOCKSZ
+            .HmacKey = baKey
+        Else
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallHmacSha2Init)
+            If pvCallHmacSha2Init(.Pfn(ucsPfnHmacSha2Init), VarPtr(.HmacCtx(0)), lHashSize, lKeyPtr, lKeySize) = 0 Then
+                GoTo QH
+            End If
+        End If
+        .HmacHashSize = lHashSize
+    End With
+    '--- success
+    pvCryptoHmacSha2Init = True
+QH:
+End Function
+
+Private Function pvCryptoHmacSha2(baRetVal() As Byte, baInput() As Byte, Optional ByVal Pos As Long, Optional ByVal Size As Long = -1) As Boolean
+    Const FUNC_NAME     As String = "CryptoHmacSha2"
     Dim lPtr            As Long
+    Dim lCtxPtr         As Long
+    Dim lBlockSize      As Long
     Dim lIdx            As Long
+    Dim ePfn            As UcsThunkPfnIndexEnum
     
-    Debug.Assert UBound(baKey) < LNG_SHA384_BLOCKSZ
+    '--- note: uses key state from last pvCryptoHmacSha2Init
     If Size < 0 Then
         Size = pvArraySize(baInput) - Pos
     Else
@@ -6131,32 +7734,123 @@ Private Function pvCryptoHmacSha384(baRetVal() As Byte, baKey() As Byte, baInput
         lPtr = VarPtr(baInput(Pos))
     End If
     With m_uData
-        lCtxPtr = VarPtr(.HashCtx(0))
-        pvArrayAllocate baRetVal, LNG_SHA384_HASHSZ, FUNC_NAME & ".baRetVal"
-        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Init)
-        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Update)
-        Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Final)
-        '-- inner hash
-        Call FillMemory(.HashPad(0), LNG_SHA384_BLOCKSZ, LNG_HMAC_INNER_PAD)
-        For lIdx = 0 To UBound(baKey)
-            .HashPad(lIdx) = baKey(lIdx) Xor LNG_HMAC_INNER_PAD
-        Next
-        pvCallSha2Init .Pfn(ucsPfnSha384Init), lCtxPtr
-        pvCallSha2Update .Pfn(ucsPfnSha384Update), lCtxPtr, VarPtr(.HashPad(0)), LNG_SHA384_BLOCKSZ
-        pvCallSha2Update .Pfn(ucsPfnSha384Update), lCtxPtr, lPtr, Size
-        pvCallSha2Final .Pfn(ucsPfnSha384Final), lCtxPtr, .HashFinal(0)
-        '-- outer hash
-        Call FillMemory(.HashPad(0), LNG_SHA384_BLOCKSZ, LNG_HMAC_OUTER_PAD)
-        For lIdx = 0 To UBound(baKey)
-            .HashPad(lIdx) = baKey(lIdx) Xor LNG_HMAC_OUTER_PAD
-        Next
-        pvCallSha2Init .Pfn(ucsPfnSha384Init), lCtxPtr
-        pvCallSha2Update .Pfn(ucsPfnSha384Update), lCtxPtr, VarPtr(.HashPad(0)), LNG_SHA384_BLOCKSZ
-        pvCallSha2Update .Pfn(ucsPfnSha384Update), lCtxPtr, VarPtr(.HashFinal(0)), LNG_SHA384_HASHSZ
-        pvCallSha2Final .Pfn(ucsPfnSha384Final), lCtxPtr, baRetVal(0)
+        Debug.Assert .HmacHashSize > 0
+        pvArrayAllocate baRetVal, .HmacHashSize, FUNC_NAME & ".baRetVal"
+        If .Pfn(ucsPfnHmacSha2) = 0 Then
+            ePfn = pvCryptoGetSha2PfnInit(.HmacHashSize)
+            lBlockSize = IIf(.HmacHashSize = LNG_SHA256_HASHSZ, LNG_SHA256_BLOCKSZ, LNG_SHA384_BLOCKSZ)
+            lCtxPtr = VarPtr(.HashCtx(0))
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Init)
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Update)
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallSha2Final)
+            '-- inner hash
+            Call FillMemory(.HashPad(0), lBlockSize, LNG_HMAC_INNER_PAD)
+            For lIdx = 0 To pvArraySize(.HmacKey) - 1
+                .HashPad(lIdx) = .HmacKey(lIdx) Xor LNG_HMAC_INNER_PAD
+            Next
+            pvCallSha2Init .Pfn(ePfn), lCtxPtr
+            pvCallSha2Update .Pfn(ePfn + 1), lCtxPtr, VarPtr(.HashPad(0)), lBlockSize
+            pvCallSha2Update .Pfn(ePfn + 1), lCtxPtr, lPtr, Size
+            pvCallSha2Final .Pfn(ePfn + 2), lCtxPtr, .HashFinal(0)
+            '-- outer hash
+            Call FillMemory(.HashPad(0), lBlockSize, LNG_HMAC_OUTER_PAD)
+            For lIdx = 0 To pvArraySize(.HmacKey) - 1
+                .HashPad(lIdx) = .HmacKey(lIdx) Xor LNG_HMAC_OUTER_PAD
+            Next
+            pvCallSha2Init .Pfn(ePfn), lCtxPtr
+            pvCallSha2Update .Pfn(ePfn + 1), lCtxPtr, VarPtr(.HashPad(0)), lBlockSize
+            pvCallSha2Update .Pfn(ePfn + 1), lCtxPtr, VarPtr(.HashFinal(0)), .HmacHashSize
+            pvCallSha2Final .Pfn(ePfn + 2), lCtxPtr, baRetVal(0)
+        Else
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallHmacSha2)
+            pvCallHmacSha2 .Pfn(ucsPfnHmacSha2), VarPtr(.HmacCtx(0)), lPtr, Size, baRetVal(0)
+        End If
     End With
     '--- success
-    pvCryptoHmacSha384 = True
+    pvCryptoHmacSha2 = True
+End Function
+
+Private Function pvCryptoHkdfExpandLabel(baRetVal() As Byte, ByVal lHashSize As Long, baSecret() As Byte, baLabel() As Byte, baContext() As Byte, ByVal lSize As Long) As Boolean
+    Const FUNC_NAME     As String = "CryptoHkdfExpandLabel"
+    Dim lSecretPtr      As Long
+    Dim lLabelPtr       As Long
+    Dim lContextPtr     As Long
+    Dim uOutput         As UcsBuffer
+    Dim uInfo           As UcsBuffer
+    Dim uInput          As UcsBuffer
+    Dim lIdx            As Long
+    Dim baLast()        As Byte
+    
+    If m_uData.Pfn(ucsPfnHkdfExpandLabel) = 0 Then
+        '--- no native HKDF in thunk image -> HkdfLabel framing and T(i) rounds over HMAC
+        pvBufferWriteLong uInfo, lSize, Size:=2
+        pvBufferWriteLong uInfo, 6 + pvArraySize(baLabel)
+        pvBufferWriteString uInfo, "tls13 "
+        pvBufferWriteArray uInfo, baLabel
+        pvBufferWriteLong uInfo, pvArraySize(baContext)
+        pvBufferWriteArray uInfo, baContext
+        pvBufferWriteEOF uInfo
+        If Not pvCryptoHmacSha2Init(lHashSize, baSecret) Then
+            GoTo QH
+        End If
+        lIdx = 1
+        Do While uOutput.Size < lSize
+            uInput.Size = 0
+            pvBufferWriteArray uInput, baLast
+            pvBufferWriteArray uInput, uInfo.Data
+            pvBufferWriteLong uInput, lIdx
+            pvCryptoHmacSha2 baLast, uInput.Data, Size:=uInput.Size
+            pvBufferWriteArray uOutput, baLast
+            lIdx = lIdx + 1
+        Loop
+        uOutput.Size = lSize
+        pvBufferWriteEOF uOutput
+        baRetVal = uOutput.Data
+        '--- success
+        pvCryptoHkdfExpandLabel = True
+        GoTo QH
+    End If
+    If pvArraySize(baSecret) > 0 Then
+        lSecretPtr = VarPtr(baSecret(0))
+    End If
+    If pvArraySize(baLabel) > 0 Then
+        lLabelPtr = VarPtr(baLabel(0))
+    End If
+    If pvArraySize(baContext) > 0 Then
+        lContextPtr = VarPtr(baContext(0))
+    End If
+    pvArrayAllocate baRetVal, lSize, FUNC_NAME & ".baRetVal"
+    Debug.Assert pvPatchTrampoline(AddressOf pvCallHkdfExpandLabel)
+    If pvCallHkdfExpandLabel(m_uData.Pfn(ucsPfnHkdfExpandLabel), lHashSize, lSecretPtr, pvArraySize(baSecret), _
+            lLabelPtr, pvArraySize(baLabel), lContextPtr, pvArraySize(baContext), baRetVal(0), lSize) = 0 Then
+        GoTo QH
+    End If
+    '--- success
+    pvCryptoHkdfExpandLabel = True
+QH:
+End Function
+
+Private Function pvCryptoZlibUncompress(baRetVal() As Byte, ByVal lSize As Long, baInput() As Byte, ByVal lPos As Long, ByVal lInputSize As Long) As Boolean
+    Const FUNC_NAME     As String = "CryptoZlibUncompress"
+    Dim lDestSize       As Long
+    
+    If lSize <= 0 Or lInputSize <= 0 Then
+        GoTo QH
+    End If
+    Debug.Assert pvArraySize(baInput) >= lPos + lInputSize
+    pvArrayAllocate baRetVal, lSize, FUNC_NAME & ".baRetVal"
+    lDestSize = lSize
+    Debug.Assert pvPatchTrampoline(AddressOf pvCallTinfUncompress)
+    If pvCallTinfUncompress(m_uData.Pfn(ucsPfnTinfZlibUncompress), baRetVal(0), lDestSize, baInput(lPos), lInputSize) <> 0 Then
+        GoTo QH
+    End If
+    '--- uncompressed_length is exact
+    If lDestSize <> lSize Then
+        GoTo QH
+    End If
+    '--- success
+    pvCryptoZlibUncompress = True
+QH:
 End Function
 
 Private Function pvCryptoBulkChacha20Poly1305Encrypt( _
@@ -6199,8 +7893,19 @@ Private Function pvCryptoBulkChacha20Poly1305Decrypt( _
     End If
 End Function
 
+Private Function pvCryptoBulkAesCtxInit(baKey() As Byte) As Long
+    Debug.Assert pvArraySize(baKey) = LNG_AES128_KEYSZ Or pvArraySize(baKey) = LNG_AES256_KEYSZ
+    Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCtxInit)
+    pvCryptoBulkAesCtxInit = pvCallAesCtxInit(m_uData.Pfn(ucsPfnAesCtxInit), baKey(0), UBound(baKey) + 1)
+End Function
+
+Private Sub pvCryptoBulkAesCtxFree(ByVal lCtx As Long)
+    Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCtxFree)
+    Call pvCallAesCtxFree(m_uData.Pfn(ucsPfnAesCtxFree), lCtx)
+End Sub
+
 Private Function pvCryptoBulkAesGcmEncrypt( _
-            baNonce() As Byte, baKey() As Byte, _
+            baNonce() As Byte, baKey() As Byte, ByVal lCtx As Long, _
             baAad() As Byte, ByVal lAadPos As Long, ByVal lAadSize As Long, _
             baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long) As Boolean
     Dim lAadPtr         As Long
@@ -6211,61 +7916,97 @@ Private Function pvCryptoBulkAesGcmEncrypt( _
     If lAadSize > 0 Then
         lAadPtr = VarPtr(baAad(lAadPos))
     End If
-    Debug.Assert pvPatchTrampoline(AddressOf pvCallAesGcmEncrypt)
-    Call pvCallAesGcmEncrypt(m_uData.Pfn(ucsPfnAesGcmEncrypt), _
-            baBuffer(lPos), baBuffer(lPos + lSize), _
-            baBuffer(lPos), lSize, _
-            lAadPtr, lAadSize, _
-            baNonce(0), baKey(0), UBound(baKey) + 1)
+    If lCtx = 0 Then
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallAesGcmEncrypt)
+        Call pvCallAesGcmEncrypt(m_uData.Pfn(ucsPfnAesGcmEncrypt), _
+                baBuffer(lPos), baBuffer(lPos + lSize), _
+                baBuffer(lPos), lSize, _
+                lAadPtr, lAadSize, _
+                baNonce(0), baKey(0), UBound(baKey) + 1)
+    Else
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallAesGcmSeal)
+        Call pvCallAesGcmSeal(m_uData.Pfn(ucsPfnAesGcmSeal), lCtx, _
+                baBuffer(lPos), baBuffer(lPos + lSize), _
+                baBuffer(lPos), lSize, _
+                lAadPtr, lAadSize, _
+                baNonce(0))
+    End If
     '--- success
     pvCryptoBulkAesGcmEncrypt = True
 End Function
 
 Private Function pvCryptoBulkAesGcmDecrypt( _
-            baNonce() As Byte, baKey() As Byte, _
+            baNonce() As Byte, baKey() As Byte, ByVal lCtx As Long, _
             baAad() As Byte, ByVal lAadPos As Long, ByVal lAadSize As Long, _
             baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long) As Boolean
+    Dim lResult         As Long
+    
     Debug.Assert pvArraySize(baNonce) = LNG_AESGCM_IVSZ
     Debug.Assert pvArraySize(baKey) = LNG_AES128_KEYSZ Or pvArraySize(baKey) = LNG_AES256_KEYSZ
     Debug.Assert pvArraySize(baBuffer) >= lPos + lSize
-    Debug.Assert pvPatchTrampoline(AddressOf pvCallAesGcmDecrypt)
-    If pvCallAesGcmDecrypt(m_uData.Pfn(ucsPfnAesGcmDecrypt), _
-            baBuffer(lPos), _
-            baBuffer(lPos), lSize - LNG_AESGCM_TAGSZ, _
-            baBuffer(lPos + lSize - LNG_AESGCM_TAGSZ), _
-            baAad(lAadPos), lAadSize, _
-            baNonce(0), baKey(0), UBound(baKey) + 1) = 0 Then
+    If lCtx = 0 Then
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallAesGcmDecrypt)
+        lResult = pvCallAesGcmDecrypt(m_uData.Pfn(ucsPfnAesGcmDecrypt), _
+                baBuffer(lPos), _
+                baBuffer(lPos), lSize - LNG_AESGCM_TAGSZ, _
+                baBuffer(lPos + lSize - LNG_AESGCM_TAGSZ), _
+                baAad(lAadPos), lAadSize, _
+                baNonce(0), baKey(0), UBound(baKey) + 1)
+    Else
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallAesGcmOpen)
+        lResult = pvCallAesGcmOpen(m_uData.Pfn(ucsPfnAesGcmOpen), lCtx, _
+                baBuffer(lPos), _
+                baBuffer(lPos), lSize - LNG_AESGCM_TAGSZ, _
+                baBuffer(lPos + lSize - LNG_AESGCM_TAGSZ), _
+                baAad(lAadPos), lAadSize, _
+                baNonce(0))
+    End If
+    If lResult = 0 Then
         '--- success
         pvCryptoBulkAesGcmDecrypt = True
     End If
 End Function
 
 Private Function pvCryptoBulkAesCbcEncrypt( _
-            baNonce() As Byte, baKey() As Byte, _
+            baNonce() As Byte, baKey() As Byte, ByVal lCtx As Long, _
             baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long) As Boolean
     Debug.Assert pvArraySize(baNonce) = LNG_AESCBC_IVSZ
     Debug.Assert pvArraySize(baKey) = LNG_AES128_KEYSZ Or pvArraySize(baKey) = LNG_AES256_KEYSZ
     Debug.Assert pvArraySize(baBuffer) >= lPos + lSize
     Debug.Assert lSize Mod pvArraySize(baNonce) = 0
-    Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCbcEncrypt)
-    Call pvCallAesCbcEncrypt(m_uData.Pfn(ucsPfnAesCbcEncrypt), _
-            baBuffer(lPos), baBuffer(lPos), lSize, _
-            baNonce(0), baKey(0), UBound(baKey) + 1)
+    If lCtx = 0 Then
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCbcEncrypt)
+        Call pvCallAesCbcEncrypt(m_uData.Pfn(ucsPfnAesCbcEncrypt), _
+                baBuffer(lPos), baBuffer(lPos), lSize, _
+                baNonce(0), baKey(0), UBound(baKey) + 1)
+    Else
+        Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCbcSeal)
+        Call pvCallAesCbcSeal(m_uData.Pfn(ucsPfnAesCbcSeal), lCtx, _
+                baBuffer(lPos), baBuffer(lPos), lSize, _
+                baNonce(0))
+    End If
     '--- success
     pvCryptoBulkAesCbcEncrypt = True
 End Function
 
 Private Function pvCryptoBulkAesCbcDecrypt( _
-            baNonce() As Byte, baKey() As Byte, _
+            baNonce() As Byte, baKey() As Byte, ByVal lCtx As Long, _
             baBuffer() As Byte, ByVal lPos As Long, ByVal lSize As Long) As Boolean
     Debug.Assert pvArraySize(baNonce) = LNG_AESCBC_IVSZ
     Debug.Assert pvArraySize(baKey) = LNG_AES128_KEYSZ Or pvArraySize(baKey) = LNG_AES256_KEYSZ
     Debug.Assert pvArraySize(baBuffer) >= lPos + lSize
     If lSize Mod pvArraySize(baNonce) = 0 Then
-        Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCbcDecrypt)
-        Call pvCallAesCbcDecrypt(m_uData.Pfn(ucsPfnAesCbcDecrypt), _
-                baBuffer(lPos), baBuffer(lPos), lSize, _
-                baNonce(0), baKey(0), UBound(baKey) + 1)
+        If lCtx = 0 Then
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCbcDecrypt)
+            Call pvCallAesCbcDecrypt(m_uData.Pfn(ucsPfnAesCbcDecrypt), _
+                    baBuffer(lPos), baBuffer(lPos), lSize, _
+                    baNonce(0), baKey(0), UBound(baKey) + 1)
+        Else
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallAesCbcOpen)
+            Call pvCallAesCbcOpen(m_uData.Pfn(ucsPfnAesCbcOpen), lCtx, _
+                    baBuffer(lPos), baBuffer(lPos), lSize, _
+                    baNonce(0))
+        End If
         '--- success
         pvCryptoBulkAesCbcDecrypt = True
     End If
@@ -6289,12 +8030,110 @@ Private Function pvCryptoRsaCrtModExp(baBase() As Byte, baExp() As Byte, baModul
     Const FUNC_NAME     As String = "CryptoRsaCrtModExp"
     
     pvArrayAllocate baRetVal, UBound(baBase) + 1, FUNC_NAME & ".baRetVal"
-    Debug.Assert pvPatchTrampoline(AddressOf pvCallRsaCrtModExp)
-    Call pvCallRsaCrtModExp(m_uData.Pfn(ucsPfnRsaCrtModExp), UBound(baBase) + 1, baBase(0), baExp(0), baModulus(0), baPrime1(0), baPrime2(0), baCoefficient(0), baRetVal(0))
+    With m_uData
+        '--- keep Montgomery constants of the last private key (usually the server certificate's)
+        If .RsaKeyCtx <> 0 Then
+            If Not pvArrayEqual(.RsaKeyModulus, baModulus) Or Not pvArrayEqual(.RsaKeyExp, baExp) Then
+                Debug.Assert pvPatchTrampoline(AddressOf pvCallRsaCrtCtxFree)
+                Call pvCallRsaCrtCtxFree(.Pfn(ucsPfnRsaCrtCtxFree), .RsaKeyCtx)
+                .RsaKeyCtx = 0
+            End If
+        End If
+        '--- note: thunk images w/o key contexts use the one-shot CRT export below
+        If .RsaKeyCtx = 0 And .Pfn(ucsPfnRsaCrtCtxInit) <> 0 Then
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallRsaCrtCtxInit)
+            .RsaKeyCtx = pvCallRsaCrtCtxInit(.Pfn(ucsPfnRsaCrtCtxInit), UBound(baBase) + 1, baExp(0), baModulus(0), baPrime1(0), baPrime2(0), baCoefficient(0))
+            .RsaKeyModulus = baModulus
+            .RsaKeyExp = baExp
+        End If
+        If .RsaKeyCtx <> 0 Then
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallRsaCrtCtxModExp)
+            If pvCallRsaCrtCtxModExp(.Pfn(ucsPfnRsaCrtCtxModExp), .RsaKeyCtx, baBase(0), baRetVal(0)) = 0 Then
+                GoTo QH
+            End If
+        Else
+            Debug.Assert pvPatchTrampoline(AddressOf pvCallRsaCrtModExp)
+            Call pvCallRsaCrtModExp(.Pfn(ucsPfnRsaCrtModExp), UBound(baBase) + 1, baBase(0), baExp(0), baModulus(0), baPrime1(0), baPrime2(0), baCoefficient(0), baRetVal(0))
+        End If
+    End With
     '--- success
     pvCryptoRsaCrtModExp = True
+QH:
+End Function
+
+Private Function pvCryptoJobQueue(ByVal lOp As Long, ByVal lSize As Long, ByVal lRetSize As Long, ByVal hWnd As Long, ByVal lMsgID As Long, ByVal wParam As Long, ByVal lParam As Long, ParamArray A() As Variant) As Long
+    Dim uJob            As UcsCryptoJob
+    Dim lJobPtr         As Long
+    Dim lPos            As Long
+    Dim lIdx            As Long
+    Dim baArg()         As Byte
+    
+    If m_uData.Pfn(ucsPfnCryptoJobRun) = 0 Then
+        GoTo QH
+    End If
+    '--- inputs are copied after header on 8-byte boundaries, output last
+    lPos = (LenB(uJob) + 7) And -8
+    For lIdx = 0 To UBound(A)
+        baArg = A(lIdx)
+        lPos = lPos + ((pvArraySize(baArg) + 7) And -8)
+    Next
+    lJobPtr = CoTaskMemAlloc(lPos + lRetSize)
+    If lJobPtr = 0 Then
+        GoTo QH
+    End If
+    With uJob
+        .State = LNG_CRYPTO_JOB_QUEUED
+        .Op = lOp
+        .Size = lSize
+        .AllocSize = lPos + lRetSize
+        .hWnd = hWnd
+        .MsgID = lMsgID
+        .wParam = wParam
+        .lParam = lParam
+        .PfnPostMessage = GetProcAddress(GetModuleHandle("user32"), "PostMessageW")
+        lPos = (LenB(uJob) + 7) And -8
+        For lIdx = 0 To UBound(A)
+            baArg = A(lIdx)
+            .Args(lIdx) = UnsignedAdd(lJobPtr, lPos)
+            If pvArraySize(baArg) > 0 Then
+                Call CopyMemory(ByVal .Args(lIdx), baArg(0), UBound(baArg) + 1)
+            End If
+            lPos = lPos + ((pvArraySize(baArg) + 7) And -8)
+        Next
+        .Args(lIdx) = UnsignedAdd(lJobPtr, lPos)
+    End With
+    pvArrayWipe baArg
+    Call CopyMemory(ByVal lJobPtr, uJob, LenB(uJob))
+    If QueueUserWorkItem(m_uData.Pfn(ucsPfnCryptoJobRun), lJobPtr, 0) = 0 Then
+        pvCryptoJobFree lJobPtr
+        GoTo QH
+    End If
+    '--- success
+    pvCryptoJobQueue = lJobPtr
+QH:
+End Function
+
+Private Function pvCryptoJobPoll(ByVal lJobPtr As Long, uJob As UcsCryptoJob) As Boolean
+    Call CopyMemory(uJob, ByVal lJobPtr, LenB(uJob))
+    pvCryptoJobPoll = (uJob.State = LNG_CRYPTO_JOB_DONE)
 End Function
 
+Private Sub pvCryptoJobAbandon(ByVal lJobPtr As Long)
+    '--- worker frees the job if still running
+    If InterlockedCompareExchange(lJobPtr, LNG_CRYPTO_JOB_ABANDONED, LNG_CRYPTO_JOB_QUEUED) <> LNG_CRYPTO_JOB_QUEUED Then
+        pvCryptoJobFree lJobPtr
+    End If
+End Sub
+
+Private Sub pvCryptoJobFree(ByVal lJobPtr As Long)
+    Dim uJob            As UcsCryptoJob
+    
+    '--- inputs include the private key
+    Call CopyMemory(uJob, ByVal lJobPtr, LenB(uJob))
+    Call FillMemory(ByVal lJobPtr, uJob.AllocSize, 0)
+    Call CoTaskMemFree(lJobPtr)
+End Sub
+
 '= private ===============================================================
 
 Private Function pvThunkAllocate(sText As String, Optional ByVal ThunkPtr As Long) As Long
@@ -6333,6 +8172,18 @@ Private Function pvThunkAllocate(sText As String, Optional ByVal ThunkPtr As Lon
     Next
 End Function
 
+Private Property Get pvThunkGlobalData(sKey As String) As Long
+    Dim sBuffer     As String
+    
+    sBuffer = String$(50, 0)
+    Call GetEnvironmentVariable("_MST_GLOBAL" & GetCurrentProcessId() & "_" & sKey, sBuffer, Len(sBuffer) - 1)
+    pvThunkGlobalData = Val(Left$(sBuffer, InStr(sBuffer, vbNullChar) - 1))
+End Property
+
+Private Property Let pvThunkGlobalData(sKey As String, ByVal lValue As Long)
+    Call SetEnvironmentVariable("_MST_GLOBAL" & GetCurrentProcessId() & "_" & sKey, lValue)
+End Property
+
 Private Function pvPatchTrampoline(ByVal Pfn As Long) As Boolean
     Dim bInIDE          As Boolean
  
@@ -6605,6 +8456,23 @@ Private Function pvCallSha2Final(ByVal Pfn As Long, ByVal lCtxPtr As Long, pHash
     ' void cf_sha512_digest_final(cf_sha512_context *ctx, uint8_t hash[LNG_SHA384_HASHSZ])
 End Function
 
+Private Function pvCallHmacSha2Init(ByVal Pfn As Long, ByVal lCtxPtr As Long, ByVal lHashSize As Long, ByVal lKeyPtr As Long, ByVal lKeySize As Long) As Long
+    ' int cf_hmac_sha2_init(cf_hmac_sha2_ctx *ctx, uint32_t hashsz, const uint8_t *key, size_t nkey)
+End Function
+
+Private Function pvCallHmacSha2(ByVal Pfn As Long, ByVal lCtxPtr As Long, ByVal lDataPtr As Long, ByVal lSize As Long, pHashPtr As Byte) As Long
+    ' void cf_hmac_sha2(const cf_hmac_sha2_ctx *ctx, const void *data, size_t ndata, uint8_t *out)
+End Function
+
+Private Function pvCallHkdfExpandLabel( _
+            ByVal Pfn As Long, ByVal lHashSize As Long, ByVal lSecretPtr As Long, ByVal lSecretSize As Long, _
+            ByVal lLabelPtr As Long, ByVal lLabelSize As Long, ByVal lContextPtr As Long, ByVal lContextSize As Long, _
+            pOutPtr As Byte, ByVal lOutSize As Long) As Long
+    ' int cf_hkdf_expand_label(uint32_t hashsz, const uint8_t *secret, size_t nsecret,
+    '                          const char *label, size_t nlabel, const uint8_t *context, size_t ncontext,
+    '                          uint8_t *out, size_t nout)
+End Function
+
 Private Function pvCallChacha20Poly1305Encrypt( _
             ByVal Pfn As Long, pKeyPtr As Byte, pNoncePtr As Byte, _
             ByVal lHeaderPtr As Long, ByVal lHeaderSize As Long, _
@@ -6651,6 +8519,40 @@ Private Function pvCallAesCbcDecrypt( _
     '                              const uint8_t *npub, const uint8_t *k, const size_t klen)
 End Function
 
+Private Function pvCallAesCtxInit(ByVal Pfn As Long, pKeyPtr As Byte, ByVal lKeySize As Long) As Long
+    ' void *cf_aes_ctx_init(const uint8_t *k, const size_t klen)
+End Function
+
+Private Function pvCallAesCtxFree(ByVal Pfn As Long, ByVal lCtxPtr As Long) As Long
+    ' void cf_aes_ctx_free(void *ctx)
+End Function
+
+Private Function pvCallAesGcmSeal( _
+            ByVal Pfn As Long, ByVal lCtxPtr As Long, pCipherTextPtr As Byte, pTagPtr As Byte, pPlaintTextPtr As Byte, ByVal lPlaintTextSize As Long, _
+            ByVal lHeaderPtr As Long, ByVal lHeaderSize As Long, pNoncePtr As Byte) As Long
+    ' void cf_aesgcm_seal(void *ctx, uint8_t *c, uint8_t *mac, const uint8_t *m, const size_t mlen,
+    '                     const uint8_t *ad, const size_t adlen, const uint8_t *npub)
+End Function
+
+Private Function pvCallAesGcmOpen( _
+            ByVal Pfn As Long, ByVal lCtxPtr As Long, pPlaintTextPtr As Byte, pCipherTextPtr As Byte, ByVal lCipherTextSize As Long, pTagPtr As Byte, _
+            pHeaderPtr As Byte, ByVal lHeaderSize As Long, pNoncePtr As Byte) As Long
+    ' int cf_aesgcm_open(void *ctx, uint8_t *m, const uint8_t *c, const size_t clen, const uint8_t *mac,
+    '                    const uint8_t *ad, const size_t adlen, const uint8_t *npub)
+End Function
+
+Private Function pvCallAesCbcSeal( _
+            ByVal Pfn As Long, ByVal lCtxPtr As Long, pCipherTextPtr As Byte, pPlaintTextPtr As Byte, ByVal lPlaintTextSize As Long, _
+            pNoncePtr As Byte) As Long
+    ' void cf_aescbc_seal(void *ctx, uint8_t *c, const uint8_t *m, const size_t mlen, const uint8_t *npub)
+End Function
+
+Private Function pvCallAesCbcOpen( _
+            ByVal Pfn As Long, ByVal lCtxPtr As Long, pPlaintTextPtr As Byte, pCipherTextPtr As Byte, ByVal lCipherTextSize As Long, _
+            pNoncePtr As Byte) As Long
+    ' void cf_aescbc_open(void *ctx, uint8_t *m, const uint8_t *c, const size_t clen, const uint8_t *npub)
+End Function
+
 Private Function pvCallRsaModExp(ByVal Pfn As Long, ByVal lSize As Long, pBasePtr As Byte, pExpPtr As Byte, pModPtr As Byte, pRetPtr As Byte) As Long
     ' static void rsa_modexp(const uint32_t maxbytes, const uint8_t *base_in, const uint8_t *exp_in, const uint8_t *mod_in, uint8_t *ret_out)
 End Function
@@ -6660,6 +8562,24 @@ Private Function pvCallRsaCrtModExp(ByVal Pfn As Long, ByVal lSize As Long, pBas
     '                            const uint8_t *p_in, const uint8_t *q_in, const uint8_t *iqmp_in, uint8_t *ret_out)
 End Function
 
+Private Function pvCallRsaCrtCtxInit(ByVal Pfn As Long, ByVal lSize As Long, pExpPtr As Byte, pModPtr As Byte, pPPtr As Byte, pQPtr As Byte, pIqmpPtr As Byte) As Long
+    ' static void *rsa_crt_ctx_init(const uint32_t maxbytes, const uint8_t *exp_in, const uint8_t *mod_in,
+    '                               const uint8_t *p_in, const uint8_t *q_in, const uint8_t *iqmp_in)
+End Function
+
+Private Function pvCallRsaCrtCtxFree(ByVal Pfn As Long, ByVal lCtxPtr As Long) As Long
+    ' static void rsa_crt_ctx_free(void *ctx)
+End Function
+
+Private Function pvCallRsaCrtCtxModExp(ByVal Pfn As Long, ByVal lCtxPtr As Long, pBasePtr As Byte, pRetPtr As Byte) As Long
+    ' static int rsa_crt_ctx_modexp(void *ctx, const uint8_t *base_in, uint8_t *ret_out)
+End Function
+
+Private Function pvCallTinfUncompress(ByVal Pfn As Long, pDestPtr As Byte, lDestSize As Long, pSrcPtr As Byte, ByVal lSrcSize As Long) As Long
+    ' int tinf_uncompress(void *dest, unsigned int *destLen, const void *source, unsigned int sourceLen)
+    ' int tinf_zlib_uncompress(void *dest, unsigned int *destLen, const void *source, unsigned int sourceLen)
+End Function
+
 Private Sub pvAppendBuffer(ByVal a01 As Long, ByVal a02 As Long, ByVal a03 As Long, ByVal a04 As Long, ByVal a05 As Long, ByVal a06 As Long, ByVal a07 As Long, ByVal a08 As Long, ByVal a09 As Long, ByVal a10 As Long, ByVal a11 As Long, ByVal a12 As Long, ByVal a13 As Long, ByVal a14 As Long, ByVal a15 As Long, ByVal a16 As Long, ByVal a17 As Long, ByVal a18 As Long, ByVal a19 As Long, ByVal a20 As Long, ByVal a21 As Long, ByVal a22 As Long, ByVal a23 As Long, ByVal a24 As Long, ByVal a25 As Long, ByVal a26 As Long, ByVal a27 As Long, ByVal a28 As Long, ByVal a29 As Long, ByVal a30 As Long, ByVal a31 As Long, ByVal a32 As Long)
     #If a01 And a02 And a03 And a04 And a05 And a06 And a07 And a08 And a09 And a10 And a11 And a12 And a13 And a14 And a15 And a16 And a17 And a18 And a19 And a20 And a21 And a22 And a23 And a24 And a25 And a26 And a27 And a28 And a29 And a30 And a31 And a32 Then '--- touch args
     #End If
@@ -6668,306 +8588,608 @@ Private Sub pvAppendBuffer(ByVal a01 As Long, ByVal a02 As Long, ByVal a03 As Lo
 End Sub
 
 Private Sub pvGetGlobData(baBuffer() As Byte)
-    ReDim m_baBuffer(0 To 2048 - 1) As Byte
+    ReDim m_baBuffer(0 To 11392 - 1) As Byte
     m_lBuffIdx = 0
     '--- begin thunk data
-    pvAppendBuffer &H76F299D0, &H76F9CF80, &H76F8B7C0, &H0&, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &H0&, &H0&, &H0&, &H1&, &HFFFFFFFF, &H27D2604B, &H3BCE3C3E, &HCC53B0F6, &H651D06B0, &H769886BC, &HB3EBBD55, &HAA3A93E7, &H5AC635D8, &HD898C296, &HF4A13945, &H2DEB33A0, &H77037D81, &H63A440F2, &HF8BCE6E5, &HE12C4247, &H6B17D1F2, &H37BF51F5, &HCBB64068, &H6B315ECE, &H2BCE3357
-    pvAppendBuffer &H7C0F9E16, &H8EE7EB4A, &HFE1A7F9B, &H4FE342E2, &HFC632551, &HF3B9CAC2, &HA7179E84, &HBCE6FAAD, &HFFFFFFFF, &HFFFFFFFF, &H0&, &HFFFFFFFF, &HFFFFFFFF, &H0&, &H0&, &HFFFFFFFF, &HFFFFFFFE, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HD3EC2AEF, &H2A85C8ED, &H8A2ED19D, &HC656398D, &H5013875A, &H314088F, &HFE814112, &H181D9C6E
-    pvAppendBuffer &HE3F82D19, &H988E056B, &HE23EE7E4, &HB3312FA7, &H72760AB7, &H3A545E38, &HBF55296C, &H5502F25D, &H82542A38, &H59F741E0, &H8BA79B98, &H6E1D3B62, &HF320AD74, &H8EB1C71E, &HBE8B0537, &HAA87CA22, &H90EA0E5F, &H7A431D7C, &H1D7E819D, &HA60B1CE, &HB5F0B8C0, &HE9DA3113, &H289A147C, &HF8F41DBD, &H9292DC29, &H5D9E98BF, &H96262C6F, &H3617DE4A, &HCCC52973, &HECEC196A, &H48B0A77A, &H581A0DB2
+    pvAppendBuffer &H0&, &H0&, &H0&, &HF58C3B85, &H2FBC93C6, &HFB8C0E19, &HCF932DC6, &H643D42C2, &H270B4898, &H33D4BA65, &H7CF9D3A, &HD740913E, &H9D103905, &HD140BEB3, &HFD399F05, &H688F8A09, &HA5C18434, &H98F81267, &H44FD2F92, &H877AAA68, &HABC91205, &HCCAAC49E, &H26D9E823, &HDD43598C, &H5A1B7DCB, &H9F0C65A8, &H6F117B68, &HFC7C3484, &HB36E706E, &HC3C1CF61, &H73DFC9B4, &H781CC7E5
+    pvAppendBuffer &HEB1D79C9, &H7DAF675C, &H70459ADB, &H305FA0BB, &HE7A4FBD, &H54C663AD, &H829D4CE0, &H2FE33848, &HF421C383, &H1BF64C42, &H795AC80D, &H91B42BB3, &H1B91DB49, &H4B02DCCA, &H57269623, &H1F8C78DC, &H9FDF9EE5, &H8CE21FD3, &H5FE16284, &HF0C1D6D4, &H46077ADC, &H2432A4D7, &HE9879EA8, &H4688848F, &H2F0D62E9, &H795A41D2, &H3140F360, &H5FD936CD, &H907444A1, &H9A4E953C, &H9476B3C5, &H54767252
+    pvAppendBuffer &HBEDE0C4E, &HD9660864, &H59AD7C11, &H524B1A65, &H88D2F082, &H2289D6BE, &HD5D5726A, &H89B22E5D, &H527850EF, &H746F11B, &H512011B1, &H68BCD52C, &H33BEF2BD, &H69482EF2, &HC649DBB0, &H41CB1AEE, &HB5B6EE0C, &H212A7E5, &H5C294D27, &HD1BFF7F9, &H4E3DCBDA, &H20645717, &HC9118E82, &HF189D56, &HBACCCEBC, &HD4467668, &H1B4822E9, &H25563781, &HAB360A7F, &H480F7958, &H2512228A, &H6114B4E3
+    pvAppendBuffer &HC75D0527, &HD976FE2A, &H222D9625, &HC87EBDFF, &H23ACA0C5, &HB0C01B1E, &HCA73AD35, &HCB82694, &HB83FDA47, &H5936CD7F, &H4FE7C78A, &HA217C272, &H80CA9F8A, &H24688357, &HF2B8E639, &HDB472FCD, &HC42FE0C6, &HC462B254, &H45E18F00, &H23E93FCB, &H7E0DCC7B, &H9B727474, &HBA7E1E3B, &H9FBEF505, &H37D8209B, &H7D331E08, &H13FEB7F0, &HE8568C9E, &H2CE5D318, &HE62B3F73, &H121EC5DE, &H95F2C0A9
+    pvAppendBuffer &H8CFC176C, &HD37D4F7B, &H4F3F0395, &H2FBB0156, &H2B35D2DC, &HDBF02DB5, &H346703B3, &HD0B98155, &HDCBFEF96, &HA3561FA1, &H4EE1641B, &HB5BFB9E3, &HBB5790AD, &H608D5DF8, &HC07EC2D5, &H3EDF2D49, &H12E89C4B, &H72E5AFD7, &H5D6FA59E, &HE1147DC3, &HD2AAE0CA, &H66112A12, &H2780F1B3, &HB31F844F, &H5507397, &H10104964, &H378925BF, &H2D48ED74, &H919D2063, &H872F2752, &H9FBFC989, &HDBD9B7A4
+    pvAppendBuffer &H908AA38B, &H7C749C8D, &H5296CDD0, &HB93318EA, &HF93FCE36, &H868CE9EF, &HD3EA515E, &H2DCE78C0, &HBFCDBCE5, &H9ABAC626, &H15F1BCD1, &H9E5B0353, &H472BAF62, &H278D0447, &H3BAA0B90, &H9643BF27, &HC785F46, &H8D837B13, &H7F3A6A1A, &H6F166F23, &H40D0AD51, &H1FAB6ABE, &H118E3293, &HA04D088E, &H3FE35E14, &H26E16266, &H30806035, &H5D3D800B, &HF7E64439, &HC901EDF6, &H95A8D555, &H592C6339
+    pvAppendBuffer &H68CD7830, &H2E51307E, &H30D0FDED, &HCD8A9259, &HD9C6CFB2, &HB1152102, &H1C321D1E, &HA6A1E6BD, &HD89F2022, &HF757EC73, &H7183D5A9, &H4886ABF, &H86547623, &H2BFE4F2A, &H9E595F49, &H50938329, &H830AA4C9, &H5B4886E2, &H245AD80F, &HDD9B7CE2, &HFC240ABE, &H2A961AEA, &H6971380, &H2016D93E, &HEF3E638A, &H23730D65, &H250A799F, &H2692609E, &H4B180765, &H2D9A7F06, &H4BDC37E2, &H11907174
+    pvAppendBuffer &HAFF48054, &H5B6DF985, &HDDC1103, &HC1B8034E, &HEEEC03F6, &HB47DDDD0, &H43BCC9A, &H343E54B7, &H5854D4C7, &HAC5E9B7C, &H59DA1476, &H84ED55DA, &HF71938F9, &HB2029F79, &H2EC823AC, &H96ED3A89, &H58BF01D7, &H7F7DAE2D, &H4B6467B2, &H1B4DACEB, &H6BF85B65, &HE90C5BD0, &HB92036E4, &H49BE3458, &H2C6D3441, &H17DF9CBE, &H5AB606DD, &H13F829A5, &HE6C159C6, &HC323A78E, &H5837CBE0, &H791B8A97
+    pvAppendBuffer &H47308E48, &H34272223, &H5F5B86ED, &HA93431AB, &H3F8ED4F0, &HCA3CF849, &HDC9582F5, &H6A2ACE59, &H51C67112, &HFA496233, &H41729B11, &H7B7210, &HE50A1880, &HD2F6E036, &H2CE328AB, &H5C4057B4, &HE2201C07, &HB7FD8329, &H6656611E, &HAFE0F3F5, &H2842FA5C, &H835B3ED5, &H61DB6831, &HAC34F93F, &H1C726DC, &H2479F37D, &H3194AD99, &HFB8FB537, &HBDAB6E48, &H92A00A61, &H39856343, &HC45A5608
+    pvAppendBuffer &HB68569B7, &HAD27D9FC, &H64D7D76B, &H3D86A360, &H8D407E74, &H375D64BD, &H595A6A2B, &HB34142DE, &HAB45A829, &H4C62B15C, &H57834D80, &HB2112C89, &HD907BD52, &H92FC21D, &H98ABF61F, &H1929305A, &H4CF9EE30, &H5DDB3B03, &H3AA5E16D, &H23E97F0D, &HDDE7F30E, &HF62B1E88, &HFE6F09AB, &HFC802C63, &H62A5A7B4, &H164CAE06, &H3442A06D, &HBEB34ACA, &HEBB1E896, &H4866030C, &H5CE2272C, &H846E802A
+    pvAppendBuffer &HF17B4716, &H47CFC512, &H7E441293, &H309B9D8A, &H5F2691BC, &H1C92CCB1, &H38484F67, &HE342B733, &HA14BA806, &HB447813, &H69A82F9F, &H798064B2, &H3F229013, &HB444A96, &HF5A02569, &HE3831C26, &HF224BF54, &H8F277B6D, &H480BA27A, &HD615DC4C, &HBC4C5FCA, &HEAF9EFEC, &H8F677EE3, &H352B8402, &H1DB65D80, &H3873919E, &H4CD95DDD, &H30E65F12, &H290C4D0D, &H2F332B38, &HC6E8C6C5, &H35FED9E4
+    pvAppendBuffer &H40BF9AC9, &H31A2CBCF, &HA814EB4, &H824C8865, &H5EC2AEC2, &HA03BF506, &HCB74A2FE, &H71A1BC14, &HA0B086B0, &HCB92AA67, &H46F9D63C, &H4A35D1, &HFB735AC2, &H3A6607C3, &H31DE0F43, &HC528D599, &H7B8591BF, &HF5BB050C, &H55BE9A25, &H4FFB81EF, &H3F50A50A, &H3BF420BF, &HB1E03509, &HC6AA2CD0, &H9BAA8E1C, &HFA237A40, &H32239861, &H33DB3DBF, &HD005ACD, &H80AC35E2, &H111B37C, &H6F88EBEB
+    pvAppendBuffer &H4892D66C, &H6508FBCD, &H770EADB1, &HDF9366AC, &H1BF3C12B, &HA03BD820, &H5C0CD768, &HA2F33F3, &H1E9424A7, &HA4CAB413, &H2350F6B9, &HFB766A62, &H8269BDE, &HDBA8C132, &HDCCC5940, &H2ABD97B3, &H92210842, &HD151F3AC, &H3EB5DE95, &H268A820D, &HA1527A42, &H50FAF508, &HBB3D37BE, &H34B83B8D, &H12C91730, &H6D45BB5A, &H7A2D212E, &HD3659BB3, &H6260C72B, &HF968DDA5, &HC2714450, &HF7B226BB
+    pvAppendBuffer &H5789F572, &H49BF0FE4, &H513C6D2E, &HC515A335, &HE863E42F, &H29866CF6, &H4D17D218, &HEEE130C1, &H6B6B80B, &HA9EE0C89, &H3DB90EEA, &HBB357794, &H3174A4CE, &H55773A92, &H1140D02C, &H73B0C6C4, &H895603AB, &H8F33636F, &H2F94FBF1, &H7CE4C556, &H1CD1FE5D, &HB1F561AE, &HCD92BF28, &H667EE11B, &HFFA28AE7, &HE1D2E271, &H6F8174E5, &H136FF2C, &H894D35C6, &H817F9FEB, &H69804906, &H7C03027C
+    pvAppendBuffer &H5D015DEA, &H8BD8A473, &H2C995AF9, &HEE0A86EA, &HF8A9A7D2, &H536B1C56, &HBE7E4FF, &HB63391BF, &HCBACDD9E, &H95C5FD68, &HDD9A25C, &H6A548721, &HE4B441B3, &HFDA44ED8, &HF6B03940, &H64CF6893, &HE96F3176, &HA168F9B0, &H76D0B327, &HA2BE3806, &HE937F481, &HDA7FF22C, &H3197E8BC, &H90E23650, &H8340FE11, &HBE84B2C4, &H7F8D9411, &H390D3900, &H9F30623F, &H1D723BC, &HEE8882FD, &H3CA81390
+    pvAppendBuffer &HA6A8EED2, &H26A84F1, &HB68ADC8, &H64225B84, &HEF6C2FFA, &H7E55D2E6, &HCB7A4088, &H918F8904, &H6A4B38A7, &HD8A39529, &H7171960, &HBB2E53DB, &HE1EE2917, &H2CE182F8, &HEF010389, &H3434B5D, &HFE575E37, &HCDA8BBBC, &H369BB6EE, &H113AF0FF, &HCD83F539, &H5BDECDD, &H9FF0103D, &HE7D8A6C8, &H22C8233, &H47A2D426, &H7327A3AB, &H3A0DF243, &HB12EA179, &H7DF68F8C, &H77A2B4AF, &HB6C2F22C
+    pvAppendBuffer &HD34574F9, &HCF6A669D, &H5EFE55D4, &H1CFD3604, &HDCEA38CF, &H362F9CEF, &HAEEDFC39, &HAAD071E8, &H6356D25A, &HD5850A40, &H7B1101EB, &HE1086A9C, &H5F61DA0, &H87743EA9, &HAFBFD136, &H8AA1F05, &H124A440F, &HA91B86A7, &H69B8B80E, &H2D6846E2, &H22C5D3C, &HFC48B69D, &HD778A898, &H7D680784, &HF489F376, &HBA1C2850, &H39C6CA15, &H2A128216, &H7322BC10, &HC97F922C, &H897AC0, &H8EC8BFB5
+    pvAppendBuffer &H7C890F2D, &H49012E05, &H6BD6C41C, &H8FCBF541, &H2FDBF731, &H605DA7B9, &H46FCF991, &HFF6109CE, &H624EA5E3, &H293FEBEE, &H26BA7B78, &H164B640A, &HAFA1A795, &HB30AEAC9, &H8BAF195F, &H965AE5A2, &HDD7B2418, &H10E672B, &H6B695ACE, &HC12E9F32, &HD606849, &HBE14D9EA, &H5B327B6, &H57BBB7F8, &H1216C65E, &H3EC50D13, &H6C61D3B5, &H40F2EDAF, &HCEBDFD5C, &H1E7AC13C, &H8D51D5BA, &HF9A176BA
+    pvAppendBuffer &H1D1CAFD5, &H53E54D5B, &H4BFA0DE4, &HCB362932, &HB50BE32B, &HAC3370EE, &HF7DEB81A, &HBF7686DC, &HD15E35D1, &H21AE798A, &H31543296, &H25AC039C, &H8FA5BCDF, &HDAEF6E2A, &H4E9EE010, &H509E5227, &H94DE783C, &H2DE0C09E, &H349B6111, &H57AE50B0, &H5645565F, &H18F5F3A3, &H322F840E, &HE80DF321, &HE5622057, &H3BECA30F, &H1FCCD91D, &HE5A08A1C, &HA91348D0, &HF20115D4, &H4516283D, &HC8DEC01F
+    pvAppendBuffer &HF38C40B0, &H65FCE8D3, &H4A41E998, &H5E263D26, &HD27CAE14, &HC2EC4994, &H99C2440D, &HAEA1C293, &HCD76DCC, &HBA42301B, &H4042D5D7, &H520B532C, &H81EEF480, &H25DCBCAA, &HD8415447, &H6F8E2D0, &H13055B97, &HCA2BBB80, &H2DDFE8B9, &H85E87C45, &H7ACBD35D, &HFFF85D2F, &H8A185FF6, &H5A52EE4C, &HEE78F381, &H7BAD516B, &H7AE20355, &H49B24F47, &HCBA0DC45, &H232E12CD, &H193C0E52, &HAFDB46D6
+    pvAppendBuffer &H9C40B861, &H829C3482, &H570E40F4, &H278E92AA, &H8418EE2, &H69ED74BF, &HF7E4E1EF, &H57D57E1F, &H3A43962F, &H1CC96BBC, &H6B53D138, &H98493E2D, &H10DE21CC, &HC88AB7DB, &H502B8239, &HB8889D36, &HC7325547, &H34846224, &HB87588C, &H1669B6EF, &H3EB36F4C, &H9B869FF8, &H2078ABFF, &HDC939C7E, &HA0233977, &H18F00E9, &H3EC4FE6F, &HC8D93D7C, &H8729525, &HD01D8880, &HDCA4EC1F, &H2D6E24FF
+    pvAppendBuffer &HA4B20FA6, &H243A5B0B, &H4D686E9D, &H3175E9D3, &H98F7349B, &HC7E3A5C2, &H439CCB8F, &HF351E45, &H7D754DCF, &H59B3803F, &H497CA883, &H78BC4A61, &H96ADFF7, &HC5770111, &HD4F30D9E, &H8FF24A76, &HA90CC25A, &H683762A0, &H4234F756, &H8EA29AE9, &HC2F28C35, &HC0A37F5E, &H50B62781, &H9EB35E0A, &H545CA30D, &HBC3DCBA2, &H7F2362ED, &H68A8233C, &H30BFCB5F, &H69D0B03C, &HEC8AFD88, &H8E4FDEE0
+    pvAppendBuffer &H4FCC19B1, &HAEDF0038, &H168B5BE, &H2C882CB5, &H267669EE, &H777F1BC9, &HE41042B, &H1D6AC2E2, &HC16BD15, &H6EDEC043, &H9676EF, &HFCF880CF, &H95A606D6, &HB0038E73, &HE3A1C055, &H1B62A9D0, &H37FD5EFE, &H3489469B, &H3E740A5D, &H45EC7F4, &H10FD567B, &H47B7CBB7, &HD6B76CC5, &H66B5ED68, &H4013F58B, &H7304F1D6, &H5E3829B3, &H70E2D0A6, &H9FBE7E50, &H73F7FFFF, &H130DE0F0, &H71E802D0
+    pvAppendBuffer &H9157FEB8, &H3D17046B, &H4CBB7DCD, &HC67EF7E1, &H1CDDC2EF, &HC4411CD8, &HFE02D579, &H658FD849, &H7DEA81F0, &HB5BAD8DC, &H2A6DFE58, &H0&, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &H0&, &H0&, &H0&, &H1&, &HFFFFFFFF, &H27D2604B, &H3BCE3C3E, &HCC53B0F6, &H651D06B0, &H769886BC, &HB3EBBD55, &HAA3A93E7, &H5AC635D8, &HD898C296, &HF4A13945, &H2DEB33A0, &H77037D81
+    pvAppendBuffer &H63A440F2, &HF8BCE6E5, &HE12C4247, &H6B17D1F2, &H37BF51F5, &HCBB64068, &H6B315ECE, &H2BCE3357, &H7C0F9E16, &H8EE7EB4A, &HFE1A7F9B, &H4FE342E2, &HD898C296, &HF4A13945, &H2DEB33A0, &H77037D81, &H63A440F2, &HF8BCE6E5, &HE12C4247, &H6B17D1F2, &H37BF51F5, &HCBB64068, &H6B315ECE, &H2BCE3357, &H7C0F9E16, &H8EE7EB4A, &HFE1A7F9B, &H4FE342E2, &H71E5C83, &HEEA6BC92, &H8542A0BE, &H8BD27F19
+    pvAppendBuffer &H2A58E5B1, &H20A845B7, &H5026D73F, &H54CCC941, &H140916A1, &HCFD08EF7, &H5D8EE496, &H929E0BCC, &HDAD2BF22, &H3A8F8715, &HB4514532, &H1C433F45, &H4BAC870, &HF7D24BB7, &H3A23C6AB, &H593A09A0, &HF94C9D1D, &HDFCC2358, &H297BED02, &H3CFA0F87, &H40F26940, &HCE98A30B, &H248A8AF, &H62121C0D, &H8309AF9B, &HA758AA80, &H70BE12C6, &HE4E37694, &H3ECCA7E0, &HC739A5EA, &H6743333E, &HA7D2C98F
+    pvAppendBuffer &H224D9428, &HFEF6335, &H5C792A0C, &H7EF2EE3C, &H552AC094, &H302B22DD, &HDFBD3D20, &H81B21450, &HD5E609DB, &HA4F67F51, &H30ACC011, &HAFB68627, &H86EF7D7D, &HDD37E3FF, &H88B86DB, &HF6D77C27, &H254C5491, &H28FE9A4F, &H6DF0FD5E, &HD6690337, &HADDAD596, &H9FF04992, &H9E4373F9, &HF3D1A7AF, &HDF074167, &HA13E9578, &HE6D13D22, &H20E2A53C, &HB0879605, &HD7B86AEE, &HBE3C7265, &HA424EC2D
+    pvAppendBuffer &H12F01E9E, &H276203C2, &HB77E46E9, &HB666FAC5, &H3BF0C52D, &HF431BB1A, &H726CD8B6, &HEF46A44A, &HEE3DE5A9, &HEB5ABC19, &H90246904, &H38AAA380, &H525D6ABF, &HAEBFD735, &H96BEA25A, &HC302F8F4, &H544920A4, &HDB82B3EA, &H2EADB2E, &H621C75D1, &H9EF485F0, &H8939DC4C, &H57C46D63, &H225D03D8, &H522D7F70, &H4FDAC96F, &HB4FA649D, &HD7C4A4FE, &H943E832A, &H9C762EF1, &H1786DF70, &H7E50AB0
+    pvAppendBuffer &H2589F18E, &H90F573A8, &HA7C2A51A, &HD2BF28B, &H5B20D37C, &H48263AF1, &H60551446, &H27EC9DB9, &H94B4E7ED, &H7087A10A, &H13BD00AC, &HCAC3F43, &HC0B9372A, &H8BC659AA, &HEDD9583F, &HF7659958, &H8C267D88, &H9F05F94A, &HC99A739D, &HDC46E7, &HDF55D0F2, &H4AF50A00, &H8156BF6A, &HB5EB202D, &H5228C111, &H40D1E3AB, &H45793424, &H312A557, &H9E6486E0, &H9D90CDA8, &H1C7522C0, &HC8A820BD
+    pvAppendBuffer &H8DCD7AB, &H867C5580, &H882A7892, &H3C510CE2, &H646D54C6, &HE283334, &HEDA4E046, &H33392776, &H5BA997B0, &HC3A7FC08, &H5ACF053F, &HD35E620F, &H7EB8CFEE, &H8D9692F7, &HD8C013D, &H5E3F223, &H84E32E59, &H76347A52, &H15B0A1E5, &H3C53E290, &HFAE798D4, &H538B7DA5, &HD23591, &H1B9F1BD1, &H9A08693F, &H11A9F072, &H140EFEB3, &HD30E7CDA, &H4DD6C004, &H81DEC926, &HDAD210D5, &HBFED14FE
+    pvAppendBuffer &HB96B9911, &H39F9FF69, &H29C2024D, &H2FD7B73, &H715D29FC, &H50CFCEB8, &HC236311, &HB682B999, &HC7797831, &HF34ADD, &H59927DF3, &H42EBD3CB, &HF8E8F683, &H6DFCF787, &H3F7FBE90, &H13D72B7A, &H2DF232CF, &HFD426D94, &H5FE39AAD, &HED84BB42, &H732995FC, &H23E67A1, &H355430E3, &H67DD0A8E, &H97A1D703, &HCF83B61, &H583C33F2, &HA3233455, &H68142904, &H27014AB4, &HCFA617, &HFB500882
+    pvAppendBuffer &H7009B958, &H6745FF87, &HD449242D, &H9E9889BC, &H575616C8, &H35B613B, &H138E99E2, &H855156, &H292E6AA0, &H94C0D24B, &H7E79B3A2, &HD9BA5B68, &H5F165D99, &HCEBBBC7B, &H8A4EEE61, &H50CC51C1, &H1B4D0D1F, &HB31D2353, &H66382ADA, &H95E18452, &HA839B5B, &HACAD4F81, &H4142FF0F, &HA0A2A96E, &H1F4FA12F, &H3EAA8289, &H6B0FB8F3, &H68D68C8F, &H839BB85F, &H320F09C3, &HA050E62C, &H101FB06
+    pvAppendBuffer &H9AD53458, &H557582C9, &H1666432B, &H55D5398D, &H4FED936F, &HF7F63118, &H1833D9E1, &HD90D6A7F, &H8EBAA72A, &H59C6A9E, &H49FF8E2D, &H576E2290, &H51BBB3F1, &H9311A269, &H8D0F4F65, &HE80F26BD, &H6BECCBB9, &H9D3DC334, &H101E5DE4, &H54E244D5, &HF1B19E28, &HB3AD4C6E, &H58C2E3B7, &H4334FBC0, &H35DF9C25, &H19BD4107, &HEC106EB6, &HD6BBEC0E, &HE5046DC5, &H788251C7, &HF179327B, &H12839B95
+    pvAppendBuffer &H4A8CB46E, &HF1C05D98, &H3C00736B, &H443737CD, &H12CD8FE5, &HA760A456, &H817BDD9, &H797489DE, &HF42C23E8, &HC56EB80A, &HE6FE7AF5, &H83719DD7, &H3FEFCFC8, &HE8881A83, &HB9B5290B, &HAEA3C9E0, &H771E4688, &H10B37ECD, &HD4D021B6, &HEE0816A3, &HB3A8CAA1, &H8E9929BF, &HC105F2D1, &H48915DCF, &HDB49019F, &H3A5FDF82, &HAD9006E1, &HC4A438E3, &H87DE4B29, &H5DB9620F, &HD91ECB2E, &HD7420C18
+    pvAppendBuffer &H32ACF105, &H301BA1B2, &H7853A937, &HDB96BB0C, &HC359AC34, &HD84BFEF6, &H64852A1D, &HAB80CEF0, &HB9DA1717, &H3FBEE4D3, &H7A13222C, &HB325074E, &HE83AD2C9, &H5D6DC503, &HAED035BE, &HCA9F7A1D, &HCBD21E33, &H552788AC, &HE09CB9F0, &H8699DD31, &H329BF961, &H38584196, &HB82A5AF9, &H4CB20E96, &HC72C78C1, &H24199908, &HE92859B7, &H16E65484, &H52FDE29, &H6A201C4B, &H31DBB4, &H6C897123
+    pvAppendBuffer &H16C1DA96, &H4A759982, &H2CC67214, &HEEC0B975, &H812C864E, &HB908B9F1, &H8439F6BA, &H367FB66A, &HF966F329, &H789D664B, &HF7F1D283, &HE02AF770, &HDB3038DD, &HA20A2C70, &HE99D5C7C, &H5F0B46D5, &H4B600B83, &HC9B97D37, &H3DF3245E, &H186C7F79, &H4F1CE57F, &H2AF72460, &H91E2D8ED, &H9249897F, &H8D2EA797, &H8139B36A, &H9AB58913, &H9C428DB8, &H6471AAA0, &HB4A196FB, &H1B6B9730, &HDCBAB650
+    pvAppendBuffer &H295B57D2, &H7AFCCC8A, &H4E33A65D, &HEE2280F4, &H890FCD12, &HC47A0803, &H82604F6B, &H4E98A98D, &HED5FBBD2, &HD598F06, &HA6A1EB84, &HCE46EC91, &H4BE6458D, &H1F1E4F3F, &H595E6547, &H5F72CC22, &H271A93F1, &H5BC5341E, &H58A5F263, &HC62E155C, &H58BA7FF4, &H5F6F845A, &H7E36A6AD, &H67E1F7DC, &HEEAA4D04, &HD33A7657, &H18267E4E, &HFF9F2322, &H4A53789F, &HD369F11F, &H3696B437, &HC7876FB6
+    pvAppendBuffer &HBABA29A, &HA0E8F0A7, &H32F6E514, &HA0318A5F, &H11775A08, &H5C4A43D1, &H362EEBB1, &H418C507C, &H9A325AA, &HFD08903F, &HF0EEBB3A, &HF320B8FC, &HC7644C1D, &HE33F0255, &HBB9002D8, &H4030ECC3, &HF4646F9F, &HA4486916, &H959C44FA, &H5E677D0C, &HD88B9144, &HE2E7D7D0, &H6248F91F, &H5D93A86F, &H2993AEA, &HE33D0BD5, &H3100D31E, &H449F0CE6, &H73CF2678, &H3FCD925A, &HA6D0AFC7, &H34CA923B
+    pvAppendBuffer &H3067791F, &H9011091D, &H5A7941E4, &H8C568874, &HFC339800, &H34D37180, &H595C51F4, &H7744316B, &HE88C6420, &HF2DDB693, &H5BAD14D2, &HFB3A48B1, &HFDAAB256, &H52DF1588, &H3127354C, &H68C0CD44, &HA591F853, &H2A849471, &H93D0CB92, &HE4DA88E9, &H1639C624, &H6D1EA35D, &H263707BA, &H60FE2A36, &HD0F3BC51, &H97FC50DE, &H10062E80, &HF7FA4D15, &H24C168D, &HC429A113, &H3FEAA272, &HB6C935FB
+    pvAppendBuffer &HE639EC09, &HB58A6071, &HF9C13DE7, &H4B59253A, &HFBFB8955, &H6D2D68F2, &H50723FE2, &HF0064C12, &H1F185F5, &HE85D7820, &H7FA79C93, &HAA0307BF, &H5B696527, &H2E75A266, &H5A00169C, &H1A2530B0, &H4286FB42, &H76C4C180, &H8E831D5B, &H825F0194, &HEF703739, &HDBF0A11F, &HCE5B106A, &H106F9BC4, &H24111150, &H61794C4F, &HBC723A17, &H435872FE, &HD898C296, &HF4A13945, &H2DEB33A0, &H77037D81
+    pvAppendBuffer &H63A440F2, &HF8BCE6E5, &HE12C4247, &H6B17D1F2, &H37BF51F5, &HCBB64068, &H6B315ECE, &H2BCE3357, &H7C0F9E16, &H8EE7EB4A, &HFE1A7F9B, &H4FE342E2, &HC6E7FD6C, &HFB41661B, &HEFADA985, &HE6C6B721, &H1D4BF165, &HC8F7EF95, &HA6330A44, &H5ECBE4D1, &HA27D5032, &H9A79B127, &H384FB83D, &HD82AB036, &H1A64A2EC, &H374B06CE, &H4998FF7E, &H8734640C, &HC3D033ED, &H21554A0D, &H1F5BE524, &HEF8C82FD
+    pvAppendBuffer &H8668FDF, &HD784C856, &H515140D2, &H51590B7A, &HFDA16DA4, &HD1D0BB44, &HD4D80888, &HD012F00, &HBF8A7926, &H8AE1BF36, &H904A727D, &HE0C17DA8, &H3187B2A3, &H30062870, &HA80FEF5B, &H7EF9F8B8, &H7C01FB60, &H25BB3066, &HA0BF7B46, &H8E533B6F, &HC1F400B4, &HC55E1A86, &HCB041B21, &H53C73633, &HA6F59000, &H6D069F83, &HE0331836, &H73EB1DBD, &H90949EE0, &HD79E8A4B, &H2C6DF8B3, &H9E0ACB8C
+    pvAppendBuffer &H1D71F872, &H878938D5, &HFEDF0B71, &HEA68D7B6, &H4DD048FA, &HE85A224A, &HA4DE823F, &H4D714FEA, &H4A8EA0C8, &H87014A96, &H72C9FCE7, &H2A2744C9, &H74BC21D1, &H433391D3, &H255048BF, &H16742ED0, &HB0C21CDA, &H638379D, &H883B4C59, &H3ED113B7, &HE82A3740, &HE2F8EEFC, &H5E9889DA, &H90D04DA, &HA4F4C68A, &H24C843AF, &HCCC4C8A2, &H9099209A, &H46072C01, &H98E15D9D, &H65EAD58A, &H792E284B
+    pvAppendBuffer &HD85EE2FC, &H61805DF2, &HE0AC495A, &H177C837A, &HEFC7BFD8, &H9C43BBE2, &HA1FB4DF3, &H26EE14C3, &HB40F4E72, &HA24091AD, &H4EBEA558, &H63BB58CD, &HE59B9D5F, &H63668C63, &HDE3A0EF1, &HAE03AF92, &H99888265, &HADFB3789, &H971ABAE7, &HF0454DC6, &HD034F36, &H47E59CDE, &H75B5FA3F, &H2A3B21CE, &H1F9643E6, &H4E6594E5, &H592E2D1F, &HB5B93EE3, &HFC632551, &HF3B9CAC2, &HA7179E84, &HBCE6FAAD
+    pvAppendBuffer &HFFFFFFFF, &HFFFFFFFF, &H0&, &HFFFFFFFF, &HFFFFFFFF, &H0&, &H0&, &HFFFFFFFF, &HFFFFFFFE, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HD3EC2AEF, &H2A85C8ED, &H8A2ED19D, &HC656398D, &H5013875A, &H314088F, &HFE814112, &H181D9C6E, &HE3F82D19, &H988E056B, &HE23EE7E4, &HB3312FA7, &H72760AB7, &H3A545E38, &HBF55296C, &H5502F25D
+    pvAppendBuffer &H82542A38, &H59F741E0, &H8BA79B98, &H6E1D3B62, &HF320AD74, &H8EB1C71E, &HBE8B0537, &HAA87CA22, &H90EA0E5F, &H7A431D7C, &H1D7E819D, &HA60B1CE, &HB5F0B8C0, &HE9DA3113, &H289A147C, &HF8F41DBD, &H9292DC29, &H5D9E98BF, &H96262C6F, &H3617DE4A, &H72760AB7, &H3A545E38, &HBF55296C, &H5502F25D, &H82542A38, &H59F741E0, &H8BA79B98, &H6E1D3B62, &HF320AD74, &H8EB1C71E, &HBE8B0537, &HAA87CA22
+    pvAppendBuffer &H90EA0E5F, &H7A431D7C, &H1D7E819D, &HA60B1CE, &HB5F0B8C0, &HE9DA3113, &H289A147C, &HF8F41DBD, &H9292DC29, &H5D9E98BF, &H96262C6F, &H3617DE4A, &H574A2D7A, &H214A5541, &HBAFF67E, &H8BB26B1F, &H685CB49E, &HE8E8A314, &H5F1DBE9, &H6AD56435, &H415B4393, &HB2128765, &HE52E83A1, &HFDFF5D78, &H978E2B11, &HE715E976, &HD4D391B8, &HDCC72E10, &HDD2D7EC4, &HEF01A9D8, &H5963C951, &H377F99
+    pvAppendBuffer &HF10B944A, &H13F5D41F, &H7857AA4C, &H4DB0BC42, &H8E8CF6BD, &H4DF624DB, &H8547E6B6, &H8244132B, &HEAAC9420, &HA9D5E399, &H21AD8066, &HA9B91BD, &H3EEE915B, &H492ECEBD, &HFDD804E, &H5E54D953, &HCC5A43B2, &H44288C00, &H42727FD7, &HF66D7125, &H89A66C33, &H6F98B352, &H95821B09, &H5009A4B4, &HE8131D0, &HB5E534AC, &H4BA24BC0, &H4A3D7763, &HE0BDE8C2, &HD490B021, &HCA52B096, &H6CC28A6C
+    pvAppendBuffer &HC30BD659, &HCF1DF4FD, &H50FEAF12, &HE63F460, &H7F52C6E5, &HCD958F85, &H34CB8FA1, &H2913D4EB, &HB083DCB0, &HCBF987E9, &HB1A874D8, &HB47F863A, &HB3BB7DA7, &H2D48722E, &H7603FD5F, &H27855D53, &H7765A132, &HA5CCE5A0, &H5A14FFB1, &H47B885F, &H931694D6, &H3311EC54, &HD26C55B2, &H66004EC3, &H1F2CCD66, &HD50A0AC4, &H4B047385, &H274E6260, &HB7FD6664, &HD96204E4, &H6AA71294, &HD23B746B
+    pvAppendBuffer &H46B64ADD, &H9A7231A7, &HBE780847, &H47709B8E, &HAA3AEC73, &HC5BE101D, &HB89D3090, &H2786BD19, &H9A71BA8, &H5F348F1D, &H169076A, &HE2F2CDA7, &H12D256E1, &HDB699E4, &HA526F3F5, &HCC589514, &HB6F8C073, &HE7EA29A0, &HADBA7324, &H50359755, &HE672C579, &HFD7FC38, &HF5D93F24, &HE9FB6A4D, &H910A0FB5, &H9103B778, &H1DE052BE, &H6E7107BD, &HDBDBAE3D, &H6C24C094, &H66F0CD5A, &H6F5424A9
+    pvAppendBuffer &HD171104B, &HEAB70FFA, &HE51210F9, &H52AD7C38, &H1A465EE0, &H70CB8A4C, &HF8EE3F37, &HF04BA246, &HC81EE126, &HD6BEAEB6, &HDC50393C, &H5FC113E8, &HD094B6A7, &HD0472DD3, &HDA1C1669, &HB769B0BE, &H4157BCA1, &H772481FA, &H96BEEEC6, &HDE0AED5E, &H284569C0, &HB9C04F16, &H8B36D601, &HA2415911, &HD415E1CA, &H81D51B7F, &HEBAAD0A2, &H4FE542B9, &HA93C10A7, &HCB610182, &H36AFB3B, &HBD5059C9
+    pvAppendBuffer &HFAAC375A, &HCB538303, &HAC1B02F4, &HC35A94E6, &H8AE7D58B, &H8B5D4209, &H4241BD, &HA8EB2114, &H262FAC2C, &HAA3C554A, &H31306B48, &HC6D2BCDF, &HFAB6BE4D, &HADAE8A9, &HEA77D12, &H89B18AED, &HA2675D24, &H2C4382FF, &H105529BA, &HABB60CE6, &HEDF8C996, &H7FFAF718, &HC58B999A, &H4EE49986, &HBA5328E9, &H5FDC0C0F, &H4DE7B0B3, &H22BB9F3B, &H79A8B5AB, &H59BDB661, &H5B46960B, &HA41CEB96
+    pvAppendBuffer &H673F565B, &HF95FD896, &H5546575D, &H1682F977, &H725E981D, &H985159D4, &H82EDFF44, &H2CFE484D, &HE5EFAAD0, &H785CB625, &H10E28346, &HC6E94CF8, &HE79FC953, &HCFA78FCC, &H62A76A5B, &HD8503095, &H4AB1FB6E, &HDF363E09, &HA506B01A, &H907E97BA, &HA15AF7C1, &H9BEFB795, &HEAC69987, &HC7FA7869, &H1C404FE9, &HDE4D11B2, &H2E6D0FB8, &HB0917D3B, &HAEE80FB9, &HB37CC365, &HF87F9262, &H306C8470
+    pvAppendBuffer &H43FC91F8, &H87519B7F, &HA61CDF5, &H9D434DBE, &HB33139E7, &H49BF609F, &HAC820A90, &H60FD2CEB, &H164A20F6, &HA1344AD0, &HCED42AB2, &HC8A16564, &H87F81DB5, &HC778EF62, &HDA05DE0C, &H81C02C3E, &HC17D28B9, &H924D0E64, &H90E31340, &H8BF310B1, &HA9CE292C, &H9DDAD413, &HC42F9A8E, &H46A2A12D, &H69CB4B1D, &HC345297, &H4C3EF2D3, &H1CE0028A, &H4484249F, &H7B2EA237, &HDE8D2145, &HCDC53530
+    pvAppendBuffer &H225A3DD1, &H8B6136DD, &H53740EC9, &HB18E9E73, &H5F27C64A, &H644E97B7, &HA9CEA0C5, &HA7208E9D, &HA48B98EC, &H6BB544BD, &H57C5F037, &H1DEBA7F3, &H1F068FB5, &HBCC87131, &H11CF7C4B, &HAE719373, &H2CB2EC36, &H74A95C5B, &H335D77B6, &H65BE9E50, &HB2319168, &HF9A6E7F2, &H51D144A0, &HEDD5F953, &HAD2AD161, &H7171C038, &HF7215966, &H5C01A2BE, &HB978FA06, &HF696C756, &H6579D248, &H714398BB
+    pvAppendBuffer &HAB1FB325, &H4ADE5706, &HFF0C1846, &H818B42B4, &HD6EE937E, &H7F0C9F34, &H90CD7784, &H54AC28C5, &HE17F0476, &H8701F645, &HA4B5D7B8, &H6545AA51, &H775226D6, &H880F880F, &H9CB06473, &HDF312F51, &H4644DBC4, &HAAE46B81, &H7654C263, &H40371DC1, &HBEB9F7AF, &HC747F85F, &HCC281C52, &HF4B35B77, &H8C15E275, &H28EC4AC0, &HFBF5433B, &H51537CA3, &HFD212D3F, &H28CF7BC3, &HE1B6365E, &HD2D86E75
+    pvAppendBuffer &H120328CE, &H47BBCF0, &HF07414D3, &H33E139EF, &HCB38E86D, &HE2A2F4FC, &H5382ED59, &HCB5357BA, &H1B5076C2, &H6BE08D5D, &H4D83E11C, &HC62DF637, &H60969A97, &HD6958C1E, &H54DBFC48, &HA49B602C, &H51914BCA, &HFB97D2EE, &HAA211719, &HB4BC64C9, &H644D20, &HADCD952, &HA75F0046, &HB8E8CA59, &H17A818F2, &H9F5E1FE2, &HB5CF54D1, &H7E1D2F2E, &H31E76220, &H3992D2A1, &HFF7003C6, &H7AD2A60B
+    pvAppendBuffer &H8F1546BE, &HDB6A4D39, &HE8A1A2A3, &HB13228B1, &H993D3A02, &H1470159C, &H9E9BF4D9, &H5B4E8B1D, &HCD001D1, &H6FCB85E9, &H3DF1DFE2, &HE0781A9D, &HC8A2265B, &HF650285A, &H37A9B579, &H8727088A, &H22C74609, &HBB844DF2, &HD5476D33, &HC3742094, &H1E060165, &H79FE2465, &HB6B90F17, &H5130BDE7, &H853CB459, &HCE254CFD, &HBA440754, &HA8782B8E, &HDAF8AA6C, &H7D81F68F, &H44B8BF68, &HAA0E19AA
+    pvAppendBuffer &H2664A487, &H6E3EE96F, &H4E9FEA80, &H8F1B7D25, &H131C050D, &H7A282A2A, &HCA81498E, &HD986B357, &H154EC895, &HC4750753, &HCB3C35A3, &H65DB0B8A, &HCE9499EB, &H4AC90B15, &H91AEE266, &HBF5777FA, &H4615CE5F, &HD87272F9, &HFF3C56CE, &HB92110A3, &HCCA3B289, &HB327638E, &H3D0A9F44, &H396B35A9, &H8AD619EF, &HDAD5514, &H3F9AA00A, &H44242D55, &HB843CDE9, &HD7E221ED, &H71DDE46, &HA3C20977
+    pvAppendBuffer &HA5B4CD7A, &H16DD93B9, &H21460CA, &HCCD5DF68, &H6A570F04, &H1D21128B, &H394FE427, &HE917B31C, &H6BA2D13C, &HC0FE28DE, &H7F08EBA2, &H2D31795F, &H88492CB7, &HDABB8957, &HC82A64C1, &H5B6478B4, &HCD430E4C, &H5D14F518, &H217D14F8, &H552992D1, &H95033367, &HB38D3C11, &HAE07E0E5, &HACBB2DDC, &H7B50F818, &H7093124C, &H7E9CC15B, &HAE3337F, &H428E5500, &H505F49BA, &H20E83E0D, &H4FEB246B
+    pvAppendBuffer &H7C632779, &H8D18AB7D, &HD299BC0D, &HFB435379, &H89E66C63, &HDEA8F23F, &HD93C74A3, &HDD790987, &H4B79ADF6, &HA9AC8F10, &H677F9849, &HFF4CAA4A, &H80C84B38, &H4E1BB75C, &H105393D3, &H52D2575D, &H4569D2D3, &H4F465F5F, &H41E36869, &HABAD1376, &HEB3F72ED, &HB8566746, &H8E114AE, &H53316ED1, &H91AEA8C6, &H45E5B481, &H2857A9D5, &H73C30BF5, &HFD1F7C82, &H26DB96AF, &HDF1822B5, &H8C9010D0
+    pvAppendBuffer &H20428D3D, &H246624AB, &H6A02C7CD, &HA3A48C9F, &H34CD1BDD, &H1298B738, &H1B71B3BD, &H664833BC, &H70A6E08, &HD9365CD7, &HD610B66B, &HA44AD979, &HA6690FC0, &HCC174EB1, &HC9196D36, &H5883B4BE, &H4FF222D2, &H6507BBC3, &H8506370B, &HF90DAD22, &H235C94E5, &HD5B17CEC, &H4F1D0704, &H15C31CD6, &H83692E96, &HA45E13E0, &H23632198, &H30CA9241, &H68C5D526, &HFB14B0B9, &H53FF8F7F, &H1CB6AADE
+    pvAppendBuffer &H9277F031, &H64B1D3AA, &HB57A14DD, &H92504AAD, &H6F824A23, &HA651A249, &HBC1B0886, &HABA60A2B, &H67E331A8, &HC632EF51, &HD3432743, &H386CAB94, &H24DBDACC, &H644657CD, &HEA9D8EEB, &H79BAEFE3, &H7C0022A9, &HCE100B59, &HB5552550, &HC72C67D5, &HC625D47F, &HCC7C468D, &H43B94872, &H54376AE2, &HFD91B733, &H86116D31, &HC07AB981, &HC33E942E, &HC1A90C5B, &H7E0181B9, &HEF64936E, &H4B2E6511
+    pvAppendBuffer &HAA71BE85, &H9187E8D4, &HB683D1DB, &H9F03A529, &HE63B581E, &HE9825AAC, &H4B8A03BA, &H5E6B0A8, &HF3938636, &H61907C78, &H7CCADF9D, &H2DDA27D3, &H9787C6AE, &H1E7B1E07, &HA645CA8F, &H6E6A6097, &H3B950770, &HA152690C, &H80453061, &HCC813D19, &HDC9BB565, &H5026D3E0, &HA41DAC8D, &H3A345564, &HCF05440B, &H92B8073, &HE7E95F9A, &HDE1F971D, &HBCB04838, &H177D47C6, &H37393D29, &HB2A0C449
+    pvAppendBuffer &HE77340CD, &H224C3D, &H6A4E526E, &H31E37B98, &HBC55A51B, &HEE98B785, &H91BC664, &H4ED22126, &H98C7090F, &H59C178BA, &HA14CE4D5, &H597FC7F4, &HA623862F, &HDE0AED2, &H49106B56, &H9195ACAF, &H939A89D1, &H8703E4AF, &H2AF3BFB2, &HDA07A303, &HEB51AB60, &H72817277, &HFA0CB48F, &H5AEEDCB5, &H6A386DA2, &H43E24139, &HA6284E47, &H9157D8F, &HDCB7B7F6, &H10D3ABFF, &HC4A4EF51, &H4FEC85D9
+    pvAppendBuffer &HE11640B5, &H6BEFAF87, &HAFBA91C, &HB05FF572, &HFEDF311D, &HF305D9, &H6082A9F9, &H2322592A, &HDFC76F75, &HF1841C28, &H10AF674E, &HF0714D17, &HAF895173, &HCD871803, &H94F5571C, &H110AB6A9, &H22D4D124, &H5AA3B421, &HA2FE7A5F, &HCB6EB594, &HB6B4AC39, &HBBE918BA, &H3A31C961, &H19E5161E, &H3FFFC9CD, &HC2A7A2CB, &HC67BBAA3, &H1A0825B1, &HA02D4BB0, &H283C9073, &HE05DA927, &H1C06EEBC
+    pvAppendBuffer &HA7CE557B, &HEE920D22, &HF79AEC92, &HF137A49C, &HF7E0C93D, &HAC949AA9, &HD2E5D915, &H1D7481E4, &H5CBE77D3, &HAA5A8228, &H128145FD, &H2459758, &H1BDB11F5, &HF2096E10, &HA5DC4090, &H2B4ECB07, &H4C110C19, &HD335126C, &H27EFAC4C, &HD1B5960E, &H77E930E1, &H3D4100E8, &HADC4C838, &H899BAAD, &HF6B3097E, &H5B64899F, &H2790439D, &H7C060A89, &H513497C6, &H40AB25D0, &H202D8833, &HDFA74FE2
+    pvAppendBuffer &H2466F95B, &H689CCEC5, &HE0B8E88E, &HE757107A, &H56A78F16, &H38D0D513, &H5DA9F7C2, &H47C8301C, &H31956F2B, &HE8C55CC6, &HC8D4931, &H6DA590D6, &H374E2772, &HFFEFF253, &H2AFEDDA2, &HC0132D35, &H6C782F3C, &HC6211452, &HC98A97E8, &H7D7F61CD, &H74DB0E01, &HF0602625, &H5D0D215D, &H36C1AC6A, &H59A579DE, &H88CBE3CF, &HC2C17408, &H8DDEEC0B, &H34D07D8, &H6D87FCED, &H656A1F61, &H9066AFE4
+    pvAppendBuffer &HFBC82854, &H758AE55F, &HF73DFE9, &HBC110FA, &H679A2ABA, &H96EDF50F, &H7FA01880, &H31B92B91, &H72495766, &HFDA047EB, &HCB1299C9, &HE8C663C5, &H91DBE668, &H15798146, &H9DA9121C, &H25E209C5, &HF69B64DA, &H9AD033A2, &HD82ADB97, &H6366E8F3, &HE9103189, &H96052F28, &H6E6CE744, &H6C279054, &HFE5D6697, &HDA53B069, &HDA09FB6A, &H553200B9, &H72760AB7, &H3A545E38, &HBF55296C, &H5502F25D
+    pvAppendBuffer &H82542A38, &H59F741E0, &H8BA79B98, &H6E1D3B62, &HF320AD74, &H8EB1C71E, &HBE8B0537, &HAA87CA22, &H90EA0E5F, &H7A431D7C, &H1D7E819D, &HA60B1CE, &HB5F0B8C0, &HE9DA3113, &H289A147C, &HF8F41DBD, &H9292DC29, &H5D9E98BF, &H96262C6F, &H3617DE4A, &H500C831, &H2D7E5C7, &H5026580D, &HB408BBAE, &HD3566DA6, &HBEA4F240, &H202DCD06, &HCB9D3910, &H5FDC7D98, &H64793C7E, &H606FFA14, &H77A41D4
+    pvAppendBuffer &HA2F1DF1, &HB65F2860, &HE4B5D298, &HC24ABD6B, &HDC111EAC, &HF7684C0E, &H85115AA5, &H8520B41C, &H2A9FC99, &H7D0BBE96, &HB0C4283, &HC995F7CA, &H836D84BC, &HABCDBC3, &H1CA297E6, &H37882F4A, &HE56583B0, &H4F6661CB, &HBFF98FC5, &HF208E51D, &HA025E467, &H573CAC5E, &HC251C777, &H11DE24A2, &HE6C1713A, &H184414AB, &HAE8FB33, &H3177686D, &HB6901AEB, &H8C986533, &H54D5DEE8, &H284B4477
+    pvAppendBuffer &HA00E7C5, &HF5837E9, &H7440F92D, &H8FA696C7, &H8FB6D0E1, &H40F05B4, &H55B9EBB2, &H8B05526F, &HFA7B1C50, &H2D58CC9D, &HFBEA5FFA, &HAD6FE997, &H234EDFFE, &HF29F8EBF, &H65CE4788, &H283C1D73, &HC512EF8C, &H64664CDA, &H32A78F9E, &H30D84EDE, &H1DBD2256, &HD9C92CD0, &HED799729, &H1A61D867, &H8C169047, &HBA52EFDB, &H61E41B88, &H9475C990, &H1079118B, &H5C55E446, &HFEE2B953, &HC388528B
+    pvAppendBuffer &H85FB6E21, &HC6CB1EE2, &H1E6FD3BA, &H2216F729, &HB025B78F, &HF1BF29B8, &H49BCB3E, &H8F0A39A4, &HAC664AF8, &H262DA4F9, &HDFD51B68, &H9E743EFE, &HAED9B302, &HB7678854, &HA3C400C6, &H9A9B3D7C, &H22C3A979, &H452C4A53, &H38B601D6, &H62C77E14, &H55B4DDD8, &H26356F3B, &H3AFB81D6, &H4749B66E, &H892D3F8C, &H56C9FD14, &H5837C374, &H7FE935ED, &H904816C5, &HDA1EEEC2, &H7DA7B998, &H99056E2
+    pvAppendBuffer &H38C5E0BB, &H7D5DBA81, &H63AAFF35, &H5466D512, &H1B52A325, &H43FF93F4, &HDFC363FD, &H6FC4EED8, &H4AC5E039, &H68850554, &H4E30AB96, &H2E4C0C23, &H3B5CBCE7, &HAAF1CA1E, &HABD99F1B, &H9EE5F441, &HF0F11C13, &H6267BCD1, &HF01F873F, &H9632BFF9, &H2FFCC6AB, &HAFDAF500, &HB67AEA5B, &HA567BA97, &H36F429CC, &H6423A127, &H72218A7D, &H776BCB82, &H57857D66, &H86329BE0, &H46932EC0, &H51855950
+    pvAppendBuffer &HAF164ECC, &H644E4147, &H989F3318, &HDE1B38B3, &H9606860B, &H4B88701A, &H10B6383B, &HA849557A, &HDA7C4E9C, &H5B21F9F7, &HFFF01C20, &H22A94156, &HD8135255, &H8CC15C11, &HB32B0105, &HB3D13FC8, &H33F7BD62, &H985D588D, &HB284AF50, &H838D24F8, &H73DFBFD9, &H84D11143, &H1D749AF4, &HEEBAC4A1, &H36164B1B, &H1B049B25, &HDF9162A6, &H152919E7, &HCCC52973, &HECEC196A, &H48B0A77A, &H581A0DB2
     pvAppendBuffer &HF4372DDF, &HC7634D81, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &HFFFFFFFF, &H428A2F98, &H71374491, &HB5C0FBCF, &HE9B5DBA5, &H3956C25B, &H59F111F1, &H923F82A4, &HAB1C5ED5, &HD807AA98, &H12835B01, &H243185BE, &H550C7DC3, &H72BE5D74, &H80DEB1FE, &H9BDC06A7, &HC19BF174, &HE49B69C1, &HEFBE4786, &HFC19DC6, &H240CA1CC, &H2DE92C6F, &H4A7484AA, &H5CB0A9DC, &H76F988DA
     pvAppendBuffer &H983E5152, &HA831C66D, &HB00327C8, &HBF597FC7, &HC6E00BF3, &HD5A79147, &H6CA6351, &H14292967, &H27B70A85, &H2E1B2138, &H4D2C6DFC, &H53380D13, &H650A7354, &H766A0ABB, &H81C2C92E, &H92722C85, &HA2BFE8A1, &HA81A664B, &HC24B8B70, &HC76C51A3, &HD192E819, &HD6990624, &HF40E3585, &H106AA070, &H19A4C116, &H1E376C08, &H2748774C, &H34B0BCB5, &H391C0CB3, &H4ED8AA4A, &H5B9CCA4F, &H682E6FF3
-    pvAppendBuffer &H748F82EE, &H78A5636F, &H84C87814, &H8CC70208, &H90BEFFFA, &HA4506CEB, &HBEF9A3F7, &HC67178F2, &HD728AE22, &H428A2F98, &H23EF65CD, &H71374491, &HEC4D3B2F, &HB5C0FBCF, &H8189DBBC, &HE9B5DBA5, &HF348B538, &H3956C25B, &HB605D019, &H59F111F1, &HAF194F9B, &H923F82A4, &HDA6D8118, &HAB1C5ED5, &HA3030242, &HD807AA98, &H45706FBE, &H12835B01, &H4EE4B28C, &H243185BE, &HD5FFB4E2, &H550C7DC3
-    pvAppendBuffer &HF27B896F, &H72BE5D74, &H3B1696B1, &H80DEB1FE, &H25C71235, &H9BDC06A7, &HCF692694, &HC19BF174, &H9EF14AD2, &HE49B69C1, &H384F25E3, &HEFBE4786, &H8B8CD5B5, &HFC19DC6, &H77AC9C65, &H240CA1CC, &H592B0275, &H2DE92C6F, &H6EA6E483, &H4A7484AA, &HBD41FBD4, &H5CB0A9DC, &H831153B5, &H76F988DA, &HEE66DFAB, &H983E5152, &H2DB43210, &HA831C66D, &H98FB213F, &HB00327C8, &HBEEF0EE4, &HBF597FC7
-    pvAppendBuffer &H3DA88FC2, &HC6E00BF3, &H930AA725, &HD5A79147, &HE003826F, &H6CA6351, &HA0E6E70, &H14292967, &H46D22FFC, &H27B70A85, &H5C26C926, &H2E1B2138, &H5AC42AED, &H4D2C6DFC, &H9D95B3DF, &H53380D13, &H8BAF63DE, &H650A7354, &H3C77B2A8, &H766A0ABB, &H47EDAEE6, &H81C2C92E, &H1482353B, &H92722C85, &H4CF10364, &HA2BFE8A1, &HBC423001, &HA81A664B, &HD0F89791, &HC24B8B70, &H654BE30, &HC76C51A3
-    pvAppendBuffer &HD6EF5218, &HD192E819, &H5565A910, &HD6990624, &H5771202A, &HF40E3585, &H32BBD1B8, &H106AA070, &HB8D2D0C8, &H19A4C116, &H5141AB53, &H1E376C08, &HDF8EEB99, &H2748774C, &HE19B48A8, &H34B0BCB5, &HC5C95A63, &H391C0CB3, &HE3418ACB, &H4ED8AA4A, &H7763E373, &H5B9CCA4F, &HD6B2B8A3, &H682E6FF3, &H5DEFB2FC, &H748F82EE, &H43172F60, &H78A5636F, &HA1F0AB72, &H84C87814, &H1A6439EC, &H8CC70208
-    pvAppendBuffer &H23631E28, &H90BEFFFA, &HDE82BDE9, &HA4506CEB, &HB2C67915, &HBEF9A3F7, &HE372532B, &HC67178F2, &HEA26619C, &HCA273ECE, &H21C0C207, &HD186B8C7, &HCDE0EB1E, &HEADA7DD6, &HEE6ED178, &HF57D4F7F, &H72176FBA, &H6F067AA, &HA2C898A6, &HA637DC5, &HBEF90DAE, &H113F9804, &H131C471B, &H1B710B35, &H23047D84, &H28DB77F5, &H40C72493, &H32CAAB7B, &H15C9BEBC, &H3C9EBE0A, &H9C100D4C, &H431D67C4
-    pvAppendBuffer &HCB3E42B6, &H4CC5D4BE, &HFC657E2A, &H597F299C, &H3AD6FAEC, &H5FCB6FAB, &H4A475817, &H6C44198C, &H61707865, &H3120646E, &H79622D36, &H6B206574, &H70786500, &H20646E61, &H622D3233, &H20657479, &H6B&, &H5&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&
-    pvAppendBuffer &H0&, &HFC&, &H7B777C63, &HC56F6BF2, &H2B670130, &H76ABD7FE, &H7DC982CA, &HF04759FA, &HAFA2D4AD, &HC072A49C, &H2693FDB7, &HCCF73F36, &HF1E5A534, &H1531D871, &HC323C704, &H9A059618, &HE2801207, &H75B227EB, &H1A2C8309, &HA05A6E1B, &HB3D63B52, &H842FE329, &HED00D153, &H5BB1FC20, &H39BECB6A, &HCF584C4A, &HFBAAEFD0, &H85334D43, &H7F02F945, &HA89F3C50, &H8F40A351, &HF5389D92
-    pvAppendBuffer &H21DAB6BC, &HD2F3FF10, &HEC130CCD, &H1744975F, &H3D7EA7C4, &H73195D64, &HDC4F8160, &H88902A22, &H14B8EE46, &HDB0B5EDE, &HA3A32E0, &H5C240649, &H62ACD3C2, &H79E49591, &H6D37C8E7, &HA94ED58D, &HEAF4566C, &H8AE7A65, &H2E2578BA, &HC6B4A61C, &H1F74DDE8, &H8A8BBD4B, &H66B53E70, &HEF60348, &HB9573561, &H9E1DC186, &H1198F8E1, &H948ED969, &HE9871E9B, &HDF2855CE, &HD89A18C, &H6842E6BF
-    pvAppendBuffer &HF2D9941, &H16BB54B0, &H402018D, &H40201008, &H52361B80, &H30D56A09, &HBF38A536, &H819EA340, &H7CFBD7F3, &H9B8239E3, &H3487FF2F, &HC444438E, &H54CBE9DE, &HA632947B, &HEE3D23C2, &H420B954C, &H84EC3FA, &H2866A12E, &H76B224D9, &H6D49A25B, &H7225D18B, &H8664F6F8, &HD4169868, &H5DCC5CA4, &H6C92B665, &HFD504870, &H5EDAB9ED, &HA7574615, &H90849D8D, &H8C00ABD8, &HF70AD3BC, &HB80558E4
-    pvAppendBuffer &HD00645B3, &HCA8F1E2C, &HC1020F3F, &H103BDAF, &H3A6B8A13, &H4F411191, &H97EADC67, &HF0CECFF2, &H9673E6B4, &HE72274AC, &HE28535AD, &H1CE837F9, &H476EDF75, &H1D711AF1, &H6F89C529, &HAA0E62B7, &HFC1BBE18, &HC64B3E56, &H9A2079D2, &H78FEC0DB, &H1FF45ACD, &H8833A8DD, &HB131C707, &H27591012, &H605FEC80, &H19A97F51, &H2D0D4AB5, &H939F7AE5, &HA0EF9CC9, &HAE4D3BE0, &HC8B0F52A, &H833CBBEB
-    pvAppendBuffer &H17619953, &HBA7E042B, &HE126D677, &H55631469, &H7D0C21, &H0&, &H1&, &H1&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&
+    pvAppendBuffer &H748F82EE, &H78A5636F, &H84C87814, &H8CC70208, &H90BEFFFA, &HA4506CEB, &HBEF9A3F7, &HC67178F2, &H0&, &H0&, &HD728AE22, &H428A2F98, &H23EF65CD, &H71374491, &HEC4D3B2F, &HB5C0FBCF, &H8189DBBC, &HE9B5DBA5, &HF348B538, &H3956C25B, &HB605D019, &H59F111F1, &HAF194F9B, &H923F82A4, &HDA6D8118, &HAB1C5ED5, &HA3030242, &HD807AA98, &H45706FBE, &H12835B01, &H4EE4B28C, &H243185BE
+    pvAppendBuffer &HD5FFB4E2, &H550C7DC3, &HF27B896F, &H72BE5D74, &H3B1696B1, &H80DEB1FE, &H25C71235, &H9BDC06A7, &HCF692694, &HC19BF174, &H9EF14AD2, &HE49B69C1, &H384F25E3, &HEFBE4786, &H8B8CD5B5, &HFC19DC6, &H77AC9C65, &H240CA1CC, &H592B0275, &H2DE92C6F, &H6EA6E483, &H4A7484AA, &HBD41FBD4, &H5CB0A9DC, &H831153B5, &H76F988DA, &HEE66DFAB, &H983E5152, &H2DB43210, &HA831C66D, &H98FB213F, &HB00327C8
+    pvAppendBuffer &HBEEF0EE4, &HBF597FC7, &H3DA88FC2, &HC6E00BF3, &H930AA725, &HD5A79147, &HE003826F, &H6CA6351, &HA0E6E70, &H14292967, &H46D22FFC, &H27B70A85, &H5C26C926, &H2E1B2138, &H5AC42AED, &H4D2C6DFC, &H9D95B3DF, &H53380D13, &H8BAF63DE, &H650A7354, &H3C77B2A8, &H766A0ABB, &H47EDAEE6, &H81C2C92E, &H1482353B, &H92722C85, &H4CF10364, &HA2BFE8A1, &HBC423001, &HA81A664B, &HD0F89791, &HC24B8B70
+    pvAppendBuffer &H654BE30, &HC76C51A3, &HD6EF5218, &HD192E819, &H5565A910, &HD6990624, &H5771202A, &HF40E3585, &H32BBD1B8, &H106AA070, &HB8D2D0C8, &H19A4C116, &H5141AB53, &H1E376C08, &HDF8EEB99, &H2748774C, &HE19B48A8, &H34B0BCB5, &HC5C95A63, &H391C0CB3, &HE3418ACB, &H4ED8AA4A, &H7763E373, &H5B9CCA4F, &HD6B2B8A3, &H682E6FF3, &H5DEFB2FC, &H748F82EE, &H43172F60, &H78A5636F, &HA1F0AB72, &H84C87814
+    pvAppendBuffer &H1A6439EC, &H8CC70208, &H23631E28, &H90BEFFFA, &HDE82BDE9, &HA4506CEB, &HB2C67915, &HBEF9A3F7, &HE372532B, &HC67178F2, &HEA26619C, &HCA273ECE, &H21C0C207, &HD186B8C7, &HCDE0EB1E, &HEADA7DD6, &HEE6ED178, &HF57D4F7F, &H72176FBA, &H6F067AA, &HA2C898A6, &HA637DC5, &HBEF90DAE, &H113F9804, &H131C471B, &H1B710B35, &H23047D84, &H28DB77F5, &H40C72493, &H32CAAB7B, &H15C9BEBC, &H3C9EBE0A
+    pvAppendBuffer &H9C100D4C, &H431D67C4, &HCB3E42B6, &H4CC5D4BE, &HFC657E2A, &H597F299C, &H3AD6FAEC, &H5FCB6FAB, &H4A475817, &H6C44198C, &H31736C74, &H65002033, &H6E617078, &H36312064, &H7479622D, &H6B2065, &H61707865, &H3320646E, &H79622D32, &H6B206574, &H0&, &H0&, &H7B777C63, &HC56F6BF2, &H2B670130, &H76ABD7FE, &H7DC982CA, &HF04759FA, &HAFA2D4AD, &HC072A49C, &H2693FDB7, &HCCF73F36
+    pvAppendBuffer &HF1E5A534, &H1531D871, &HC323C704, &H9A059618, &HE2801207, &H75B227EB, &H1A2C8309, &HA05A6E1B, &HB3D63B52, &H842FE329, &HED00D153, &H5BB1FC20, &H39BECB6A, &HCF584C4A, &HFBAAEFD0, &H85334D43, &H7F02F945, &HA89F3C50, &H8F40A351, &HF5389D92, &H21DAB6BC, &HD2F3FF10, &HEC130CCD, &H1744975F, &H3D7EA7C4, &H73195D64, &HDC4F8160, &H88902A22, &H14B8EE46, &HDB0B5EDE, &HA3A32E0, &H5C240649
+    pvAppendBuffer &H62ACD3C2, &H79E49591, &H6D37C8E7, &HA94ED58D, &HEAF4566C, &H8AE7A65, &H2E2578BA, &HC6B4A61C, &H1F74DDE8, &H8A8BBD4B, &H66B53E70, &HEF60348, &HB9573561, &H9E1DC186, &H1198F8E1, &H948ED969, &HE9871E9B, &HDF2855CE, &HD89A18C, &H6842E6BF, &HF2D9941, &H16BB54B0, &H402018D, &H40201008, &H52361B80, &H30D56A09, &HBF38A536, &H819EA340, &H7CFBD7F3, &H9B8239E3, &H3487FF2F, &HC444438E
+    pvAppendBuffer &H54CBE9DE, &HA632947B, &HEE3D23C2, &H420B954C, &H84EC3FA, &H2866A12E, &H76B224D9, &H6D49A25B, &H7225D18B, &H8664F6F8, &HD4169868, &H5DCC5CA4, &H6C92B665, &HFD504870, &H5EDAB9ED, &HA7574615, &H90849D8D, &H8C00ABD8, &HF70AD3BC, &HB80558E4, &HD00645B3, &HCA8F1E2C, &HC1020F3F, &H103BDAF, &H3A6B8A13, &H4F411191, &H97EADC67, &HF0CECFF2, &H9673E6B4, &HE72274AC, &HE28535AD, &H1CE837F9
+    pvAppendBuffer &H476EDF75, &H1D711AF1, &H6F89C529, &HAA0E62B7, &HFC1BBE18, &HC64B3E56, &H9A2079D2, &H78FEC0DB, &H1FF45ACD, &H8833A8DD, &HB131C707, &H27591012, &H605FEC80, &H19A97F51, &H2D0D4AB5, &H939F7AE5, &HA0EF9CC9, &HAE4D3BE0, &HC8B0F52A, &H833CBBEB, &H17619953, &HBA7E042B, &HE126D677, &H55631469, &H7D0C21, &H0&, &H1&, &H1&, &H121110, &H6090708, &H40B050A, &H20D030C
+    pvAppendBuffer &HF010E, &H0&, &H1000000, &H2010101, &H3020202, &H4030303, &H5040404, &H50505, &H3007F, &H50004, &H70006, &H90008, &HB000A, &HF000D, &H130011, &H1B0017, &H23001F, &H33002B, &H43003B, &H630053, &H830073, &HC300A3, &H10200E3, &H0&, &H1010000, &H3030202, &H5050404, &H7070606, &H9090808, &HB0B0A0A, &HD0D0C0C, &H20001
+    pvAppendBuffer &H40003, &H70005, &HD0009, &H190011, &H310021, &H610041, &HC10081, &H1810101, &H3010201, &H6010401, &HC010801, &H18011001, &H30012001, &H60014001, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&
     '--- end thunk data
-    ReDim baBuffer(0 To 1952 - 1) As Byte
+    ReDim baBuffer(0 To 11320 - 1) As Byte
     Call CopyMemory(baBuffer(0), m_baBuffer(0), UBound(baBuffer) + 1)
     Erase m_baBuffer
 End Sub
 
 Private Sub pvGetThunkData(baBuffer() As Byte)
-    ReDim m_baBuffer(0 To 34432 - 1) As Byte
+    ReDim m_baBuffer(0 To 63744 - 1) As Byte
     m_lBuffIdx = 0
     '--- begin thunk data
-    pvAppendBuffer &HCB0238, &H299E&, &H2C96&, &H39F5&, &H3E0F&, &H3ECC&, &H3F46&, &H41DA&, &H3A9F&, &H3E69&, &H3F09&, &H4086&, &H45A7&, &H34DD&, &H352D&, &H33F2&, &H3589&, &H3614&, &H3560&, &H3746&, &H37D1&, &H3619&, &H28EB&, &H28AE&, &H1F8E&, &H1F3F&, &H1EEC&, &H1E99&, &H6CBE&, &H6B0D&, &H85848BB8, &HFFFFFF78
-    pvAppendBuffer &HC25DE58B, &HE80004, &H58000000, &HCA408B2D, &H40000500, &H8B00CA, &HE8C3&, &H2D580000, &HCA409E, &HCA400005, &H8B55C300, &H48EC83EC, &H105D8B53, &H5E046A56, &H61E85356, &H85000075, &H63850FC0, &H57000001, &HC75FF56, &H50D8458D, &H7F46E8, &H87D8B00, &H56D8458D, &H458D5750, &H7E850B8, &H5600007F, &H50D8458D, &H7F29E850, &H53560000, &HFF0C75FF, &HEFE80C75, &H5600007E
-    pvAppendBuffer &H14E85353, &H5600007F, &HFFFF79E8, &H10C083FF, &H57575350, &H7975E8, &H67E85600, &H83FFFFFF, &H535010C0, &H63E85353, &H56000079, &HFFFF55E8, &H10C083FF, &H53575350, &H7F08E8, &H57535600, &H7EA8E857, &HE8560000, &HFFFFFF3A, &H5010C083, &HE8535757, &H7936&, &HFF28E856, &HC083FFFF, &H57535010, &H7924E857, &H6A0000, &H837CE857, &HC20B0000, &HE8257456, &HFFFFFF0A, &H5010C083
-    pvAppendBuffer &H86E85757, &H6A000073, &HF08B5704, &H809AE8, &H1FE6C100, &H6A1C7709, &H6EB5E04, &H8089E857, &H57560000, &H7E71E853, &HE8560000, &HFFFFFED6, &H5010C083, &H50B8458D, &H86E85353, &H5600007E, &HFFFEC1E8, &H10C083FF, &HB8458D50, &HE8535350, &H7E71&, &HFEACE856, &HC083FFFF, &H8D535010, &H5050B845, &H7E5CE8, &H458D5600, &H575750B8, &H7DF9E8, &H8BE85600, &H83FFFFFE, &H8D5010C0
-    pvAppendBuffer &H5750D845, &H7E3BE850, &H53560000, &H806FE857, &HFF560000, &HE8530C75, &H8065&, &HD8458D56, &HC75FF50, &H8058E8, &H5B5E5F00, &HC25DE58B, &H8B55000C, &H68EC83EC, &H105D8B53, &H5E066A56, &HD9E85356, &H85000073, &H77850FC0, &H57000001, &HC75FF56, &H50C8458D, &H7DBEE8, &H87D8B00, &H56C8458D, &H458D5750, &H7FE85098, &H5600007D, &H50C8458D, &H7DA1E850, &H53560000, &HFF0C75FF
-    pvAppendBuffer &H67E80C75, &H5600007D, &H8CE85353, &H5600007D, &HFFFDF1E8, &HB005FF, &H53500000, &HEBE85757, &H56000077, &HFFFDDDE8, &HB005FF, &H53500000, &HD7E85353, &H56000077, &HFFFDC9E8, &HB005FF, &H53500000, &H7AE85357, &H5600007D, &HE8575753, &H7D1A&, &HFDACE856, &HB005FFFF, &H50000000, &HE8535757, &H77A6&, &HFD98E856, &HB005FFFF, &H50000000, &HE8575753, &H7792&, &HE857006A
-    pvAppendBuffer &H81EA&, &H7456C20B, &HFD78E827, &HB005FFFF, &H50000000, &HF2E85757, &H6A000071, &HF08B5706, &H7F06E8, &H1FE6C100, &H6A2C7709, &H6EB5E06, &H7EF5E857, &H57560000, &H7CDDE853, &HE8560000, &HFFFFFD42, &HB005&, &H458D5000, &H53535098, &H7CF0E8, &H2BE85600, &H5FFFFFD, &HB0&, &H98458D50, &HE8535350, &H7CD9&, &HFD14E856, &HB005FFFF, &H50000000, &H98458D53, &HC2E85050
-    pvAppendBuffer &H5600007C, &H5098458D, &H5FE85757, &H5600007C, &HFFFCF1E8, &HB005FF, &H8D500000, &H5750C845, &H7C9FE850, &H53560000, &H7ED3E857, &HFF560000, &HE8530C75, &H7EC9&, &HC8458D56, &HC75FF50, &H7EBCE8, &H5B5E5F00, &HC25DE58B, &H8B55000C, &H758B56EC, &H56046A08, &H7243E8, &H74C08500, &H8D046A14, &HE8502046, &H7234&, &H574C085, &HEB40C033, &H5EC03302, &H4C25D, &H56EC8B55
-    pvAppendBuffer &H6A08758B, &H15E85606, &H85000072, &H6A1474C0, &H30468D06, &H7206E850, &HC0850000, &HC0330574, &H3302EB40, &HC25D5EC0, &H8B550004, &HA8EC81EC, &H53000000, &H8D0C5D8B, &H5756B845, &H5053046A, &H7E3CE8, &H20438D00, &H8950046A, &H858DF845, &HFFFFFF78, &H7E27E850, &H75FF0000, &H58858D14, &H50FFFFFF, &H5098458D, &HFF78858D, &H8D50FFFF, &HE850B845, &H882&, &H75FF046A, &H7D48E810
-    pvAppendBuffer &HF6330000, &H4602E883, &H85144589, &H50577EC0, &HE81075FF, &H8056&, &H475C20B, &H2EBCE8B, &HE1C1C933, &H589D8D05, &H3FFFFFF, &H98458DD9, &HB58DC103, &HFFFFFF78, &H89D9F753, &H350FC45, &HB87D8DF1, &H5756F903, &H4F3E8, &H53575600, &HE8FC75FF, &H2BB&, &H4814458B, &H6A144589, &HC0855E01, &H6AA97F, &HE81075FF, &H7FFE&, &H274C20B, &HE6C1F633, &H589D8D05, &H3FFFFFF
-    pvAppendBuffer &H107589DE, &H98458D53, &HBD8DC603, &HFFFFFF78, &H758DFE2B, &H10752BB8, &HE8565750, &H4A0&, &H5FE8046A, &H83FFFFFB, &H8D5010C0, &H8D509845, &H8D50B845, &HE850D845, &H7B09&, &H8D57046A, &H5050D845, &H7AA5E8, &HFF046A00, &H458D0C75, &HE85050D8, &H7A96&, &H27E8046A, &H83FFFFFB, &H8D5010C0, &H5050D845, &H7560E8, &HFF046A00, &H458DF875, &HE85050D8, &H7A72&, &H8D56046A
-    pvAppendBuffer &H5050D845, &H7A65E8, &H8D565700, &H45039845, &HE8505310, &H1FB&, &H50D8458D, &HFF58858D, &H8D50FFFF, &HE8509845, &HA60&, &H8D08758B, &H46A9845, &HC6E85650, &H6A00007C, &H58858D04, &H50FFFFFF, &H5020468D, &H7CB4E8, &H5B5E5F00, &HC25DE58B, &H8B550010, &HF8EC81EC, &H53000000, &H8D0C5D8B, &H57569845, &H5053066A, &H7C90E8, &H30438D00, &H8950066A, &H858DF845, &HFFFFFF38
-    pvAppendBuffer &H7C7BE850, &H75FF0000, &H8858D14, &H50FFFFFF, &HFF68858D, &H8D50FFFF, &HFFFF3885, &H458D50FF, &H4DE85098, &H6A000007, &H1075FF06, &H7B99E8, &H83DB3300, &H894302E8, &HC0851445, &HFF505A7E, &HA7E81075, &HB00007E, &H8B0475C2, &H3302EBC3, &H30C06BC0, &HFF089D8D, &H8D8DFFFF, &HFFFFFF68, &HFF38B58D, &H7D8DFFFF, &H3D80398, &HD8F753C8, &H51FC4D89, &HF803F003, &HCCE85756, &H56000004
-    pvAppendBuffer &H75FF5357, &H219E8FC, &H458B0000, &H45894814, &H5B016A14, &HA67FC085, &H75FF006A, &H7E4CE810, &HC20B0000, &HDB330274, &H8D30C36B, &HFFFF688D, &H89D8DFF, &H8DFFFFFF, &HFFFF38BD, &H98758DFF, &HC803D803, &HF82B5153, &H2B104D89, &HE85657F0, &H477&, &HABE8066A, &H5FFFFF9, &HB0&, &H68858D50, &H50FFFFFF, &H5098458D, &H50C8458D, &H7950E8, &H57066A00, &H50C8458D, &H78ECE850
-    pvAppendBuffer &H66A0000, &H8D0C75FF, &H5050C845, &H78DDE8, &HE8066A00, &HFFFFF96E, &HB005&, &H458D5000, &HE85050C8, &H73A5&, &H75FF066A, &HC8458DF8, &HB7E85050, &H6A000078, &H458D5606, &HE85050C8, &H78AA&, &HFF535657, &H54E81075, &H8D000001, &H8D50C845, &HFFFF0885, &H858D50FF, &HFFFFFF68, &H8F1E850, &H758B0000, &H68858D08, &H6AFFFFFF, &HE8565006, &H7B09&, &H858D066A, &HFFFFFF08
-    pvAppendBuffer &H30468D50, &H7AF7E850, &H5E5F0000, &H5DE58B5B, &H550010C2, &HEC83EC8B, &H57565320, &H565E046A, &HFFF8E1E8, &H85D8BFF, &H5010C083, &H1075FF53, &H50E0458D, &H788CE8, &H458D5600, &HE85050E0, &H7857&, &HE0458D56, &HE8535350, &H781E&, &HE0458D56, &H1075FF50, &HE81075FF, &H780E&, &HF8A0E856, &H758BFFFF, &H10C0830C, &H50147D8B, &HE8575756, &H784D&, &H8D57046A, &HE850E045
-    pvAppendBuffer &H7817&, &H7BE8046A, &H83FFFFF8, &H535010C0, &H50E0458D, &H782BE850, &H46A0000, &HFFF865E8, &H10C083FF, &H1075FF50, &H50E0458D, &H7813E850, &H46A0000, &HFFF84DE8, &H10C083FF, &H75FF5350, &H1075FF10, &H77FCE8, &HFF046A00, &H56561075, &H7799E8, &HE8046A00, &HFFFFF82A, &H5010C083, &H50E0458D, &H1075FF53, &H77D8E8, &HFF046A00, &H57571075, &H7775E8, &HE8046A00, &HFFFFF806
-    pvAppendBuffer &H5010C083, &HE8575756, &H77B9&, &H458D046A, &H75FF50E0, &H79E7E810, &H5E5F0000, &H5DE58B5B, &H550010C2, &HEC83EC8B, &H57565330, &H575F066A, &HFFF7D1E8, &H85D8BFF, &HB0BE&, &H50C60300, &H1075FF53, &H50D0458D, &H7778E8, &H458D5700, &HE85050D0, &H7743&, &HD0458D57, &HE8535350, &H770A&, &HD0458D57, &H1075FF50, &HE81075FF, &H76FA&, &HF78CE857, &H7D8BFFFF, &H8BC60314
-    pvAppendBuffer &H56500C75, &H3AE85757, &H6A000077, &H458D5706, &H4E850D0, &H6A000077, &HF768E806, &HB005FFFF, &H50000000, &HD0458D53, &H16E85050, &H6A000077, &HF750E806, &HB005FFFF, &H50000000, &H8D1075FF, &H5050D045, &H76FCE8, &HE8066A00, &HFFFFF736, &HB005&, &HFF535000, &H75FF1075, &H76E3E810, &H66A0000, &H561075FF, &H7680E856, &H66A0000, &HFFF711E8, &HB005FF, &H8D500000, &H5350D045
-    pvAppendBuffer &HE81075FF, &H76BD&, &H75FF066A, &HE8575710, &H765A&, &HEBE8066A, &H5FFFFF6, &HB0&, &H57575650, &H769CE8, &H8D066A00, &HFF50D045, &HCAE81075, &H5F000078, &HE58B5B5E, &H10C25D, &H83EC8B55, &H565360EC, &H5B046A57, &HF6B4E853, &H7D8BFFFF, &H10C08310, &H875FF50, &H57C0458D, &H765FE850, &H8D530000, &H5050C045, &H762AE8, &H458D5300, &H75FF50C0, &H875FF08, &H75EDE8
-    pvAppendBuffer &H458D5300, &H575750C0, &H75E1E8, &H73E85300, &H8BFFFFF6, &HC0830C5D, &H14758B10, &H8D565350, &HE850C045, &H7066&, &H57E8046A, &H83FFFFF6, &H535010C0, &HAE85656, &H6A000076, &HF644E804, &HC083FFFF, &H75FF5010, &HE0458D08, &HF2E85057, &H6A000075, &HE0458D04, &HE8535350, &H758E&, &H1FE8046A, &H83FFFFF6, &H575010C0, &H8D0875FF, &HE850E045, &H7016&, &H5756046A, &H759AE8
-    pvAppendBuffer &HE8046A00, &HFFFFF5FE, &H5010C083, &H50E0458D, &HAEE85757, &H6A000075, &HF5E8E804, &HC083FFFF, &HFF575010, &H458D0875, &H96E850A0, &H6A000075, &HA0458D04, &HE8565650, &H7532&, &HC3E8046A, &H6AFFFFF5, &HC7035F10, &H56565350, &H7574E8, &H5E046A00, &HC0458D56, &HA0458D50, &H7539E850, &HE8560000, &HFFFFF59E, &H8D50C703, &H8D50E045, &H5050A045, &H754CE8, &H87E85600, &H3FFFFF5
-    pvAppendBuffer &H75FF50C7, &HA0458D08, &HE0458D50, &H7533E850, &H8D560000, &H8D50C045, &H5050E045, &H74CDE8, &H5FE85600, &H3FFFFF5, &H8D5350C7, &H5350E045, &H7510E8, &H458D5600, &H75FF50A0, &H773FE808, &H5E5F0000, &H5DE58B5B, &H550010C2, &HEC81EC8B, &H90&, &H6A575653, &HE8565E06, &HFFFFF526, &HBB107D8B, &HB0&, &HFF50C303, &H458D0875, &HE85057A0, &H74CD&, &HA0458D56, &H98E85050
-    pvAppendBuffer &H56000074, &H50A0458D, &HFF0875FF, &H5BE80875, &H56000074, &H50A0458D, &H4FE85757, &H56000074, &HFFF4E1E8, &H14758BFF, &H5D8BC303, &H5653500C, &H50A0458D, &H6ED5E8, &HE8066A00, &HFFFFF4C6, &HB005&, &H56535000, &H7477E856, &H66A0000, &HFFF4B1E8, &HB005FF, &HFF500000, &H458D0875, &HE85057D0, &H745D&, &H458D066A, &H535350D0, &H73F9E8, &HE8066A00, &HFFFFF48A, &HB005&
-    pvAppendBuffer &HFF575000, &H458D0875, &H7FE850D0, &H6A00006E, &HE8575606, &H7403&, &H67E8066A, &H5FFFFF4, &HB0&, &HD0458D50, &HE8575750, &H7415&, &H4FE8066A, &H5FFFFF4, &HB0&, &H75FF5750, &H70858D08, &H50FFFFFF, &H73F8E8, &H8D066A00, &HFFFF7085, &H565650FF, &H7391E8, &HE8066A00, &HFFFFF422, &HB0BF&, &H50C70300, &HE8565653, &H73D1&, &H565E066A, &H50A0458D, &HFF70858D
-    pvAppendBuffer &HE850FFFF, &H7393&, &HF3F8E856, &HC703FFFF, &HD0458D50, &H70858D50, &H50FFFFFF, &H73A3E850, &HE8560000, &HFFFFF3DE, &HFF50C703, &H858D0875, &HFFFFFF70, &HD0458D50, &H7387E850, &H8D560000, &H8D50A045, &H5050D045, &H7321E8, &HB3E85600, &H3FFFFF3, &H8D5350C7, &H5350D045, &H7364E8, &H858D5600, &HFFFFFF70, &H875FF50, &H7590E8, &H5B5E5F00, &HC25DE58B, &H8B550010, &H20EC83EC
-    pvAppendBuffer &H75FF046A, &H1075FF08, &H7574E8, &HFF046A00, &H75FF0C75, &H7567E814, &H46A0000, &H50E0458D, &H687FE8, &HE4658300, &H187D8300, &HE045C700, &H1&, &H46A0B74, &H501875FF, &H7540E8, &HE0458D00, &HC75FF50, &HE80875FF, &H2BC&, &H50E0458D, &HFF0C75FF, &H4BE80875, &H8DFFFFF3, &HFF50E045, &H75FF1475, &H29EE810, &HE58B0000, &H14C25D, &H83EC8B55, &H66A30EC, &HFF0875FF
-    pvAppendBuffer &HFAE81075, &H6A000074, &HC75FF06, &HE81475FF, &H74ED&, &H458D066A, &H5E850D0, &H83000068, &H8300D465, &HC700187D, &H1D045, &HB740000, &H75FF066A, &HC6E85018, &H8D000074, &HFF50D045, &H75FF0C75, &H28DE808, &H458D0000, &H75FF50D0, &H875FF0C, &HFFF459E8, &HD0458DFF, &H1475FF50, &HE81075FF, &H26F&, &HC25DE58B, &H8B530014, &H8B0C2444, &HF710244C, &H8BD88BE1, &HF7082444
-    pvAppendBuffer &H3142464, &H24448BD8, &H3E1F708, &H10C25BD3, &H40F98000, &HF9801573, &HF067320, &HE0D3C2A5, &H33D08BC3, &H1FE180C0, &H33C3E2D3, &HC3D233C0, &H7340F980, &H20F98015, &HAD0F0673, &HC3EAD3D0, &HD233C28B, &HD31FE180, &HC033C3E8, &H55C3D233, &H558BEC8B, &H8B565310, &H8B570C75, &HF22B087D, &HFA2B106A, &H160C8B5B, &H448B0A03, &H42130416, &H170C8904, &H8908528D, &H83FC1744, &HE57501EB
-    pvAppendBuffer &H5D5B5E5F, &H55000CC2, &H5151EC8B, &H8B1C558B, &H8B562045, &H8B570875, &HD7030C7D, &H89104513, &H4468916, &H7710453B, &H3B04720D, &H330773D7, &HC93340C0, &H570F0EEB, &H130F66C0, &H4D8BF845, &HF8458BFC, &H5F244503, &H3284D13, &H46891445, &H13C68B08, &H4E89184D, &HE58B5E0C, &H24C25D, &H8BEC8B55, &H4D8B0C55, &H31028B08, &H4428B01, &H8B044131, &H41310842, &HC428B08, &H5D0C4131
-    pvAppendBuffer &H550008C2, &HEC83EC8B, &H84D8B0C, &H758B5653, &H83018B10, &HEEC104C1, &HFF335702, &H89107589, &H48DFC4D, &H485&, &HF8458900, &H2C74F685, &H8B0C4D29, &H87589D9, &H8B0C758B, &H48D087D, &HB1E8501E, &H8900005A, &H45B8D03, &H7501EF83, &H10758BED, &H4D8BFE8B, &HF8458BFC, &H45C7DB33, &H108&, &HFF83B00, &H9683&, &H2BC78B00, &H81048DC6, &H8B104589, &H89FCB954, &HDE3B0C55
-    pvAppendBuffer &H45FF0575, &H85DB3308, &HE83475DB, &HFFFFF0F6, &H58805, &H458B5000, &H8C0C10C, &H64D9E850, &H45890000, &HF0DCE80C, &H4D8BFFFF, &HC558B08, &H884B60F, &H688&, &H3318E0C1, &H8320EBD0, &H1E7606FE, &H7504FB83, &HF0B8E819, &H8805FFFF, &H50000005, &H500C458B, &H649EE8, &H8BD08B00, &H88B1045, &H33FC458B, &HB80C89CA, &H10458B47, &H83FC4D8B, &H894304C0, &H7D3B1045, &H74820FF8
-    pvAppendBuffer &H5FFFFFFF, &HE58B5B5E, &HCC25D, &H83EC8B55, &H458D20EC, &HFF046AE0, &HE8501075, &H6FFB&, &H458D046A, &H75FF50E0, &H875FF08, &H6FBDE8, &HFF046A00, &H458D1075, &HE85050E0, &H6FAE&, &H458D046A, &H75FF50E0, &HC75FF0C, &H6F9DE8, &H5DE58B00, &H55000CC2, &HEC83EC8B, &HD0458D30, &H75FF066A, &HB0E85010, &H6A00006F, &HD0458D06, &H875FF50, &HE80875FF, &H6F72&, &H75FF066A
-    pvAppendBuffer &HD0458D10, &H63E85050, &H6A00006F, &HD0458D06, &HC75FF50, &HE80C75FF, &H6F52&, &HC25DE58B, &H8B55000C, &H24EC83EC, &H5308458B, &H7D8B5756, &H39378B0C, &H304F0F30, &HBCE85646, &H33000052, &H41D88BC9, &H33DC5D89, &HC0570FD2, &H45130F66, &HFF13BE4, &H868C&, &H85D8B00, &H8904478D, &H458BF445, &HFC5D89E8, &H29DC5D8B, &H4589FC7D, &HE4458BE0, &H29F85D89, &H4589F87D, &HF4458BE8
-    pvAppendBuffer &H3B085D8B, &H8B0B7F0B, &H1C8BFC5D, &HEC5D8903, &H658304EB, &HF3B00EC, &H8B077F, &HEBF04589, &HF0658304, &HF05D8B00, &H5D03C033, &HF87D8BEC, &H5D03C013, &HE04513E8, &HE06583, &H8BE84589, &H1C89F445, &HC7D8B07, &H574DB85, &H4F0FCA3B, &HC08341D1, &HF4458904, &HA47ECE3B, &H5FDC5D8B, &H8B13895E, &HE58B5BC3, &H8C25D, &H83EC8B55, &H565310EC, &HC7D8B57, &HDE8B378B, &H8902E3C1
-    pvAppendBuffer &H5D89F475, &HEEFCE8F0, &HFF53FFFF, &H33D08B10, &HC5589C9, &HF7EF685, &HC12B078B, &H8987048B, &H3B418A04, &H8BF17CCE, &H1B8B085D, &H37FDE3B, &H8B015E8D, &H2E7C1FB, &HE8F87D89, &HFFFFEEC6, &H8B10FF57, &HFC5589D0, &HB7EDB85, &HFA8BCF8B, &H3302E9C1, &H8BABF3C0, &HFF33084D, &H7C393947, &H83C38B1C, &HE0C1FCC2, &H3F78B02, &HB1048BD0, &H8D028946, &H313BFC52, &H758BF37E, &HC458BF4
-    pvAppendBuffer &H8950008B, &HDEE80845, &H8B000004, &H45890855, &H74C085F4, &HD3C88B1A, &H7EF73BE2, &H59206A12, &H458BC82B, &H4408B0C, &HD00BE8D3, &H50F4458B, &H5812E852, &HFF500000, &H8B561475, &H53560C75, &HE8FC75FF, &H3A2F&, &H85104D8B, &H392474C9, &H8B207C39, &H834BFC45, &H4503FCC0, &H78DB85F8, &HEB108B04, &H89D23302, &HE883B914, &H3B4B4704, &HFFEA7E39, &HE856F075, &H6137&, &HFFEE05E8
-    pvAppendBuffer &H50FF56FF, &HF875FF08, &H56FC758B, &H6122E8, &HEDF0E800, &HFF56FFFF, &H5E5F0850, &H5DE58B5B, &H550010C2, &H8B56EC8B, &HFF570C75, &H50C9E836, &H6A0000, &H5657F88B, &HE80875FF, &HFFFFFEAC, &H76013F83, &H83078B10, &H7500873C, &H7894808, &H7701F883, &H5FC78BF0, &H8C25D5E, &HEC8B5500, &H75FF006A, &H875FF0C, &H4E8&, &H8C25D00, &HEC8B5500, &H8B1CEC83, &H56530845, &H8B0C758B
-    pvAppendBuffer &H45895700, &H3B0E8BE8, &H89F98BC1, &H4F0FEC4D, &H57DF8BF8, &HE802E3C1, &H503B&, &HE3C1D803, &HE45D8902, &HFFED5DE8, &H10FF53FF, &HD233D88B, &H85FC5D89, &H8D4D7EFF, &HC78BBB0C, &H89085D8B, &H7529F85D, &HFC5D8BF8, &H8DF44D89, &H758BBE0C, &H7F063B08, &HF8758B08, &HEB0E348B, &H89F63302, &H758B9334, &H7F063B0C, &HEB318B04, &H8BF63302, &H8342F45D, &H8304F445, &H894804E9, &HFC5D8B33
-    pvAppendBuffer &HCA7CD73B, &HE0C1C78B, &H50C30304, &H8D084589, &H5057FB04, &H50BB048D, &H3BA0E853, &H4D8B0000, &H10458BE8, &HEC4D0341, &H850C4D89, &H8B0C74C0, &H7FC83B00, &H1488D06, &H510C4D89, &H4FBAE8, &H33F08B00, &HC93342D2, &H1639C28B, &H5D8B297C, &H3F148D08, &H3BFCC383, &H8B047FC2, &H3302EB3B, &H89FF85FF, &H450F863C, &HEB8340C8, &H7E063B04, &HFC5D8BE6, &H8342D233, &H8900107D, &H83840F0E
-    pvAppendBuffer &HF000000, &HF66C057, &H39F04513, &H767C0C55, &H8D105D8B, &H5D890446, &HF45D8B08, &H89087529, &H5D8BEC5D, &HF85D89F0, &H89105D8B, &H163BE845, &H388B077F, &HEBF47D89, &HF4658304, &H7F133B00, &H87D8B0B, &H8907048B, &H4EB1045, &H106583, &H33107D8B, &HF47D03C0, &H7D03C013, &HEC4513F8, &HEC6583, &H4589FF85, &HE8458BF8, &H7D8B3889, &H3B05740C, &HCA4F0FD1, &H4C08342, &H3BE84589
-    pvAppendBuffer &H8BAB7ED7, &H75FFFC5D, &H530E89E4, &H5F22E8, &HEBF0E800, &HFF53FFFF, &H8B5F0850, &H8B5B5EC6, &HCC25DE5, &HEC8B5500, &H560C4D8B, &H3278C985, &H8B08758B, &H2E0C106, &H267DC83B, &H8399C18B, &HC20303E2, &H8102F8C1, &H3E1&, &H49057980, &H41FCC983, &H486448B, &HD303E1C1, &HC0B60FE8, &HC03302EB, &H8C25D5E, &HEC8B5500, &H758B5653, &H7D8B570C, &H8B168B08, &H1F9830F, &HC0330875
-    pvAppendBuffer &HF044739, &HFA83C844, &H33087501, &H44639C0, &H3BD0440F, &HFC28BCA, &HC085C14F, &H1C8D3174, &H3BFE2B86, &H83067EC1, &HEB000865, &H1F348B06, &H3B087589, &H33047EC2, &H8B07EBF6, &H8753933, &H75391B72, &H83117708, &HE88304EB, &H33D47501, &H5B5E5FC0, &H8C25D, &HEB40C033, &HFFC883F4, &H8B55EFEB, &H5D8B53EC, &H8D57560C, &H83990343, &H3C8D03E2, &H2FFC102, &H4DFDE857, &HF08B0000
-    pvAppendBuffer &H7C01FF83, &H33CF8B09, &H47E8DC0, &HDB85ABF3, &HFB8B3A74, &H8B03E7C1, &H834B084D, &H18A08EF, &H84D8941, &HD285D38B, &HC2830379, &H2FAC103, &HE181CF8B, &H8000001F, &H83490579, &HF41E0C9, &HE0D3C0B6, &H4964409, &HCB75DB85, &H76013E83, &H83068B10, &H7500863C, &H6894808, &H7701F883, &HC68B5FF0, &HC25D5B5E, &H8B550008, &HC4D8BEC, &H3D78C985, &H8758B56, &HE0C1068B, &H7DC83B05
-    pvAppendBuffer &H99C18B2F, &H31FE283, &H5F8C1C2, &H1FE181, &H5798000, &HE0C98349, &H42D23341, &H7D83E2D3, &H6740010, &H4865409, &HD2F706EB, &H4865421, &HCC25D5E, &HEC8B5500, &H8B18EC83, &H56530845, &HC7D8B57, &H18391F8B, &H53184F0F, &HE8EC5D89, &H4D27&, &HF633D08B, &H5589C033, &H458940E8, &H3BC88BF8, &H8B677CD8, &H5F8D0845, &H8BC72B04, &HC558BFA, &H4589FA2B, &HF07D89F4, &H458B03EB
-    pvAppendBuffer &H87D8BF4, &H87F0F3B, &H8918048B, &H4EBFC45, &HFC6583, &H47F0A3B, &H2EB3B8B, &H558BFF33, &HF7C033F0, &HFC7D03D7, &H7D03C013, &H1A3C89F8, &H830C558B, &H458900D0, &H74FF85F8, &HFCE3B05, &H8341F14F, &H4D3B04C3, &H8BB37EEC, &H3289E855, &H855B5E5F, &H520A75C0, &H32BAE8, &HEBC03300, &H8BC28B02, &H8C25DE5, &HEC8B5500, &H7D8B5756, &H6AF63308, &H206A5A10, &H8BCA2B59, &H85E8D3C7
-    pvAppendBuffer &H8B0675C0, &H3E7D3CA, &H75FAD1F2, &HC68B5FE9, &H4C25D5E, &HEC8B5500, &H9908458B, &H31FE283, &H5F8C1C2, &HE8504056, &H4C4F&, &H75FF016A, &H56F08B08, &HFFFEB1E8, &H5EC68BFF, &H4C25D, &H8BEC8B55, &HEC83084D, &H5756531C, &H481DB33, &H10000D9, &HD9148B00, &H4D95483, &HD9448B00, &HC2AC0F04, &H10F8C110, &H89F45589, &HFB83F845, &H3309750F, &H658341C9, &H1CEB00FC, &H66C0570F
-    pvAppendBuffer &HEC45130F, &H8BF0458B, &HF66EC4D, &H8BE44513, &H4589E455, &HE8458BFC, &H8D0FFB83, &H6A017B, &HDEF7F61B, &H2BF7AF0F, &H1B256AD1, &H5250FC45, &HFFF639E8, &HF44503FF, &H13084D8B, &HE883F855, &HDA8301, &H8BF10401, &H5411F845, &H558B04F1, &HD0A40FF4, &H10E2C110, &H19D91429, &H8B04D944, &H10FB83DF, &HFF64820F, &H5E5FFFFF, &H5DE58B5B, &H550004C2, &HEC83EC8B, &H758B5610, &HE856570C
-    pvAppendBuffer &H51F4&, &H8DF04589, &HE8500446, &H51E8&, &H8DF44589, &HE8500846, &H51DC&, &H8DF84589, &HE8500C46, &H51D0&, &H89084D8B, &H318BFC45, &H8B04798D, &H4E0C1C6, &H458DF803, &HE85057F0, &HFFFFF69C, &HABE821EB, &H8D00003B, &HE850F045, &H3C38&, &HF0458D57, &HF682E850, &H458DFFFF, &H59E850F0, &H8300003B, &H458D10EF, &HEE8350F0, &HE8D37501, &H3B7E&, &H50F0458D, &H3C0BE8
-    pvAppendBuffer &H458D5700, &H55E850F0, &H8BFFFFF6, &HFF561075, &H8EE8F075, &H8D00006C, &HFF500446, &H82E8F475, &H8D00006C, &HFF500846, &H76E8F875, &H8D00006C, &HFF500C46, &H6AE8FC75, &H5F00006C, &H5DE58B5E, &H55000CC2, &HEC83EC8B, &H8B565310, &H56570C75, &H5123E8, &HF0458900, &H5004468D, &H5117E8, &HF4458900, &H5008468D, &H510BE8, &HF8458900, &H500C468D, &H50FFE8, &H85D8B00, &H8DFC4589
-    pvAppendBuffer &H738DF045, &HE8505604, &HFFFFF5D4, &HC683FF33, &H3B394710, &H458D2D76, &HFFE850F0, &H8D00005A, &HE850F045, &H59F5&, &H50F0458D, &H3C54E8, &H458D5600, &HA5E850F0, &H83FFFFF5, &H3B4710C6, &H8DD3723B, &HE850F045, &H5AD2&, &H50F0458D, &H59C8E8, &H458D5600, &H81E850F0, &H8BFFFFF5, &HFF561075, &HBAE8F075, &H8D00006B, &HFF500446, &HAEE8F475, &H8D00006B, &HFF500846, &HA2E8F875
-    pvAppendBuffer &H8D00006B, &HFF500C46, &H96E8FC75, &H5F00006B, &HE58B5B5E, &HCC25D, &H53EC8B55, &H75FF5756, &H107D8B1C, &H571875FF, &H457E8, &H74C08500, &HE6E3E81F, &H62BEFFFF, &HBB00CA5B, &HCA4000, &HF003F32B, &HFFE6D0E8, &H5A6EB9FF, &H2CEB00CA, &H8B1C75FF, &H75FF147D, &H3CE85718, &HE8000000, &HFFFFE6B5, &HCA58C3BE, &H4000BB00, &HF32B00CA, &HA2E8F003, &HB9FFFFE6, &HCA57F3, &HC103CB2B
-    pvAppendBuffer &H89084D8B, &H458B0841, &H471890C, &H1001C7, &H38890000, &H5D5B5E5F, &H550018C2, &H8B56EC8B, &HF4680875, &H6A000000, &H1E85600, &H8300003B, &H7D830CC4, &H20741010, &H18107D83, &H7D831074, &H25752010, &HE06C7, &H206A0000, &H6C712EB, &HC&, &H8EB186A, &HA06C7, &H106A0000, &H560C75FF, &HFFF49AE8, &HC25D5EFF, &H8B53000C, &H835151DC, &HC483F0E4, &H6B8B5504, &H246C8904
-    pvAppendBuffer &H83EC8B04, &H4B8B2CEC, &HC438B08, &H8B106A56, &H20091, &H38100F00, &HF5E018B, &HD6030228, &HF8EF0F66, &HF07D290F, &H740AE883, &HE883483C, &H481E7401, &HF01E883, &H9585&, &HA280F00, &HF66D603, &HFF9DE38, &HD6030228, &HDE380F66, &HA280FF8, &HF66D603, &HFF9DE38, &HD6030228, &HDE380F66, &H7D290FF8, &H3A280FF0, &H280FD603, &HFD60332, &HFE07529, &H66F07528, &HF7DE380F
-    pvAppendBuffer &H32A280F, &H75290FD6, &H7D280FF0, &H380F66F0, &HFE07DDE, &HD6032228, &HDE380F66, &H380F66FD, &H280FFCDE, &H66D6031A, &HFBDE380F, &H312280F, &H380F66D6, &H280FFADE, &H66D6030A, &HF9DE380F, &HDE380F66, &H380F663A, &H66323CDE, &H7CDF380F, &H438B1032, &H110F5E10, &H5DE58B38, &HC25BE38B, &H8B53000C, &H835151DC, &HC483F0E4, &H6B8B5504, &H246C8904, &H83EC8B04, &H4B8B2CEC, &HC438B08
-    pvAppendBuffer &H8B106A56, &H1FC91, &H38100F00, &HF5E018B, &HD6030228, &HF8EF0F66, &HF07D290F, &H740AE883, &HE883483C, &H481E7401, &HF01E883, &H9585&, &HA280F00, &HF66D603, &HFF9DC38, &HD6030228, &HDC380F66, &HA280FF8, &HF66D603, &HFF9DC38, &HD6030228, &HDC380F66, &H7D290FF8, &H3A280FF0, &H280FD603, &HFD60332, &HFE07529, &H66F07528, &HF7DC380F, &H32A280F, &H75290FD6, &H7D280FF0
-    pvAppendBuffer &H380F66F0, &HFE07DDC, &HD6032228, &HDC380F66, &H380F66FD, &H280FFCDC, &H66D6031A, &HFBDC380F, &H312280F, &H380F66D6, &H280FFADC, &H66D6030A, &HF9DC380F, &HDC380F66, &H380F663A, &H66323CDC, &H7CDD380F, &H438B1032, &H110F5E10, &H5DE58B38, &HC25BE38B, &H8B55000C, &HCEC81EC, &H8B000001, &HC9330C45, &H45C75756, &H40201F4, &H8DF18B08, &H45C70678, &H402010F8, &HBD148D80, &H4&
-    pvAppendBuffer &HFC45C766, &H7D89361B, &HE85589E4, &H840FD285, &HE7&, &H8D0C7D8B, &H5589F455, &HF4958DF0, &HC1FFFFFE, &HD02B02E0, &H8908458B, &H958DEC55, &HFFFFFEF4, &H4589C22B, &H73F73B08, &HB0048D1B, &HFEF48D8D, &HC103FFFF, &H4D52E850, &H558B0000, &HE9C933EC, &H86&, &HF0B5848B, &H33FFFFFE, &HC4589D2, &HF7F7C68B, &H7508FF83, &H24C68B0A, &HB0043C07, &H8A027401, &H75D285C1, &H6E0F6632
-    pvAppendBuffer &HC0330C4D, &H66D2570F, &H8BC06E0F, &HF66F045, &HF66C862, &HF66D162, &HC2DF3A, &H6600B60F, &HC2163A0F, &HFFD03301, &H5589F045, &H8427EB0C, &H662374C0, &HC4D6E0F, &H570FC033, &H6E0F66D2, &H620F66C0, &H620F66C8, &H3A0F66D1, &H6600C2DF, &H45163A0F, &H558B000C, &H33028BEC, &H84890C45, &HFFFEF4B5, &H4C283FF, &H4608458B, &H3BEC5589, &H820FE875, &HFFFFFF41, &H8BE47D8B, &H858D1055
-    pvAppendBuffer &HFFFFFEF8, &HD62BF08B, &H8901778D, &H758B0875, &H86D8310, &H6E0F6601, &HF660858, &H6604406E, &H66086E0F, &HFC506E0F, &HD0620F66, &HCB620F66, &HD1620F66, &H214290F, &H7510408D, &HF068D4, &H8D510000, &HFFFEF485, &H61E850FF, &H8B000037, &HCC483CF, &H304E1C1, &HD233144D, &H8506280F, &H8B0B74D2, &H74C22BC7, &H380F6605, &H290FC0DB, &HC6834201, &H10E98310, &HE076D73B, &HE58B5E5F
-    pvAppendBuffer &H10C25D, &H83EC8B55, &H565310EC, &H8DC03357, &H3340F07D, &HA20F53C9, &H895BF38B, &H4778907, &H89084F89, &H45F70C57, &HF8&, &HF75F7402, &HF845&, &H56740008, &H8B107D8B, &H8758BC7, &HF799CE8B, &H3E283D1, &H302EFC1, &H2F8C1C2, &H8906C083, &H4468D06, &HC140D0F7, &HE08302E8, &HC1414003, &HE18302E9, &H40C18303, &H8986148D, &H1FC96, &H8E0C8D00, &HFF575251, &H8E890C75
-    pvAppendBuffer &H200&, &HFFFDCDE8, &H40C033FF, &HC03302EB, &H8B5B5E5F, &HCC25DE5, &HEC8B5500, &H228EC81, &H75FF0000, &HD8858D1C, &HFFFFFFFD, &H50501875, &H501C458D, &H50F4458D, &HFFFADBE8, &H1475FFFF, &HFFF4458D, &H8D501C75, &HE850DC45, &H431&, &HC110458B, &HFF5004E8, &H458D0875, &HC75FFDC, &H33BE850, &HE58B0000, &H18C25D, &H81EC8B55, &H228EC, &H1C75FF00, &HFDD8858D, &H75FFFFFF
-    pvAppendBuffer &H8D505018, &H8D501C45, &HE850F445, &HFFFFFA88, &H8D1475FF, &H75FFF445, &H458D501C, &HDEE850DC, &H8B000003, &HE8C11045, &H75FF5004, &HDC458D08, &H500C75FF, &H359E8, &H5DE58B00, &H550018C2, &HEC81EC8B, &H210&, &H8D2875FF, &HFFFDF085, &H2475FFFF, &H458D5050, &H458D5028, &H35E850F4, &HFFFFFFFA, &H458D0875, &HFF106AF4, &HC6A1475, &HFF2075FF, &H75FF1C75, &H1075FF18, &HFF0C75FF
-    pvAppendBuffer &HE8502875, &HD3C&, &HC25DE58B, &H8B550024, &H10EC81EC, &HFF000002, &H858D2875, &HFFFFFDF0, &H502475FF, &H28458D50, &HF4458D50, &HF9E6E850, &H106AFFFF, &H8D0C75FF, &H75FFF445, &HFF0C6A08, &H75FF2075, &H1875FF1C, &HFF1475FF, &H75FF1075, &H9BE85028, &H8B00000E, &H24C25DE5, &HEC8B5500, &H7D8B5751, &H89C03318, &HFF85FC45, &H8B536374, &H8B560C5D, &H10758B0B, &H4D89F12B, &HFFE3B18
-    pvAppendBuffer &HC085F742, &HB60F1A75, &H50561445, &H308458B, &H19E850C1, &H8B000035, &HC483184D, &HFC458B0C, &HC75C985, &H3B42D233, &H440F1075, &HFC4589C2, &H3B0E048D, &HE751045, &HFF0875FF, &H55FF2075, &H23831C, &H330102EB, &H2BFC458B, &H5EA475FE, &HE58B5F5B, &H1CC25D, &H56EC8B55, &H8B20758B, &HE883C6, &H86840F, &H75FF0000, &H2475FF28, &HE883016A, &H83617401, &H458D01E8, &H75FF5014
-    pvAppendBuffer &HC75FF10, &H740875FF, &H67E848, &H75FF0000, &H184D8B28, &H382475FF, &H20741C4D, &H50FE468D, &H1075FF51, &HFF0C75FF, &H2EE80875, &HFFFFFFFF, &H458D2875, &H2475FF1C, &H25EB016A, &H50FF468D, &H1075FF51, &HFF0C75FF, &HEE80875, &HEBFFFFFF, &H1FE81F, &HD7EB0000, &H301C458A, &H458D1445, &H75FF5014, &HC75FF10, &HE80875FF, &H5&, &H24C25D5E, &HEC8B5500, &HFF2075FF, &H75FF1C75
-    pvAppendBuffer &H1875FF1C, &HFF1475FF, &H75FF1075, &H875FF0C, &H4E8&, &H1CC25D00, &HEC8B5500, &H530C4D8B, &H56145D8B, &H57003983, &H74187D8B, &H74FF854A, &H10458B46, &H12BF78B, &H420FC73B, &H3018BF0, &H53560845, &H33C1E850, &H4D8B0000, &H2BDE030C, &HCC483FE, &H758B3101, &H75313910, &H875FF33, &H852475FF, &HFF0575FF, &H3EB2055, &H8B1C55FF, &H20830C45, &H8B19EB00, &H14EB1075, &H2475FF53
-    pvAppendBuffer &H575FE3B, &HEB2055FF, &H1C55FF03, &HFE2BDE03, &HE873FE3B, &H2E74FF85, &H8B0C458B, &H2BC68B08, &H3BF78BC1, &HF0420FC7, &H5608458B, &H5053C103, &H3356E8, &HC458B00, &HC483DE03, &H2B30010C, &H10758BFE, &H5E5FD575, &H20C25D5B, &HEC8B5500, &H1C7D8B57, &H4474FF85, &HC5D8B53, &H3B8356, &H75FF1075, &H2475FF08, &H8B2055FF, &H3891045, &H458B03EB, &H8B032B10, &HF3B39F7, &H45033342
-    pvAppendBuffer &HFF505608, &H75FF1475, &H63EEE818, &H33290000, &H1187501, &HFE2B1475, &H5B5EC375, &H20C25D5F, &HEC8B5500, &H5310EC83, &H56145D8B, &H8B08758B, &H89008B06, &HDB850845, &H8B575074, &H7D290C7D, &H8D068B10, &H5751F04D, &HFF0476FF, &H75FF0850, &H8468D08, &HF0458D50, &H9DE85050, &HFF000063, &H468D0875, &HE8505708, &H329F&, &H8D0875FF, &H8B50F045, &HC7031045, &H328DE850, &H7D030000
-    pvAppendBuffer &H18C48308, &H7501EB83, &H5B5E5FB8, &HC25DE58B, &H8B550010, &H10EC83EC, &H8758B56, &H147D8B57, &H88B068B, &H85084D89, &H8B4E74FF, &H568D0C45, &H5D8B5308, &H89C32B10, &H52510C45, &H8D50C303, &HE850F045, &H6334&, &H4E8D068B, &H4D8D5108, &H76FF51F0, &H450FF04, &H8D0875FF, &H53500846, &H3226E8, &H84D8B00, &H8B08568D, &HC4830C45, &H83D9030C, &HC27501EF, &H8B5E5F5B, &H10C25DE5
-    pvAppendBuffer &HEC8B5500, &H8B08558B, &H458B0C4D, &H4428910, &H8908428D, &HFF31FF0A, &HE8501475, &H31EB&, &H5D0CC483, &H550010C2, &H6AE8EC8B, &HB9FFFFDD, &HCA6877, &H4000E981, &HC10300CA, &H51084D8B, &H1475FF50, &HFF74418D, &H75FF1075, &H50406A0C, &H5034418D, &HFFFE74E8, &H10C25DFF, &HEC8B5500, &H5370EC83, &H14758B56, &HB1E85657, &H8D000046, &HF88B044E, &HD07D8951, &H46A3E8, &H84E8D00
-    pvAppendBuffer &H51F84589, &HE8CC4589, &H4694&, &H890C4E8D, &H8951F445, &H85E8C845, &H8B000046, &H89560875, &H4589F045, &H4676E8C4, &H4E8D0000, &HD4458904, &HC0458951, &H4667E8, &H84E8D00, &H51E84589, &HE8BC4589, &H4658&, &H890C4E8D, &H8951E445, &H49E8B845, &H8B000046, &H89560C75, &H4589E045, &H463AE8B4, &H4E8D0000, &HFC458904, &HB0458951, &H462BE8, &H84E8D00, &H51084589, &HE8AC4589
-    pvAppendBuffer &H461C&, &H890C4E8D, &H89511445, &HDE8A845, &H8B000046, &H89561075, &H45890C45, &H45FEE8A4, &H4E8D0000, &H51D88B04, &HE8A05D89, &H45F0&, &H89084E8D, &H8951DC45, &HE1E89C45, &H8D000045, &H45890C4E, &H458951D8, &H45D2E898, &H4D8B0000, &H8BF08BDC, &H7589D855, &H9045C794, &HA&, &H758B06EB, &H107D8BEC, &H8BD47D03, &HDF33FC45, &H310C3C1, &HFC4589C3, &HC1D44533, &HF8030CC0
-    pvAppendBuffer &H7D89DF33, &HFC7D8B10, &H308C3C1, &HFC7D89FB, &H458BF833, &HE84503F8, &H4589C833, &H8458BF8, &H310C1C1, &H7C7C1C1, &H33084589, &HC0C1E845, &HF845010C, &HC1F84D33, &H4D0108C1, &HDC4D8908, &H33084D8B, &HF4458BC8, &H33E44503, &HF44589D0, &HC114458B, &HC20310C2, &H8907C1C1, &H45331445, &HCC0C1E4, &H33F44501, &HC2C1F455, &H14550108, &H89104D01, &H558BD855, &H8BD03314, &H4503F045
-    pvAppendBuffer &H89F033E0, &H458BF045, &H10C6C10C, &HC2C1C603, &HC458907, &HC1E04533, &H45010CC0, &HF07533F0, &H108C6C1, &H75890C75, &HC758BEC, &H458BF033, &H104533EC, &H110C0C1, &H45891445, &H14458BEC, &HC6C1C133, &HCC0C107, &H8B104501, &H4D33EC4D, &H8C1C110, &H89144D01, &H4D8BEC4D, &H8BC83314, &HC1C10C45, &HE84D8907, &H3F84D8B, &HC1D933CA, &HC30310C3, &H330C4589, &HF4558BC2, &H30CC0C1
-    pvAppendBuffer &H33C803D6, &HF84D89D9, &HC10C4D8B, &HCB0308C3, &H330C4D89, &HFC458BC8, &H8907C1C1, &H4D8BE44D, &HC1CA33DC, &HC10310C1, &H33FC4589, &HF0758BC6, &H30CC0C1, &H33D003F7, &HF45589CA, &HC1FC558B, &HD10308C1, &H33FC5589, &H8458BD0, &H8907C2C1, &H558BE055, &HC1D633D8, &HC20310C2, &H33084589, &H87D8BC7, &H30CC0C1, &H89D633F0, &HC2C1F075, &H89FA0308, &HF833087D, &H8307C7C1, &H8901906D
-    pvAppendBuffer &H850FD47D, &HFFFFFE5A, &H3D0458B, &H45891045, &HCC458BD0, &H89F84503, &H458BCC45, &HF44503C8, &H8BC84589, &H4503BC45, &HBC4589E8, &H3B8458B, &H4589E445, &HB4458BB8, &H89E04503, &H458BB445, &H84503AC, &H89A05D01, &H458BAC45, &H144503A8, &H8B985501, &H5D8B1855, &HA84589D0, &H3A4458B, &H45890C45, &H94458BA4, &H88EC4503, &H9445891A, &HE8C1C38B, &H1428808, &HE8C1C38B, &H2428810
-    pvAppendBuffer &HC1C47501, &H5A8818EB, &HCC5D8B03, &H5A88C38B, &H8E8C104, &H8B054288, &HC07D01C3, &H8810E8C1, &H7D8B0642, &HB07D01FC, &HC19C4D01, &H5A8818EB, &HC85D8B07, &H5A88C38B, &H8E8C108, &H8B094288, &H10E8C1C3, &HC10A4288, &H5A8818EB, &HC45D8B0B, &H5A88C38B, &H8E8C10C, &H8B0D4288, &H10E8C1C3, &HC10E4288, &H5A8818EB, &HC05D8B0F, &H5A88C38B, &H8E8C110, &H8B114288, &H10E8C1C3, &HC1124288
-    pvAppendBuffer &H5A8818EB, &HBC5D8B13, &H5A88C38B, &H8E8C114, &H8B154288, &H10E8C1C3, &HC1164288, &H5A8818EB, &HB85D8B17, &H5A88C38B, &H8E8C118, &H8B194288, &H10E8C1C3, &HC11A4288, &H5A8818EB, &HB45D8B1B, &H5A88C38B, &H8E8C11C, &H8B1D4288, &H10E8C1C3, &HC11E4288, &H5A8818EB, &HB05D8B1F, &H5A88C38B, &H8E8C120, &H8B214288, &H10E8C1C3, &HC1224288, &H5A8818EB, &HAC5D8B23, &H5A88C38B, &H8E8C124
-    pvAppendBuffer &H8B254288, &H10E8C1C3, &HC1264288, &H5A8818EB, &HA85D8B27, &H5A88C38B, &H8E8C128, &H8B294288, &H10E8C1C3, &HC12A4288, &H5A8818EB, &HA45D8B2B, &H5A88C38B, &H8E8C12C, &H8B2D4288, &H10E8C1C3, &HC12E4288, &H5A8818EB, &HA05D8B2F, &H5A88C38B, &H8E8C130, &H8D314288, &HC38B3C4A, &HC118EBC1, &H428810E8, &H335A8832, &H8B9C5D8B, &H345A88C3, &H8808E8C1, &HC38B3542, &H8810E8C1, &HEBC13642
-    pvAppendBuffer &H375A8818, &H8B985D8B, &H385A88C3, &H8808E8C1, &HC38B3942, &H8810E8C1, &HEBC13A42, &H3B5A8818, &H8B94558B, &H8E8C1C2, &H41881188, &H5FC28B01, &HC110E8C1, &H885E18EA, &H51880241, &HE58B5B03, &H14C25D, &H56EC8B55, &H8B1075FF, &H75FF0875, &H62E8560C, &H6A000045, &H1475FF10, &H5020468D, &H2CA6E8, &H18458B00, &H830CC483, &H89007466, &H5D5E7846, &H550014C2, &H8B56EC8B, &HFF570875
-    pvAppendBuffer &H76FF0C75, &H207E8D30, &H10468D57, &HCAE85650, &H8BFFFFFA, &HC9337856, &H75010780, &HCA3B410B, &H4800674, &HF5740139, &HC25D5E5F, &H8B550008, &H10EC83EC, &H6AF0458D, &H2075FF10, &H2C49E850, &HC4830000, &HF0458D0C, &HFF006A50, &H75FF2475, &H1875FF1C, &HFF1475FF, &H75FF1075, &H875FF0C, &H3F0BE8, &H5DE58B00, &H550020C2, &H75FFEC8B, &HFF016A24, &H75FF2075, &H1875FF1C, &HFF1475FF
-    pvAppendBuffer &H75FF1075, &H875FF0C, &H3EE3E8, &H20C25D00, &HEC8B5500, &HFFD780E8, &H7841B9FF, &HE98100CA, &HCA4000, &H4D8BC103, &HFF505108, &H18B1475, &HFF1075FF, &H30FF0C75, &H5028418D, &H5018418D, &HFFF888E8, &H10C25DFF, &HEC8B5500, &H8B084D8B, &H41890C45, &H10458B2C, &H5D304189, &H55000CC2, &H8B56EC8B, &H346A0875, &HE856006A, &H2BC0&, &H830C4D8B, &H8B002C66, &H28668301, &H30468900
-    pvAppendBuffer &H8910458B, &H468D0446, &HFF0E8908, &H1475FF31, &H2B75E850, &HC4830000, &HC25D5E18, &H8B550010, &H20EC81EC, &H53000004, &HDB335756, &HFD6085C7, &HDB41FFFF, &H706A0000, &HFD70858D, &H9D89FFFF, &HFFFFFD64, &H85C75053, &HFFFFFD68, &H1&, &HFD6C9D89, &H55E8FFFF, &H8B00002B, &H858D0C75, &HFFFFFF60, &H50561F6A, &H2B1EE8, &H1F468A00, &H8018C483, &HFFFF60A5, &H3F24F8FF, &H8588400C
-    pvAppendBuffer &HFFFFFF7F, &HFBE0858D, &H75FFFFFF, &HB0E85010, &H6A00004A, &H570F591E, &H60B58DC0, &H6AFFFFFE, &H130F661E, &HFFFE6085, &H68BD8DFF, &HF3FFFFFE, &HF6659A5, &H8D804513, &H7D8D8075, &H130F6688, &HFFFEE085, &H6AA5F3FF, &HB58D591E, &HFFFFFEE0, &HFE649D89, &HBD8DFFFF, &HFFFFFEE8, &HF3845D89, &H59206AA5, &HFBE0B58D, &HFEBBFFFF, &H8D000000, &HFFFDE0BD, &H33A5F3FF, &HBD8947FF, &HFFFFFE60
-    pvAppendBuffer &H8B807D89, &HCBB60FC3, &H8303F8C1, &HB60F07E1, &HFF6005B4, &H858DFFFF, &HFFFFFDE0, &HF723EED3, &H458D5056, &H8AE85080, &H56000042, &HFE60858D, &H8D50FFFF, &HFFFEE085, &H76E850FF, &H8D000042, &HFFFEE085, &H458D50FF, &H858D5080, &HFFFFFCE0, &HE379E850, &H858DFFFF, &HFFFFFEE0, &H80458D50, &HFFE85050, &H8D000048, &HFFFE6085, &H858D50FF, &HFFFFFDE0, &HE0858D50, &H50FFFFFE, &HFFE34EE8
-    pvAppendBuffer &H60858DFF, &H50FFFFFE, &HFDE0858D, &H5050FFFF, &H48D1E8, &HE0858D00, &H50FFFFFC, &HFE60858D, &HE850FFFF, &H48A9&, &H5080458D, &HFC60858D, &HE850FFFF, &H4899&, &H5080458D, &HFEE0858D, &H8D50FFFF, &HE8508045, &H3697&, &HFCE0858D, &H8D50FFFF, &HFFFDE085, &H858D50FF, &HFFFFFEE0, &H367DE850, &H858D0000, &HFFFFFEE0, &H80458D50, &HE0858D50, &H50FFFFFC, &HFFE2D2E8, &HE0858DFF
-    pvAppendBuffer &H50FFFFFE, &H5080458D, &H4858E850, &H458D0000, &H858D5080, &HFFFFFDE0, &H4833E850, &H858D0000, &HFFFFFC60, &H60858D50, &H50FFFFFE, &HFEE0858D, &HE850FFFF, &H482E&, &HFD60858D, &H8D50FFFF, &HFFFEE085, &H458D50FF, &H14E85080, &H8D000036, &HFFFE6085, &H458D50FF, &HE8505080, &HFFFFE26F, &H5080458D, &HFEE0858D, &H5050FFFF, &H35F2E8, &H60858D00, &H50FFFFFC, &HFE60858D, &H8D50FFFF
-    pvAppendBuffer &HE8508045, &H35DB&, &HFBE0858D, &H8D50FFFF, &HFFFDE085, &H858D50FF, &HFFFFFE60, &H35C1E850, &H858D0000, &HFFFFFCE0, &HE0858D50, &H50FFFFFD, &H479CE8, &H858D5600, &HFFFFFDE0, &H80458D50, &H40EFE850, &H8D560000, &HFFFE6085, &H858D50FF, &HFFFFFEE0, &H40DBE850, &HEB830000, &H20890F01, &H8DFFFFFE, &HFFFEE085, &HE85050FF, &H26B4&, &HFEE0858D, &H8D50FFFF, &H50508045, &H3562E8
-    pvAppendBuffer &H80458D00, &H875FF50, &H37D0E8, &H5B5E5F00, &HC25DE58B, &H8B55000C, &H20EC83EC, &H59076A57, &H45C6C033, &H7D8D09E0, &H66ABF3E1, &H458DAAAB, &H75FF50E0, &H875FF0C, &HFFFCE1E8, &HE58B5FFF, &H8C25D, &H81EC8B55, &H114EC, &H57565300, &H758BC033, &H8DDB3308, &H5D88E17D, &HABABABE0, &H8DAAAB66, &H5050E045, &HFF0C75FF, &H7D830456, &H1E750C24, &H75FF0C6A, &HF0458D20, &H2809E850
-    pvAppendBuffer &HC4830000, &H5D89660C, &HFC5D88FD, &H1FF45C6, &H458D32EB, &H858D50E0, &HFFFFFEEC, &H1E23E850, &H75FF0000, &HEC858D24, &HFFFFFFFE, &HE8502075, &H1CFA&, &H50F0458D, &HFEEC858D, &HE850FFFF, &H1D87&, &H50E0458D, &HFF3C858D, &HE850FFFF, &H1DF1&, &H8D1C75FF, &HFFFF3C85, &H1875FFFF, &H1CAAE850, &HC0330000, &H8DD05D88, &HABABD17D, &HAAAB66AB, &H50F0458D, &H8D0C75FF, &H50568C45
-    pvAppendBuffer &HFFFBDAE8, &H6A046AFF, &H8C458D0C, &HFBB7E850, &H106AFFFF, &H50D0458D, &H8C458D50, &HFB6FE850, &H75FFFFFF, &H3C858D14, &HFFFFFFFF, &HE8501075, &H1C7A&, &H50C0458D, &HFF3C858D, &HE850FFFF, &H1D07&, &H8D2C758B, &H5056D045, &H50C0458D, &H5826E850, &H4D8D0000, &H74F685C0, &H28558B18, &HD02BC18B, &H320A048A, &H41D80A01, &H7501EE83, &H75DB84F3, &H1475FF16, &HFF8C458D, &H75FF3075
-    pvAppendBuffer &HAE85010, &H33FFFFFB, &H3303EBF6, &HC03346F6, &HABE07D8D, &H6A506A, &H8AABABAB, &H7D8DE045, &HABC033F0, &H8AABABAB, &H7D8DF045, &HABC033D0, &H8AABABAB, &H7D8DD045, &HABC033C0, &H8AABABAB, &H858DC045, &HFFFFFF3C, &H26E2E850, &H8D8A0000, &HFFFFFF3C, &H6A8C458D, &H50006A34, &H26CFE8, &H8C4D8A00, &H8B18C483, &H5B5E5FC6, &HC25DE58B, &H8B55002C, &H14EC81EC, &H53000001, &HC0335756
-    pvAppendBuffer &H3308758B, &HE17D8DDB, &HABE05D88, &HAB66ABAB, &HE0458DAA, &H75FF5050, &H456FF0C, &HC247D83, &HC6A1E75, &H8D2075FF, &HE850F045, &H265B&, &H660CC483, &H88FD5D89, &H45C6FC5D, &H32EB01FF, &H50E0458D, &HFEEC858D, &HE850FFFF, &H1C75&, &H8D2475FF, &HFFFEEC85, &H2075FFFF, &H1B4CE850, &H458D0000, &H858D50F0, &HFFFFFEEC, &H1BD9E850, &H458D0000, &H858D50E0, &HFFFFFF3C, &H1C43E850
-    pvAppendBuffer &H75FF0000, &H3C858D1C, &HFFFFFFFF, &HE8501875, &H1AFC&, &H5D88C033, &HD17D8DD0, &H66ABABAB, &H458DAAAB, &H75FF50F0, &H8C458D0C, &H2CE85056, &H6AFFFFFA, &H8D0C6A04, &HE8508C45, &HFFFFFA09, &H458D106A, &H8D5050D0, &HE8508C45, &HFFFFF9C1, &H8D1475FF, &H75FF8C45, &H1075FF28, &HF9AFE850, &H75FFFFFF, &H3C858D14, &HFFFFFFFF, &HE8502875, &H1ABA&, &H5D88C033, &HC17D8DC0, &H66ABABAB
-    pvAppendBuffer &H458DAAAB, &H858D50C0, &HFFFFFF3C, &H1B39E850, &H75FF0000, &HD0458D30, &HC0458D50, &H2C75FF50, &H5657E8, &H8DC03300, &HABABE07D, &H458AABAB, &HF07D8DE0, &HABABC033, &H458AABAB, &HD07D8DF0, &H6AABC033, &HABAB5350, &HD0458AAB, &H33C07D8D, &HABABABC0, &HC0458AAB, &HFF3C858D, &HE850FFFF, &H254C&, &HFF3C858A, &H346AFFFF, &H538C458D, &H253AE850, &H458A0000, &H18C4838C, &H8B5B5E5F
-    pvAppendBuffer &H2CC25DE5, &HEC8B5500, &H8B0C558B, &H8B56104D, &H68B0875, &H1890233, &H3304468B, &H41890442, &H8468B04, &H89084233, &H468B0841, &HC42330C, &H5E0C4189, &HCC25D, &H51EC8B55, &HC5D8B53, &H7D8B5756, &H45C76608, &H8BE100FC, &HD1C18B0F, &H1E183E8, &H578B0389, &HD1C28B04, &H1E283E8, &HB1FE1C1, &H1FE2C1C8, &H8B044B89, &HC68B0877, &HE683E8D1, &HC1D00B01, &H53891FE6, &HC4F8B08
-    pvAppendBuffer &HE8D1C18B, &HB01E183, &H73895FF0, &H44B60F0C, &HE0C1FC0D, &H5E033118, &H5DE58B5B, &H550008C2, &H8B56EC8B, &H56570875, &H394BE8, &HC7D8B00, &H468D0789, &H3DE85004, &H89000039, &H468D0447, &H31E85008, &H89000039, &H468D0847, &H25E8500C, &H89000039, &H5E5F0C47, &H8C25D, &H83EC8B55, &H575620EC, &HF633106A, &H56E0458D, &H243EE850, &H106A0000, &H8D0C75FF, &HE850F045, &H240B&
-    pvAppendBuffer &H83087D8B, &H100F18C4, &HC68BE04D, &H6A1FE083, &HC82B591F, &HF8C1C68B, &H87048B05, &H1A8E8D3, &H100F0C74, &HF66F045, &H110FC8EF, &H458DE04D, &HE85050F0, &HFFFFFF00, &H80FE8146, &H7C000000, &H8D106AC9, &HFF50E045, &HBCE81075, &H83000023, &H5E5F0CC4, &HC25DE58B, &H8B55000C, &H8458BEC, &H8B00100F, &HF660C45, &HF1BE870, &H280FD528, &H100FDD, &H6610458B, &H1BC8700F, &H66C5280F
-    pvAppendBuffer &HC1443A0F, &H3A0F6601, &H6610D144, &H66D0EF0F, &HD9443A0F, &H3A0F6600, &HF11E944, &HF66C228, &H6608DA73, &H8F8730F, &HEAEF0F66, &HD8EF0F66, &HFE5280F, &HF66C328, &H661FD472, &H1FD0720F, &HF3720F66, &HC8280F01, &HFC730F66, &H730F6604, &HF660CD8, &H6604F973, &H66CBEB0F, &H1F5720F, &H66D9280F, &H66E5EB0F, &H1FF3720F, &HE0EB0F66, &H66C1280F, &H1EF0720F, &HD8EF0F66, &H66C1280F
-    pvAppendBuffer &H19F0720F, &HD8EF0F66, &H66D3280F, &H4DB730F, &HFA730F66, &HEF0F660C, &HCA280FD1, &H66C2280F, &H2D1720F, &HD0720F66, &HEF0F6601, &HC2280FC8, &HD0720F66, &HEF0F6607, &HEF0F66C8, &HEF0F66CB, &HEF0F66CA, &H700F66CC, &H110F1BC1, &HCC25D00, &HEC8B5500, &HC758B56, &H87D8B57, &HE837FF56, &H52C1&, &H5004468D, &HE80477FF, &H52B5&, &H5008468D, &HE80877FF, &H52A9&, &H500C468D
-    pvAppendBuffer &HE80C77FF, &H529D&, &HC25D5E5F, &H8B550008, &H44EC83EC, &H8758B56, &HA8BE83, &H74000000, &HDEE85606, &H33000033, &H84B60FC9, &H880E&, &H8D448900, &HF98341BC, &H83EE7210, &H5600FC65, &H334BE8, &HBC458D00, &HF3E85650, &H8B000032, &HC9330C55, &H888E048A, &H83411104, &HF47210F9, &HAC68&, &H56006A00, &H2243E8, &H83068A00, &H8B5E0CC4, &H8C25DE5, &HEC8B5500, &H8758B56
-    pvAppendBuffer &HAC68&, &H56006A00, &H2223E8, &HC4D8B00, &HFCBA&, &HFF106A00, &HB60F1075, &H44468901, &H141B60F, &HF484689, &H890241B6, &HB60F4C46, &HE0830341, &H5046890F, &H441B60F, &H4689C223, &H41B60F54, &H58468905, &H641B60F, &HF5C4689, &H830741B6, &H46890FE0, &H41B60F60, &H89C22308, &HB60F6446, &H46890941, &H41B60F68, &H6C46890A, &HB41B60F, &H890FE083, &HB60F7046, &HC2230C41
-    pvAppendBuffer &HF744689, &H890D41B6, &HB60F7846, &H46890E41, &H41B60F7C, &H84A6830F, &H0&, &H890FE083, &H8086&, &H88868D00, &H50000000, &H215AE8, &H18C48300, &HCC25D5E, &HEC8B5500, &HFFCCD8E8, &HA7BEB9FF, &HE98100CA, &HCA4000, &H4D8BC103, &HFF505108, &H818D1075, &HA8&, &H6A0C75FF, &H818D5010, &H98&, &HED07E850, &HC25DFFFF, &H8B55000C, &HCEC83EC, &HE8575653, &HFFFFCC99
-    pvAppendBuffer &HBE084D8B, &HCAAE2C, &H815A406A, &HCA4000EE, &H8DF00300, &H418B6479, &H6AE2F760, &H8B070300, &H56515ADA, &HDA13F08B, &H8D58406A, &HE183084E, &H50C12B3F, &H80685252, &H6A000000, &H7D8B5740, &H20478D08, &HEC0EE850, &H458DFFFF, &HA40F50F4, &HC15303F3, &HE85603E6, &H50F0&, &H458D086A, &HE85750F4, &HC5&, &H560C758B, &HB2E837FF, &H8D000050, &HFF500446, &HA6E80477, &H8D000050
-    pvAppendBuffer &HFF500846, &H9AE80877, &H8D000050, &HFF500C46, &H8EE80C77, &H8D000050, &HFF501046, &H82E81077, &H8D000050, &HFF501446, &H76E81477, &H8D000050, &HFF501846, &H6AE81877, &H8D000050, &HFF501C46, &H5EE81C77, &H6A000050, &H57006A68, &H205FE8, &HCC48300, &H8B5B5E5F, &H8C25DE5, &HEC8B5500, &H8758B56, &H6A686A, &H2042E856, &HC4830000, &H6706C70C, &HC76A09E6, &HAE850446, &H46C7BB67
-    pvAppendBuffer &H6EF37208, &HC46C73C, &HA54FF53A, &H7F1046C7, &HC7510E52, &H688C1446, &H46C79B05, &H83D9AB18, &H1C46C71F, &H5BE0CD19, &H4C25D5E, &HEC8B5500, &HFFCB64E8, &HAE2CB9FF, &HE98100CA, &HCA4000, &H4D8BC103, &HFF505108, &H418D1075, &HC75FF64, &H8D50406A, &HE8502041, &HFFFFEB99, &HCC25D, &H83EC8B55, &H458D40EC, &H75FF50C0, &HA7E808, &H306A0000, &H50C0458D, &HE80C75FF, &H1F8B&
-    pvAppendBuffer &H8B0CC483, &H8C25DE5, &HEC8B5500, &H8758B56, &HC868&, &H56006A00, &H1F93E8, &HCC48300, &H9ED806C7, &H46C7C105, &HBB9D5D04, &H846C7CB, &H367CD507, &H2A0C46C7, &HC7629A29, &HDD171046, &H46C73070, &H59015A14, &H1846C791, &HF70E5939, &HD81C46C7, &HC7152FEC, &HB312046, &H46C7FFC0, &H33266724, &H2846C767, &H68581511, &H872C46C7, &HC78EB44A, &H8FA73046, &H46C764F9, &HC2E0D34
-    pvAppendBuffer &H3846C7DB, &HBEFA4FA4, &H1D3C46C7, &H5E47B548, &H4C25D, &H1B8E9, &HEC8B5500, &H458B5151, &H80B908, &H56530000, &HC4B08D57, &H8B000000, &HC080&, &H8BE1F700, &H3FA8BD8, &HD7831E, &HFFCA54E8, &H8558BFF, &HCAAFD2B9, &HE9815200, &HCA4000, &H4B8DC103, &HE1835010, &H80B87F, &HC12B0000, &H6A006A50, &H80B800, &H50500000, &H40428D56, &HE9DEE850, &H458DFFFF, &H6A50F8
-    pvAppendBuffer &HC5E8006A, &H6A00004E, &HF8458D08, &H875FF50, &H13CE8, &HF8458D00, &HDFA40F50, &HE3C15703, &HA5E85303, &H8B00004E, &H458D085D, &H50086AF8, &H11BE853, &H758B0000, &H73FF560C, &HE833FF04, &H4E88&, &H5008468D, &HFF0C73FF, &H79E80873, &H8D00004E, &HFF501046, &H73FF1473, &H4E6AE810, &H468D0000, &H73FF5018, &H1873FF1C, &H4E5BE8, &H20468D00, &H2473FF50, &HE82073FF, &H4E4C&
-    pvAppendBuffer &H5028468D, &HFF2C73FF, &H3DE82873, &H8D00004E, &HFF503046, &H73FF3473, &H4E2EE830, &H468D0000, &H73FF5038, &H3873FF3C, &H4E1FE8, &HC86800, &H6A0000, &H1DF6E853, &HC4830000, &H5B5E5F0C, &HC25DE58B, &H8B550008, &H758B56EC, &HC86808, &H6A0000, &H1DD6E856, &HC4830000, &H806C70C, &HC7F3BCC9, &HE6670446, &H46C76A09, &HCAA73B08, &HC46C784, &HBB67AE85, &H2B1046C7, &HC7FE94F8
-    pvAppendBuffer &HF3721446, &H46C73C6E, &H1D36F118, &H1C46C75F, &HA54FF53A, &HD12046C7, &HC7ADE682, &H527F2446, &H46C7510E, &H3E6C1F28, &H2C46C72B, &H9B05688C, &H6B3046C7, &HC7FB41BD, &HD9AB3446, &H46C71F83, &H7E217938, &H3C46C713, &H5BE0CD19, &H4C25D5E, &HEC8B5500, &HFFC8C0E8, &HAFD2B9FF, &HE98100CA, &HCA4000, &H4D8BC103, &HFF505108, &H818D1075, &HC4&, &H680C75FF, &H80&, &H40418D50
-    pvAppendBuffer &HE8EFE850, &HC25DFFFF, &H8B55000C, &HE85756EC, &HFFFFC872, &H8B087D8B, &H8D0C8D0F, &H4&, &H8B10FF51, &H8DF08B0F, &H48D0C, &H57510000, &H1CD5E856, &HC4830000, &H5FC68B0C, &H4C25D5E, &HEC8B5500, &H8758B56, &H8B0C75FF, &H8468D0E, &H476FF50, &H8B0451FF, &H4E8B2C56, &H5ED60330, &HC98504EB, &H80490874, &H1080A44, &HC25DF474, &H8B550008, &H84D8BEC, &H3940C033, &H830F7E01
-    pvAppendBuffer &H7500813C, &H810C8309, &H13B40FF, &HCFFF17C, &H4C25D81, &HEC8B5500, &H530C458B, &HDB335756, &H831A788D, &H458918C0, &H47B60F0C, &HC88B99FF, &H458BF28B, &HC6D830C, &HB60F08, &HC2A40F99, &HC1F20B08, &HC80B08E0, &HF07B60F, &H9908CEA4, &HC1F87F8D, &HF20B08E1, &HB60FC80B, &HA40F0947, &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0A47, &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0B47
-    pvAppendBuffer &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0C47, &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0D47, &HC19908CE, &HF20B08E1, &H458BC80B, &HD80C8908, &H4D87489, &H4FB8343, &HFF6B820F, &H5E5FFFFF, &H8C25D5B, &HEC8B5500, &H530C458B, &HDB335756, &H832A788D, &H458928C0, &H47B60F0C, &HC88B99FF, &H458BF28B, &HC6D830C, &HB60F08, &HC2A40F99, &HC1F20B08, &HC80B08E0, &HF07B60F, &H9908CEA4
-    pvAppendBuffer &HC1F87F8D, &HF20B08E1, &HB60FC80B, &HA40F0947, &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0A47, &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0B47, &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0C47, &HC19908CE, &HF20B08E1, &HB60FC80B, &HA40F0D47, &HC19908CE, &HF20B08E1, &H458BC80B, &HD80C8908, &H4D87489, &H6FB8343, &HFF6B820F, &H5E5FFFFF, &H8C25D5B, &HEC8B5500, &H8D60EC83, &H75FFE045
-    pvAppendBuffer &H8EE8500C, &H6AFFFFFE, &HE0458D04, &H3C0EE850, &HC0850000, &HC0330474, &H6A567FEB, &HE0458D04, &HC660E850, &H90BEFFFF, &H3000000, &H9EE850C6, &H8300003B, &H147401F8, &H47E8046A, &H3FFFFC6, &H458D50C6, &HE85050E0, &H4A13&, &H458D006A, &H2FE850E0, &H83FFFFC6, &H8D5050C0, &HE850A045, &HFFFFC9C6, &H50A0458D, &HFFC961E8, &H74C085FF, &HEBC03304, &H8758B23, &H51A04D8D, &HC6014E8D
-    pvAppendBuffer &HE8510406, &HD2&, &H51C04D8D, &H51214E8D, &HC5E8&, &H40C03300, &H5DE58B5E, &H550008C2, &HEC81EC8B, &H90&, &HFFD0458D, &HE8500C75, &HFFFFFE91, &H458D066A, &H61E850D0, &H8500003B, &H330774C0, &H8AE9C0, &H6A560000, &HD0458D06, &HC5B0E850, &H70BEFFFF, &H3000001, &HEEE850C6, &H8300003A, &H147401F8, &H97E8066A, &H3FFFFC5, &H458D50C6, &HE85050D0, &H4963&, &H458D006A
-    pvAppendBuffer &H7FE850D0, &H5FFFFC5, &H110&, &H70858D50, &H50FFFFFF, &HFFCABDE8, &H70858DFF, &H50FFFFFF, &HFFC8D7E8, &H74C085FF, &HEBC03304, &H8758B26, &HFF708D8D, &H8D51FFFF, &H6C6014E, &HAEE85104, &H8D000000, &H8D51A04D, &HE851314E, &HA1&, &H5E40C033, &HC25DE58B, &H8B550008, &H8458BEC, &H8B575653, &H488D0C7D, &H89F63318, &H588D084D, &HF7448A1A, &HB1018807, &HF7448A28, &HFF438806
-    pvAppendBuffer &H8BF7048B, &HE804F754, &HFFFFD2A4, &H20B10388, &H8BF7048B, &HE804F754, &HFFFFD294, &H8D014388, &HC8BF85B, &HF7448BF7, &HC1AC0F04, &H18E8C118, &H8B0A4B88, &H448BF70C, &HAC0F04F7, &HE8C110C1, &HB4B8810, &H8BF70C8B, &HF04F744, &HC108C1AC, &H4B8808E8, &HF7048A0C, &H84D8B46, &H8808E983, &H4D890D43, &H4FE8308, &H5E5F8772, &H8C25D5B, &HEC8B5500, &H5308458B, &H7D8B5756, &H28488D0C
-    pvAppendBuffer &H4D89F633, &H2A588D08, &H7F7448A, &H28B10188, &H6F7448A, &H8BFF4388, &H548BF704, &HDE804F7, &H88FFFFD2, &H8B20B103, &H548BF704, &HFDE804F7, &H88FFFFD1, &H5B8D0143, &HF70C8BF8, &H4F7448B, &H18C1AC0F, &H8818E8C1, &HC8B0A4B, &HF7448BF7, &HC1AC0F04, &H10E8C110, &H8B0B4B88, &H448BF70C, &HAC0F04F7, &HE8C108C1, &HC4B8808, &H46F7048A, &H83084D8B, &H438808E9, &H84D890D, &H7206FE83
-    pvAppendBuffer &H5B5E5F87, &H8C25D, &H83EC8B55, &H8B5320EC, &HC033085D, &HC758B56, &H59066A57, &H8DE44589, &H45C7E87D, &H3E0&, &H8DABF300, &H53500146, &HFFFBE0E8, &H43E80FF, &H468D0F75, &H438D5021, &HCEE85020, &HEBFFFFFB, &H53046A76, &H57207B8D, &H4346E8, &HE8046A00, &HFFFFC3AA, &H5010C083, &H50E0458D, &H5AE85757, &H6A000043, &H57575304, &H42F9E8, &HE8046A00, &HFFFFC38A, &H5010C083
-    pvAppendBuffer &HFFC381E8, &H30C083FF, &HE8575750, &H3D7E&, &H18A5E857, &H68A0000, &H1240F8B, &H83C0B60F, &H3B9901E1, &H330675C8, &H74C23BC0, &H57046A12, &HFFC351E8, &H10C083FF, &H20E85750, &H5F000047, &HE58B5B5E, &H8C25D, &H83EC8B55, &H8B5330EC, &HC033085D, &HC758B56, &H590A6A57, &H8DD44589, &H45C7D87D, &H3D0&, &H8DABF300, &H53500146, &HFFFBD0E8, &H43E80FF, &H468D0F75, &H438D5031
-    pvAppendBuffer &HBEE85030, &HEBFFFFFB, &H53066A7D, &H57307B8D, &H4286E8, &HE8066A00, &HFFFFC2EA, &HB005&, &H458D5000, &H575750D0, &H4298E8, &H53066A00, &H37E85757, &H6A000042, &HC2C8E806, &HB0BBFFFF, &H3000000, &HBBE850C3, &H5FFFFC2, &HE0&, &HE8575750, &H3CB6&, &H1871E857, &H68A0000, &H1240F8B, &H83C0B60F, &H3B9901E1, &H330675C8, &H74C23BC0, &H57066A11, &HFFC289E8, &H50C303FF
-    pvAppendBuffer &H4659E857, &H5E5F0000, &H5DE58B5B, &H550008C2, &HEC81EC8B, &HA0&, &HFF60858D, &H75FFFFFF, &H61E85008, &HFFFFFFFE, &H458D0C75, &H62E850E0, &H6AFFFFFA, &HE0458D00, &H60858D50, &H50FFFFFF, &H50A0458D, &HFFC5E1E8, &HA0458DFF, &H1075FF50, &HFFFD05E8, &HA0458DFF, &HC570E850, &HD8F7FFFF, &H8B40C01B, &HCC25DE5, &HEC8B5500, &HF0EC81, &H858D0000, &HFFFFFF10, &H500875FF, &HFFFEC7E8
-    pvAppendBuffer &HC75FFFF, &H50D0458D, &HFFFAB8E8, &H8D006AFF, &H8D50D045, &HFFFF1085, &H858D50FF, &HFFFFFF70, &HC730E850, &H858DFFFF, &HFFFFFF70, &H1075FF50, &HFFFD3CE8, &H70858DFF, &H50FFFFFF, &HFFC53BE8, &H1BD8F7FF, &HE58B40C0, &HCC25D, &H83EC8B55, &H458D40EC, &H75FF56C0, &HA9E85008, &H8BFFFFFD, &H458D0C75, &H468D50C0, &H406C601, &HFC68E850, &H458DFFFF, &H468D50E0, &H5BE85021, &H33FFFFFC
-    pvAppendBuffer &H8B5E40C0, &H8C25DE5, &HEC8B5500, &H8D60EC83, &HFF56A045, &HE8500875, &HFFFFFE2C, &H8D0C758B, &H8D50A045, &H6C60146, &HC2E85004, &H8DFFFFFC, &H8D50D045, &HE8503146, &HFFFFFCB5, &H5E40C033, &HC25DE58B, &H8B550008, &H80EC81EC, &H53000000, &H107D8B57, &H535B046A, &H36C2E857, &HC0850000, &HC0330774, &H115E9, &H57535600, &HFFC115E8, &H90BEFF, &HC6030000, &H3653E850, &HF8830000
-    pvAppendBuffer &H53107401, &HFFC0FDE8, &H50C603FF, &HCCE85757, &H6A000044, &HEBE85700, &H83FFFFC0, &H8D5050C0, &HE8508045, &HFFFFC482, &H80458D53, &HC0D4E850, &HC603FFFF, &H3617E850, &HF8830000, &H53137401, &HFFC0C1E8, &H50C603FF, &H5080458D, &H448DE850, &H8D530000, &HE8508045, &H3644&, &H774C085, &H96E9C033, &H8B000000, &H458D1475, &HE8565080, &HFFFFFB66, &H8D0875FF, &HE850C045, &HFFFFF895
-    pvAppendBuffer &HFFC081E8, &H9005FF, &H8D500000, &H8D50C045, &H8D508045, &HE850E045, &H3CE2&, &H8D0C75FF, &HE850C045, &HFFFFF86D, &HC058E853, &H9005FFFF, &H50000000, &H50E0458D, &H50C0458D, &H50E0458D, &H3A49E8, &H3BE85300, &HBBFFFFC0, &H90&, &H5750C303, &H3A73E857, &H27E80000, &H3FFFFC0, &HE04D8DC3, &H51515750, &H3C91E8, &HE04D8D00, &H204E8D51, &HFAE0E851, &HC033FFFF, &H5B5F5E40
-    pvAppendBuffer &HC25DE58B, &H8B550010, &HC0EC81EC, &H53000000, &H107D8B57, &H535B066A, &H3582E857, &HC0850000, &HC0330774, &H129E9, &H57535600, &HFFBFD5E8, &H170BEFF, &HC6030000, &H3513E850, &HF8830000, &H53107401, &HFFBFBDE8, &H50C603FF, &H8CE85757, &H6A000043, &HABE85700, &H5FFFFBF, &H110&, &H40858D50, &H50FFFFFF, &HFFC4E9E8, &H858D53FF, &HFFFFFF40, &HBF8CE850, &HC603FFFF, &H34CFE850
-    pvAppendBuffer &HF8830000, &H53167401, &HFFBF79E8, &H50C603FF, &HFF40858D, &H5050FFFF, &H4342E8, &H858D5300, &HFFFFFF40, &H34F6E850, &HC0850000, &HC0330774, &H9CE9&, &H14758B00, &HFF40858D, &H5650FFFF, &HFFFAACE8, &H875FFFF, &H50A0458D, &HFFF7F4E8, &HBF30E8FF, &H7005FFFF, &H50000001, &H50A0458D, &HFF40858D, &H8D50FFFF, &HE850D045, &H3CF5&, &H8D0C75FF, &HE850A045, &HFFFFF7C9, &HBF04E853
-    pvAppendBuffer &H7005FFFF, &H50000001, &H50D0458D, &H50A0458D, &H50D0458D, &H38F5E8, &HE7E85300, &HBBFFFFBE, &H170&, &H5750C303, &H391FE857, &HD3E80000, &H3FFFFBE, &HD04D8DC3, &H51515750, &H3CA4E8, &HD04D8D00, &H304E8D51, &HFA23E851, &HC033FFFF, &H5B5F5E40, &HC25DE58B, &H8B550010, &HB0EC81EC, &H8D000001, &HFFFE5085, &HFF5653FF, &HE8500875, &HFFFFFA94, &H8D10758B, &HFFFF3085, &HE85056FF
-    pvAppendBuffer &HFFFFF691, &H5020468D, &H5090458D, &HFFF684E8, &H5E046AFF, &H30858D56, &H50FFFFFF, &H33FFE8, &HFC08500, &H37485, &H458D5600, &HEDE85090, &H85000033, &H62850FC0, &H56000003, &HFF30858D, &HE850FFFF, &HFFFFBE3E, &H90BB&, &H50C30300, &H337CE8, &H1F88300, &H33F850F, &H8D560000, &HE8509045, &HFFFFBE1E, &HE850C303, &H3361&, &HF01F883, &H32485, &HE8565700, &HFFFFBE06
-    pvAppendBuffer &H8D50C303, &H8D509045, &HE850E045, &H383D&, &H8D0C75FF, &HFFFF5085, &HF6E850FF, &HE8FFFFF5, &HFFFFBDE2, &H8D50C303, &H8D50E045, &HFFFF5085, &HE85050FF, &H3A46&, &HFFBDC9E8, &H50C303FF, &H50E0458D, &HFF30858D, &H8D50FFFF, &HFFFF1085, &H27E850FF, &H5600003A, &HFE50858D, &H8D50FFFF, &HFFFEB085, &H96E850FF, &H5600003F, &HFE70858D, &H8D50FFFF, &HFFFED085, &H82E850FF, &H5600003F
-    pvAppendBuffer &HFFBD81E8, &H50C083FF, &H70858D50, &H50FFFFFF, &H3F6CE8, &H6BE85600, &H83FFFFBD, &H8D5070C0, &HE8509045, &H3F59&, &HBD58E856, &HC083FFFF, &H858D5010, &HFFFFFF70, &HB0858D50, &H50FFFFFE, &H50E0458D, &H3CFCE8, &HD0858D00, &H50FFFFFE, &HFEB0858D, &H8D50FFFF, &H8D509045, &HFFFF7085, &H2CE850FF, &H56FFFFC4, &HFFBD19E8, &H10C083FF, &HE0458D50, &H52E85050, &H8D000037, &H8D50E045
-    pvAppendBuffer &HFFFED085, &H858D50FF, &HFFFFFEB0, &HCC7AE850, &H6583FFFF, &HEBE800D0, &H83FFFFBC, &H458950C0, &H50858DD4, &H89FFFFFE, &H858DD845, &HFFFFFEB0, &H8DDC4589, &HFFFF1085, &HE85056FF, &H3E0A&, &H858DD88B, &HFFFFFF50, &HFBE85056, &H3B00003D, &HD8470FC3, &HFF50858D, &H738DFFFF, &HE85056FF, &H410A&, &H574C20B, &HEB47FF33, &H56FF3302, &HFF10858D, &HE850FFFF, &H40F2&, &H574C20B
-    pvAppendBuffer &HEB5E026A, &HBF63302, &HB0458DF7, &H748B046A, &H5056D0B5, &H3E68E8, &H8D046A00, &H8D502046, &HFFFEF085, &H56E850FF, &H6A00003E, &HE0458D04, &H316EE850, &H65830000, &H738D00E4, &HE045C7FE, &H1&, &H880FF685, &HDD&, &H50E0458D, &HFEF0858D, &H8D50FFFF, &HE850B045, &HFFFFBC4A, &H50858D56, &H50FFFFFF, &H4081E8, &H74C20B00, &H47FF3305, &HFF3302EB, &H10858D56, &H50FFFFFF
-    pvAppendBuffer &H4069E8, &H74C20B00, &H58026A05, &HC03302EB, &H7C8BF80B, &HFF85D0BD, &H82840F, &H46A0000, &H70858D57, &H50FFFFFF, &H3DD4E8, &H8D046A00, &H8D502047, &HE8509045, &H3DC5&, &H50E0458D, &H5090458D, &HFF70858D, &HE850FFFF, &HFFFFCB3C, &HAFE8046A, &H83FFFFBB, &H8D5010C0, &HFFFF7085, &H458D50FF, &H858D50B0, &HFFFFFE90, &H3B53E850, &H858D0000, &HFFFFFEF0, &HB0458D50, &H90458D50
-    pvAppendBuffer &H70858D50, &H50FFFFFF, &HFFC286E8, &H8D046AFF, &HFFFE9085, &H458D50FF, &HE85050E0, &H3ACE&, &HF01EE83, &HFFFF2389, &HE8046AFF, &HFFFFBB56, &H5010C083, &H50E0458D, &H358FE850, &H458D0000, &H858D50E0, &HFFFFFEF0, &HB0458D50, &HCABAE850, &H46AFFFF, &H50B0458D, &HFFBB29E8, &H90BEFF, &HC6030000, &H3067E850, &H835F0000, &H147401F8, &HFE8046A, &H3FFFFBB, &H458D50C6, &HE85050B0
-    pvAppendBuffer &H3EDB&, &H858D046A, &HFFFFFF30, &HB0458D50, &H303BE850, &HD8F70000, &HEB40C01B, &H5EC03302, &H5DE58B5B, &H55000CC2, &HEC81EC8B, &H280&, &HFD80858D, &H5653FFFF, &H875FF57, &HF786E850, &H758BFFFF, &HD0858D10, &H56FFFFFE, &HF373E850, &H468DFFFF, &H858D5030, &HFFFFFF60, &HF363E850, &H66AFFFF, &H858D575F, &HFFFFFED0, &H302EE850, &HC0850000, &H392850F, &H8D570000, &HFFFF6085
-    pvAppendBuffer &H19E850FF, &H85000030, &H7D850FC0, &H57000003, &HFED0858D, &HE850FFFF, &HFFFFBA6A, &H170BB, &H50C30300, &H2FA8E8, &H1F88300, &H35A850F, &H8D570000, &HFFFF6085, &H47E850FF, &H3FFFFBA, &H8AE850C3, &H8300002F, &H850F01F8, &H33C&, &HBA30E857, &HC303FFFF, &H60858D50, &H50FFFFFF, &H50C0458D, &H3464E8, &HC75FF00, &HFF00858D, &HE850FFFF, &HFFFFF2CD, &HFFBA09E8, &H50C303FF
-    pvAppendBuffer &H50C0458D, &HFF00858D, &H5050FFFF, &H37D4E8, &HB9F0E800, &HC303FFFF, &HC0458D50, &HD0858D50, &H50FFFFFE, &HFEA0858D, &HE850FFFF, &H37B5&, &H80858D57, &H50FFFFFD, &HFE10858D, &HE850FFFF, &H3BBD&, &HB0858D57, &H50FFFFFD, &HFE40858D, &HE850FFFF, &H3BA9&, &HB9A8E857, &H738DFFFF, &H50C603A0, &HFF30858D, &HE850FFFF, &H3B91&, &HB990E857, &H4005FFFF, &H50000001, &HFF60858D
-    pvAppendBuffer &HE850FFFF, &H3B79&, &HB978E857, &H5E8DFFFF, &H50C303A0, &HFF30858D, &H8D50FFFF, &HFFFE1085, &H458D50FF, &H1AE850C0, &H8D000039, &HFFFE4085, &H858D50FF, &HFFFFFE10, &H60858D50, &H50FFFFFF, &HFF30858D, &HE850FFFF, &HFFFFC157, &HB934E857, &HC303FFFF, &HC0458D50, &H6EE85050, &H8D000033, &H8D50C045, &HFFFE4085, &H858D50FF, &HFFFFFE10, &HC8E1E850, &H6583FFFF, &H7E800F0, &H3FFFFB9
-    pvAppendBuffer &HF44589C6, &HFD80858D, &H4589FFFF, &H10858DF8, &H89FFFFFE, &H858DFC45, &HFFFFFEA0, &H27E85057, &H8B00003A, &H858DD8, &H57FFFFFF, &H3A18E850, &HC33B0000, &H8DD8470F, &HFFFF0085, &HFF738DFF, &H27E85056, &HB00003D, &H330574C2, &H2EB47FF, &H8D56FF33, &HFFFEA085, &HFE850FF, &HB00003D, &H6A0574C2, &H2EB5E02, &HF70BF633, &H6A90458D, &HB5748B06, &HE85056F0, &H3A85&, &H468D066A
-    pvAppendBuffer &H858D5030, &HFFFFFE70, &H3A73E850, &H66A0000, &H50C0458D, &H2D8BE8, &HC4658300, &HFE738D00, &H1C045C7, &H85000000, &HE8880FF6, &H8D000000, &H8D50C045, &HFFFE7085, &H458D50FF, &HEFE85090, &H56FFFFB9, &HFF00858D, &HE850FFFF, &H3C9E&, &H574C20B, &HEB47FF33, &H56FF3302, &HFEA0858D, &HE850FFFF, &H3C86&, &H574C20B, &HEB58026A, &HBC03302, &HBD7C8BF8, &HFFF85F0, &H8D84&
-    pvAppendBuffer &H57066A00, &HFF30858D, &HE850FFFF, &H39F1&, &H478D066A, &H858D5030, &HFFFFFF60, &H39DFE850, &H458D0000, &H858D50C0, &HFFFFFF60, &H30858D50, &H50FFFFFF, &HFFC79EE8, &HE8066AFF, &HFFFFB7C6, &HB005&, &H858D5000, &HFFFFFF30, &H90458D50, &HE0858D50, &H50FFFFFD, &H3768E8, &H70858D00, &H50FFFFFE, &H5090458D, &HFF60858D, &H8D50FFFF, &HFFFF3085, &HA8E850FF, &H6AFFFFBF, &HE0858D06
-    pvAppendBuffer &H50FFFFFD, &H50C0458D, &H36E0E850, &HEE830000, &H18890F01, &H6AFFFFFF, &HB768E806, &HB005FFFF, &H50000000, &H50C0458D, &H319FE850, &H458D0000, &H858D50C0, &HFFFFFE70, &H90458D50, &HC715E850, &H66AFFFF, &H5090458D, &HFFB739E8, &H170BEFF, &HC6030000, &H2C77E850, &HF8830000, &H6A147401, &HB720E806, &HC603FFFF, &H90458D50, &HECE85050, &H6A00003A, &HD0858D06, &H50FFFFFE, &H5090458D
-    pvAppendBuffer &H2C4CE8, &H1BD8F700, &H2EB40C0, &H5E5FC033, &H5DE58B5B, &H55000CC2, &H8B56EC8B, &H68B0875, &H485048D, &H50000000, &H2A05E856, &HD3E80000, &H56FFFFB6, &H5E0850FF, &H4C25D, &H8BEC8B55, &HC18B084D, &H8107E8C1, &H7F7F7FE1, &H10125FF, &HC9030101, &H331BC06B, &H4C25DC1, &HEC8B5500, &HFFB6B4E8, &H8A98B9FF, &HE98100CA, &HCA4000, &H4D8BC103, &HFF505108, &H418D1075, &HC75FF30
-    pvAppendBuffer &H8D50106A, &HE8502041, &HFFFFD6E9, &HCC25D, &H8BEC8B55, &H458B084D, &H75FF5010, &H3841010C, &H3C518351, &HFFB3E800, &HC25DFFFF, &H8B55000C, &H758B56EC, &H487E8308, &H560D7501, &H20E8&, &H4846C700, &H2&, &H110458B, &HFF504046, &H56830C75, &HE8560044, &HFFFFFF81, &HCC25D5E, &HEC8B5500, &H8758B56, &H85304E8B, &H6A2474C9, &HC12B5810, &H20468D50, &H6AC103, &HAAEE850
-    pvAppendBuffer &HC4830000, &H20468D0C, &H9E85650, &H83000000, &H5E003066, &H4C25D, &H83EC8B55, &H458D10EC, &H505756F0, &HE80C75FF, &HFFFFE5F3, &H8D087D8B, &H778DF045, &H50565610, &HFFE548E8, &H565756FF, &H5F4C57FF, &H5DE58B5E, &H550008C2, &H5151EC8B, &H8758B56, &H1487E83, &H7E830674, &HA750248, &HFF7BE856, &H6683FFFF, &H4E8B0048, &HF8458D38, &H3C468B50, &H3C8A40F, &H5003E1C1, &H3A4AE851
-    pvAppendBuffer &H86A0000, &H50F8458D, &HFECFE856, &H4E8BFFFF, &HF8458D40, &H44468B50, &H3C8A40F, &H5003E1C1, &H3A26E851, &H86A0000, &H50F8458D, &HFEABE856, &H75FFFFFF, &H10468D0C, &HE713E850, &H8B5EFFFF, &H8C25DE5, &HEC8B5500, &H5310EC83, &H7D8B5756, &H6A506A08, &HD5E85700, &H83000009, &HFF570CC4, &H38E80C75, &H33FFFFE5, &H40C933C0, &H48478953, &HF38BA20F, &HF05D8D5B, &H73890389, &H84B8904
-    pvAppendBuffer &HE80C5389, &HFFFFB511, &H2F845F6, &HCA715AB9, &HB9057500, &HCA70DC, &H4000E981, &HC10300CA, &H5F4C4789, &HE58B5B5E, &H8C25D, &H8BEC8B55, &H33561455, &H1EA83F6, &H458B3078, &H5D8B530C, &HD82B5708, &H29903C8D, &HC8B1045, &H3C0333B, &H3C013CE, &HD0830F, &H8B01EA83, &H10458BF0, &H8D380C89, &HE279FC7F, &HC68B5B5F, &H10C25D5E, &HEC8B5500, &H758B5653, &H99C68B10, &H571FE283
-    pvAppendBuffer &HC1023C8D, &HE68105FF, &H8000001F, &H834E0579, &H8B46E0CE, &HDE8B0C55, &H2B59206A, &HD3C28BCE, &H8BDBF7E8, &HD3DB1BCE, &H33D823E2, &H105D89C9, &H8B085D8B, &H54011075, &HC91304BB, &H475F685, &H2C74C985, &H8BB448B, &HC103D233, &HC603D213, &H8BB4489, &H8300D283, &HD28503C7, &H348D1274, &H1C033BB, &H4768D16, &HD08BC013, &HF175D285, &H5D5B5E5F, &H55000CC2, &HEC83EC8B, &H14558B38
-    pvAppendBuffer &HC5D8B53, &H5756C38B, &HC22BFF33, &HFEC4589, &H21688, &HEC558B00, &H458BC88B, &H5E1C108, &H8BFC4D89, &HF685B834, &H83470C75, &H4D8920E9, &H1E7E9FC, &HE8560000, &HFFFFCA2D, &HCA8BD08B, &HD3D05589, &H7ED285E6, &H1478D17, &H107DC33B, &H6A08458B, &HCA2B5920, &H4B8548B, &HF20BEAD3, &H8B205D8B, &H1C65F7C6, &H83FC458B, &H452BE1C3, &H3F28BD0, &HF07589D8, &H79F45D89, &HE0FB831F
-    pvAppendBuffer &H19F8E0F, &HDBF70000, &HDB33CB8B, &H7589EED3, &HF45D89F0, &H840FF685, &H189&, &H1F25C38B, &H79800000, &HC8834805, &H4D8B40E0, &HD845890C, &H8399C38B, &HC2031FE2, &HC114558B, &HC82B05F8, &H2BD8458B, &HFC085CA, &H8985&, &HD8452100, &H89CA034A, &H4D89E855, &HC0570FE4, &H45130F66, &HF045C7C8, &H1&, &H8C0FCF3B, &H111&, &H8B08458B, &H48D105D, &HC84D8B88, &H8BF84589
-    pvAppendBuffer &H4589CC45, &H79D285E0, &HEBC03304, &H93048B03, &HC103E6F7, &H5513D0F7, &H89C933E0, &H558BD055, &H130203F8, &HF04503C9, &H4D130289, &HE8558BD8, &H4F86D83, &HE065834A, &HD8658300, &HF04D8900, &H49E44D8B, &H89E85589, &HCF3BE44D, &H7DD04D8B, &HA8E9B4, &H65830000, &H34A00E8, &HD45589CA, &H3BD04D89, &H968C0FCF, &H6A000000, &HD82B5B20, &H1E445C7, &H8B000000, &H570F0845, &H130F66C0
-    pvAppendBuffer &H5D89DC45, &HD85D8BCC, &H8B88048D, &H4589E04D, &HDC458BF8, &H85E04589, &H330479D2, &H8B06EBC0, &H48B1045, &H8BE6F790, &HE07503F0, &HCB8BD113, &H33E05589, &HD3D68BC0, &HE8550BE2, &HF7F84D8B, &H131103D2, &HE45503C0, &H8300D083, &H8900D865, &HC18BE445, &H89CC4D8B, &H8BD68B10, &HE883F075, &H8BEAD304, &H5589D04D, &HD4558BE8, &HF845894A, &HD4558949, &H3BD04D89, &HD84D8BCF, &H5D8B997D
-    pvAppendBuffer &H187D83F4, &H530A7400, &H1875FF56, &HFFFD60E8, &HEC558BFF, &H8BFC4D8B, &H5D8B0845, &HFFA3B0C, &HFFFDFE8E, &HC5D8BFF, &H8B14558B, &HC933087D, &H247EDB85, &H2B10458B, &H90348DD3, &H850A048D, &H330479C0, &H8B02EBC0, &H8F043906, &H8776772, &H4C68341, &HE47CCB3B, &HC6583, &HC7FF538D, &H10845, &HD2850000, &H458B3978, &H2BF28B10, &H147503F3, &H85B01C8D, &H330479F6, &H8B02EBC9
-    pvAppendBuffer &HF7C0330B, &H970C03D1, &H4D03C013, &H970C8908, &H4E0C4513, &HC6583, &H8304EB83, &H458901EA, &H83D47908, &H7400187D, &H6A006A0C, &H1875FF01, &HFFFCBCE8, &H5B5E5FFF, &HC25DE58B, &H8B55001C, &H28EC83EC, &H145D8B53, &HFB835756, &HB88E0F32, &H8B000001, &HC38B1875, &H8BC22B99, &H56C38BF8, &HFF57FFD1, &HC72B1075, &HFFF07D89, &H45890C75, &H875FFFC, &HFFFFC5E8, &H10458BFF, &HFC758B56
-    pvAppendBuffer &HF8148D56, &H520C458B, &H8DD85589, &H458BB80C, &H4D895108, &HB8048DDC, &HE4458950, &HFFFF9DE8, &H184D8BFF, &H3301468D, &H8D046AF6, &H7A8D8114, &H89328904, &H518DF455, &H89378904, &H3289EC55, &H89F0558B, &H3189E07D, &H7ED2855F, &H2BC00346, &H81048DC2, &H8BE84589, &H2B40FC45, &H81048DC2, &H890C4D8B, &H458BF845, &H89C12B08, &H558B0C55, &H84589E8, &H8BF85D8B, &H7D010804, &H8B0389F8
-    pvAppendBuffer &H8BCF0301, &H289145D, &H6D83D703, &H458B010C, &HFFE17508, &H458BFC75, &H75FF50EC, &H89E850E4, &H8BFFFFFB, &H75FF184D, &H8B0189FC, &HFF50E045, &HE850DC75, &HFFFFFB74, &H8BF44D8B, &H8942FC55, &H184D8B01, &H89D1048D, &HC28B0C45, &H304E0C1, &HFF5250C1, &H75FF0C75, &HDFE851F4, &H8BFFFFFE, &H558B184D, &H8418DF0, &H890C7189, &H3089DC45, &H8912048D, &H31890471, &H85084589, &H8B1E7EC0
-    pvAppendBuffer &H5D8BFC45, &HC22B4010, &H8D08558B, &H48BC10C, &H18946B3, &HF23BCF03, &H5D8BF47C, &HFC758B14, &H5036048D, &H50DC458B, &H50D875FF, &HFFFAFBE8, &HEC4D8BFF, &H468D0189, &H184D8B01, &H8B00348D, &H50560C45, &H3E85051, &H8B000002, &H8D56FC4D, &HD82B0141, &H310458B, &H8DD92BDB, &HFF509804, &HE8500C75, &HFFFFFAC4, &HF685F08B, &H87840F, &H558B0000, &HFCC28310, &H339A148D, &H133201C0
-    pvAppendBuffer &H8BD72BC0, &H75F685F0, &H8B6EEBF2, &HC8D1055, &H7EC9851B, &H8BC03306, &H8BABF3FA, &HC8D0845, &H76C83B98, &HC758B54, &H83DA148D, &H46AFCC2, &H8D105589, &H75899E34, &H65835F14, &HCF2B0018, &H753BDA8B, &H8B21760C, &HF7F72B01, &H18450326, &H100D283, &HD28303, &H5589DF2B, &HC753B18, &H458BE577, &H10558B08, &H2B18758B, &H8B3389D7, &H55891475, &H77C83B10, &H5B5E5FC1, &HC25DE58B
-    pvAppendBuffer &H8B550014, &H10EC83EC, &H145D8B53, &HFB835756, &HA48E0F32, &H8B000000, &HC38B0C7D, &H9908758B, &HD38BC22B, &H458BC88B, &H2BF9D118, &HFC4D89D1, &H8DF85589, &H5253D81C, &H50C8048D, &H508F048D, &H508E048D, &HFFFD75E8, &HFC4D8BFF, &H5318458B, &H88048D51, &HF8458B50, &H5087048D, &HFFA0E856, &HFF53FFFF, &H5D8BFC75, &H8B575318, &H48DF87D, &H8BE850BE, &H8BFFFFFF, &HFF85FC75, &H458B1B7E
-    pvAppendBuffer &HB00C8D10, &H8D77048D, &H28B8314, &H8904528D, &H4498D01, &H7501EF83, &H8D5356F1, &H5350B304, &HFFF987E8, &H14458BFF, &H1075FF56, &H5083048D, &HF976E853, &H8AE9FFFF, &H85000000, &H8B097EDB, &HCB8B107D, &HABF3C033, &H8B08458B, &HC8D107D, &H9F348D98, &H3B147589, &H8B6A76C8, &H48D0C45, &H85D8B98, &H89FCC083, &HE983FC45, &HC758904, &HFF84589, &HF66C057, &H3BF04513, &H8B3C76F7
-    pvAppendBuffer &HDE8BF445, &H89F8758B, &H458B1845, &H104589F0, &HEB83068B, &H8D21F704, &H303FC76, &H300D283, &H3891045, &H83185513, &H89001865, &HDF3B1055, &H758BDE77, &H85D8B14, &H83FC458B, &H758904EE, &H77CB3B14, &H5B5E5FA5, &HC25DE58B, &H8B550014, &H558B51EC, &HFC658314, &H1EA8300, &H11445C7, &H78000000, &H8458B39, &H758B5653, &H7D8B570C, &H901C8D10, &HF82BF02B, &H331E0C8B, &H3D1F7C0
-    pvAppendBuffer &H3C0130B, &HC89144D, &HFC5B8D1F, &H83FC4513, &H8300FC65, &H458901EA, &H5FDD7914, &HE58B5B5E, &H10C25D, &H81EC8B55, &H80EC&, &H758B5600, &H206A570C, &H807D8D59, &HFDBEA5F3, &H8D000000, &H50508045, &H2088E8, &H2FE8300, &HFE831274, &HFF0D7404, &H458D0C75, &HE8505080, &HE83&, &H7901EE83, &H87D8BDA, &H6A80758D, &HA5F35920, &HE58B5E5F, &H8C25D, &H53EC8B55, &H75FF5756
-    pvAppendBuffer &HF636E808, &HD88BFFFF, &HF62EE853, &HD08BFFFF, &HF626E852, &HF88BFFFF, &H8B087D33, &H33C78BF7, &H8CFC1C3, &HC0C1F233, &HC1CE8B08, &HC13310C9, &HC633C733, &H33C3335F, &H5B5E0845, &H4C25D, &H56EC8B55, &HFF08758B, &HFFAAE836, &H76FFFFFF, &HE8068904, &HFFFFFFA0, &H890876FF, &H95E80446, &HFFFFFFFF, &H46890C76, &HFF8AE808, &H4689FFFF, &HC25D5E0C, &H8B550004, &H5D8B53EC, &HF575608
-    pvAppendBuffer &HF077BB6, &HF0243B6, &HF0B73B6, &HC10F53B6, &HF80B08E7, &H34BB60F, &HD43B60F, &HB08E7C1, &H8E6C1F8, &H843B60F, &HB08E7C1, &H8E2C1F8, &H643B60F, &HE1C1F00B, &H43B60F08, &H8E6C101, &HB60FF00B, &HE6C10C43, &HFF00B08, &HB0A43B6, &H43B60FD0, &H8E2C105, &HB60FD00B, &H8E2C103, &HB60FD00B, &HC80B0E43, &HF0C5389, &HC10943B6, &HC80B08E1, &HF087389, &H890443B6, &HE1C1047B
-    pvAppendBuffer &HC80B5F08, &H5B0B895E, &H4C25D, &H56EC8B55, &HABF0E857, &H758BFFFF, &H693BF08, &HC7030000, &HE836FF50, &H1FD3&, &HD7E80689, &H3FFFFAB, &H76FF50C7, &H1FC1E804, &H46890000, &HABC4E804, &HC703FFFF, &H876FF50, &H1FAEE8, &H8468900, &HFFABB1E8, &H50C703FF, &HE80C76FF, &H1F9B&, &HC46895F, &H4C25D5E, &HEC8B5500, &HC7D83, &HFF561574, &H758B0C75, &H56006A08, &H2FE8&
-    pvAppendBuffer &H83068A00, &H5D5E0CC4, &H550008C2, &H558BEC8B, &H8458B10, &H85F08B56, &H571274D2, &H2B0C7D8B, &H370C8AF8, &H83460E88, &HF57501EA, &HC35D5E5F, &H8BEC8B55, &HC985104D, &HB60F1F74, &H8B560C45, &H1C069F1, &H57010101, &HC1087D8B, &HABF302E9, &HE183CE8B, &H5FAAF303, &H8458B5E, &H8B55C35D, &H758B56EC, &H51E85608, &H8BFFFFF4, &H33CE8BD0, &H10C9C1D6, &HC108C2C1, &HD13308CE, &HC233D633
-    pvAppendBuffer &H4C25D5E, &HEC8B5500, &H8758B56, &HCBE836FF, &HFFFFFFFF, &H6890476, &HFFFFC1E8, &H876FFFF, &HE8044689, &HFFFFFFB6, &H890C76FF, &HABE80846, &H89FFFFFF, &H5D5E0C46, &H550004C2, &HEC83EC8B, &HC4658340, &H21C03300, &H5653E445, &H59066A57, &H7D8DDB33, &H43066AC8, &HF3C05D89, &H46A59AB, &H89E87D8D, &HABF3E05D, &H458D575F, &H93E850C0, &H83FFFFAA, &H8D5010C0, &HE850C045, &H1F0D&
-    pvAppendBuffer &HC0458D57, &H2BC0E850, &H708D0000, &H8D26EBFF, &HE850E045, &H2A03&, &HC0458D56, &H2ECCE850, &HC20B0000, &HFF570E74, &H458D0875, &HE85050E0, &H29BA&, &HE0458D4E, &HF33B5057, &H75FFD177, &H2C3BE808, &H5E5F0000, &H5DE58B5B, &H550004C2, &HEC83EC8B, &HA4658360, &H21C03300, &H5653D445, &H590A6A57, &H7D8DDB33, &H430A6AA8, &HF3A05D89, &H66A59AB, &H89D87D8D, &HABF3D05D, &H458D575F
-    pvAppendBuffer &HFFE850A0, &H5FFFFA9, &HB0&, &HA0458D50, &H1E77E850, &H8D570000, &HE850A045, &H2B2A&, &HEBFF708D, &HD0458D26, &H296DE850, &H8D560000, &HE850A045, &H2E36&, &HE74C20B, &H875FF57, &H50D0458D, &H2924E850, &H8D4E0000, &H5057D045, &HD177F33B, &HE80875FF, &H2BA5&, &H8B5B5E5F, &H4C25DE5, &HEC8B5500, &H5310EC83, &H75FF5756, &HE114E80C, &H75FFFFFF, &HFC458908, &HFFE109E8
-    pvAppendBuffer &HE8F08BFF, &HFFFFA97E, &H79405, &HF7E85000, &H89FFFFE0, &H6BE80845, &H5FFFFA9, &H798&, &HE0E4E850, &HFF33FFFF, &H8947D88B, &H53E8F07D, &HE9FFFFA9, &HA6&, &HFFA949E8, &H79405FF, &H56500000, &HFFBDA0E8, &HFC085FF, &H10B84, &HE836FF00, &HC23&, &H8BF84589, &H30FFFC45, &HC16E8, &H45895000, &HF8458BF4, &H75FF5650, &HB9F6E8FC, &H4D8BFFFF, &H763939F8, &H83018B0F
-    pvAppendBuffer &H7500813C, &H1894807, &HF177C73B, &H39F44D8B, &H8B0F7639, &H813C8301, &H48077500, &HC73B0189, &H75FFF177, &HF1EDE8FC, &H458BFFFF, &HFC7589F8, &H5608758B, &HF475FF53, &H89F84589, &H2EE8085D, &HF7FFFFBB, &HD88BF05D, &HF1C9E856, &H75FFFFFF, &HF1C1E8F4, &HABE8FFFF, &H8BFFFFA8, &H9805F875, &H50000007, &HBCFFE856, &HC085FFFF, &HFF46850F, &HE856FFFF, &HFFFFF19F, &HE8FC75FF, &HFFFFF197
-    pvAppendBuffer &HE80875FF, &HFFFFF18F, &HF07D83, &HB58D0F, &H458B0000, &HE830FF0C, &HB5F&, &H7D89F08B, &H89C933FC, &H3E39F875, &H8F8C0F, &H458B0000, &H4568D0C, &H8BF04589, &HF05D29C7, &H29085D89, &H758B0875, &H8B063B0C, &H307F0875, &H3F0458B, &H10048BC6, &H8BF44589, &H24EBFC45, &HF135E856, &H75FFFFFF, &HF12DE8FC, &H75FFFFFF, &HF125E808, &HE853FFFF, &HFFFFF11F, &H4DEBC033, &HF46583
-    pvAppendBuffer &H57F033B, &HEB16048B, &H8BC03302, &HF02BF475, &HF12BD0F7, &HC9853289, &HF03B0774, &HEB41C91B, &H1BC63B06, &H8BD9F7C9, &HF685FC45, &HFF8758B, &H8340F845, &H458904C2, &H7E063BFC, &H3E895385, &HFFF0D2E8, &H8BDE8BFF, &H5B5E5FC3, &HC25DE58B, &H8B550008, &H20EC83EC, &H758B5653, &H1E8B5710, &HE7C1FB8B, &HE47D8902, &HFFA799E8, &H10FF57FF, &HC933D08B, &H85105589, &H8B0F7EDB, &H8BC12B06
-    pvAppendBuffer &H4898604, &HCB3B418A, &H7D8BF17C, &HC558B08, &H78BCA8B, &H470F023B, &H8D318BCF, &HC33B3604, &HC38B0A7F, &H8BC22B99, &H46FED1F0, &HE0C1C68B, &HE0458902, &HFFA74DE8, &HC1CE8BFF, &HFF5102E1, &H89D68B10, &H172BFC45, &HC7ED285, &H8BFC7D8B, &HF3C033CA, &H87D8BAB, &HC933078B, &H1A7EC085, &H8DFC7D8B, &H7D8B9714, &H41C12B08, &H8987048B, &H4528D02, &HC83B078B, &H7E8EF7C, &H8BFFFFA7
-    pvAppendBuffer &H2E1C1CE, &H8B10FF51, &HCE8B0C55, &H7D89F88B, &H890A2BF8, &HC985084D, &HC033077E, &H4D8BABF3, &H33028B08, &H7EC085FF, &HF8558B1A, &H8B8A0C8D, &HC72B0C55, &H82048B47, &H498D0189, &H3B028B04, &H8BEF7CF8, &H3E7C1FE, &HE8E87D89, &HFFFFA6B6, &H5610FF57, &HE8084589, &H97B&, &HE7C1F88B, &HEC7D8902, &HFFA69DE8, &H10FF57FF, &H89107D8B, &H3F8B0C45, &HBCEFE857, &H4589FFFF, &H74C085F4
-    pvAppendBuffer &HD3C88B18, &H1FB83E7, &H206A0F7E, &H8BC82B59, &H408B1045, &HBE8D304, &HC75FFF8, &H875FF56, &HFFF875FF, &H13E8FC75, &HFFFFFFF5, &HF603F475, &HF0758957, &H100FE8, &H6A5000, &H1075FF53, &HFF57FE8B, &H2CE80875, &H3BFFFFF2, &HFC78BDF, &H8950C34C, &H20E8F045, &H8B000009, &HD233F05D, &HDB85F08B, &H458B197E, &H8DFB2B08, &HE8BB83C, &HCA2B078B, &H47F8D42, &H3B8E0489, &H83EF7CD3
-    pvAppendBuffer &H1076013E, &H3C83068B, &H8750086, &H83068948, &HF07701F8, &H8BEC75FF, &HE8530C5D, &H1913&, &HFFA5E1E8, &H50FF53FF, &HE875FF08, &H53085D8B, &H18FEE8, &HA5CCE800, &HFF53FFFF, &H75FF0850, &H105D8BE4, &H18E9E853, &HB7E80000, &H53FFFFA5, &H8B0850FF, &H5D8BE07D, &HE85357FC, &H18D3&, &HFFA5A1E8, &H50FF53FF, &HF85D8B08, &HC0E85357, &HE8000018, &HFFFFA58E, &H850FF53, &H5EC68B5F
-    pvAppendBuffer &H5DE58B5B, &H55000CC2, &HEC83EC8B, &H5D8B532C, &H4438D10, &H890100F6, &H1175E045, &HC75FF53, &HE80875FF, &H36D&, &H361E9, &H53575600, &HE80875FF, &HFFFFB76B, &HF08B1B8B, &H5D89CB8B, &H5E1C1DC, &HBBCBE851, &HF88BFFFF, &H1075FF57, &HFFFB90E8, &H1075FFFF, &H57084589, &HFD70E856, &H8956FFFF, &H2CE8F045, &HFFFFFFEE, &HE8571075, &HFFFFB72F, &HFC458957, &HFFEE1AE8, &HC1FB8BFF
-    pvAppendBuffer &H7D8902E7, &HA4FCE8D8, &HFF57FFFF, &HEC458910, &H197EDB85, &H8DE04D8B, &HD003FC57, &H18BF38B, &H8904498D, &HFC528D02, &H7501EE83, &HA4D4E8F1, &HFF57FFFF, &H33F08B10, &HF47589C9, &H2D7EDB85, &H8308558B, &HC283FCC7, &H8BF70304, &HF3B087D, &H28B047D, &HC03302EB, &H83410689, &HEE8304C2, &H7CCB3B04, &HF4758BE9, &HE7C1FB8B, &H8458B02, &HEDA1E850, &H8BE8FFFF, &H57FFFFA4, &HD08B10FF
-    pvAppendBuffer &H85E85589, &H8B107EDB, &HC1C033CF, &HFA8B02E9, &HFB8BABF3, &H5302E7C1, &HE8525656, &HFFFFF6AE, &HDB85C033, &H558B2D7E, &HF04D8BE8, &H83FCC283, &HD70304C1, &H3BF07D8B, &H8B047D07, &H3302EB31, &H403289F6, &H8304C183, &HC33B04EA, &HFB8BE97C, &H8B02E7C1, &HE851F04D, &HFFFFED3B, &HE6C1F38B, &HE0758903, &HFFA41DE8, &H10FF56FF, &H7589F08B, &HA410E808, &HCB8BFFFF, &H5103E1C1, &HC93310FF
-    pvAppendBuffer &H85F84589, &H8B2C7EDB, &HC38BFC7D, &H8303E0C1, &HF003FCC0, &H3B04578D, &H8B047D0F, &H3302EB02, &H410689C0, &H8304C283, &HCB3B04EE, &HFB8BE97C, &HFF02E7C1, &HDCE8FC75, &H53FFFFEC, &H696E8, &H3F36B00, &HE6C1F003, &HD4758902, &HFFA3B5E8, &H10FF56FF, &H330C4D8B, &HFC4589D2, &H55891F6A, &H89018BF0, &H855EE445, &H8B317EC0, &H993C8DD8, &HCE8BC033, &H85E0D340, &H83107507, &H77901EE
-    pvAppendBuffer &H83421F6A, &H3B5E04EF, &H8BE57CD3, &HFB8BDC5D, &H8BE4458B, &H55890C4D, &H2E7C1F0, &H8D0FD03B, &H97&, &H880FF685, &H80&, &HFF084D8B, &H48DFC75, &H75FF530F, &HE85050F8, &HFFFFF1FE, &HFC75FF53, &HFFF475FF, &H75FFEC75, &H3E6E8F8, &H458B0000, &H8BCE8B0C, &H2BC03310, &HD340F055, &HC4D8BE0, &H74910485, &HFC75FF2C, &H53F8458B, &H30875FF, &HE875FFC7, &HF1C0E850, &HFF53FFFF
-    pvAppendBuffer &H75FFFC75, &HEC75FFF4, &HE80875FF, &H3A8&, &HEB084D8B, &H8458B0C, &H89F84D8B, &H4589084D, &H1EE83F8, &H558B8979, &HC4D8BF0, &H891F6A42, &H3B5EF055, &H698C0F11, &H53FFFFFF, &HFFFC75FF, &H75FFF475, &H875FFEC, &H36BE8, &H10458B00, &HA4E830FF, &H33000005, &H85F08BD2, &H8B1E7EDB, &HC7030845, &H8B0C4589, &H8B0E8BF8, &H42CA2B07, &H89047F8D, &HD33B8E04, &H7D8BEF7C, &H13E83D8
-    pvAppendBuffer &H68B1076, &H863C83, &H89480875, &H1F88306, &H75FFF077, &HFC5D8BD4, &H1595E853, &H63E80000, &H53FFFFA2, &HFF0850FF, &H5D8BE075, &H80E85308, &HE8000015, &HFFFFA24E, &H850FF53, &H8BE075FF, &HE853F85D, &H156B&, &HFFA239E8, &H50FF53FF, &HF45D8B08, &H58E85357, &HE8000015, &HFFFFA226, &H850FF53, &H57EC5D8B, &H1545E853, &H13E80000, &H53FFFFA2, &H8B0850FF, &H5357E85D, &H1532E8
-    pvAppendBuffer &HA200E800, &HFF53FFFF, &H8B5F0850, &H8B5B5EC6, &HCC25DE5, &HEC8B5500, &H532CEC83, &H10758B56, &H75FF5657, &HB3F9E808, &H1E8BFFFF, &HE7C1FB8B, &HE0458902, &H89E45D89, &HC7E8D47D, &H57FFFFA1, &HD08B10FF, &H5589C933, &H7EDB85F8, &H2B068B0F, &H86048BC1, &H418A0489, &HF17CCB3B, &HFFA1A5E8, &H10FF57FF, &H8BE0758B, &H89F88BD3, &H162BEC7D, &H97ED285, &HC033CA8B, &H7D8BABF3, &H33068BEC
-    pvAppendBuffer &H7EC085C9, &H97148D14, &H8B41C12B, &H2898604, &H8B04528D, &H7CC83B06, &HC1FB8BEF, &H7D8903E7, &HA160E8DC, &HFF57FFFF, &H89F08B10, &H53E8F475, &H57FFFFA1, &H458910FF, &H1B048D08, &HD7EC085, &HFE8BC88B, &HABF3C033, &HE7C1FB8B, &H44C75303, &H1FC37, &HFCE80000, &H8B000003, &H2E6C1F0, &HE8D87589, &HFFFFA11E, &H8B10FF56, &HF6330C4D, &H6AF04589, &HFC75891F, &H855F018B, &H8D267EC0
-    pvAppendBuffer &HD98B8114, &HCF8BC033, &H85E0D340, &H83107502, &H77901EF, &H83461F6A, &H3B5F04EA, &H8BE57C33, &H7589E45D, &HF8758BFC, &HE856368B, &HFFFFB739, &H85E84589, &H8B1874C0, &H83E6D3C8, &HF7E01FB, &H2B59206A, &HF8458BC8, &HD304408B, &H56F00BE8, &HA73E8, &HC4D8B00, &H8BE44589, &H94E9FC45, &H85000000, &H85880FFF, &H8B000000, &H75FFF475, &H9E048DF0, &H875FF53, &H3FE85050, &HFFFFFFEF
-    pvAppendBuffer &H48DE875, &HE475FF1B, &HFF53006A, &HFF50F875, &H60E80875, &H8BFFFFEC, &HCF8B0C45, &HC033108B, &H40FC552B, &H4D8BE0D3, &H9104850C, &H75FF2F74, &H8458BF0, &H75FF5653, &H98048DEC, &HEEFCE850, &H75FFFFFF, &H1B048DE8, &H6AE475FF, &H75FF5300, &HE85650F8, &HFFFFEC1F, &HEB0C4D8B, &H8BC68B08, &H45890875, &H1EF8308, &H458B8479, &HF47589FC, &H891F6A40, &H3B5FFC45, &H648C0F01, &H8BFFFFFF
-    pvAppendBuffer &H30FF1045, &H2F2E8, &H8BD23300, &H7EDB85F0, &HF4458B17, &H8B983C8D, &H2B078B0E, &H7F8D42CA, &H8E048904, &HEF7CD33B, &H76013E83, &H83068B10, &H7500863C, &H6894808, &H7701F883, &HDC7D8BF0, &H57F45D8B, &H12E9E853, &HB7E80000, &H53FFFF9F, &HFF0850FF, &H5D8BD875, &HD4E853F0, &HE8000012, &HFFFF9FA2, &H850FF53, &H57085D8B, &H12C1E853, &H8FE80000, &H53FFFF9F, &H8B0850FF, &H7D8BD45D
-    pvAppendBuffer &HE85753F8, &H12AB&, &HFF9F79E8, &H50FF57FF, &H5D8B5308, &H98E853EC, &HE8000012, &HFFFF9F66, &H850FF53, &H50E0458B, &HFFE86AE8, &HC68B5FFF, &HE58B5B5E, &HCC25D, &H8BEC8B55, &H8B530845, &H5756145D, &H6B187D8B, &H48D0CF7, &H144589B8, &H5756F303, &H1075FF53, &HF024E850, &H8B56FFFF, &H3C8D1875, &HFF5756BB, &HE8530C75, &HFFFFEDCE, &H8D085D8B, &H53503604, &H2DE85357, &H8BFFFFEA
-    pvAppendBuffer &HC9331455, &H8B104589, &H7EF685F9, &HBB048B16, &H528D0289, &HBB0C8904, &H7CFE3B47, &H14558BF0, &H8510458B, &H852A75C0, &H8B267EF6, &HFA8B0C5D, &H43B078B, &H4108758B, &H3B04C783, &H3BF17CCE, &H8B0E7DCE, &H48D087D, &H87048B31, &H768B043B, &HFF52560B, &HE8520C75, &HFFFFF0F2, &H5D5B5E5F, &H550014C2, &HEC81EC8B, &H108&, &HF0C458B, &H5756C057, &H8D593C6A, &HFFFEF8B5, &H130F66FF
-    pvAppendBuffer &HFFFEF885, &HBD8DFF, &HC7FFFFFF, &H10F845, &HA5F30000, &HFEF8B58D, &HCE8BFFFF, &H2BFC7589, &HC4589C1, &H300C8B53, &H448BFE8B, &HDB330430, &H8910758B, &H4589F44D, &HFF5150F0, &HFF04DE74, &HA7E8DE34, &H1FFFFAB, &HF44D8B07, &H43045711, &H8DF0458B, &HFB83087F, &H8BDE7210, &H458BFC75, &H8C6830C, &H1F86D83, &H75FC7589, &H5BF633B8, &H266A006A, &H7CF5B4FF, &HFFFFFFFF, &HFF78F5B4
-    pvAppendBuffer &H67E8FFFF, &H1FFFFAB, &HFEF8F584, &H9411FFFF, &HFFFEFCF5, &HFE8346FF, &H8BD5720F, &HB58D087D, &HFFFFFEF8, &HFF59206A, &HA5F30875, &HFFB48FE8, &H875FFFF, &HFFB487E8, &H8B5E5FFF, &HCC25DE5, &HEC8B5500, &H5310EC83, &HDB335756, &HC75FF53, &H1475FF53, &HFFAB15E8, &H75FF53FF, &HF045890C, &HFF53F28B, &H3E81875, &H53FFFFAB, &H891075FF, &HFA8BF445, &H1875FF53, &HFFAAF1E8, &H75FF53FF
-    pvAppendBuffer &HFC458910, &H1475FF53, &HE8F85589, &HFFFFAADE, &H458BD88B, &H6ADE03F4, &HD6135E00, &HD713D803, &HD77D73B, &HD83B0472, &H75010773, &HF85583FC, &H8458B01, &H4D0BC933, &H5FDE0BF0, &H3308895E, &HFC5503C9, &H13045889, &H5089F84D, &HC488908, &H5DE58B5B, &H550014C2, &H4D8BEC8B, &HF6335608, &HC18B0DEB, &HD1C22B99, &H41C82BF8, &H838E348D, &HEE7F32F9, &H5D5EC68B, &H550004C2, &H8B53EC8B
-    pvAppendBuffer &H5756085D, &H49D348D, &HE8000000, &HFFFF9CF6, &H5610FF56, &H6AF88B, &HF192E857, &HC483FFFF, &H8B1F890C, &H5B5E5FC7, &H4C25D, &H83EC8B55, &H8B5330EC, &H5756085D, &H75FF066A, &HBEE8530C, &H6A00001E, &HFF206A06, &H458D0C75, &H74E850D0, &H6A000012, &H8DF08B06, &H458D084B, &H50FA8BD0, &HC3835151, &H1123E838, &HC6030000, &H75FF066A, &H1303890C, &H8458BD7, &H8910C083, &H50500453
-    pvAppendBuffer &H1108E8, &H84D8B00, &H4189066A, &HD0458D40, &H89515150, &H44E84451, &H8B000020, &HF003084D, &H518BFA13, &H8BD62B30, &HF71B3471, &H7234713B, &H3B05771D, &H16763051, &HEBFFCF83, &H85B8D03, &H7B113B01, &H23038B04, &HC73B0443, &H895FEF74, &H895E3471, &H8B5B3051, &H8C25DE5, &HEC8B5500, &H108EC81, &H56530000, &HC75FF57, &HFF78858D, &HE850FFFF, &H919&, &HFF78858D, &HE850FFFF
-    pvAppendBuffer &HFFFFB2BC, &HFF78858D, &HE850FFFF, &HFFFFB2B0, &HFF78858D, &HE850FFFF, &HFFFFB2A4, &HFEF89D8D, &H45C7FFFF, &H20C&, &H8BF63300, &HFFFF788D, &H7C858BFF, &H81FFFFFF, &HFFEDE9, &H1B086A00, &HF88D89C6, &H89FFFFFE, &HFFFEFC85, &H548B5FFF, &H448BF83B, &H8C8BFC3B, &HFFFF783D, &HF85589FF, &H10C2AC0F, &H7C3D848B, &H83FFFFFF, &H748901E2, &HCA2BFC3B, &HE981C61B, &HFFFF&, &HF83D8C89
-    pvAppendBuffer &H1BFFFFFE, &H3D8489C6, &HFFFFFEFC, &HF845B70F, &HF83B4489, &H8308C783, &HB27278FF, &HFF688D8B, &H858BFFFF, &HFFFFFF6C, &HFF0558B, &HF10C1AC, &HFF6885B7, &HE183FFFF, &H68858901, &H2BFFFFFF, &H6CB589D1, &H8BFFFFFF, &HCE1BF44D, &H7FFFEA81, &H95890000, &HFFFFFF70, &HC033CE1B, &HFF748D89, &HF40FFFF, &H8310CAAC, &HF9C101E2, &H50C22B10, &HFEF8858D, &H8D50FFFF, &HFFFF7885, &HB2E850FF
-    pvAppendBuffer &H83000007, &HF010C6D, &HFFFF1E85, &H8558BFF, &H78F5848A, &H8BFFFFFF, &HFF78F58C, &H488FFFF, &HF5848B72, &HFFFFFF7C, &H8C1AC0F, &H8808F8C1, &H4601724C, &H7210FE83, &H5B5E5FD7, &HC25DE58B, &H8B550008, &H84D8BEC, &H8B56D233, &H6A570C75, &H5FF12B11, &H30E048B, &HFD00301, &HEAC1C2B6, &H8D018908, &HEF830449, &H5FE97501, &H8C25D5E, &HEC8B5500, &HC75FF56, &H5608758B, &HFFFFC1E8
-    pvAppendBuffer &H44468DFF, &H15E85650, &H5E000001, &H8C25D, &H83EC8B55, &H8B5344EC, &H5756085D, &H8B59116A, &HBC7D8DF3, &H5BE8A5F3, &H5FFFF9A, &H544&, &HBC458D50, &HFF88E850, &H458BFFFF, &H25D0F7FC, &H80&, &H8D5E116A, &HD0F7FF50, &HC11FEAC1, &HD0231FE8, &HF7BC458D, &H89C32BD2, &H7A8D0845, &H8BD7F701, &H428D180C, &H23032301, &H8BC80BCF, &HB890845, &H83045B8D, &HE77501EE, &H8B5B5E5F
-    pvAppendBuffer &H4C25DE5, &HEC8B5500, &H8D44EC83, &H6A56BC45, &H56F63344, &HEE96E850, &H4D8BFFFF, &HCC48308, &HA8918B, &HD2850000, &HB60F1174, &H983184, &H44890000, &H3B46BCB5, &H8DEF72F2, &H44C7BC45, &H1BC95, &H51500000, &HFFFF24E8, &HE58B5EFF, &H4C25D, &H8BEC8B55, &H3356084D, &HD68B57F6, &H1403FE8B, &HC2B60FB9, &H8908EAC1, &H8347B904, &HEE7C10FF, &H8B405103, &H2EAC1C2, &H6B03E083
-    pvAppendBuffer &H418905D2, &HB1140340, &HC1C2B60F, &H48908EA, &HFE8346B1, &H1EE7C10, &H5E5F4051, &H4C25D, &H83EC8B55, &H8B534CEC, &H458D0C5D, &H2BD233B4, &H895756D8, &HFF33FC5D, &HD285C933, &H48D1E78, &H85D8B93, &H3B4758D, &H8B048BF0, &H8D06AF0F, &HF803FC76, &H7ECA3B41, &HFC5D8BF0, &H8901728D, &HCE8BF875, &H7D11FE83, &H85D8B2D, &HC62BC28B, &H830C758B, &H348D44C6, &H8B048B86, &H8D06AF0F
-    pvAppendBuffer &HC069FC76, &H140&, &H8341F803, &HE97C11F9, &H8BF8758B, &H7C89FC5D, &HD68BB495, &H7C11FA83, &HB4458D95, &HFF2AE850, &H7D8BFFFF, &HB4758D08, &HF359116A, &H5B5E5FA5, &HC25DE58B, &H8B550008, &HC558BEC, &H3344EC83, &H4B60FC9, &H8D448911, &HF98341BC, &H8DF27C10, &H45C7BC45, &H1FC&, &H75FF5000, &HFE07E808, &HE58BFFFF, &H8C25D, &H81EC8B55, &H178EC, &H57565300, &H7D8DC033
-    pvAppendBuffer &H88DB33B1, &H6AABB05D, &HC75FF0C, &HAB66ABAB, &HB4458DAA, &HECF1E850, &HC483FFFF, &HD05D880C, &H7D8DC033, &H59076AD1, &H46AABF3, &H8DAAAB66, &H6A50B045, &H875FF20, &HFF34858D, &HE850FFFF, &HFFFFC000, &H458D206A, &H8D5050D0, &HFFFF3485, &HD0E850FF, &H8DFFFFBA, &H8D50E045, &H8D50D045, &HFFFE8885, &H8EE850FF, &H6AFFFFCA, &HC0335908, &HF3D07D8D, &HD0458AAB, &H458D206A, &H8D5050D0
-    pvAppendBuffer &HFFFF3485, &H9CE850FF, &H33FFFFBA, &HD07D8DC0, &HFF59086A, &HABF31475, &H8DD0458A, &H75FFF17D, &H88C03310, &HABABF05D, &HAAAB66AB, &HFE88858D, &HE850FFFF, &HFFFFCB01, &HF714458B, &HFE083D8, &HF0458D50, &H88858D50, &H50FFFFFE, &HFFCAE8E8, &H1C758BFF, &H7D8BC033, &H45894018, &H4539560C, &HFF167524, &H858D2075, &HFFFFFF34, &H34E85057, &H56FFFFBA, &HEB2075FF, &H858D5701, &HFFFFFE88
-    pvAppendBuffer &HCAB3E850, &HC68BFFFF, &HE083D8F7, &H458D500F, &H858D50F0, &HFFFFFE88, &HCA9BE850, &H458DFFFF, &HFF5350F0, &H7AE81475, &H8D00001C, &H5350F845, &H1C6FE856, &H106A0000, &H458D535B, &H858D50F0, &HFFFFFE88, &HCA6FE850, &H7D83FFFF, &H2C750124, &H8D2875FF, &HFFFE8885, &H2FE850FF, &H6AFFFFC9, &H34858D7C, &H6AFFFFFF, &HC1E85000, &H8AFFFFEB, &HFFFF3485, &HCC483FF, &H73EBC033, &H50C0458D
-    pvAppendBuffer &HFE88858D, &HE850FFFF, &HFFFFC902, &H8D287D8B, &HC18BC04D, &HF82BD232, &H320F048A, &H41D00A01, &H7501EB83, &H187D8BF3, &H2075FF56, &H1275D284, &H34858D57, &H50FFFFFF, &HFFB96AE8, &HC5D21FF, &H22E805EB, &H6AFFFFEB, &H34858D7C, &H6AFFFFFF, &H59E85000, &H8AFFFFEB, &HFFFF348D, &HC07D8DFF, &H330CC483, &HABABABC0, &HC04D8AAB, &H5F0C458B, &HE58B5B5E, &H24C25D, &H8BEC8B55, &HB60F0855
-    pvAppendBuffer &H4AB60F02, &H8E0C101, &HB60FC10B, &HE0C1024A, &HFC10B08, &HC1034AB6, &HC10B08E0, &H4C25D, &H8BEC8B55, &HB60F0855, &HB60F0342, &HE0C1024A, &HFC10B08, &HC1014AB6, &HC10B08E0, &HC10AB60F, &HC10B08E0, &H4C25D, &H53EC8B55, &H33085D8B, &HC1CB8BD2, &H564110E9, &H8D006A57, &HFFFFFF81, &H8BF1F77F, &H10E6C1F0, &HE3F7C68B, &HCE03C88B, &HD283D1F7, &H83C03300, &HD2F701C1, &HC203C013
-    pvAppendBuffer &HE8C1E6F7, &H3FA8B1F, &H8BF80BFF, &H8BE3F7C7, &H3CA8BF0, &HBAF7&, &H13588000, &H72CA3BC8, &H33D3F718, &H13F303C0, &H1C683C0, &H4900D083, &H3B4FC803, &HEBEC73CA, &H3D23319, &HEBD013F3, &HC9334707, &HC813F303, &HFA81D103, &H80000000, &HC78BEF72, &H5D5B5E5F, &H550004C2, &H458BEC8B, &HC558B08, &H406A5756, &H104D2B59, &HFFA320E8, &H104D8BFF, &H458BF08B, &H8BFA8B08, &H2DE80C55
-    pvAppendBuffer &HBFFFFA3, &H5FD70BC6, &HCC25D5E, &HEC8B5500, &H5324EC83, &H7D8B5756, &H75FF5708, &HAA40E80C, &HFF57FFFF, &H45891075, &HAA34E808, &HFF57FFFF, &H45891475, &HAA28E80C, &HF78BFFFF, &HD1F04589, &H75FF56EE, &HAA18E818, &HFF56FFFF, &HD88B1C75, &HE8EC5D89, &HFFFFAA0A, &H2075FF56, &HE8104589, &HFFFFA9FE, &HE8458953, &HFFCC9DE8, &H458950FF, &HCCFCE81C, &H758BFFFF, &H8BE85610, &H50FFFFCC
-    pvAppendBuffer &HE8204589, &HFFFFCCEA, &HFF1C75FF, &H10E80C75, &HFFFFFFA7, &H45892075, &HC75FFFC, &HFFA702E8, &H75FF53FF, &HF84589FC, &HE80875FF, &HFFFFEF57, &HF875FF56, &H75FFD88B, &H145D8908, &HFFEF46E8, &H56F08BFF, &H18758953, &HFFA91CE8, &H79C085FF, &HEC75FF19, &HE853F38B, &HFFFFA4C6, &H89D88B56, &HB0E81445, &H8BFFFFDD, &H53561875, &HFFAA44E8, &H1075FFFF, &HFFF44589, &HDEE8E875, &H56FFFFA6
-    pvAppendBuffer &H89F475FF, &HE850E045, &HFFFFA6E5, &H89F075FF, &HE850DC45, &HFFFFA68B, &H85E44589, &H8B1A74FF, &HD88B2475, &HE853574F, &HFFFFA879, &H85460688, &H8BF175FF, &H758B145D, &H1C75FF18, &HFFDD56E8, &H2075FFFF, &HFFDD4EE8, &HFC75FFFF, &HFFDD46E8, &HF875FFFF, &HFFDD3EE8, &H38E853FF, &H56FFFFDD, &HFFDD32E8, &HF475FFFF, &HFFDD2AE8, &HE075FFFF, &HFFDD22E8, &HDC75FFFF, &HFFDD1AE8, &H875FFFF
-    pvAppendBuffer &HFFDD12E8, &HC75FFFF, &HFFDD0AE8, &HF075FFFF, &HFFDD02E8, &HEC75FFFF, &HFFDCFAE8, &H1075FFFF, &HFFDCF2E8, &HE875FFFF, &HFFDCEAE8, &HE475FFFF, &HFFDCE2E8, &H5B5E5FFF, &HC25DE58B, &H8B550020, &H8B5653EC, &H56570875, &HE80C75FF, &HFFFFA892, &H1075FF56, &H5D89D88B, &HA884E80C, &HFF56FFFF, &HF88B1475, &HE8087D89, &HFFFFA876, &H89535750, &H10E81045, &H8BFFFFEE, &H74F685D8, &H187D8B15
-    pvAppendBuffer &HE853564E, &HFFFFA79D, &H85470788, &H8BF175F6, &H75FF087D, &HDC7DE80C, &HE857FFFF, &HFFFFDC77, &HE81075FF, &HFFFFDC6F, &HDC69E853, &H5E5FFFFF, &H14C25D5B, &HEC8B5500, &H458B5151, &H5D8B5310, &HF7564808, &H1045C7D0, &H10&, &H7D8B5799, &H89DF2B0C, &H5589FC45, &H3B348BF8, &H43B548B, &H4F8B078B, &H23C63304, &HCA33FC45, &H33F84D23, &H89D133F0, &H54893B34, &H731043B, &H31087F8D
-    pvAppendBuffer &H6D83FC4F, &HD1750110, &H8B5B5E5F, &HCC25DE5, &HEC8B5500, &H8B0C558B, &HD12B084D, &H5E106A56, &H890A048B, &H8498D01, &HFC0A448B, &H83FC4189, &HEC7501EE, &H8C25D5E, &HEC8B5500, &H106A5653, &H105D395B, &H7D833674, &H5A752010, &H570C758B, &H53087D8B, &H30E85756, &H53FFFFE7, &H5010468D, &H5010478D, &HFFE722E8, &H18C483FF, &HFF9295E8, &H53105FF, &H47890000, &H2AEB5F30, &H5308758B
-    pvAppendBuffer &H560C75FF, &HFFE702E8, &H75FF53FF, &H10468D0C, &HE6F5E850, &HC483FFFF, &H9268E818, &H2005FFFF, &H89000005, &H5B5E3046, &HCC25D, &H83EC8B55, &H8B536CEC, &H5756085D, &HA0BFF633, &H8B000001, &H104B8B03, &H8BF84589, &H45890443, &H8438BF0, &H8BEC4589, &H45890C43, &H14438BE0, &H8BE84589, &H45891843, &H1C438BE4, &H89945D8D, &HDF2BF44D, &H89DC4589, &H7D89D875, &H10FE83D4, &H758B1773
-    pvAppendBuffer &H71E8560C, &H83FFFFFB, &H458904C6, &H3B0489FC, &HEB0C7589, &H17E8D5D, &H8D0FE683, &HE083FD47, &H85548B0F, &H83C78B94, &H4C8B0FE0, &HC18B9485, &H890EC0C1, &HC18BFC45, &H3107C8C1, &HC28BFC45, &H3103E9C1, &HCA8BFC4D, &HC10DC0C1, &HC8330FC1, &H330AEAC1, &HF8478DCA, &H83FC558B, &H7D8B0FE0, &H3D103D4, &H3948554, &H8994B554, &H5489FC55, &H8FE894B5, &H8BFFFF91, &HD68BF475, &HCAC1CE8B
-    pvAppendBuffer &H7C1C10B, &HCE8BD133, &HF706C9C1, &HE47523D6, &HC8BD133, &H4C78338, &H3E8458B, &HF44523CA, &H33FC4D03, &H89F103F0, &H4D8BD47D, &H3D18BF8, &HC18BDC75, &HC10AC0C1, &HD0330DCA, &HC8C1C18B, &H8BD03302, &HC88BF045, &H33F84523, &H4D23F84D, &H8BC833EC, &H4589E445, &H8BD103DC, &H4D8BE845, &HE44589E0, &H458BCE03, &HE84589F4, &H89EC458B, &H458BE045, &HEC4589F0, &H89F8458B, &H48DF045
-    pvAppendBuffer &HD8758B32, &HF44D8946, &H89F84589, &HFF81D875, &H2A0&, &HFEDF820F, &H5D8BFFFF, &H15E5F08, &HF0458B03, &H8B044301, &H4301EC45, &HE0458B08, &H8B0C4301, &H4301E845, &HE4458B14, &H1184301, &H458B104B, &H1C4301DC, &H5B6043FF, &HC25DE58B, &H8B550008, &HDCEC81EC, &H8B000000, &H56530845, &H4488B57, &H8BF84D89, &H108B0848, &H8BD84D89, &H4D890C48, &H10488BEC, &H8BD44D89, &H4D891448
-    pvAppendBuffer &H18488BD0, &H8BB84D89, &H4D891C48, &H20488BB4, &H8BE84D89, &H4D892448, &H28488BFC, &H8BCC4D89, &H4D892C48, &H30488BC8, &H8BC44D89, &H4D893448, &H38488BC0, &H893C408B, &H858DAC45, &HFFFFFF24, &HB9B04D89, &H2A0&, &H33E05589, &H89C12BD2, &H4D89BC55, &HA44589DC, &H7310FA83, &HC7D8B36, &H5004478D, &HFFF98FE8, &HD88B57FF, &H85E8F633, &H8BFFFFF9, &HF00BDC4D, &H83A4458B, &H5D8908C7
-    pvAppendBuffer &HF07589F4, &H890C7D89, &H7489081C, &HD6E90408, &H8D000000, &HE083FE42, &H8B3D6A0F, &HFF24C5BC, &HB48BFFFF, &HFFFF28C5, &H1428DFF, &H830FE083, &H57560FE2, &H8BA85589, &HFF24C58C, &H9C8BFFFF, &HFFFF28C5, &HE44D89FF, &HFFFA0EE8, &H56136AFF, &HF4458957, &HE8F05589, &HFFFFF9FF, &H33F44D8B, &HF0458BC8, &H6F7AC0F, &HC233086A, &H5306EEC1, &H33E475FF, &H89C633CF, &H4589F44D, &HF9D9E8F0
-    pvAppendBuffer &H16AFFFF, &HE475FF53, &HFA8BF08B, &HFFF9CAE8, &HF44D8BFF, &H458BF033, &H8BFA33E4, &HAC0FF055, &HF03307D8, &H8B07EBC1, &HFB33BC45, &HD713CE03, &H83F9C083, &H8C030FE0, &HFFFF24C5, &HC59413FF, &HFFFFFF28, &H3A8458B, &HFF24C58C, &H4D89FFFF, &HC59413F4, &HFFFFFF28, &H24C58C89, &H89FFFFFF, &H9489F055, &HFFFF28C5, &HE8758BFF, &H75FF296A, &H64E856FC, &H6AFFFFF9, &HFC75FF12, &HFA8BD88B
-    pvAppendBuffer &HF955E856, &HE6AFFFF, &H33FC75FF, &H56FA33D8, &HFFF946E8, &H33D833FF, &H8EE8E8FA, &H4D8BFFFF, &H8BD6F7DC, &HD2F7FC55, &H1C03276A, &HF875FF08, &H4087C13, &H23C47523, &H4D8BC055, &HE84D23CC, &H33C8458B, &HFC4523F1, &HDE03D033, &H13E0758B, &HF45D03FA, &HF07D1356, &H89B05D03, &H7D13A85D, &HE47D89AC, &HFFF8F2E8, &HFF226AFF, &HF88BF875, &HE856DA8B, &HFFFFF8E3, &H75FF1C6A, &H33F833F8
-    pvAppendBuffer &HD4E856DA, &H8BFFFFF8, &HDA33D84D, &H33EC558B, &HF85533F8, &H7533F18B, &HD05523E0, &H23EC458B, &H7523F845, &H23D033D4, &H458BE04D, &H89F133C4, &HF703B045, &H89C0458B, &HDA13AC45, &H89CC458B, &H458BC445, &HA84D8BC8, &H8BB84D03, &H5513E455, &HA87503B4, &H8BC04589, &H5D13E845, &HCC4589E4, &H89FC458B, &H558BFC55, &HB85589D4, &H89D0558B, &H558BB455, &HD45589D8, &H89EC558B, &H558BD055
-    pvAppendBuffer &HD85589E0, &H89F8558B, &H4D8BE84D, &HEC5589DC, &H8B08C183, &H8942BC55, &H7589C845, &HF85D89E0, &H89BC5589, &HF981DC4D, &H520&, &HFDA6820F, &H458BFFFF, &HD8558B08, &H5FD44D8B, &H758B3001, &H45811B4, &H8B085001, &H5011EC55, &H1048010C, &H11D04D8B, &H558B1448, &H185001B8, &H11E84D8B, &H48011C70, &HFC4D8B20, &H8B244811, &H4801CC4D, &HC84D8B28, &H8B2C4811, &H4801C44D, &HC04D8B30
-    pvAppendBuffer &H8B344811, &H4801B04D, &HAC4D8B38, &HFF3C4811, &HC080&, &H8B5B5E00, &H8C25DE5, &HEC8B5500, &H85D8B53, &HB60F5756, &HB60F077B, &HB60F0A43, &HB60F0B73, &HE7C10F53, &HFF80B08, &HF034BB6, &HC10D43B6, &HF80B08E7, &HF08E6C1, &HE7C103B6, &HC1F80B08, &HB60F08E2, &HF00B0E43, &HF08E1C1, &HC10143B6, &HF00B08E6, &H443B60F, &HB08E6C1, &H43B60FF0, &HFD00B02, &HC10543B6, &HD00B08E2
-    pvAppendBuffer &H843B60F, &HB08E2C1, &H43B60FD0, &H89C80B06, &HB60F047B, &HE1C10943, &H89C80B08, &HB60F0873, &HE1C10C43, &HC80B5F08, &H5E0C5389, &H5D5B0B89, &H550004C2, &H458BEC8B, &H74C08508, &HC4D8B10, &H974C985, &H400000C6, &H7501E983, &H8C25DF7, &HEC8B5500, &HFF0C75FF, &H75FF0C75, &HEE01E808, &HC25DFFFF, &H8B550008, &H10558BEC, &H758B5653, &H7D8B570C, &H6AF22B08, &H5BFA2B10, &H2B160C8B
-    pvAppendBuffer &H16448B0A, &H4421B04, &H8D170C89, &H44890852, &HEB83FC17, &H5FE57501, &HC25D5B5E, &H8B55000C, &HE85756EC, &HFFFF8C5E, &HBF08758B, &H588&, &HFF50C703, &H41E836, &H6890000, &HFF8C45E8, &H50C703FF, &HE80476FF, &H2F&, &HE8044689, &HFFFF8C32, &HFF50C703, &H1CE80876, &H89000000, &H1FE80846, &H3FFFF8C, &H76FF50C7, &H9E80C, &H895F0000, &H5D5E0C46, &H550004C2, &H558BEC8B
-    pvAppendBuffer &H5D8B530C, &HC1C38B08, &HCB8B18E8, &H8E9C156, &HFC9B60F, &H8B1034B6, &H10E8C1C3, &HFC0B60F, &HC1110CB6, &HB60F08E6, &HC60B1004, &HB08E0C1, &HCBB60FC1, &H5E08E0C1, &HCB60F5B, &H5DC10B11, &H550008C2, &H5653EC8B, &H87D8B57, &H458BDB33, &H44B60F0C, &H8B990158, &H8BF28BC8, &HA40F0C45, &HE1C108CE, &H4B60F08, &HC8039958, &H13DF0C89, &HDF7489F2, &HFB834304, &H81D37210, &H7FFF7867
-    pvAppendBuffer &H67830000, &H5E5F007C, &H8C25D5B, &HEC8B5500, &H570F5151, &H7D8B57C0, &H130F6614, &H558BF845, &HF84D8BFC, &H7374FF85, &H530C458B, &H10758B56, &H4529F02B, &H10758908, &H306348B, &HC758930, &H8B10758B, &H748B0C5D, &H70130406, &H89D90304, &HF2130C5D, &H5D8B183B, &H3B057508, &H23740470, &H7704703B, &H8B077210, &HC4D3908, &HC9330773, &HEBD23341, &HC0570F0E, &H45130F66, &HFC558BF8
-    pvAppendBuffer &H8BF84D8B, &H74890C7D, &H758B0403, &H33C8910, &H8308C083, &H7501146D, &H8B5B5E9F, &HE58B5FC1, &H10C25D, &H8BEC8B55, &HC9850C4D, &H57561F74, &H8D087D8B, &HFFF8CD0C, &HF78BFFFF, &H8302E9C1, &H67830027, &HC7830004, &H5FA5F308, &H8C25D5E, &HEC8B5500, &H83104D8B, &H575601E9, &H458B3078, &H8758B0C, &H148DF02B, &H167C8BC8, &H16048B04, &H77047A3B, &H3B1F7226, &H3B207702, &H1672047A
-    pvAppendBuffer &H23B0477, &HEA831072, &H1E98308, &HC033DB79, &HC25D5E5F, &HC883000C, &H33F5EBFF, &HF0EB40C0, &H33EC8B55, &HC4D39C9, &H558B1276, &HCA048B08, &H4CA440B, &H3B410D75, &HF1720C4D, &H5D40C033, &H330008C2, &H55F8EBC0, &HEC83EC8B, &H147D830C, &HC0570F00, &H45130F66, &H5D8B53F8, &H8B6376FC, &H558B0C4D, &H58406A08, &H2B10452B, &HF44589CA, &H56F8458B, &H890C4D89, &H8B57FC45, &HC78B113C
-    pvAppendBuffer &H411748B, &H4D8BD68B, &H9783E810, &H4D8BFFFF, &HBD30B08, &H189FC45, &H5189C78B, &H8BD68B04, &H89E8F44D, &H8BFFFF97, &HDA8B0C4D, &H8308558B, &H458908C2, &H146D83FC, &H8558901, &H5E5FBD75, &H458B03EB, &H5BD38BF8, &HC25DE58B, &H8B550010, &H28EC83EC, &H758B5653, &H7D8B570C, &H56046A08, &HB9BE857, &H468B0000, &HC0570F2C, &HE06583, &H8BE44589, &H45893046, &H34468BE8, &H8BEC4589
-    pvAppendBuffer &H45893846, &H3C468BF0, &H4589046A, &HD8458DF4, &H5050016A, &H45130F66, &HFF29E8D8, &H46AFFFF, &H458DD88B, &H575750D8, &HFFFDE0E8, &H384E8BFF, &H468BD803, &H3C568B30, &HE06583, &HF46583, &H33E44589, &H34460BC0, &H4589046A, &HD8458DE8, &H5050016A, &H89EC4D89, &HE8E8F055, &H6AFFFFFE, &H8DD80304, &H5750D845, &HFD9FE857, &H6583FFFF, &HD80300E4, &HF20468B, &H4589C057, &H24468BD8
-    pvAppendBuffer &H8BDC4589, &H45892846, &H38468BE0, &H8BF04589, &H46A3C46, &H8DF44589, &H5750D845, &H130F6657, &H66E8E845, &H3FFFFFD, &H244E8BD8, &H460BC033, &H34568B28, &H8BDC4589, &H45893046, &HBC033F8, &H45892C46, &H38468BE0, &H8BE84589, &H45893C46, &HBC033EC, &H46A2046, &H8DF44589, &H8950D845, &HCA8BD84D, &H4D895757, &HF05589E4, &HFFFD1CE8, &H2C4E8BFF, &H568BD803, &HBC03334, &H570F3046
-    pvAppendBuffer &HE46583C0, &HDC458900, &H6A20468B, &HF0458904, &H89D8458D, &HC933D84D, &H50284E0B, &H55895757, &H130F66E0, &H4D89E845, &HC31E8F4, &H568B0000, &H8BD82B24, &H570F3046, &HD84589C0, &H468B20B1, &HDC458934, &H8938468B, &H468BE045, &HE445893C, &H6620468B, &HE845130F, &HFF95D3E8, &H2C560BFF, &H4589046A, &HD8458DF0, &H89575750, &HECE8F455, &H8B00000B, &HD82B344E, &H5D89C033, &H38460BFC
-    pvAppendBuffer &H89305E8B, &H4589D84D, &H20568BDC, &H460BC033, &H8B20B13C, &HF633247E, &H8BE45589, &H45890C55, &H28428BE0, &HE82C528B, &HFFFF9565, &HF06583, &H46AF80B, &H8DF45D89, &H535BD845, &HE87D8950, &H7D8BF20B, &H89575708, &H90E8EC75, &H8B00000B, &H758B0C4D, &HE06583FC, &H83F02B00, &H8B00F065, &H45893841, &H3C418BD8, &H8BDC4589, &H45892441, &H28418BE4, &H8BE84589, &H45892C41, &H34418BEC
-    pvAppendBuffer &HF4458953, &H50D8458D, &H50E85757, &H2B00000B, &H531E79F0, &HFF876DE8, &H10C083FF, &HE8575750, &HFFFFFBE9, &HEB78F003, &H8B5B5E5F, &H8C25DE5, &H75F68500, &HE8575315, &HFFFF874A, &H5010C083, &HFFFC8CE8, &H1F883FF, &HE853DE74, &HFFFF8736, &H5010C083, &H4E85757, &H2B00000B, &H55D2EBF0, &HEC83EC8B, &H758B5674, &H66A570C, &H57307E8D, &HE8EC7D89, &HFFFFFCA8, &H850FC085, &HAB&
-    pvAppendBuffer &H8C5D8D53, &H66ADE2B, &HF8C458D, &H6650C057, &HF045130F, &HFFFC0BE8, &H8D066AFF, &HE850BC45, &HFFFFFC00, &H8C458D57, &HE9FEE850, &H66AFFFF, &HFBEEE857, &H4D8BFFFF, &H89C68BF4, &H4D8BF84D, &H8BF98BF0, &H45C7F875, &H9FC&, &H3148B00, &H4C8B1003, &H48130403, &H13D70304, &H75103BCE, &H4483B05, &H483B2074, &H720D7704, &H73103B04, &H47FF3307, &HEEBF633, &H66C0570F, &HF045130F
-    pvAppendBuffer &H8BF4758B, &H1089F07D, &H83044889, &H6D8308C0, &HB97501FC, &H6AEC7D8B, &H1E85706, &H8BFFFFFC, &HC0850C75, &HFF5C840F, &H6A5BFFFF, &H8654E806, &HB0BFFFFF, &HEB000000, &H8648E816, &HC703FFFF, &HE8565650, &HA17&, &H37E8066A, &H3FFFF86, &HE85650C7, &HFFFFFB79, &HC085066A, &HFF56DB7F, &H1AE80875, &H5F000008, &H5DE58B5E, &H550008C2, &H7D83EC8B, &H75FF0410, &H875FF0C, &H4BE80775
-    pvAppendBuffer &HEBFFFFFC, &HFED5E805, &HC25DFFFF, &H8B55000C, &H1875FFEC, &HFF1075FF, &H75FF0C75, &HFA6BE808, &HC20BFFFF, &H75FF1275, &H1475FF18, &HE80875FF, &HFFFFFB1D, &H1178C085, &HFF1875FF, &H75FF1475, &H875FF08, &H996E8, &H14C25D00, &HEC8B5500, &HC8EC81, &H8B560000, &HFF561475, &H3DE80C75, &H85FFFFFB, &H560E74C0, &HE80875FF, &HFFFFFAB4, &H202E9, &H56575300, &H8D0C75FF, &HFFFF3885
-    pvAppendBuffer &H7AE850FF, &H8B000007, &H858D105D, &HFFFFFF68, &HE8505356, &H769&, &HC8458D56, &HFA82E850, &H6583FFFF, &H458D00CC, &H56FF3398, &H7D895047, &HFA6EE8C8, &H8D56FFFF, &HFFFF6885, &H858D50FF, &HFFFFFF38, &HFA87E850, &H8FE9FFFF, &H8B000001, &HFFFF3885, &HC0570FFF, &HF66C723, &H83F84513, &HE7500C8, &HFF38858D, &HE850FFFF, &H6BB&, &H858B74EB, &HFFFFFF68, &HC883C723, &H8D117500
-    pvAppendBuffer &HFFFF6885, &HA0E850FF, &HE9000006, &HF2&, &H8E0FC985, &H9C&, &HFF68858D, &H8D50FFFF, &HFFFF3885, &HE85050FF, &H8B3&, &H38858D56, &H50FFFFFF, &H672E8, &H458D5600, &H458D5098, &HAE850C8, &H85FFFFFA, &H560C79C0, &HC8458D53, &H36E85050, &H56FFFFF9, &H5098458D, &H50C8458D, &H879E850, &H458B0000, &H83C723C8, &H137400C8, &H458D5356, &HE85050C8, &HFFFFF911, &H5589F88B
-    pvAppendBuffer &H8B09EB0C, &H7D8BFC45, &HC4589F8, &HC8458D56, &H615E850, &H7D0B0000, &HA8840F0C, &H8B000000, &H81C0F544, &HC4F54C, &H89800000, &HE9C0F544, &H93&, &HFF38858D, &H8D50FFFF, &HFFFF6885, &HE85050FF, &H817&, &H68858D56, &H50FFFFFF, &H5D6E8, &H458D5600, &H458D50C8, &H6EE85098, &H85FFFFF9, &H560C79C0, &H98458D53, &H9AE85050, &H56FFFFF8, &H50C8458D, &H5098458D, &H7DDE850
-    pvAppendBuffer &H458B0000, &H83C72398, &H137400C8, &H458D5356, &HE8505098, &HFFFFF875, &H5589F88B, &H8B09EB0C, &H7D8BFC45, &HC4589F8, &H98458D56, &H579E850, &H7D0B0000, &H8B10740C, &H8190F544, &H94F54C, &H89800000, &H5690F544, &HFF68858D, &H8D50FFFF, &HFFFF3885, &HF6E850FF, &H6AFFFFF8, &HC88B5F01, &HFC98556, &HFFFE6685, &HC8458DFF, &H875FF50, &H58CE8, &H5E5B5F00, &HC25DE58B, &H8B550010
-    pvAppendBuffer &H80EC81EC, &H53000000, &H46A5756, &H75FF535B, &H4B4E814, &HFF530000, &HF08B1075, &HFF80458D, &HE8500C75, &H34A&, &HA0458D53, &H498E850, &HF88B0000, &H874FF85, &H100C781, &HCEB0000, &H80458D53, &H480E850, &HF88B0000, &H73FE3B53, &H80458D0C, &H875FF50, &HFAE9&, &HC0458D00, &HF83EE850, &H8D53FFFF, &HE850E045, &HFFFFF834, &HC62BC78B, &HEEC1F08B, &HE0835306, &H501A743F
-    pvAppendBuffer &H8D1475FF, &H48DC045, &HB8E850F0, &H89FFFFF8, &H89E0F544, &HEBE4F554, &H1475FF0F, &H8DC0458D, &HE850F004, &H4D9&, &H85D8B53, &HF7F2E853, &H6383FFFF, &H3C70004, &H1&, &H815E046A, &H100FF, &H56117700, &H8D1475FF, &HE850C045, &HFFFFF7FD, &H7978C085, &HA0458D56, &HE0458D50, &HF7EBE850, &HC085FFFF, &H40751478, &H80458D56, &HC0458D50, &HF7D7E850, &HC085FFFF, &H8D562E7F
-    pvAppendBuffer &H8D50C045, &H50508045, &H652E8, &H74C20B00, &H8D53560C, &H5050A045, &H642E8, &H458D5600, &H458D50E0, &HE85050A0, &H633&, &H8DE0758B, &H46AE045, &H1FE6C150, &H3EEE8, &H8D046A00, &HE850C045, &H3E3&, &H4FDC7509, &HFFFF6BE9, &H458D56FF, &HE8535080, &H425&, &H8B5B5E5F, &H10C25DE5, &HEC8B5500, &HC0EC81, &H56530000, &H5B066A57, &H1475FF53, &H34DE8, &H75FF5300
-    pvAppendBuffer &H8DF08B10, &HFFFF4085, &HC75FFFF, &H1E0E850, &H8D530000, &HFFFF7085, &H2BE850FF, &H8B000003, &H74FF85F8, &H80C78108, &HEB000001, &H858D530F, &HFFFFFF40, &H310E850, &HF88B0000, &H73FE3B53, &H40858D0F, &H50FFFFFF, &HE90875FF, &H110&, &H50A0458D, &HFFF6CBE8, &H458D53FF, &HC1E850D0, &H8BFFFFF6, &H8BC62BC7, &H6EEC1F0, &H3FE08353, &HFF501A74, &H458D1475, &HF0048DA0, &HF745E850
-    pvAppendBuffer &H4489FFFF, &H5489D0F5, &HFEBD4F5, &H8D1475FF, &H48DA045, &H66E850F0, &H53000003, &H53085D8B, &HFFF67FE8, &H46383FF, &H103C700, &H6A000000, &HFF815E06, &H180&, &HFF561577, &H458D1475, &H8AE850A0, &H85FFFFF6, &H88880FC0, &H56000000, &HFF70858D, &H8D50FFFF, &HE850D045, &HFFFFF671, &H1778C085, &H8D564C75, &HFFFF4085, &H458D50FF, &H5AE850A0, &H85FFFFF6, &H56377FC0, &H50A0458D
-    pvAppendBuffer &HFF40858D, &H5050FFFF, &H4D2E8, &H74C20B00, &H8D53560F, &HFFFF7085, &HE85050FF, &H4BF&, &HD0458D56, &H70858D50, &H50FFFFFF, &H4ADE850, &H758B0000, &HD0458DD0, &HC150066A, &H68E81FE6, &H6A000002, &HA0458D06, &H25DE850, &H75090000, &H58E94FCC, &H56FFFFFF, &HFF40858D, &H5350FFFF, &H29CE8, &H5B5E5F00, &HC25DE58B, &H8B550010, &H60EC83EC, &HFFA0458D, &H75FF1475, &HC75FF10
-    pvAppendBuffer &H6CE850, &H75FF0000, &HA0458D14, &H875FF50, &HFFFA5AE8, &H5DE58BFF, &H550010C2, &HEC83EC8B, &HA0458D60, &HFF1075FF, &HE8500C75, &H27D&, &H8D1075FF, &HFF50A045, &H30E80875, &H8BFFFFFA, &HCC25DE5, &HEC8B5500, &HFF1875FF, &H75FF1075, &H875FF0C, &H406E8, &H74C20B00, &H1875FF11, &HFF1475FF, &H75FF0875, &HF49FE808, &HC25DFFFF, &H8B550014, &H64EC83EC, &HF144D8B, &H5653C057
-    pvAppendBuffer &H66FF3357, &HCC45130F, &H8DCC758B, &HFFFF4D04, &H8947FFFF, &H458BE845, &H2BDB33D0, &H130F66F9, &H7D89D445, &H1F148DE4, &H33C0570F, &H130F66FF, &HD93BF845, &H8BD7420F, &H5589FC7D, &HFD33BF0, &HBD87&, &H10758B00, &HC22BC38B, &H8DF47D89, &H458BC634, &HEC7589F8, &H3BFC4589, &H97830FD1, &HFF000000, &H458B0476, &HFF36FF0C, &HFF04D074, &H458DD034, &HC6E850AC, &H8BFFFFE1, &HBC7D8DF0
-    pvAppendBuffer &HA510EC83, &H8BA5A5A5, &H83F08BFC, &H458D10EC, &HA5A5A59C, &H8DFC8BA5, &HA550CC75, &HE8A5A5A5, &HFFFF8D63, &H7D8DF08B, &HA5A5A5CC, &HD8458BA5, &H77C8453B, &H8B087211, &H453BD445, &H330773C4, &HC93340C0, &H570F0EEB, &H130F66C0, &H4D8BDC45, &HDC458BE0, &H8BFC4501, &H558BF47D, &H8BF913F0, &H8B42EC75, &HEE83144D, &HF47D8908, &H89F05589, &HD33BEC75, &HFF61860F, &H458BFFFF, &HCC758BD0
-    pvAppendBuffer &H558B06EB, &HFC5589F8, &H8B08558B, &H3489FC4D, &HD4758BDA, &H4DA4489, &HD8458B43, &H8BD44D89, &H7D89144D, &HE47D8BD8, &H89CC7589, &H5D3BD045, &HEE820FE8, &H3FFFFFE, &H74895FC9, &H895EF8CA, &H5BFCCA44, &HC25DE58B, &H8B550010, &H75FF56EC, &H8758B0C, &H2EE856, &HC88B0000, &H2374C985, &HFCCE548B, &HCE7C8B57, &HEBF633F8, &HD7AC0F07, &H46EAD101, &HC20BC78B, &HE1C1F375, &H418D5F06
-    pvAppendBuffer &H5EC603C0, &H8C25D, &H8BEC8B55, &HE9830C4D, &H8B117801, &H48B0855, &HCA440BCA, &H83057504, &HF27901E9, &H5D01418D, &H550008C2, &H5151EC8B, &HF0C458B, &H5756C057, &H66087D8B, &HF845130F, &H3BC7348D, &H8B3276F7, &H8B53F845, &H4589FC5D, &HFC4E8B08, &H8B08EE83, &HFC28B16, &HB01C8AC, &H65830845, &HE9D10008, &H689CB0B, &H4E89DA8B, &H1FE3C104, &HD977F73B, &H8B5E5F5B, &H8C25DE5
-    pvAppendBuffer &HEC8B5500, &H8510558B, &H8B1E74D2, &H8B56084D, &HF12B0C75, &H890E048B, &H8498D01, &HFC0E448B, &H83FC4189, &HEC7501EA, &HCC25D5E, &HEC8B5500, &H8B64EC83, &HD2331045, &HC0570F53, &HC8D5642, &HFFFFFF45, &H130F66FF, &H4D89CC45, &H2BC933E0, &H130F66D0, &H8B57D445, &H4D89D07D, &HDC5589E4, &HF0A1C8D, &HD233C057, &H45130F66, &HEC758BEC, &H420FC83B, &HFD93BDA, &H11587, &HC558B00
-    pvAppendBuffer &HC32BC18B, &H8DFC7589, &H558BC23C, &HE87D89F0, &H8BF85589, &H89C32BC1, &HD83BF045, &HEB870F, &H77FF0000, &HC458B04, &H74FF37FF, &H34FF04D8, &HAC458DD8, &HDF87E850, &H7D8DFFFF, &HA5F08BBC, &H3BA5A5A5, &H4373F05D, &H8BC84D8B, &HC0558BC1, &HE8C1F28B, &HFC45011F, &H83C4458B, &H3300F855, &HC1A40FFF, &H1FEEC101, &HF90BC003, &H7D89F00B, &HBC458BF4, &H1C2A40F, &H3F07589, &HC47589C0
-    pvAppendBuffer &H89C87D89, &H5589BC45, &H8B0CEBC0, &H4589C845, &HC4458BF4, &H83F04589, &H758D10EC, &H8DFC8BBC, &HEC839C45, &HA5A5A510, &H8DFC8BA5, &HA550CC75, &HE8A5A5A5, &HFFFF8ACF, &H7D8DF08B, &HA5A5A5CC, &HD8458BA5, &H77F4453B, &H8B087211, &H453BD445, &H330773F0, &HC93340C0, &H570F0EEB, &H130F66C0, &H4D8BEC45, &HEC458BF0, &H8BFC758B, &HF003F855, &H13E87D8B, &HFC7589D1, &H43E44D8B, &H8908EF83
-    pvAppendBuffer &H7D89F855, &HFD93BE8, &HFFFF0686, &HD07D8BFF, &H558B03EB, &H8458BF0, &H89CC5D8B, &HD88BC81C, &H8910458B, &H4104CB7C, &H8BD87D8B, &H5589D45D, &HDC558BD8, &H89CC5D89, &H7589D07D, &HE44D89D4, &HFE04D3B, &HFFFE9782, &H84D8BFF, &H7C89C003, &H5E5FFCC1, &HF8C15C89, &H5DE58B5B, &H55000CC2, &H5151EC8B, &H57C0570F, &H66147D8B, &HF845130F, &H8BFC558B, &HFF85F84D, &H458B6B74, &H1045290C
-    pvAppendBuffer &H53084529, &H105D8B56, &H342B308B, &HC758903, &H1B04708B, &H8B040374, &HD92B0C5D, &H1B0C5D89, &H8B183BF2, &H575085D, &H7404703B, &H4703B23, &H7771072, &H4D39088B, &H3307760C, &HD23341C9, &H570F0EEB, &H130F66C0, &H558BF845, &HF84D8BFC, &H890C7D8B, &H7489033C, &HC0830403, &H146D8308, &H5EA27501, &H5FC18B5B, &HC25DE58B, &H8B550010, &H84D8BEC, &H5756D233, &H330C7D8B, &H83C78BF6
-    pvAppendBuffer &HAB0F3FE0, &H20F883C6, &H33D6430F, &H40F883F2, &HC1D6430F, &H342306EF, &HF95423F9, &H5FC68B04, &H8C25D5E, &HEC8B5500, &H8B08558B, &HC4D8BC2, &H8818E8C1, &HC1C28B01, &H418810E8, &HC1C28B01, &H418808E8, &H3518802, &H8C25D, &H8BEC8B55, &HCA8B0855, &HC5D8B53, &HE8C1C38B, &H758B5618, &H8B068810, &H10E8C1C3, &H8B014688, &H8E8C1C3, &H8B024688, &HC1AC0FC3, &H35E8818, &H8818E8C1
-    pvAppendBuffer &HC38B044E, &HAC0FCA8B, &HE8C110C1, &H88C28B10, &HAC0F054E, &H468808D8, &H7568806, &H5E08EBC1, &HCC25D5B, &HEC8B5500, &H8B08558B, &H5D8B53CA, &HFC38B0C, &H5608C1AC, &HC110758B, &HC38B08E8, &H4E881688, &HFCA8B01, &HC110C1AC, &HC38B10E8, &HF024E88, &HC118C2AC, &H568818E8, &H88C38B03, &HE8C1045E, &H5468808, &HE8C1C38B, &H18EBC110, &H88064688, &H5B5E075E, &HCC25D, &H8BEC8B55
-    pvAppendBuffer &HD2851455, &H4D8B1F74, &H758B5610, &H7D8B570C, &H2BF12B08, &HE048AF9, &H4880132, &HEA83410F, &H5FF27501, &H10C25D5E, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&
+    pvAppendBuffer &H0&, &H760&, &HB037&, &H6C08&, &H7347&, &H7627&, &H6CBF&, &H7668&, &H885E&, &H8FE8&, &H92CA&, &H891B&, &H930B&, &HBA55&, &HC5C2&, &HC6CD&, &HB9C8&, &HD3F4&, &HD36C&, &HB93B&, &HD1D3&, &HD221&, &HC248&, &HC29B&, &HCC48&, &HD036&, &HC307&, &HC413&, &HF59E&, &HF2C0&, &HB555&, &H987C&
+    pvAppendBuffer &HCD75&, &HD167&, &HC3B9&, &HBC10&, &HF640&, &HDC07&, &HE3A7&, &HD553&, &HD4E3&, &HD6DF&, &H5812&, &H582B&, &HF4B6&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&
+    pvAppendBuffer &H53E58955, &HD089C389, &HF18EAC1, &H26188CB, &HC2891188, &H8910EAC1, &H885B0459, &H885D0151, &HFC30341, &HC30289C8, &HC80F008B, &HC3008BC3, &H55C30289, &HE589C931, &H8A1C8B53, &H41881C89, &H750AF983, &HC35D5BF4, &H89D18955, &H535657E5, &HE483DB31, &H30EC83F8, &H4244489, &H8BD9048B, &H8904D954, &H244489C6, &H81D78928, &HC6&, &H24548902, &H24548B2C, &H83F0892C, &H2500D7
+    pvAppendBuffer &H89FC0000, &H891C247C, &H8B182444, &H2B282444, &H1B182444, &HF1C2454, &HC11AFEAC, &H74031AFF, &H7C1308D9, &H4890CD9, &H89F089D9, &H8904D954, &H5FA&, &H74890100, &HD2832024, &H247C8900, &H89C68924, &H245489D7, &HFEAC0F14, &H19FFC119, &H2C247C89, &HE781C789, &HFE000000, &H28247489, &H2024748B, &H10247C89, &H24247C8B, &H1024742B, &H14247C1B, &H8D97489, &HCD97C89, &H7408FB83
+    pvAppendBuffer &H24448B18, &H24548B28, &HD944012C, &HD9541110, &H2C38314, &HFFFF43E9, &H245C6BFF, &H13B8132C, &HF7000000, &H1282464, &H130103DA, &HC6890451, &HC681D789, &H2000000, &HD783F389, &HE38100, &H89FC0000, &H890C247C, &H2B08245C, &H1B082444, &H890C2454, &HFEAC0F01, &H451891A, &H11AFFC1, &H79110871, &H8BC0310C, &H5C8BC114, &H14890424, &HF8834083, &H8DF0750A, &H5E5BF465, &H55C35D5F
+    pvAppendBuffer &HE589D231, &HF8E48353, &H8B50EC83, &HC89900C, &H1FF9C1D4, &H4D44C89, &HAFA8342, &HE289ED75, &HFFFEA3E8, &HFC5D8BFF, &H8955C3C9, &HCF8957E5, &H53DFF756, &HC031C389, &H8B83348B, &HF131820C, &HCE31F921, &H31833489, &H8340820C, &HE8750AF8, &H5D5F5E5B, &HE58955C3, &HBB535657, &H1A&, &H83F8E483, &H48938EC, &H24448D24, &HFE41E810, &H88E8FFFF, &H6BFFFFFF, &H13342444, &H5D231
+    pvAppendBuffer &HC1010000, &HD68919F8, &H4403D989, &H83421094, &HF12901E6, &HFA83F8D3, &H6BEB750A, &H440113C0, &H448D1024, &HD2311024, &H4244489, &H1AB9D689, &H42000000, &H2901E683, &HD3308BF1, &H47001FE, &HD304C083, &HFC488BE6, &H4889F129, &H9FA83FC, &H6481DA75, &HFFFF3424, &HC03101FF, &HC6243C8B, &H40000704, &H7520F883, &H1BFF3, &H448B0000, &HF9890424, &HD1241C8B, &H89308BE9, &H7E183F8
+    pvAppendBuffer &H8D04E8C1, &HE6D31814, &HD989DB31, &HE8D3F089, &H208D989, &H8C18342, &HF983CB89, &H83EB7520, &H448333C7, &H81040424, &H1FFFF, &H8DBF7500, &H5E5BF465, &H55C35D5F, &H5657E589, &HD231D689, &H51C38953, &HB933C26B, &H1A&, &HF0458940, &H104E8C1, &HFD53E8F0, &HC789FFFF, &HE083D089, &HB8C12901, &H1&, &H4D8BE0D3, &HE9D148F0, &HD307E183, &H89F821EF, &H83429304, &HC4750AFA
+    pvAppendBuffer &H5F5E5B58, &H8955C35D, &HD68956E5, &H31C38953, &H81148BC0, &H89861403, &H83408314, &HF1750AF8, &HC35D5E5B, &H56E58955, &H8953D689, &H8BC031C3, &H142B8614, &H83148981, &HAF88340, &H5E5BF175, &H8955C35D, &H535657E5, &H83F8E483, &H548968EC, &HC890424, &H24448924, &H31C03108, &HC45489D2, &HC4548918, &HF883401C, &H31F0750A, &H24448BC9, &H31CE8904, &H88048BDB, &H10244489, &H8913C06B
+    pvAppendBuffer &H8B0C2444, &H89102444, &H244489F7, &H9FE8314, &H448B0B7E, &H7E8D0C24, &H244489F6, &H8BC88914, &HD8212414, &H4001E083, &H9A04AF0F, &H14246CF7, &H18FC4401, &H1CFC5411, &HFB834643, &H41C4750A, &H750AF983, &H24448BA8, &H24548D08, &HFC76E818, &H658DFFFF, &H5F5E5BF4, &H8955C35D, &H535657E5, &H83F8E483, &H548968EC, &H44890C24, &HC0310424, &H5489D231, &H548918C4, &H83401CC4, &HF0750AF8
+    pvAppendBuffer &H448BDB31, &HDE890C24, &H8998048B, &H6B102444, &H448913C0, &H48D0824, &H2444891B, &H247C8B14, &H24548B14, &H9FF8310, &H548B077E, &H7F8D0824, &H21F089F6, &H1E083D8, &HFDE3940, &HE0D3C195, &HC244C8B, &HB104AF0F, &H4401EAF7, &H541118FC, &HFF461CFC, &H83142444, &HC1750AFE, &HAFB8343, &H448BA075, &H548D0424, &HD9E81824, &H8DFFFFFB, &H5E5BF465, &H55C35D5F, &HE589C931, &HDB41BF57
+    pvAppendBuffer &H53560001, &HE483D389, &H58EC83F8, &H4244489, &H2CF7F889, &H24748D8B, &HCE048908, &H4CE5489, &HAF98341, &H448BEA75, &HF2890424, &HFFFB97E8, &HF4658DFF, &H5D5F5E5B, &HE58955C3, &H53C68956, &H834BCB89, &HFE8F8E4, &H89FFFFFF, &HE8F089F2, &HFFFFFF06, &H8DF4754B, &H5E5BF865, &H8955C35D, &HD78957E5, &HE4835356, &H78EC81F8, &H8D000001, &H8910245C, &H748D2404, &HD8893824, &HFFFED9E8
+    pvAppendBuffer &H24848DFF, &H150&, &H2B9DA89, &H89000000, &HE8042444, &HFFFFFFA1, &H424548B, &HF089F989, &H60247C8D, &HFFFE19E8, &H89D989FF, &HE8F889F2, &HFFFFFE0E, &H424448B, &H9C8DFA89, &H8824&, &HFE94E800, &H548BFFFF, &HF1890424, &HB48DD889, &HB024&, &HFDE8E800, &H448BFFFF, &HDA890424, &H5B9&, &HFF4FE800, &H548BFFFF, &HD9890424, &H9C8DF089, &HD824&, &HFDC4E800, &H448BFFFF
+    pvAppendBuffer &HF2890424, &HAB9&, &HFF2BE800, &H548BFFFF, &HF1890424, &HA7E8D889, &H8BFFFFFD, &H89042444, &H14B9DA, &HEE80000, &H8BFFFFFF, &H89042454, &H249C8DD9, &H100&, &H83E8D089, &H8BFFFFFD, &HB9042454, &HA&, &HEAE8D089, &H8BFFFFFE, &H89042454, &H8DD889F1, &H12824B4, &H5FE80000, &H8BFFFFFD, &H89042444, &H32B9DA, &HC6E80000, &H8BFFFFFE, &H89042454, &HE8F089D9, &HFFFFFD42
+    pvAppendBuffer &H424448B, &H64B9F289, &HE8000000, &HFFFFFEA9, &H424548B, &HD089F189, &HFFFD25E8, &H24548BFF, &H32B904, &HD0890000, &HFFFE8CE8, &H24548BFF, &H89D98904, &HFD08E8D0, &H548BFFFF, &H5B90424, &H89000000, &HFE6FE8D0, &H548BFFFF, &H48B0424, &HE8F98924, &HFFFFFCEA, &H5BF4658D, &HC35D5F5E, &H89C03155, &H535657E5, &H81F8E483, &H158EC, &HC558B00, &H88020C8A, &H4020044C, &H751FF883
+    pvAppendBuffer &H1F428AF3, &H40245C8D, &H8010558B, &HF8202464, &H833FE083, &H448840C8, &HD8893F24, &HFFFC16E8, &H8BC031FF, &H94898314, &H9084&, &H89D23100, &HB88494, &H54890000, &H94896884, &HE084&, &HF8834000, &HC7DC750A, &HE02484, &H10000, &HFEBB0000, &HC7000000, &H1682444, &H89000000, &H8DD989D8, &H10824B4, &HF8C10000, &H7E18303, &H3024BC8D, &HF000001, &H200444B6, &HE083F8D3
+    pvAppendBuffer &H24448901, &H24848D04, &H90&, &H4244C8B, &HC244489, &HC24548B, &H6824448D, &H14244489, &HFFFA85E8, &H24848DFF, &HE0&, &H4244C8B, &H8244489, &H824548B, &HB824848D, &H89000000, &HE8102444, &HFFFFFA62, &H10244C8B, &H1424548B, &HAFE8F089, &H8BFFFFFB, &H8B142454, &H8910244C, &HFBBEE8D0, &H4C8BFFFF, &H548B0824, &H448B0C24, &H8FE81024, &H8BFFFFFB, &H8B0C2454, &H8908244C
+    pvAppendBuffer &HFB9EE8D0, &H448BFFFF, &HF2890824, &HFFFC49E8, &H24548BFF, &HE8F88914, &HFFFFFC3E, &H14244C8B, &H1024548B, &H97E8C889, &H8BFFFFFB, &H8B0C2454, &H89102444, &HFB88E8F1, &H4C8BFFFF, &H548B1024, &HF0891424, &HFFFB3DE8, &H24548BFF, &H244C8B14, &HE8D08910, &HFFFFFB4C, &H1424548B, &HC24448B, &HFFFBF5E8, &H24548BFF, &H24448B08, &HE8F98910, &HFFFFFB30, &H1024548B, &H1424448B, &HFFFC76E8
+    pvAppendBuffer &H24548BFF, &H244C8B14, &HE8D08908, &HFFFFFAF6, &H1024548B, &H14244C8B, &H23E8D089, &H8BFFFFFB, &H8B082454, &H89142444, &HFB14E8F9, &H548BFFFF, &H448B0C24, &H4C8D0824, &H3E84024, &H8BFFFFFB, &H890C2444, &HFB90E8F2, &H4C8BFFFF, &H548B0424, &H448B0C24, &H4FE81424, &H8BFFFFF9, &H8B04244C, &H8B082454, &HE8102444, &HFFFFF93E, &HF01EB83, &HFFFE6A83, &H24548BFF, &HE8D08910, &HFFFFFC5E
+    pvAppendBuffer &H1424548B, &H10244C8B, &HB3E8D089, &H8BFFFFFA, &H8B142454, &H3AE80845, &H8DFFFFF9, &H5E5BF465, &HCC25D5F, &HC2895500, &H5657E589, &H83C38953, &HEC81F8E4, &H158&, &H18247C8D, &H9024B48D, &H89000000, &HFB10E8F8, &H438DFFFF, &H24448928, &H24548B08, &H24448D08, &H24448940, &HFAF8E804, &H438DFFFF, &H24048950, &H8D24148B, &H89682444, &HE8142444, &HFFFFFAE2, &H14244C8B, &HC889CA89
+    pvAppendBuffer &HFFFA01E8, &H24448BFF, &HF871E814, &H4C8BFFFF, &HDA890824, &HEBE8F089, &H89FFFFF9, &HE8F089F2, &HFFFFFAB6, &H424548B, &HB824848D, &H89000000, &H244489F9, &H24BC8D10, &H108&, &HFFF9C5E8, &H24548BFF, &H24848D04, &HE0&, &HC244489, &HFFF9CFE8, &H244C8BFF, &H89F28910, &H24B48DF8, &H130&, &HFFF9BBE8, &H244C8BFF, &H24548B0C, &HE8F08914, &HFFFFF9AC, &HFA89F189, &HBFE8D889
+    pvAppendBuffer &H8BFFFFF9, &H8B0C244C, &H8B102454, &HE8082444, &HFFFFF9AE, &HC24548B, &H8924048B, &HF9A0E8F1, &H4C8BFFFF, &H438D1024, &HE8FA8978, &HFFFFF992, &H5BF4658D, &HC35D5F5E, &H57E58955, &H53D68956, &H408DC389, &H8DD98928, &HE4832853, &H60EC81F8, &H89000001, &H8D042444, &H8D202444, &H9824BC, &H44890000, &H39E81C24, &H8BFFFFF9, &H8D1C2454, &HD089284E, &HFFF949E8, &H24548BFF, &H24448D04
+    pvAppendBuffer &H89D98948, &HE8182444, &HFFFFF8FA, &H1824548B, &HD089F189, &HFFF929E8, &H78438DFF, &H89504E8D, &H148B2404, &H24448D24, &H24B48D70, &H110&, &H10244489, &HFFF909E8, &H50438DFF, &H14244489, &HC289C189, &HBBE8F889, &H8BFFFFF8, &H8B1C244C, &H8D182454, &HC02484, &H44890000, &HC1E80C24, &H8BFFFFF8, &H8D10244C, &HE82484, &HFA890000, &H8244489, &HFFF8ABE8, &H244C8BFF, &H89FA8910
+    pvAppendBuffer &H24BC8DF0, &H138&, &HFFF879E8, &H244C8BFF, &H24548B1C, &HE8F88918, &HFFFFF86A, &H8244C8B, &HC24548B, &H97E8D889, &H8BFFFFF8, &H89042444, &HE8F289F9, &HFFFFF88A, &H824548B, &H1424448B, &H7BE8F189, &H8BFFFFF8, &H8B0C2454, &HF9892404, &HFFF86DE8, &HF4658DFF, &H5D5F5E5B, &HC7C931C3, &HC804&, &H44C70000, &H4C8&, &H39410000, &HC3EC75CA, &H31C18955, &H53E589C0, &H4C15C8B
+    pvAppendBuffer &H75C11C0B, &HC239400C, &H1B8F275, &HEB000000, &H5BC03102, &H8955C35D, &H3FE183D1, &H8957E589, &H5EFC1CF, &H1E78356, &H89D38953, &H6EBC1FE, &HD301F683, &HD8548BE7, &H8BE6D304, &H215BD80C, &H5EF121FA, &H5DC8895F, &H4C8B4AC3, &HC0B04D0, &H830775D0, &H2D7201EA, &HFA83F0EB, &H552674FF, &H5356E589, &H8BD00C8B, &H3104D05C, &H9DE89C0, &HF0974CE, &H4001D9AC, &HF1EBEBD1, &H5B06E2C1
+    pvAppendBuffer &H5DD0015E, &HC3C031C3, &H57E58955, &H8956D789, &HDB3153C6, &H8BDF048B, &H8904DF54, &H5489DE04, &H394304DE, &H5BED75D9, &HC35D5F5E, &H89C18955, &H535657E5, &H83F8E483, &H458B10EC, &HC5D8B08, &H4245489, &H31240489, &H24548BC0, &HC1348B04, &H4C17C8B, &H33C23433, &H8B04C27C, &HF2212414, &H8245489, &H748BFA89, &HDA210824, &H89C13433, &H8B0C2454, &H330C247C, &H8904C17C, &H7C89C134
+    pvAppendBuffer &H394004C1, &HC1751045, &H5BF4658D, &HC25D5F5E, &H8D55000C, &HC931D014, &H3153E589, &H74D039DB, &HB080B0A, &HC0830458, &H89F2EB08, &HF7DA89C8, &HD283D8, &HDA09DAF7, &HD0895D5B, &HE8C1D231, &HFFC0831F, &HC3FFD283, &H57E58955, &H418DC789, &H835356FF, &HEC83F8E4, &H24548908, &H245C8B04, &HC7548B04, &HC7348B04, &H89C30C8B, &H4C8B240C, &H343904C3, &H19CB8924, &H8B1272D3, &HDE39241C
+    pvAppendBuffer &H1072CA19, &H7301E883, &HEBC031D4, &H1B80A, &H3EB0000, &H8DFFC883, &H5E5BF465, &H55C35D5F, &H3157E589, &H835356FF, &HEC83F8E4, &H244C8920, &H40B918, &H44890000, &H448B0C24, &H54891824, &HC1290824, &H1C247C89, &H10247C89, &H14247C89, &H4244C89, &H824448B, &H1C247C8B, &H4C8ADB31, &H348B1824, &HF87C8BF8, &H89F08904, &HF2A50FFA, &HC1F6E0D3, &HD0450F20, &H89C3450F, &H8BC189D3
+    pvAppendBuffer &H8B1C2454, &HB0C2444, &HB10244C, &H8914245C, &H4C8AD00C, &H5C890424, &HF08904D0, &HF631FA89, &HAD0FEAD3, &H20C1F6F8, &HFC2450F, &H44FFD645, &H44891C24, &H448B1024, &H54891C24, &H45391424, &H8B917508, &H8B102444, &H8D142454, &H5E5BF465, &H4C25D5F, &HE5895500, &H56C78957, &H31D0348D, &H53D231C0, &H83F8E483, &HF73908EC, &H5E8B2B73, &HF84E8BFC, &H8908EE83, &HAC0F240C, &HC10901D9
+    pvAppendBuffer &H8924048B, &HD104245C, &H89D309EB, &H89C2890E, &HC031045E, &HEB1FE2C1, &HF4658DD1, &H5D5F5E5B, &HE58955C3, &H56CF8957, &HF8E48353, &H8950EC83, &H448D2404, &HCDE81824, &H31FFFFFD, &HCC4489C0, &HCC448918, &H2444891C, &H1478D0C, &H8244489, &H824548B, &H1824448D, &HFFFD17E8, &H85C689FF, &H99850FC0, &H8B000000, &H8B182444, &H891C2454, &H1E183C1, &H7400C983, &H89C18964, &H1FE683C6
+    pvAppendBuffer &H7410E180, &H20EE8305, &HF68517EB, &HF3891374, &H291FFBC1, &H89DA19F0, &H89182444, &HEB1C2454, &H8DF0893C, &HF7182454, &H245489D8, &H89C38904, &HC1C031C1, &HC7391FFB, &HCA892372, &H1D74DA09, &H424548B, &H13C20C03, &H8904C25C, &H920FC20C, &HC25C89C1, &HC9B60F04, &HEB40DB31, &H2444FFD9, &H241C8B0C, &H548BF089, &H44880C24, &H548BFF13, &H448D0824, &HDAE81824, &HE9FFFFFE, &HFFFFFF49
+    pvAppendBuffer &HC24448B, &H5BF4658D, &HC35D5F5E, &H57E58955, &H53F63156, &H83F8E483, &H4C8918EC, &H44890424, &HC0310C24, &H8245489, &H5C8BD231, &H7C8B0824, &HC8B0424, &HF35C8BF3, &H244C8904, &HF70C0310, &H14245C89, &H4F75C13, &HD311C101, &H14245C39, &H4C390675, &H19741024, &H10247C8B, &H1B8D231, &H39000000, &H1BDF89F9, &H7214247C, &H31C03104, &H247C8BD2, &HF70C890C, &H4F75C89, &H8753946
+    pvAppendBuffer &H658DA875, &H5F5E5BF4, &H4C25D, &H57E58955, &H53F63156, &H83F8E483, &H4C8918EC, &H44890424, &HC0310C24, &H8245489, &H5C8BD231, &H7C8B0824, &HC8B0424, &HF35C8BF3, &H244C8904, &H89C12910, &H1914245C, &HF70C2BD3, &H4F75C1B, &H14245C39, &H4C390675, &H17741024, &H14247C8B, &H4C39D231, &H1B81024, &H19000000, &H310472DF, &H8BD231C0, &H890C247C, &H5C89F70C, &H394604F7, &HAA750875
+    pvAppendBuffer &H5BF4658D, &HC25D5F5E, &H89550004, &H535657E5, &HE483D389, &H18EC83F8, &H890C758B, &H8B042444, &HFE6B0845, &H24048900, &H4489E2F7, &HD8891024, &H8900D96B, &HF7142454, &H244489E6, &H89F08908, &HF70C2454, &H247C01E1, &H8BC6890C, &HD7892404, &HDA01E1F7, &H14245C8B, &H8244403, &HC245413, &HDB31D989, &H4C8BC801, &HDA110824, &HC839D389, &HC245C1B, &H8B470173, &H8B04245C, &H8910244C
+    pvAppendBuffer &H89082444, &HD0890443, &HF001D231, &HFA110B89, &H89084389, &HC5389D8, &H5BF4658D, &HC25D5F5E, &H8D570008, &H8308247C, &H77FFF8E4, &HE58955FC, &HFE895657, &H83C38953, &H768B08EC, &H563F8B04, &HFFFE47E8, &H59C209FF, &HF1890F75, &HD889FA89, &HFFFBF3E8, &H78C085FF, &HF989500E, &HD889DA89, &HFEA6E856, &H8D5AFFFF, &H5E5BF465, &H678D5D5F, &H8C25FF8, &H4B95700, &H8D000000, &H8308247C
+    pvAppendBuffer &H77FFF8E4, &HE58955FC, &HE6F9E857, &HC7810000, &HE6FE&, &HD3895356, &H894CEC83, &H7D89CC45, &HFAE2E8C4, &HC031FFFF, &H4589D231, &HD44589D0, &H892C438B, &H538BD855, &HDC458934, &H8930438B, &H538BE455, &HE045893C, &H8938438B, &H4589EC55, &HD0458DE8, &H89C84589, &H1B951C2, &H6A000000, &HFBB9E804, &H558BFFFF, &HC84D8BCC, &HC689046A, &H95E8D089, &H8BFFFFFD, &H4B8B387B, &H1D2313C
+    pvAppendBuffer &H89F631F0, &H438BC045, &H31FA0930, &HD87589FF, &H4589F631, &H34438BDC, &H8BE45589, &HF009C855, &HB9E84D89, &H1&, &H4589F631, &H89D089E0, &H46AEC7D, &HFFFB66E8, &HC07D8BFF, &H6ACC558B, &HC84D8B04, &HD089C701, &HFFFD3FE8, &H24538BFF, &H1C84D8B, &H20438BC7, &H8BD45589, &H45893C53, &H28438BD0, &H8BEC5589, &H4589CC55, &H89C031D8, &H4589DC45, &HE44589E0, &H8938438B, &HD089E845
+    pvAppendBuffer &H5E8046A, &H8BFFFFFD, &HD231344B, &H7B8BF801, &HC0458928, &H924438B, &HBC4D89FA, &HF009FF31, &H5589F631, &H89D231D4, &H550BB875, &H89F631BC, &H438BD045, &HB8450B2C, &H89DC5589, &H538BD845, &H38438B3C, &H89B04D89, &H7B8BB47D, &HE0458920, &H89B0458B, &H558BE455, &H8BF009B4, &HF631C84D, &H4589FA09, &HEC5589E8, &H6ACC558B, &HE8D08904, &HFFFFFC98, &H31C07D8B, &H344B8BD2, &H7B8BF801
+    pvAppendBuffer &HD84D8930, &H8BB84589, &HFA092C43, &H8B287B8B, &HF009C84D, &H31D45589, &H89D231F6, &HC031D045, &H4589FA09, &HE04589DC, &H8BE44589, &H55892043, &HCC558BEC, &H4589F009, &H6AD089E8, &HFCCAE804, &H758BFFFF, &H34538BB8, &H7B8BC931, &HA84D892C, &H438BC629, &HC84D8B30, &H8BD45589, &H7D893C53, &HD04589AC, &H8938438B, &HD231DC55, &H89AC550B, &H438BD845, &HA8450B24, &H89EC5589, &H558BE845
+    pvAppendBuffer &H89046ACC, &HFC82E8D0, &H7B8BFFFF, &H8BD23138, &HC629304B, &H8934438B, &HF631B875, &H7B8BFA09, &H89F00920, &HD231D455, &H4589F631, &H3C438BD0, &HFF31FA09, &H8BDC5589, &HF0092853, &H8924738B, &H4589EC4D, &H8BC031D8, &HF009C84D, &HF631FA09, &H4589FF31, &HE45589E0, &H89CC558B, &H46AE875, &H25E8D089, &H8BFFFFFC, &H538BB875, &HD87D893C, &H29C84D8B, &H38438BC6, &H8BD45589, &H45892C53
+    pvAppendBuffer &H24438BD0, &H31E45589, &HDC4589D2, &H8928438B, &H558BE855, &HE04589CC, &H8934438B, &HD089EC45, &HE5E8046A, &H59FFFFFB, &H6079C629, &H8BC4458B, &HFF077488, &H558B53FF, &H81046ACC, &HBB0C1, &HE8D08900, &HFFFFFB44, &H78C6015F, &H8B43EBDF, &H558BC445, &H4B9CC, &H808B0000, &HFFFF0774, &HBB005, &HF8DEE800, &H7448FFFF, &HC4458B25, &H774888B, &H8B50FFFF, &H46ACC55, &HBB0C181
+    pvAppendBuffer &HD0890000, &HFFFB83E8, &H5AC629FF, &HBF74F685, &H658DDBEB, &H5F5E5BF4, &HF8678D5D, &HB957C35F, &H6&, &H8247C8D, &HFFF8E483, &H8955FC77, &HD0E857E5, &H810000E3, &HE3D5C7, &HF6315600, &H83D38953, &H458944EC, &HB47D89BC, &HFFF7B7E8, &H8BC031FF, &H4B8B587B, &HC045895C, &H4589D231, &H89FA09C4, &H4589C845, &H54438BCC, &H9D45589, &HD84D89F0, &H1B9&, &HD0458900, &H4589C031
+    pvAppendBuffer &HE04589DC, &H89E44589, &H4589E845, &HC0458DEC, &H52B84589, &H66AC289, &HFFF882E8, &HBC558BFF, &H6AB84D8B, &H89C78906, &HFA5EE8D0, &H558BFFFF, &H304B8DBC, &HC701066A, &H4DE8D089, &H8BFFFFFA, &H738B5853, &H31F80154, &HB84D8BFF, &HFF31FA09, &H31B04589, &HC45589C0, &H930538B, &H5C738BF0, &H31C04589, &H31FA09C0, &HCC5589FF, &H938538B, &H34738BF0, &H31C84589, &H31FA09C0, &HD45589FF
+    pvAppendBuffer &H940538B, &H3C738BF0, &H31D04589, &H9FA09C0, &HDC5589F0, &H8B48538B, &H45894473, &H31C031D8, &H31FA09FF, &H89F009FF, &H738BE455, &H50538B4C, &H31E04589, &H31F009C0, &H89FA09F6, &H5589E845, &HBC558BEC, &HD089066A, &HFFF9BFE8, &HB07D8BFF, &H3134538B, &HC04D89C9, &H1B84D8B, &H5C438BC7, &H8BD45589, &H75893C53, &HC44589C8, &H8950438B, &H538BDC55, &HCC458944, &H8930438B, &H538BE455
+    pvAppendBuffer &HD045894C, &H8938438B, &H558BEC55, &HD84589BC, &H8940438B, &H438BE045, &HE8458948, &H66AD089, &HFFF967E8, &H54538BFF, &H1B84D8B, &H89C031C7, &H4589C045, &HC84589C4, &H8BCC4589, &H55895043, &H5C538BD4, &H8BD04589, &H55895843, &HBC558BDC, &H31D84589, &HE04589C0, &H89E44589, &H4589E845, &H6AD089EC, &HF922E806, &HD231FFFF, &HC701C931, &H8950438B, &H538BC855, &HD84D895C, &H31C04589
+    pvAppendBuffer &HC44589C0, &H8954438B, &H558BD455, &HCC4589BC, &H8958438B, &H4D8BDC4D, &HD04589B8, &H66AD089, &HFFF8E7E8, &H30538BFF, &H15C738B, &H8BFF31F8, &HFA09B84D, &H31B04589, &H89FF31C0, &H538BC455, &H8BF00938, &H45893473, &H9C031C0, &H9FF31FA, &HCC5589F0, &H8B3C738B, &H45894053, &H9C031C8, &H44738BF0, &HFF31FA09, &H31D04589, &HD45589C0, &H948538B, &H4C738BF0, &H31D84589, &H31FA09C0
+    pvAppendBuffer &HDC5589FF, &H950538B, &H54738BF0, &H31E04589, &H31FA09C0, &HE45589FF, &H958538B, &H89F631F0, &HFA09E845, &H8BEC5589, &H66ABC55, &HD9E8D089, &H8BFFFFF8, &H538BB07D, &HC0758958, &H8B54738B, &HC7295C4B, &H8950438B, &HFF31B07D, &H31C44589, &H31FA09C0, &H89F009FF, &H558BCC55, &HC84589BC, &H8BD04D89, &HD089B84D, &H89D47D89, &H7D89D87D, &HE07D89DC, &H89E47D89, &H7D89E87D, &HE8066AEC
+    pvAppendBuffer &HFFFFF888, &H31B0758B, &H89C931D2, &H558BC855, &H31C629BC, &HD44D89C0, &H89B84D8B, &H4589C045, &H5C438BC4, &H89CC4589, &HD089D045, &H59E8066A, &H5BFFFFF8, &H6079C629, &H8BB4458B, &HFF077488, &H558B53FF, &H81066ABC, &H1610C1, &HE8D08900, &HFFFFF7B8, &H78C6015F, &H8B43EBDF, &H558BB445, &H6B9BC, &H808B0000, &HFFFF0774, &H161005, &HF552E800, &H7448FFFF, &HB4458B25, &H774888B
+    pvAppendBuffer &H8B50FFFF, &H66ABC55, &H1610C181, &HD0890000, &HFFF7F7E8, &H5AC629FF, &HBF74F685, &H658DDBEB, &H5F5E5BF4, &HF8678D5D, &HBA55C35F, &H4&, &H8953E589, &HF3BAE8C3, &HC085FFFF, &H438D0F74, &HF3AEE820, &HC085FFFF, &HEBC0950F, &HFC03102, &H5D5BC0B6, &HC18955C3, &HE589C031, &H8B535657, &H8B18025C, &H891C0274, &H8E883C7, &HCB0FDFF7, &H5C89CE0F, &H34890439, &HE0F88339, &H5E5BE175
+    pvAppendBuffer &H55C35D5F, &HE589D189, &HC6895657, &H18588D53, &H741B60F, &HC183DF89, &H8EB8308, &HF084388, &H88FE41B7, &H418B0943, &HA6388FC, &H88FC418B, &H518B0B43, &HF8418BFC, &H18D0AC0F, &H8B0C4388, &H518BF841, &HD0AC0FFC, &HD438810, &H88F8418B, &H418B0E63, &HF4388F8, &HB475F739, &H5D5F5E5B, &H6BA55C3, &H89000000, &HC38953E5, &HFFF303E8, &H74C085FF, &H30438D0F, &HFFF2F7E8, &HFC085FF
+    pvAppendBuffer &H2EBC095, &HB60FC031, &HC35D5BC0, &H31C18955, &H57E589C0, &H5C8B5356, &H748B2802, &HC7892C02, &HF708E883, &HFCB0FDF, &H395C89CE, &H39348904, &H75D0F883, &H5F5E5BE1, &H8955C35D, &H57E589D1, &H53C68956, &HF28588D, &H890741B6, &H8C183DF, &H8808EB83, &HB70F0843, &H4388FE41, &HFC418B09, &H8B0A6388, &H4388FC41, &HFC518B0B, &HFF8418B, &H8818D0AC, &H418B0C43, &HFC518BF8, &H10D0AC0F
+    pvAppendBuffer &H8B0D4388, &H6388F841, &HF8418B0E, &H390F4388, &H5BB475F7, &HC35D5F5E, &H56E58955, &H8953CE89, &H3BC031C3, &HC740845, &H32020C8A, &HC88060C, &HEFEB4003, &HC25D5E5B, &H8D570004, &H8308247C, &H77FFF0E4, &HE58955FC, &HFE895657, &H83D38953, &H45892CEC, &H89078BE4, &H4589E04D, &H4478BDC, &H89087F8B, &H468BD845, &HD445890C, &H8910468B, &HFF85D045, &H3B834A74, &H50147500, &HD4458B50
+    pvAppendBuffer &HFFE475FF, &HD0FFD075, &H89E0458B, &H8B595A03, &HE04D8B03, &H558BFE89, &HFF839DC, &HC129F046, &H8B0CEC83, &H156E445, &HD8458BC1, &H65E8F729, &H29FFFFFF, &HD8750133, &H10CC483, &HB2EBDC75, &H5BF4658D, &H8D5D5F5E, &HC25FF867, &H20E80014, &H50000DE, &HDE39&, &H57E58955, &H53F63156, &H81F8E483, &H148EC, &H87D8B00, &HC244489, &H8B04578B, &H24548907, &HC578B7C, &H78244489
+    pvAppendBuffer &H8908478B, &H8B742454, &H44891457, &H478B7024, &H24548910, &H1C578B6C, &H68244489, &H8918478B, &H8B642454, &H44892457, &H478B6024, &H24548920, &H2C578B5C, &H58244489, &H8928478B, &H89542454, &H8B502444, &H578B3047, &H24448934, &H38478B48, &H4C245489, &H893C578B, &H89402444, &H89442454, &H8B302444, &H89482444, &H8B342454, &H894C2454, &H902484, &H448B0000, &H94895024, &H9424&
+    pvAppendBuffer &H24548B00, &H24848954, &H98&, &H5824448B, &H9C249489, &H8B000000, &H895C2454, &HC02484, &H448B0000, &H94896024, &HC424&, &H24548B00, &H24448964, &H24448B38, &H24548968, &H24548B3C, &H2484896C, &HA8&, &H7024448B, &HAC249489, &H8B000000, &H89742454, &HB02484, &H94890000, &HB424&, &H24448B00, &H24548B78, &H2484897C, &HB8&, &HBC249489, &H83000000, &H48770FFE
+    pvAppendBuffer &HE80C458B, &HFFFFE5A0, &H458BC289, &H4C0830C, &HFFE593E8, &H249489FF, &HA4&, &HA424948B, &H89000000, &HA02484, &H848B0000, &HA024&, &HC458300, &HF4848908, &HC8&, &HCCF49489, &HE9000000, &H1A4&, &H83FE468D, &H948B0FE0, &HCCC4&, &HC4848B00, &HC8&, &HA0248489, &H8D000000, &H8C8BF146, &HA024&, &HFE08300, &HA4249489, &H8B000000, &HA4249C, &H948B0000
+    pvAppendBuffer &HCCC4&, &HC4848B00, &HC8&, &H88248489, &H89000000, &HFE083F0, &H8C249489, &H8B000000, &HA42494, &H84890000, &H8024&, &HFC88900, &HF13D9AC, &H8B13C3AC, &HA02484, &HC890000, &H245C8924, &H240C8B04, &HA40FC389, &HA40F03D0, &H5C8B03DA, &HC1310424, &HA024848B, &H31000000, &H24948BD3, &HA4&, &H6D0AC0F, &H3106EAC1, &H8DC131D3, &H9C89F946, &HA424&, &H249C8B00
+    pvAppendBuffer &H80&, &H890FE083, &HA0248C, &H8C8B0000, &HC8DC&, &HDC9C8B00, &HCC&, &HD989CA89, &HC8C49403, &H13000000, &HCCC48C, &HD0890000, &H8C8BCA89, &HA024&, &H249C8B00, &HA4&, &HD311C101, &HA0248C89, &H8B000000, &H88248C, &H9C890000, &HA424&, &H249C8B00, &H8C&, &H948BC889, &H8C24&, &HD9AC0F00, &HC3AC0F01, &H24848B01, &H88&, &H4245C89, &HC89C389
+    pvAppendBuffer &HD0AC0F24, &H240C8B08, &H8DAAC0F, &H4245C8B, &H848BC131, &H8824&, &H8BD33100, &H8C2494, &HAC0F0000, &HEAC107D0, &H31D33107, &H248C03C1, &HA0&, &HA4249C13, &H89000000, &HA4249C, &H9C8B0000, &H8024&, &H248C8900, &HA0&, &HA424948B, &H8B000000, &HA02484, &H94890000, &HCCDC&, &HDC848900, &HC8&, &HC24448B, &HC424948B, &H8B000000, &HC4249C, &H808B0000
+    pvAppendBuffer &HFFFF0774, &H88248489, &H8B000000, &HC02484, &HC1890000, &H12D0AC0F, &H12CAAC0F, &HC0248C8B, &H89000000, &H802484, &H94890000, &H8424&, &H24948B00, &H84&, &HAC0FC889, &HAC0F0ED9, &H848B0EC3, &H8024&, &H8BDA3100, &HC4249C, &HC8310000, &HC0248C8B, &H89000000, &H842494, &H84890000, &H8024&, &H24948B00, &H84&, &HA40FC889, &HA40F17D9, &H848B17C3, &H8024&
+    pvAppendBuffer &H8BDA3100, &H90249C, &HC8310000, &H84249489, &H89000000, &H802484, &H848B0000, &HC024&, &H21D0F700, &H24848BC3, &HC4&, &H28245C89, &H94249C8B, &HF7000000, &H8BC321D0, &HC02484, &H5C890000, &H9C8B2C24, &H9824&, &H8BD82100, &H9C249C, &H44890000, &H848B2024, &HC424&, &H89D82100, &H8B242444, &H8B282444, &H8B2C2454, &H88249C, &H54330000, &H44332424, &H84032024
+    pvAppendBuffer &H8024&, &H24941300, &H84&, &HA8F38403, &H13000026, &H26ACF394, &H84030000, &HA024&, &H24941300, &HA4&, &H30244403, &H34245413, &H88248489, &H8B000000, &HB82484, &H94890000, &H8C24&, &H24948B00, &HBC&, &H9C8BC189, &HBC24&, &HD0AC0F00, &HCAAC0F1C, &H248C8B1C, &HB8&, &H80248489, &H89000000, &HD9A40FC8, &H2494891E, &H84&, &H8424948B, &HF000000
+    pvAppendBuffer &H8B1EC3A4, &H802484, &HDA310000, &HBC249C8B, &H31000000, &H248C8BC8, &HB8&, &H84249489, &H89000000, &H802484, &H948B0000, &H8424&, &HFC88900, &HF19D9A4, &H8B19C3A4, &H802484, &HDA310000, &H8489C831, &H8024&, &H249C8B00, &HB8&, &HB024848B, &H8B000000, &H8938244C, &H842494, &H84330000, &HA824&, &H24948B00, &HB4&, &H9433C321, &HAC24&, &H24848B00
+    pvAppendBuffer &HB0&, &H18245C89, &HBC249C8B, &H21000000, &H245C89D3, &H249C8B1C, &HA8&, &H1C24548B, &H9C8BD821, &HAC24&, &H24448900, &H24848B10, &HB4&, &H5C8BD821, &H44893C24, &H448B1424, &H54331824, &H44331424, &H84031024, &H8024&, &H24941300, &H84&, &H88248C03, &H13000000, &H8C249C, &H84030000, &H8824&, &H24941300, &H8C&, &H24948946, &H8C&, &H88248489
+    pvAppendBuffer &H8B000000, &HA82484, &H948B0000, &HAC24&, &H24448900, &H24848B38, &H90&, &H3C245489, &H9424948B, &H89000000, &H89302444, &H83342454, &H840F50FE, &H9F&, &H9824848B, &H8B000000, &H9C2494, &H84890000, &H9024&, &H24848B00, &HC0&, &H94249489, &H8B000000, &HC42494, &H84890000, &H9824&, &H24848B00, &HB0&, &H9C249489, &H8B000000, &HB42494, &H84890000
+    pvAppendBuffer &HA824&, &H24848B00, &HB8&, &HAC249489, &H8B000000, &HBC2494, &H84890000, &HB024&, &H24848B00, &H88&, &HB4249489, &H8B000000, &H8C2494, &H8C890000, &HC024&, &H249C8900, &HC4&, &HB8248489, &H89000000, &HBC2494, &HA4E90000, &H8BFFFFFA, &H882484, &H948B0000, &H8C24&, &H24440300, &H24541378, &H8B07897C, &H89702444, &H84030457, &HB824&, &H24548B00
+    pvAppendBuffer &H24941374, &HBC&, &H89084789, &H448B0C57, &H548B6824, &H84036C24, &HB024&, &H24941300, &HB4&, &H89104789, &H448B1457, &H548B6024, &H84036424, &HA824&, &H24941300, &HAC&, &H58244C03, &H13184789, &H895C245C, &H4F891C57, &H245F8920, &H5024448B, &H5424548B, &HC0248403, &H13000000, &HC42494, &H47890000, &H2C578928, &H4824448B, &H4C24548B, &H98248403, &H13000000
+    pvAppendBuffer &H9C2494, &H47890000, &H34578930, &H4024448B, &H4424548B, &H90248403, &H13000000, &H942494, &H47890000, &HC087FF38, &H89000000, &H658D3C57, &H5F5E5BF4, &H8C25D, &H20488D55, &H5356E589, &H8D30708B, &HF0891058, &H8304C283, &H5AE804C6, &H89FFFFDF, &H438DFC42, &HDF4FE8F0, &H4289FFFF, &HE8D8890C, &HFFFFDF45, &H8D1C4289, &HC3831043, &HDF37E804, &H4289FFFF, &H75CB392C, &H5D5E5BC9
+    pvAppendBuffer &HE58955C3, &H81535657, &H84EC&, &H87D8B00, &H8930578B, &HDF13E8D0, &H4589FFFF, &H4428DB8, &HFFDF08E8, &HB44589FF, &HE808428D, &HFFFFDEFD, &H8DB04589, &HF2E80C42, &H89FFFFDE, &HF889AC45, &HFFDEE8E8, &HA84589FF, &HE804478D, &HFFFFDEDD, &H8DA44589, &HD2E80847, &H89FFFFDE, &H478DA045, &HDEC7E80C, &H4589FFFF, &H10478D9C, &HFFDEBCE8, &H984589FF, &HE814478D, &HFFFFDEB1, &H8D944589
+    pvAppendBuffer &HA6E81847, &H89FFFFDE, &H478D9045, &HDE9BE81C, &H4589FFFF, &H20478D8C, &HFFDE90E8, &H884589FF, &HE824478D, &HFFFFDE85, &H8D844589, &H7AE82847, &H89FFFFDE, &H478D8045, &HDE6FE82C, &H8589FFFF, &HFFFFFF7C, &H898C458B, &H858BD445, &HFFFFFF7C, &H8BE84589, &H45899C45, &HAC458BC4, &H8BC04589, &H45899045, &H80458BE4, &H8BBC4589, &H4589A045, &HB0458BD0, &H8B945D8B, &H45C7984D, &HAF0&
+    pvAppendBuffer &HCC458900, &H8B84458B, &H4589A855, &HA4458BC8, &H8BE04589, &H4589B445, &H88458BDC, &H8BD84589, &H4589B845, &HEC758BEC, &H1D8458B, &HC1F031D6, &HC10110C0, &HC2C1CA31, &H31D6010C, &HEC7589F0, &H8908C0C1, &HC801D845, &H31C84D8B, &H788589C2, &H8BFFFFFF, &HC2C1E045, &H74958907, &H8BFFFFFF, &HC201DC55, &HC1C1D131, &H31CB0110, &HCC0C1D8, &H8B02348D, &HF131D055, &H8BDC7589, &HC1C1CC75
+    pvAppendBuffer &H89CB0108, &H4D8BC84D, &H89D831BC, &HFFFF709D, &HD05D8BFF, &H107C0C1, &HE45D8BDE, &H31E04589, &H10C1C1F1, &HDA31CB01, &H10CC2C1, &H89F131D6, &H758BCC75, &H8C1C1C0, &H4D89CB01, &HC44D8BBC, &HC2C1DA31, &H8BCE0107, &H5589D44D, &HE8558BD0, &HF231F089, &HC1C4758B, &HD10110C2, &HC6C1CE31, &H31F0010C, &HC04589C2, &HC1EC458B, &HD10108C2, &HC6C1CE31, &HC4758907, &H1E0758B, &HE0458BC6
+    pvAppendBuffer &HC2C1F231, &H31D30110, &HCC0C1D8, &HF231C601, &HC1EC7589, &HD30108C2, &H8BE85589, &HD831D055, &H8BE45D89, &HC0C1D05D, &HE0458907, &H1DC458B, &HD8458BC3, &HC0C1D831, &H31C10110, &HCC2C1CA, &HD831D301, &H8BDC5D89, &HC0C1C45D, &HD8458908, &HC231C801, &H8BD44589, &HC2C1CC45, &H18348D07, &H8BC85D8B, &HFFFF7885, &HD05589FF, &H31C4558B, &H10C3C1F3, &H31180C8D, &HCC2C1CA, &H8B16048D
+    pvAppendBuffer &HC331BC75, &H8BCC4589, &HFFFF7485, &H8C3C1FF, &H5D89D901, &HC05D8BC8, &HD801CA31, &H8907C2C1, &HC631C045, &HFF70858B, &HC6C1FFFF, &HC4558910, &HFF74958B, &H1C8DFFFF, &HC0458B30, &HC2C1DA31, &H31D0010C, &HC04589C6, &H108C6C1, &HBC7589F3, &HC2C1DA31, &HF04DFF07, &HFE47850F, &H458BFFFF, &HB4758BDC, &H458BC601, &HDC7589B0, &H1CC758B, &HC0758BF0, &H8BCC4589, &HF001AC45, &H89E0758B
+    pvAppendBuffer &H458BC045, &H89D001A8, &H458BB445, &H8BF001A4, &H4589D075, &HA0458BE0, &H758BF001, &HD04589C4, &H19C458B, &HE4758BF0, &H8BC44589, &HC8019845, &H458BC189, &H89D80194, &H90458BC3, &H758BF001, &HE44589D4, &H18C458B, &HD8758BF0, &H8BD44589, &HF0018845, &H8BD84589, &H758B8445, &HC558BC8, &H758BF001, &HC84589BC, &H180458B, &HE8758BF0, &H8BBC4589, &HFFFF7C85, &H8BF001FF, &H4589EC75
+    pvAppendBuffer &HB8458BE8, &HA5E8F001, &H8BFFFFDB, &H508D0C45, &HDC458B04, &HFFDB97E8, &HC458BFF, &H8B08508D, &H89E8CC45, &H8BFFFFDB, &H508D0C45, &HC0458B0C, &HFFDB7BE8, &HC458BFF, &H8B10508D, &H6DE8B445, &H8BFFFFDB, &H508D0C45, &HE0458B14, &HFFDB5FE8, &HC458BFF, &H8B18508D, &H51E8D045, &H8BFFFFDB, &H508D0C45, &HC4458B1C, &HFFDB43E8, &HC458BFF, &H8920508D, &HDB36E8C8, &H458BFFFF, &H24508D0C
+    pvAppendBuffer &H29E8D889, &H8BFFFFDB, &H508D0C45, &HE4458B28, &HFFDB1BE8, &HC458BFF, &H8B2C508D, &HDE8D445, &H8BFFFFDB, &H508D0C45, &HD8458B30, &HFFDAFFE8, &HC458BFF, &H8B34508D, &HF1E8C845, &H8BFFFFDA, &H508D0C45, &HBC458B38, &HFFDAE3E8, &HC458BFF, &H8B3C508D, &HD5E8E845, &H8BFFFFDA, &H458B7857, &HF04D8BF0, &H2007448A, &H40EC4588, &H200F4488, &HA75C084, &H8BF045FF, &HC239F045, &HC481E075
+    pvAppendBuffer &H84&, &H5D5F5E5B, &H550008C2, &H5657E589, &H89C38953, &H83CA89D0, &HEC83F8E4, &H4798B30, &H2C247C89, &H8908798B, &H8D14247C, &H3C89BF3C, &HC798B24, &H89BF0C8D, &H890C247C, &H8B08244C, &H3C8D104A, &H244C8989, &H890A8B04, &H8B10247C, &H244C8938, &HC488B24, &H28247C89, &H8904788B, &H8B1C244C, &H7C891048, &H788B2024, &H24448B08, &H2464F728, &H13030324, &H7C890453, &HC6891824
+    pvAppendBuffer &H448BD789, &H64F72024, &HC6011024, &H1C24448B, &H24F7D711, &H8BC60124, &H11182444, &H2464F7D7, &H11C60108, &H24446BD7, &HE1F7052C, &H448BC601, &HD7112824, &H2C2464F7, &H7B893389, &H89C68904, &H24448BD7, &H2464F724, &H8BC60120, &H111C2444, &H87303D7, &HF70C7B13, &H1082464, &H24448BC6, &HF7D71110, &H1182464, &H24048BC6, &HE1F7D711, &H448BC601, &HD7112824, &H142464F7, &H89087389
+    pvAppendBuffer &HC6890C7B, &H448BD789, &H64F72024, &HC6012C24, &H2424448B, &H7303D711, &H147B1310, &H182464F7, &H448BC601, &HD7111024, &H1C2464F7, &H448BC601, &HD7110824, &HC601E1F7, &H2824448B, &H64F7D711, &H73890C24, &H147B8910, &HD789C689, &H2024448B, &H142464F7, &H448BC601, &HD7112424, &H13187303, &H64F71C7B, &HC6011C24, &H1824448B, &H64F7D711, &HC6012C24, &H1024448B, &HE1F7D711, &H448BC601
+    pvAppendBuffer &HD7112824, &H42464F7, &H89187389, &HC6891C7B, &H448BD789, &H64F72024, &HC6010C24, &H1C24448B, &H7303D711, &H247B1320, &H2C2464F7, &H448BC601, &HD7111824, &H142464F7, &H448BC601, &HD7112424, &HC601E1F7, &H7389D711, &H247B8920, &H5BF4658D, &HC35D5F5E, &H89D18955, &HFF3157E5, &HC3895356, &H83F8E483, &H28B28EC, &H8904528B, &HF182444, &H891AD0AC, &H87103C6, &H890C7913, &H891C2454
+    pvAppendBuffer &HC7989F0, &H1AF8AC0F, &H24247C89, &H10244489, &H4489C031, &H448B1424, &H41031024, &H24548B10, &H8718914, &H89145113, &H104189C7, &HFFFFE781, &HAC0F03FF, &H51891AD0, &H24448914, &H24448B08, &H87B8908, &H4103FF31, &H247C8918, &H8BC7890C, &H890C2454, &H13202474, &HE7811C51, &H3FFFFFF, &HF184189, &H8B1AD0AC, &H89202474, &H7B891C51, &H89FF310C, &H48B2404, &H247C8924, &H20410304
+    pvAppendBuffer &H424548B, &H89245113, &HE6812041, &H3FFFFFF, &H89245189, &HD0AC0FC1, &H24548B1A, &H80048D18, &HFFFFE181, &HE28103FF, &H3FFFFFF, &H1104B89, &HC1C289D0, &HC6011AE8, &HFFFFE281, &H138903FF, &H8D047389, &H5E5BF465, &H55C35D5F, &H8918E1C1, &HC38953E5, &HD2E8D089, &H25FFFFD7, &H3FFFFFF, &H428D0389, &HD7C3E803, &HE8C1FFFF, &HFFFF2502, &H438903FF, &H6428D04, &HFFD7B0E8, &H4E8C1FF
+    pvAppendBuffer &HFFFFFF25, &H8438903, &HE809428D, &HFFFFD79D, &H8906E8C1, &H428D0C43, &HD78FE80C, &HE8C1FFFF, &H89C80908, &H5D5B1043, &HC18955C3, &H8918E8C1, &HD38953E5, &H204B60F, &HFD1B60F, &HC11314B6, &HD00918E0, &HEAC1CA89, &HD2B60F10, &H1314B60F, &H910E2C1, &HD5B60FD0, &H1314B60F, &HE2C15D5B, &HC3D00908, &H57E58955, &HCE9AE8, &H9FC78100, &H560000CE, &H89C38953, &H2E8C1C8, &H8918EC83
+    pvAppendBuffer &H38BF045, &H31E44D89, &H85048DC9, &H4&, &H8DE04589, &HDE88A04, &H89FFFFD7, &H41048B44, &H75F04D39, &H4438DEE, &H1EC45C7, &H8B000000, &HF631F04D, &H8BE84589, &HC139E045, &H558B7973, &H8B048BF0, &H575D639, &HEBEC45FF, &H75F68504, &H74978B33, &HC1FFFF07, &H4D8908C0, &H58C281DC, &HE8000029, &HFFFFFF41, &H89EC758B, &H74878BC2, &HFFFFF07, &H583084B6, &H3100002A, &H18E0C1F6
+    pvAppendBuffer &H1FEBD031, &H1BE47D83, &HFE831C76, &H8B177504, &HFF077497, &HDC4D89FF, &H2958C281, &H6E80000, &H8BFFFFFF, &H558BDC4D, &H458346E8, &H23304E8, &H48B4489, &H8380EB41, &H5E5B18C4, &H8BC35D5F, &H8B08310A, &H4831044A, &H84A8B04, &H8B084831, &H50310C52, &H8955C30C, &HA4E856E5, &H810000CD, &HCDADC6, &HC3895300, &H968B008B, &HFFFF0774, &H2958C281, &HAEE80000, &H8BFFFFFE, &HFF077496
+    pvAppendBuffer &H8B0389FF, &HC2810443, &H2958&, &HFFFE98E8, &H74968BFF, &H89FFFF07, &H438B0443, &H58C28108, &HE8000029, &HFFFFFE81, &H774968B, &H4389FFFF, &HC438B08, &H2958C281, &H6AE80000, &H89FFFFFE, &H5E5B0C43, &H488BC35D, &H8508B04, &H57E58955, &H8156CF89, &HFF0000E7, &H188B5300, &HE681DE89, &HFF000000, &HD689F709, &HFF00E681, &HFE090000, &HC78B60F, &HD789FE09, &HCE893089, &HE781&
+    pvAppendBuffer &HE68100FF, &HFF000000, &H708BF709, &HE6810C, &H90000FF, &HFBB60FFE, &H788BFE09, &H470890C, &HB60FD689, &HE681D2, &H81FF0000, &HFF0000E7, &H89F70900, &HE381DE, &H8100FF00, &HFF00E6, &HFFE0900, &HE181F9B6, &HFF00&, &H7089FE09, &HC708B08, &HE681&, &HF309FF00, &H5E5BD909, &H5D5FD109, &HC30C4889, &HE8C1C289, &H1012507, &HD2010101, &H811BC06B, &HFEFEFEE2, &HC3D031FE
+    pvAppendBuffer &H89C18955, &HCB8953E5, &HE808CBC1, &HFFFFFFD8, &HC889C289, &H3110C0C1, &HC1D831D1, &H5D5B08C1, &HC831D031, &HE58955C3, &HBB535657, &H1&, &H8B18EC83, &H7D8B0C55, &H8DD08908, &HE5E81477, &H89FFFFD4, &H428DE445, &HD4DAE804, &H4589FFFF, &H8428DE8, &HFFD4CFE8, &HEC4589FF, &H8D0C428D, &HC1E80457, &H89FFFFD4, &H458DF045, &HE04589E4, &HFFFE4AE8, &H731F3BFF, &HE4458D4F, &HDC458943
+    pvAppendBuffer &HFFFE51E8, &HDC458BFF, &HFFFEB9E8, &HE4458BFF, &HFFFF6BE8, &HE44589FF, &HE8E8458B, &HFFFFFF60, &H8BE84589, &H55E8EC45, &H89FFFFFF, &H458BEC45, &HFF4AE8F0, &HF289FFFF, &H8910C683, &H458BF045, &HFDF9E8DC, &HADEBFFFF, &HE8E0458B, &HFFFFFE06, &HE8E0458B, &HFFFFFE6E, &H89E0458B, &HFDDDE8F2, &H558BFFFF, &HE4458B10, &HFFD436E8, &H10458BFF, &H8B04508D, &H28E8E845, &H8BFFFFD4, &H508D1045
+    pvAppendBuffer &HEC458B08, &HFFD41AE8, &H10458BFF, &H8B0C508D, &HCE8F045, &H83FFFFD4, &H5E5B18C4, &HCC25D5F, &HE5895500, &HCB59E856, &HC6810000, &HCB62&, &H8BC38953, &H74968B00, &H81FFFF07, &H2A63C2, &HFC63E800, &H968BFFFF, &HFFFF0774, &H438B0389, &H63C28104, &HE800002A, &HFFFFFC4D, &H774968B, &H4389FFFF, &H8438B04, &H2A63C281, &H36E80000, &H8BFFFFFC, &HFF077496, &H84389FF, &H810C438B
+    pvAppendBuffer &H2A63C2, &HFC1FE800, &H4389FFFF, &H5D5E5B0C, &H8B108BC3, &H89550448, &H788B57E5, &HD689560C, &H8588B53, &HE681&, &HE781FF00, &HFF0000, &HDE89F709, &HFF00E681, &HFE090000, &H9F9B60F, &H89D789FE, &H81CE8930, &HFF0000E7, &HE68100, &H9FF0000, &HC708BF7, &HFF00E681, &HFE090000, &H9FBB60F, &H81CF89FE, &HFF00E1, &H4708900, &HE781DE89, &HFF0000, &HE381&, &HE68100FF
+    pvAppendBuffer &HFF000000, &HD689F709, &H81D2B60F, &HFF00E6, &HFFE0900, &H90C78B6, &H87089FE, &H810C708B, &HE6&, &H9F309FF, &H95E5BD9, &H895D5FD1, &H55C30C48, &HE589C189, &HE8535657, &HFFFFFDA8, &HA1E8C389, &H89FFFFFD, &HFD9AE8C7, &HC831FFFF, &HC731C689, &HD831C889, &HF331F189, &HC9C1FA89, &HC1F83108, &HC83108C3, &H3110C2C1, &H315E5BD8, &HC35D5FD0, &H57E58955, &HEC835356, &HC558B1C
+    pvAppendBuffer &H89084D8B, &HD29EE8D0, &H4589FFFF, &H4428DE4, &HFFD293E8, &HE84589FF, &HE808428D, &HFFFFD288, &H8DEC4589, &H7DE80C42, &H8BFFFFD2, &HF0458931, &H1B5048D, &H8D000000, &H1C8DFF7E, &HE4458D81, &H4589DA89, &HFBF5E8E0, &H438DFFFF, &HD84589F0, &H5174FF85, &H4FE4458D, &HE8DC4589, &HFFFFFEB1, &HE8DC458B, &HFFFFFE39, &H8BD8558B, &HCCE8DC45, &H8BFFFFFB, &H38E8E445, &H89FFFFFF, &H458BE445
+    pvAppendBuffer &HFF2DE8E8, &H4589FFFF, &HEC458BE8, &HFFFF22E8, &HEC4589FF, &HE8F0458B, &HFFFFFF17, &H10D86D83, &HEBF04589, &HE0458BAB, &HE8F0F66B, &HFFFFFE61, &H1E0458B, &HFDE7E8F3, &H458BFFFF, &HE8DA89E0, &HFFFFFB7B, &H8B10558B, &HD4E8E445, &H8BFFFFD1, &H508D1045, &HE8458B04, &HFFD1C6E8, &H10458BFF, &H8B08508D, &HB8E8EC45, &H8BFFFFD1, &H508D1045, &HF0458B0C, &HFFD1AAE8, &H1CC483FF, &H5D5F5E5B
+    pvAppendBuffer &H55000CC2, &HE589C189, &HFFD19BE8, &H8D0289FF, &H91E80441, &H89FFFFD1, &H418D0442, &HD186E808, &H4289FFFF, &HC418D08, &HFFD17BE8, &H42895DFF, &H4C8DC30C, &HE4830424, &HFC71FFF0, &H53E58955, &H50198B51, &H538D038B, &H471FF08, &H473FF52, &H8B0450FF, &H35A3043, &H8A482C5B, &H42080354, &H8035488, &H774C085, &H375D284, &H8DECEB48, &H5B59F865, &HFC618D5D, &H570008C2, &H8247C8D
+    pvAppendBuffer &HFFF0E483, &H8955FC77, &H535657E5, &HC86EE8, &H7BC38100, &H830000C8, &H3F8B28EC, &H5589308B, &H28508DDC, &H8DE45589, &H55891850, &H838D50E0, &HFFFF3726, &HFF515750, &HE8BDC75, &H8BE4558B, &H73E8E045, &H83FFFFE9, &H658D0CC4, &H5F5E5BF4, &HF8678D5D, &H4C25F, &H8DC3C80F, &H8304244C, &H71FFF0E4, &HE58955FC, &H558D5153, &H10EC83E8, &H418B198B, &HFF09E804, &H558BFFFF, &H45331E8
+    pvAppendBuffer &H8B04438D, &H5331EC55, &HF0558B08, &H8B0C5331, &H5331F455, &HFF505210, &H53FF5033, &H658D593C, &H5D5B59F8, &HC2FC618D, &H89550008, &HD78957E5, &H53CE8956, &H83F8E483, &H448910EC, &H458B0424, &HFF508D08, &HD285C031, &H5C8B3878, &HC8B0424, &H89DB3193, &H310C245C, &H244C89DB, &H970C8B08, &H8244C03, &HC245C13, &H8244489, &H4489C031, &H4C030C24, &H5C130824, &HC890C24, &HD8894A96
+    pvAppendBuffer &H658DC4EB, &H5F5E5BF4, &H4C25D, &H57E58955, &HE4835356, &H10EC83F8, &H8244489, &H8908458B, &HC704244C, &H10C2444, &H48000000, &H2E78C085, &H8B821C8B, &HF708247C, &H87348BD3, &HD989FF31, &HCE01DB31, &HC244C8B, &HDB31DF11, &HFB11F101, &H4247C8B, &HC245C89, &H48870C89, &H658DCEEB, &H5F5E5BF4, &H4C25D, &HF883D231, &H890C7E32, &H29F9D1C1, &H148D40C8, &H89EFEB82, &H8D57C3D0
+    pvAppendBuffer &H8308247C, &H77FFF0E4, &HE58955FC, &H83535657, &H45895CEC, &H89078BD0, &H5F8BD455, &HD8458904, &H4589C001, &H83C031A8, &H8932D87D, &H8E0FE04D, &H1BE&, &H8BD87D8B, &HFFD1D875, &H468DFE29, &HE4458901, &H458B5050, &HE85753D0, &HFFFFFFAE, &HFD048D, &H8D000000, &HFD0C&, &H45890000, &HE0458BA4, &H4D8BC801, &HC84589D4, &HBD048D, &H1000000, &HBC4D89C1, &H8BD04D8B, &HC801BC55
+    pvAppendBuffer &H89C84D8B, &H5653B845, &HFFFF71E8, &HB3448DFF, &H31D23108, &H891089C9, &H458BB445, &H83048DE4, &H45890889, &H4438DC0, &H31B04589, &H44389C0, &H458B0389, &H89C001E4, &HF089CC45, &H48DF829, &HAC458983, &H29CC458B, &H83048DF8, &H58A04589, &H8B5AC031, &H558BD04D, &HAC4583AC, &H810C8B04, &H8B044A89, &H558BD44D, &H810C8BA0, &H40820C89, &HDF75C739, &H8B0CEC83, &H558BB04D, &HC88956B8
+    pvAppendBuffer &HFFFE25E8, &HB44D8BFF, &H89BC558B, &HC8895603, &HFFFE15E8, &HC04D8BFF, &H83C0558B, &H1890CEC, &H8DE4458B, &H4589C304, &HE4458BD4, &HC1D44D8B, &HD80104E0, &HFFD88950, &HBFE8E475, &H31FFFFFE, &HE0558BC0, &H8D0C4389, &HC4830843, &HD0458918, &H4389C031, &H4438908, &H458B0389, &H8DF829E4, &H458BC33C, &H8BD001A4, &H4C2830A, &H8904C783, &HC239FC4F, &H458BF175, &HCEC83CC, &H8BD04D8B
+    pvAppendBuffer &HE883C855, &HC8895002, &HFFFD9DE8, &HD44D8BFF, &H4389DA89, &HCC75FF04, &HEDE8C889, &H8BFFFFFD, &H458BD855, &H1D201E4, &H29F229C0, &HE0458BC2, &H8DCC75FF, &H558B9004, &HE8C189D4, &HFFFFFD6A, &H8BA8558B, &HC483E07D, &H8BF2290C, &HF229CC75, &H8397348D, &HC08504EE, &HB4840F, &H168B0000, &HD189DB31, &H1689C201, &HC801D231, &HD089DA11, &H7D8BE1EB, &H7DF839A8, &HE0758B0B, &H1C89DB31
+    pvAppendBuffer &HEEEB4086, &H8BD8758B, &H7D8BE045, &HF0048DD0, &H89E44589, &H2E0C1F0, &H8B07348D, &H1C8DD47D, &H2E8C107, &H3538D40, &H8BE05D89, &HC06BD45D, &HBADA39FC, &HFFFFFFFC, &H89D0430F, &H7539CC55, &H8B4F73D0, &H7D8BE05D, &H83C931E4, &H5D3904EF, &H8B2D73D4, &H63F7FC46, &HC04D89FC, &H4D89C931, &HD84589C4, &H5589078B, &H3D231DC, &H5513C045, &HD84503C4, &H89DC5513, &H4EB8307, &HCBEBD189
+    pvAppendBuffer &H8BE4458B, &HEE83CC7D, &HE46D8304, &H380C8904, &H658DACEB, &H5F5E5BF4, &HF8678D5D, &H8C25F, &H247C8D57, &HF0E48308, &H55FC77FF, &H5657E589, &H2CEC8353, &H8BE44589, &HD8558907, &H31047F8B, &HE04D89D2, &HF32F883, &HCA8E&, &H89C38900, &H29FBD1C6, &H9D148DDE, &H0&, &H89DF0C8D, &H348DDC75, &H9D048DC7, &H0&, &H8BD44589, &HD001D845, &H8BD04589, &HD001E445, &HFF565252
+    pvAppendBuffer &H558BDC75, &HFCF4E8D0, &H458BFFFF, &H89F801D4, &H458BD045, &H2E0C1DC, &H8BCC4589, &H4D8BD845, &H8D5356CC, &H4D8B0814, &HE4458BD0, &HFFFF6FE8, &HCC4D8BFF, &H56E4458B, &H531B348D, &H1D8558B, &HE8F989C8, &HFFFFFF58, &H8BDC458B, &HF001D455, &H8DE44589, &H458B870C, &HD0015EE0, &H8BD2315A, &HF239DC75, &H348B097D, &H90348991, &H83F0EB42, &HF9890CEC, &H8B53F889, &HABE8D055, &H8BFFFFFB
+    pvAppendBuffer &HF889E475, &HE04D8B53, &H148DDE29, &HFB98E8B7, &HC483FFFF, &H3975EB0C, &H8B0B7DC2, &HC931E05D, &H42930C89, &HE0C1F1EB, &HDC458902, &H8BE0458B, &HF801DC7D, &H8BCC4589, &H3C8DE445, &HE47D3938, &H758B4A73, &HD8458BDC, &H758BF001, &HD04589CC, &H4589C031, &HD06D83D4, &HE0753904, &H5D8B2573, &HFC478BD0, &HF7FC4E8B, &H1DB3123, &HD44D8BC8, &HDB31DA11, &HD311C101, &H83FC4E89, &H5D8904EE
+    pvAppendBuffer &H83D2EBD4, &H8304CC6D, &HB1EB04EF, &H5BF4658D, &H8D5D5F5E, &HC25FF867, &H8D570008, &H8308247C, &H77FFF0E4, &HE58955FC, &H89535657, &H83C789FB, &H38B4CEC, &H89045B8B, &HCA89E455, &H8DE04589, &HFB831B34, &HE18F0F32, &H8D000000, &HFFFFFF83, &H850C8D3F, &H0&, &H8982048B, &H4589C84D, &HFF468DBC, &H89E04589, &H8DD829F0, &H45898704, &H89C031CC, &H5D39DC45, &H928C0FE0, &H8B000000
+    pvAppendBuffer &H458BE055, &HFC931BC, &H899704AF, &H438DB845, &HD84589FF, &H8997048D, &HF631D045, &HD87D83, &H89C04D89, &H3578C475, &H8BD8758B, &H458BE44D, &HB124F7B8, &H89D0758B, &H458BB045, &HB45589D0, &H8BD231, &H13C04503, &H4503C455, &HB45513B0, &H4DFF0689, &H83D189D8, &HEB04D06D, &HCC458BBD, &H758BD231, &HD45589CC, &H408BD231, &HD04589FC, &H3DC458B, &H5513C045, &HD04503C4, &H89D45513
+    pvAppendBuffer &H4DFFFC46, &HCC6D83E0, &HDC558904, &HFFFF65E9, &HC8458BFF, &H407548D, &HD839C031, &HC8B7A7D, &H820C8987, &HC89C931, &HEEEB4087, &H8B0CC36B, &HEC83E04D, &H89C80108, &H48DDC45, &H9D&, &HD0458900, &H4589F801, &HDC75FFD8, &HFD4EE853, &H4D8BFFFF, &HE0458BD0, &H4589C801, &HFFC189D0, &H8B53DC75, &H558BE045, &HFA90E8E4, &HF989FFFF, &H56F88950, &HE8D0558B, &HFFFFF9AE, &H83DC4589
+    pvAppendBuffer &HF8890CC4, &H758B108B, &H981489D8, &HC083D231, &HFC508904, &HEC75F039, &HDC7D83, &H9D148D, &H75000000, &H170C8D25, &HD839C031, &H758B1C7D, &H86348BE4, &H75813439, &HEEEB4003, &H8DE4758B, &HC8B180C, &H860C398F, &HEC831473, &H17048D0C, &HE4558B53, &HB1E8C189, &H83FFFFF9, &H658D0CC4, &H5F5E5BF4, &HF8678D5D, &H8C25F, &H57E58955, &H8956FF31, &HD3D089C6, &HCB8953E2, &H4305FBC1
+    pvAppendBuffer &H83F8E483, &H7C8910EC, &HCF890C24, &H741FE783, &H20B90D, &HF9290000, &H4489E8D3, &H3C8D0C24, &H9D&, &H8DDB3100, &H5C893E0C, &HDB310424, &H489018B, &H89D00124, &H3D18901, &H5C13240C, &HD2310424, &H5C0BD889, &H3C740C24, &H43E5C8D, &HDB310B8B, &H448BC101, &HD3110C24, &HC801D231, &H5C8DDA11, &H389043E, &HFC3E448D, &H8504C083, &H8B1574D2, &HDB310850, &H8342D189, &H508901C1
+    pvAppendBuffer &HD38308, &HE4EBDA89, &H5BF4658D, &HC35D5F5E, &HB8C28955, &H10&, &H5657E589, &H5BE&, &HDB315300, &H20B9&, &H29D78900, &H85EFD3C1, &H890675FF, &HD3C301C1, &H4EF8D1E2, &HD889E675, &H5D5F5E5B, &HD23155C3, &H5657E589, &HEEC1C689, &HC3895310, &H868D&, &HF7468000, &HF8E483F6, &HEC83D231, &H241C8910, &H8910E0C1, &H89C031C1, &H89042444, &H1C083D8, &H8900D283, &H8B082444
+    pvAppendBuffer &H89082444, &H8B0C2454, &HF70C2474, &HF1AF0FE1, &HD601D0F7, &HC083D231, &HD28301, &HF029D089, &HC24748B, &H89E1F748, &H1FE8C1D1, &HC109D101, &H824448B, &HF7F1AF0F, &H244489E1, &H24548908, &H24448B0C, &H30148D0C, &H824448B, &H2D79D285, &HFF31DE89, &HC683D6F7, &HD78301, &H8247489, &HC247C89, &HFF31C689, &H8247403, &HC247C13, &HFF3A548D, &H85D82949, &HEBE978D2, &H31C68914
+    pvAppendBuffer &H3D801FF, &H7C132434, &HFA010424, &HEB410378, &HF4658DEC, &H5E5BC889, &H55C35D5F, &H3157E589, &H835356FF, &HEC83F8E4, &H24448940, &H2454893C, &H244C8934, &H247C8920, &H24448B38, &H247C8B38, &H87D2B34, &H8C0FC739, &HA3&, &H3824448B, &H38245C8B, &H85348D, &H8B000000, &H8B3C2444, &HD2859814, &H44FF0675, &HCDEB3824, &H5489D089, &H99E83024, &H8BFFFFFE, &H89302454, &HD3C389C1
+    pvAppendBuffer &H7EC085E2, &H24448B20, &H244C8B38, &HC8394034, &H448B137D, &H20B93C24, &H29000000, &H30448BD9, &H9E8D304, &H89F631C2, &H247489D0, &H1065F71C, &H8B08758B, &H8D382444, &H8B01304C, &H89342444, &H89182454, &H29282454, &H1B8C1, &HE1C10000, &H2BD90105, &HC829144D, &H30244489, &HF8832179, &H490C7CE1, &H28246CD3, &H28247C83, &H8B607500, &H8B342444, &HC2290855, &H87E9C031, &H8B000001
+    pvAppendBuffer &HC1302444, &HC72905F8, &H4808458B, &H2C244489, &H3024448B, &H891FE083, &H74082444, &H24448B38, &H31DB312C, &H2444C7C9, &H110&, &H245C8900, &H245C8B14, &H89F80108, &H890C244C, &HB8242444, &H20&, &H4489D829, &HEEE90424, &H31000000, &H245489D2, &H8458B30, &H2C2444C7, &H1&, &H31FF708D, &H244489C0, &H39F70124, &HF38247C, &HD68F&, &H85C03100, &H8B0778F6, &H8B202444
+    pvAppendBuffer &H64F7B004, &H4C8B2824, &HDB312424, &H448BC101, &HD3113C24, &HD231D1F7, &H89B8048B, &H3124245C, &H8BC101DB, &H112C2444, &H1D231D3, &H8BDA11C8, &H4E3C245C, &H2C245489, &H4FBB0489, &HC031ADEB, &H2C247C83, &H8B0B7800, &H8B202444, &H8B2C247C, &H4C8BB804, &HDB311C24, &H3C247C8B, &HF7C8AF0F, &H1182464, &H244C8BCA, &H8BC8010C, &H1110244C, &H245C8BDA, &H24548924, &H9F348B0C, &HFF31DB31
+    pvAppendBuffer &H4C8ACE01, &HDF110824, &HE3D3C389, &H5C8BD989, &HD9091424, &HD1F7DB31, &H748BF101, &HFB113C24, &H24247C8B, &H2C244CFF, &H24244CFF, &H8ABE0C89, &H8904244C, &HD310245C, &H244489E8, &H24748B14, &H24743924, &H738E0F38, &H83FFFFFF, &HF000C7D, &HFFFDE484, &H244C8BFF, &H24548B30, &HC458B28, &HFFFC07E8, &HFDCFE9FF, &H7C8BFFFF, &H1C8B3C24, &H78D28587, &H24748B1B, &H960C8B20, &H7772CB39
+    pvAppendBuffer &H72D93942, &H5C8B400F, &HD8393424, &H4EBDC7C, &HECEBC931, &H3424748B, &HC708458B, &H1382444, &H4E000000, &H85FF788D, &H313778F6, &H78FF85C0, &H24448B07, &HB8048B20, &H3C245C8B, &HD231D0F7, &H31B30C8B, &H8BC101DB, &H11382444, &H1D231D3, &H8BDA11C8, &H4F3C245C, &H38245489, &H4EB30489, &H7D83C5EB, &HF74000C, &H310C458B, &H1BAC9, &H75E80000, &H8DFFFFFB, &H5E5BF465, &H10C25D5F
+    pvAppendBuffer &HE5895500, &H83535657, &H4D8928EC, &HD05589CC, &HC766D231, &H5004&, &H10FA8342, &H80C7F475, &H260&, &HFFFFFFFF, &H758BD231, &H74F239CC, &HD07D8B1A, &H173C80, &H90890E74, &H260&, &H170CB60F, &H4804FF66, &HB9DFEB42, &H1&, &HDB31D231, &H5834B70F, &H773F139, &HFFFFFDB8, &H6667EBFF, &HD45D5489, &H143F129, &H83C901F2, &HE07510FB, &H7601FA83, &H75C98504, &H83C931DF
+    pvAppendBuffer &H277501FA, &H2788366, &HEB207401, &HD07D8BCF, &HF1CB60F, &H1274DB84, &H5D74B70F, &H17E8DD4, &H704C8966, &H7C896620, &H8B41D45D, &HF939CC7D, &H754ADB75, &H60B88B13, &H66000002, &H20240C7, &H1578D00, &H22508966, &HC483C031, &H5F5E5B28, &H8955C35D, &H895657E5, &H508B53D6, &H8588B0C, &H297ED639, &H483B088B, &H8D137404, &H38890179, &H8939B60F, &H9E7D3D1, &H87889DF, &H40C707EB
+    pvAppendBuffer &H110&, &H8C28300, &HEB0C5089, &H89F189CD, &HD3F229DF, &HC5089EF, &H83087889, &HE0D3FFC8, &HD821D0F7, &H5D5F5E5B, &H4A8D55C3, &H57E58902, &H8956FF31, &HDB3153D6, &H8908EC83, &H458BF045, &H1BAF0, &H4D890000, &HE8DB01EC, &HFFFFFF82, &H1EC4D8B, &H1B70FC3, &H3902C183, &H1067FD8, &HEBC329C7, &H3B448DD9, &H4B70F10, &H5B595A46, &HC35D5F5E, &H31D18955, &H56E589D2, &HF0E48353
+    pvAppendBuffer &HF70EC83, &HF100C10, &H66100410, &H8D1710F, &HF0710F66, &HC1560F08, &HC0700FF2, &H700FF3B1, &H290FB1C0, &HF301444, &H83110411, &HFA8310C2, &HBAD07540, &H4&, &HD389D089, &H83D68942, &HE68303E3, &H4E3C103, &HF04E6C1, &H30344C28, &H6603708D, &H4C0F3A0F, &H8304301C, &HE68302C0, &H3E08303, &HF04E6C1, &H280FF128, &H4E0C1E1, &H3444280F, &H720F6630, &H280F03D6, &H74290FF9
+    pvAppendBuffer &H280F2024, &H720F66F1, &HF6612D4, &H660EF672, &H19F7720F, &H66D0280F, &H8D8730F, &HD1720F66, &HE6560F07, &HFD8280F, &H560FE828, &H720F66CF, &HF660AD3, &HF0FF572, &H290FCC57, &HF10245C, &H570FD828, &H6620244C, &HDF3720F, &HF3A0F66, &H4300454, &H290FD089, &H280F241C, &H720F66D8, &HE0C111D0, &H720F6604, &H560F13D3, &HF66241C, &H301C54FE, &HFC5560F, &H570FC357, &H66102444
+    pvAppendBuffer &H66D1FE0F, &HFC2FE0F, &HF66E828, &HF08FD73, &H280FE528, &HCD280FDD, &HF4720F66, &H720F660D, &H280F13D3, &H720F66D5, &HF660FF1, &HF11D572, &H560FE356, &H720F66CD, &H570F0AD2, &HE2570FE1, &HC4FE0F66, &H1C44290F, &H44110F30, &HFA83F001, &HE1850F10, &H8DFFFFFE, &H5E5BF865, &H280FC35D, &H720F66D0, &H280F01F0, &H720F66D9, &HF661FD2, &H661FD372, &H1F1720F, &HFB730F66, &HE2280F04
+    pvAppendBuffer &HFA730F66, &H730F6604, &H560F0CDC, &HD0560FD9, &HFDC560F, &H280FC228, &HEA280FF2, &HF6720F66, &H720F661E, &HF661FF0, &HF19F572, &H570FC657, &HE8280FC5, &HF8730F66, &HD0570F0C, &HDD730F66, &HFA280F04, &HFC2280F, &HF66F228, &H6601D772, &H2D0720F, &HD6720F66, &HC7570F07, &HFC6570F, &H570FC557, &HC2570FC3, &H280F57C3, &H3A0F66D8, &HF00C144, &H280FD328, &H3A0F66E3, &H6611D944
+    pvAppendBuffer &HE1443A0F, &H3A0F6601, &H8D10D144, &H8308247C, &H570FF0E4, &HFC77FFD4, &H66CA280F, &H8DA730F, &H730F6655, &H570F08F9, &HC1570FDA, &H89CB280F, &HE85057E5, &HFFFFFF26, &H8D5D5F5A, &HC35FF867, &H4244C8D, &HFFF0E483, &H8955FC71, &H8B5051E5, &H4418B11, &HF08498B, &H100F0210, &H700F6608, &HF661BC0, &HE81BC970, &HFFFFFF7D, &HC0700F66, &H1110F1B, &H8D5D595A, &HCC2FC61, &H7C8D5700
+    pvAppendBuffer &HE4830824, &HFC77FFF0, &H57E58955, &H53D68956, &HEC83DB31, &H100F1C, &HC0700F66, &HC8280F1B, &HD0700F66, &H4110F4E, &HD0570F1E, &HD84D290F, &H1914110F, &HE810C383, &HFFFFFF2D, &H80FB81, &H280F0000, &HD875D84D, &H5B1CC483, &H8D5D5F5E, &HC35FF867, &H53E58955, &H8B084D8B, &H918B0C5D, &H1FC&, &H100F098B, &H10428D03, &H8302570F, &H1B740CF9, &H740EF983, &HAF98307, &H1DEB6075
+    pvAppendBuffer &HDC380F66, &H428D1042, &H380F6630, &H662042DC, &HDC380F, &H6620C083, &H40DC380F, &H380F66F0, &HF6600DC, &H1040DC38, &HDC380F66, &HF662040, &H3040DC38, &HDC380F66, &HF664040, &H5040DC38, &HDC380F66, &HF666040, &H7040DC38, &HDC380F66, &H8080&, &H380F6600, &H9080DD, &H458B0000, &H110F10, &HCC25D5B, &HE5895500, &H83535657, &HEC83F0E4, &H12100F20, &H14244489, &H14247C8B
+    pvAppendBuffer &HC083D089, &H244C890C, &HFCB78B08, &H89000001, &H89102444, &HE81C2474, &HFFFFC00C, &H89085D8B, &H89182444, &HC4503C2, &H4244489, &H424448B, &HF883D029, &HEC860F03, &H8B000000, &HF1C2444, &H280FC228, &HE2280FEA, &HBEDA280F, &H1&, &H8908280F, &HEEFEE8D0, &HF66FFFF, &H3C0223A, &HE801428D, &HFFFFEEF0, &H66C1570F, &HE8223A0F, &H2428D03, &HFFEEDFE8, &HE9570FFF, &H223A0F66
+    pvAppendBuffer &H428D03E0, &HEECEE803, &H570FFFFF, &H3A0F66E1, &H8B03D822, &HF142444, &H8BD957, &HC244489, &HC24448B, &H2473C639, &H448BF789, &HC1461C24, &H280F04E7, &HF66380C, &H66C1DC38, &HE9DC380F, &HDC380F66, &H380F66E1, &HD4EBD9DC, &H1C24748B, &HF04E0C1, &HC3833910, &H40C18340, &HF04C283, &H66063428, &HC6DD380F, &HDD380F66, &H380F66EE, &H570FE6DD, &H380F66C7, &H110FDEDD, &H100FC043
+    pvAppendBuffer &H280FD041, &HC5570FCB, &HD043110F, &HE041100F, &HFC4570F, &HFE04311, &HFF07910, &H110FCF57, &H5E9F04B, &H8BFFFFFF, &H558B0C45, &H247C8B0C, &H24748B18, &H2E8C108, &H89FCE283, &HFCC06BC1, &H4503FA01, &HC1D0010C, &H448906E1, &HCE011824, &H39084D03, &H74182454, &H24448B63, &HCA280F1C, &H1BB&, &H280F00, &HE9E8D089, &H66FFFFED, &HC8223A0F, &H24448B03, &HC1570F14, &H4489008B
+    pvAppendBuffer &H448B0C24, &HC3390C24, &HDF891273, &H1C24448B, &H4E7C143, &HDC380F66, &HE6EB3804, &H1C245C8B, &HC13E100F, &HC68304E0, &H10C18310, &H380F6642, &HF0304DD, &H110FC757, &H97EBF041, &H1024548B, &H1824448B, &HFFBE5AE8, &HF4658DFF, &H5D5F5E5B, &H570008C2, &H8247C8D, &HFFF0E483, &H8955FC77, &H895657E5, &HC38953FE, &H8B1CEC83, &H4768B3F, &H85E44D89, &H832B74D2, &H75002878, &HD0895125
+    pvAppendBuffer &H5108538D, &HE9C1F189, &H8B575104, &HD6E8E44D, &H89FFFFFD, &HFE683F0, &H1F0E083, &HC701E445, &HEC835A58, &H89F9890C, &H558B56D8, &HECC9E8E4, &HC483FFFF, &HF4658D0C, &H5D5F5E5B, &H5FF8678D, &H550008C2, &H8B53E589, &H5D8B084D, &H918B0C, &H8B000002, &H3100F09, &HF10428D, &HF9830257, &H831B740C, &H7740EF9, &H750AF983, &H661DEB60, &H42DE380F, &H30428D10, &HDE380F66, &HF662042
+    pvAppendBuffer &H8300DE38, &HF6620C0, &HF040DE38, &HDE380F66, &H380F6600, &H661040DE, &H40DE380F, &H380F6620, &H663040DE, &H40DE380F, &H380F6640, &H665040DE, &H40DE380F, &H380F6660, &H667040DE, &H80DE380F, &H80&, &HDF380F66, &H9080&, &H10458B00, &H5B00110F, &HCC25D, &H247C8D57, &HF8E48308, &H55FC77FF, &H5657E589, &H8953FE89, &H8EC83C3, &H8B04768B, &H11E8563F, &H9FFFFCC, &HE7459C2
+    pvAppendBuffer &H89F98950, &H56D889DA, &HFFCB7FE8, &H658D5AFF, &H5F5E5BF4, &HF8678D5D, &H8C25F, &H247C8D57, &HF8E48308, &H55FC77FF, &H5657E589, &H8153D689, &HD4EC&, &H891F8B00, &HFFFF2485, &H89F089FF, &HFFFF2C8D, &HE8DA89FF, &HFFFFC7A8, &H1074C085, &HFF24858B, &H82E8FFFF, &HE9FFFFC7, &H237&, &HF289D989, &HFF30858D, &HF631FFFF, &HFFC817E8, &H2C958BFF, &H8DFFFFFF, &HFFFF6085, &HC806E8FF
+    pvAppendBuffer &H458DFFFF, &HE8DA8990, &HFFFFC751, &HC7C0458D, &H19045, &H75890000, &HC73FE894, &HBD8DFFFF, &HFFFFFF60, &HFF30B58D, &HD989FFFF, &HF089FA89, &HFFC893E8, &HFC085FF, &H1CA84, &H30958B00, &H83FFFFFF, &HCA8301E2, &H89317500, &HE8DA89F0, &HFFFFC981, &H8390458B, &HC88301E0, &H8D057500, &H3DEB9045, &H8990458D, &HFFFF2885, &H51C289FF, &H2C8D8B53, &HE9FFFFFF, &HC2&, &HFF60958B
+    pvAppendBuffer &HE283FFFF, &HCA8301, &HF8893B75, &H42E8DA89, &H8BFFFFC9, &HE083C045, &HC88301, &H458D0F75, &HE8DA89C0, &HFFFFC92D, &HFFFF71E9, &HC0458DFF, &HFF288589, &H8952FFFF, &H8D8B53C2, &HFFFFFF2C, &H116E9, &HFC08500, &H9D8E&, &HF9895000, &HF089F289, &HCAB2E853, &HDA89FFFF, &H8DF08958, &HEEE89075, &H8DFFFFC8, &HD989C055, &HD5E8F089, &H85FFFFC7, &H501279C0, &HF089F289, &H2C8D8B53
+    pvAppendBuffer &HE8FFFFFF, &HFFFFCA04, &H90458D58, &H89C04D8D, &HFFFF2885, &H56C289FF, &HCA6EE853, &H458BFFFF, &HE0835F90, &HC88301, &HFF31840F, &H5352FFFF, &HFF28958B, &H8D8BFFFF, &HFFFFFF2C, &HC9E8D089, &H89FFFFC9, &H858B58C7, &HFFFFFF28, &HDA89D689, &HFFC880E8, &HFFE09FF, &HFFFEC184, &HDD4C81FF, &H8C&, &HFEB4E980, &H8950FFFF, &H89FA89F1, &H758D53F8, &HCA12E8C0, &HDA89FFFF, &HE8F88958
+    pvAppendBuffer &HFFFFC851, &H8990558D, &HE8F089D9, &HFFFFC738, &H1279C085, &H89F28950, &H8D8B53F0, &HFFFFFF2C, &HFFC967E8, &H458D58FF, &H904D8DC0, &HFF288589, &HC289FFFF, &HD1E85356, &H8BFFFFC9, &H835FC045, &HC88301E0, &HD3840F00, &H52FFFFFE, &H28958B53, &H8BFFFFFF, &HFFFF2C8D, &HE8D089FF, &HFFFFC92C, &H8B58C789, &HFFFF2885, &H89D689FF, &HC7E3E8DA, &HFE09FFFF, &HFE24840F, &H4C81FFFF, &HBCDD&
+    pvAppendBuffer &H17E98000, &H8BFFFFFE, &HFFFF2485, &H90558DFF, &HF1E8D989, &H8DFFFFC5, &H5E5BF465, &H678D5D5F, &H4C25FF8, &H7C8D5700, &HE4830824, &HFC77FFF0, &H57E58955, &HEC835356, &HDC45893C, &H178BD089, &H83E04D89, &HB7F32F9, &HD231CB89, &H5D89CB01, &H5119EBD8, &H52C18951, &H8BE075FF, &HD089DC55, &HFFEA99E8, &HE95E5BFF, &H11B&, &H39D87D8B, &H31087DFA, &H903C89FF, &H8BF1EB42, &HFA89E05D
+    pvAppendBuffer &H7589F631, &H8BDA29C8, &H3C8DDC5D, &HC47D8990, &H8DE07D8B, &H7D8BBB1C, &HD45D89D8, &H89B8048D, &H4589CC5D, &HC04589E4, &H39C87D8B, &H577EE07D, &HFFC0458B, &HF631C845, &H89CC7D8B, &H458BD045, &H4EF83DC, &H4D06D83, &H2774C739, &H8BCC5D8B, &H63F7FC47, &HD05D8BFC, &H31FC4B8B, &H89C801DB, &H31DA11F1, &H8BC101DB, &HD311D045, &H89FC4889, &H8BCBEBDE, &H6D83C445, &H6D8304CC, &H6D8304C4
+    pvAppendBuffer &H708908C0, &H8BA1EBFC, &HF631E445, &HE883D231, &HD8553904, &H88B117E, &H91C8D42, &H91FE9C1, &H89CE89F3, &H31E7EB18, &H89F631DB, &H6D83DC5D, &H558B04D4, &HE46D83DC, &HE0553908, &H458B497E, &HE45D8BD4, &H7D89FF31, &H8B008BBC, &HDB31044B, &H4589E0F7, &HB84D03B8, &H5D13D089, &H1FF31BC, &HE44D8BCE, &HDB31DF11, &H7189D231, &H89098B04, &H11C801FE, &H1FF31DA, &HE4458BC6, &H45FFD711
+    pvAppendBuffer &H893089DC, &H8DA7EBFE, &H5E5BF465, &H678D5D5F, &H4C25FF8, &H7C8D5700, &HE4830824, &HFC77FFF0, &H57E58955, &HFB895356, &HEC83C789, &HF038B4C, &H55893710, &HB44D89C8, &H8904738B, &HF66CC45, &HBB1BD670, &H8&, &H39C9570F, &HE1280FDE, &HFC1280F, &HD231DE46, &H89D45589, &H4E0C1D8, &H89D04589, &HCC458BC1, &H89D8558D, &H280FB04D, &HB84589DA, &HFFE70AE8, &HD47D83FF, &H700F6600
+    pvAppendBuffer &H8B1BD86D, &H4D8BB845, &HDD570FB0, &H280F0374, &HC8558BDD, &HFFEB280F, &HC083D445, &H7C100F10, &H558BF00A, &H3A0F66B4, &HF00EF44, &HF00A7410, &HF10E983, &H280FC557, &H3A0F66EB, &HF11EF44, &HFB87529, &HF66E557, &HF4EEB70, &HF66DD57, &HDE443A, &H39CB570F, &H8C75D45D, &H8BD0280F, &H4D01D04D, &HD4570FCC, &HFD1570F, &H280FDA28, &H730F66CA, &HF6608FB, &HF08D973, &H570FC357
+    pvAppendBuffer &HF5D8E8CC, &H280FFFFF, &HFDE29D0, &HFFFF3285, &H700F66FF, &H110F1BD0, &H4CC48317, &H5D5F5E5B, &H5FF8678D, &H570008C2, &H8247C8D, &HFFF8E483, &H8955FC77, &H315657E5, &HEC8353F6, &H891F8B4C, &HFF31C445, &H31B85589, &H1B048DD2, &H31B44D89, &H558948C9, &HBC4589D0, &H89D45589, &H4D89D84D, &HB4458BDC, &H8DDC558B, &H5589F004, &HD4558BCC, &H8BC04589, &H5589D845, &HC84589DC, &H89D0458B
+    pvAppendBuffer &HC031D845, &H89D04589, &HFE39D445, &HDF397772, &H4D8B7373, &HE0458DB8, &H8BF9148B, &H8904F94C, &HD76BA855, &HAC4D89F8, &HFFC04D8B, &HFF041174, &H558B1134, &HAC4D8BA8, &HFFC6CDE8, &HC8458BFF, &H3CC558B, &H5513E045, &HC84589E4, &H89C0920F, &HB60FCC55, &H3D231C0, &H5513E845, &HD84501EC, &H1B8&, &HDC551100, &H31D84D8B, &HE84D3BD2, &H1BDC4D8B, &H472EC4D, &HD231C031, &H11D04501
+    pvAppendBuffer &HEB47D455, &HC47D8B85, &H8BC8458B, &H489CC55, &HBC458BF7, &H4F75489, &H73C63946, &H39FF3116, &H3A820FDE, &H89FFFFFF, &H8DD829F0, &H2EE90178, &H8BFFFFFF, &H558BD845, &H4E3C1DC, &HF81F4489, &HFC1F5489, &H5BF4658D, &H8D5D5F5E, &HC25FF867, &H8D570004, &H8308247C, &H77FFF8E4, &HE58955FC, &H758D5657, &HC3895390, &HEC83F089, &H573F8B68, &HFFFEB2E8, &H58F289FF, &HFF83D889, &HE8077504
+    pvAppendBuffer &HFFFFC6F1, &H13E805EB, &H8DFFFFCA, &H5E5BF465, &H678D5D5F, &H4C25FF8, &H7C8D5700, &HE4830824, &HFC77FFF8, &H57E58955, &HD3895356, &H4BA&, &H9CEC8100, &H89000000, &HFFFF6C85, &H8D078BFF, &HFFFF70BD, &H5C8D89FF, &H89FFFFFF, &HFFFF6885, &HC173E8FF, &HDA89FFFF, &H8B50C689, &HFFFF5C8D, &H6AF889FF, &HFE3DE804, &H458DFFFF, &H4BA5A90, &HE8000000, &HFFFFC151, &H100988D, &HC0850000
+    pvAppendBuffer &H4BA0E75, &H89000000, &HC13BE8F8, &HC389FFFF, &H2473F339, &HFF6C858B, &H958DFFFF, &HFFFFFF70, &H4B9&, &HC15EE800, &H658DFFFF, &H5F5E5BF4, &HF8678D5D, &H4C25F, &HBAB07D8D, &H4&, &H96E8F889, &H8DFFFFC0, &H8EE8D045, &H89FFFFC0, &H89F129D9, &H6EEC1CE, &H83F7048D, &H19743FE1, &H68958B57, &H6AFFFFFF, &HC231E804, &H4489FFFF, &H5489D0F5, &HEB58D4F5, &H68958B10, &HB9FFFFFF
+    pvAppendBuffer &H4&, &HFFC0FFE8, &H6C858BFF, &HBAFFFFFF, &H4&, &H42E8F631, &H8BFFFFC0, &HFFFF6C85, &H100C7FF, &H89000000, &HFB810470, &H100&, &H958B1B77, &HFFFFFF68, &HB9B0458D, &H4&, &HFFC183E8, &HFC085FF, &HFFFF4788, &H90558DFF, &HB9D0458D, &H4&, &HFF70BD8D, &H758DFFFF, &HC162E8B0, &HC085FFFF, &H4F751478, &H4B9&, &H89FA8900, &HC14EE8F0, &HC085FFFF, &H8D523D7F
+    pvAppendBuffer &HFFFF7085, &HB04D8DFF, &HC289046A, &HFFC3FBE8, &H59C209FF, &H8D561474, &H8D8B9045, &HFFFFFF6C, &HC289046A, &HFFC3E3E8, &H8D525FFF, &H4D8D9045, &H89046AD0, &HC3D2E8C2, &H8B59FFFF, &H4BAD045, &H8D000000, &HC14BB075, &H85891FE0, &HFFFFFF64, &H8589C031, &HFFFFFF60, &HE8D0458D, &HFFFFC1F5, &H4BA&, &HE8F08900, &HFFFFC1E9, &HFF60858B, &H4509FFFF, &H64958BC8, &H9FFFFFF, &H27E9CC55
+    pvAppendBuffer &H57FFFFFF, &H8247C8D, &HFFF8E483, &H8955FC77, &H535657E5, &H6BAD389, &H81000000, &HDCEC&, &H2C858900, &H8BFFFFFF, &H30BD8D07, &H89FFFFFF, &HFFFF1C8D, &H288589FF, &HE8FFFFFF, &HFFFFBF89, &HC689DA89, &H1C8D8B50, &H89FFFFFF, &HE8066AF8, &HFFFFFC53, &HFF60858D, &HBA5AFFFF, &H6&, &HFFBF64E8, &H80988DFF, &H85000001, &HBA0E75C0, &H6&, &H4EE8F889, &H89FFFFBF, &H73F339C3
+    pvAppendBuffer &H2C858B24, &H8DFFFFFF, &HFFFF3095, &H6B9FF, &H71E80000, &H8DFFFFBF, &H5E5BF465, &H678D5D5F, &H4C25FF8, &H907D8D00, &H6BA&, &HE8F88900, &HFFFFBEA9, &HE8C0458D, &HFFFFBEA1, &HF129D989, &HEEC1CE89, &HF7048D06, &H743FE183, &H958B5719, &HFFFFFF28, &H44E8066A, &H89FFFFC0, &H89C0F544, &H58C4F554, &H958B10EB, &HFFFFFF28, &H6B9&, &HBF12E800, &H858BFFFF, &HFFFFFF2C, &H6BA&
+    pvAppendBuffer &HE8F63100, &HFFFFBE55, &HFF2C858B, &HC7FFFF, &H1&, &H81047089, &H180FB, &H8B1B7700, &HFFFF2895, &H90458DFF, &H6B9&, &HBF96E800, &HC085FFFF, &HFF47880F, &H958DFFFF, &HFFFFFF60, &HB9C0458D, &H6&, &HFF30BD8D, &H758DFFFF, &HBF72E890, &HC085FFFF, &H55751478, &H6B9&, &H89FA8900, &HBF5EE8F0, &HC085FFFF, &H8D52437F, &HFFFF3085, &H904D8DFF, &HC289066A, &HFFC20BE8
+    pvAppendBuffer &H59C209FF, &H8D561774, &HFFFF6085, &H2C8D8BFF, &H6AFFFFFF, &HE8C28906, &HFFFFC1F0, &H858D525F, &HFFFFFF60, &H6AC04D8D, &HE8C28906, &HFFFFC1DC, &HC0458B59, &H6BA&, &H90758D00, &H1FE0C14B, &HFF248589, &HC031FFFF, &HFF208589, &H458DFFFF, &HBFFFE8C0, &H6BAFFFF, &H89000000, &HBFF3E8F0, &H858BFFFF, &HFFFFFF20, &H8BB84509, &HFFFF2495, &HBC5509FF, &HFFFF1EE9, &HC18955FF, &H5657E589
+    pvAppendBuffer &HA9FEE8, &H7C68100, &H530000AA, &H83F0E483, &H100F50EC, &H58100F28, &H66C03110, &HB1C5700F, &HD3700F66, &H2474891B, &HFD68908, &HD231E028, &HF3A0F66, &HF6608E2, &HF0D00E3A, &HFEA280F, &HF883DC28, &HF247F03, &HF160C10, &H66160410, &H8D1710F, &HF0710F66, &HC1560F08, &HC0700FF2, &H700FF3B1, &H290FB1C0, &H8B101444, &H8908245C, &HCD280FC7, &H8B03E783, &HFF07749B, &H247C89FF
+    pvAppendBuffer &H4E7C10C, &H3C74280F, &HFD788D10, &H1384100F, &H25A0&, &H8D0BFF83, &HF660158, &H380FC6FE, &HF66CBCB, &HF0EC070, &H3977E928, &HF03788D, &H380FFE28, &HE783D9CB, &H4E7C103, &HF3A0F66, &H4103C7C, &HE783DF89, &H4E7C103, &H7CFE0F66, &H380F103C, &H290FFECD, &H8D103C7C, &HFF83FF78, &HEB37770B, &HF3280F15, &HFFF788D, &HFF1CB38, &H280FC628, &HBFF83DE, &HC0832577, &H247C8B03
+    pvAppendBuffer &H3E0830C, &HC104E0C1, &H280F04E7, &HF100444, &H3C44CC38, &H44290F10, &HC2831004, &H8308EB10, &HFB8310C2, &H89077410, &HFF14E9D8, &HF66FFFF, &HF66C4FE, &HF66CAFE, &H661BC070, &HB1C9700F, &H66D0280F, &HD10E3A0F, &H3A0F66F0, &HF08C80F, &H110F1111, &H658D1049, &H5F5E5BF4, &H90E8C35D, &H50000A8, &HA8A9&, &H57E58955, &HE4835356, &H50EC81F0, &H8B000001, &H758B085D, &H2444890C
+    pvAppendBuffer &H68438B10, &H7502F883, &H89F2890E, &HFE67E8D8, &H16E9FFFF, &H8B000002, &H47B8B13, &H8948C931, &H8B382454, &H7C890853, &H7B8B3424, &H2454890C, &H10538B30, &H2C247C89, &H89147B8B, &H8B282454, &H7C891853, &H7B8B2424, &H2454891C, &H247C8920, &H8D4B751C, &H89502454, &HED16E8F0, &H448BFFFF, &H7C8B1C24, &H548B2824, &H44893824, &H448B1824, &H44892024, &H448B3C24, &H44892424, &H448B4424
+    pvAppendBuffer &H44892C24, &H448B1424, &H44893024, &H448B4824, &H44893424, &HC0314C24, &H40244489, &H48D5FEB, &H24548D0E, &HB07EE850, &H4489FFFF, &HC183500C, &H40F98304, &HB48DE875, &H11024, &H38428B00, &H8904C283, &HC1C189C7, &HC7C10AE8, &HDC1C10F, &H3A8BF931, &H4A8BC831, &H204A03FC, &HA8BC801, &HC107CFC1, &HF9310EC1, &HEFC13A8B, &H1F93103, &H3C4289C8, &HC575D639, &HFFFF61E9, &H24448BFF
+    pvAppendBuffer &HC1F98910, &HB08B0BC9, &HFFFF0774, &HC8C1F889, &H89C83106, &H7C1C1F9, &H448BC131, &H4C894024, &H4C8B0C24, &H448B4024, &H44FF5084, &H84034024, &H25A08E, &H24748B00, &HF7F9890C, &H8BF001D1, &H213C2474, &H24748BF1, &H31FE2144, &H24748BF1, &H89C80118, &H89F001D1, &HDC9C1D6, &H3102CEC1, &HC1D689F1, &HF1310AC6, &H4C24748B, &H18244C89, &H48244C8B, &H4C8BCE31, &HD6214C24, &HC247489
+    pvAppendBuffer &H4824748B, &HCE89F121, &HC244C8B, &HCE89F131, &H18244C8B, &H748BF101, &HC6011424, &H4C8BC801, &H7C834824, &H89404024, &H8B14244C, &H893C244C, &H7418244C, &H244C8B21, &H247C8944, &H8BF78944, &H894C2474, &H894C2454, &H244C89C2, &H2474893C, &HFF27E948, &H4C8BFFFF, &HC1013824, &H3424448B, &HD0010B89, &H4C24548B, &H8B044389, &H1302444, &H24548BD0, &H8438948, &H2C24448B, &H4389D001
+    pvAppendBuffer &H24448B0C, &H89F00128, &H448B1043, &HF8012424, &H44247C8B, &H8B144389, &H1202444, &H247C8BF8, &H1843893C, &H1C24448B, &H4389F801, &H60438B1C, &H60438940, &H5BF4658D, &HC25D5F5E, &H89550008, &H40E857E5, &H810000A6, &HA645C7, &H89535600, &H10EC83C3, &H89E45589, &H7D89E84D, &HE4558BF0, &HC2E8D889, &H8BFFFFEA, &HFF85107B, &H116850F, &HFF3D0000, &H7F000000, &H18538B1C, &H751C533B
+    pvAppendBuffer &HFFFBBF0A, &H2E9FFFF, &H8D000001, &H4B89014A, &HEB028818, &H1003DC8, &H840F0000, &HED&, &HBAE44D8B, &H11D&, &H260B18B, &HD6390000, &H39F24F0F, &HCD8F0FF0, &H8B000000, &HB983E84D, &H260&, &HBD840FFF, &H8B000000, &H918BF04D, &HFFFF0774, &H42B4B70F, &H29A0&, &H774918B, &HB60FFFFF, &H2A820294, &HC0310000, &H774D285, &HDBE8D889, &H1FFFFE9, &HE8558BF0, &H89EC4589
+    pvAppendBuffer &HEA23E8D8, &H4D8BFFFF, &H1DBAE8, &HB18B0000, &H260&, &H4F0FD639, &H7FF039F2, &HF04D8B6B, &H774918B, &HB70FFFFF, &H2BFC42B4, &H918B0000, &HFFFF0774, &H294B60F, &H2BDE&, &HD285C031, &HD8890774, &HFFE989E8, &H18538BFF, &HD089C601, &H3914432B, &H8B317CF0, &H4D8B1C43, &H39D029EC, &H1A8C0FC8, &H8BFFFFFF, &H438BEC4D, &H7DCF3918, &H29FA890D, &H10148AF2, &H47381488, &HC801E9EB
+    pvAppendBuffer &HE9184389, &HFFFFFED5, &HFFFFFDBF, &H10C483FF, &H5E5BF889, &H55C35D5F, &HE857E589, &HA4E7&, &HA4ECC781, &H53560000, &H650EC81, &H95890000, &HFFFFF9AC, &HF9ACB58B, &H8589FFFF, &HFFFFFB24, &HF9A8BD89, &H7D8BFFFF, &H20858908, &H3FFFFFB, &H89178B06, &HFFF9B48D, &HC8D89FF, &H1FFFFFB, &H288589CA, &H89FFFFFB, &HFFFB1095, &H89D231FF, &HFFFB1495, &H189589FF, &H89FFFFFB, &HFFFB1C95
+    pvAppendBuffer &HC9D8DFF, &HBAFFFFFB, &H1&, &HBFE8D889, &HBAFFFFE8, &H2&, &HF9A48589, &HD889FFFF, &HFFE8ADE8, &H1F883FF, &HA9840F, &HF8830000, &H7E840F02, &H85000001, &HB90A74C0, &HFFFFFFFD, &H3BEE9, &H10B58B00, &H8BFFFFFB, &HFFFB0C95, &H29F189FF, &H3F983D1, &H8B66E17E, &HB70F024A, &H66D1F71A, &HD3750A3B, &H29047A8D, &HC0BD89FE, &H89FFFFF9, &HFFFB0CBD, &H72DE39FF, &H24B58BBE
+    pvAppendBuffer &H8BFFFFFB, &HFFFB28BD, &H39F729FF, &H6B820FDF, &H31000003, &H74C339FF, &H24C8A0F, &H1BF04, &HC880000, &HEDEB4006, &HC084F889, &H8D8B1674, &HFFFFF9C0, &HB589DE01, &HFFFFFB24, &H8D89D901, &HFFFFFB0C, &H8589C031, &HFFFFFB14, &HFB188589, &HD3E9FFFF, &H31000002, &H84C766C0, &HFFFB2C45, &H400000FF, &H7510F883, &H85C766F0, &HFFFFFB3A, &HC0310018, &HFB3C85C7, &H98FFFF, &H908D0070
+    pvAppendBuffer &H100&, &H45948966, &HFFFFFB4C, &H18F88340, &HC031EC75, &H45848966, &HFFFFFB7C, &H903D40, &HF0750000, &HFC9C85C7, &H118FFFF, &HC0310119, &HFCA085C7, &H11AFFFF, &H85C7011B, &HFFFFFCA4, &H11D011C, &HFCA885C7, &H11EFFFF, &H908D011F, &H90&, &H45948966, &HFFFFFCAC, &H70F88340, &H85C7EC75, &HFFFFFD8C, &H11D&, &HC766C031, &HFD904584, &HFFFF&, &H10F88340, &HC766F075
+    pvAppendBuffer &HFFFD9A85, &H310020FF, &H948966D2, &HFFFDB055, &H858D42FF, &HFFFFFB0C, &H7520FA83, &HF045C7EC, &H1D&, &HFD908D8D, &H958DFFFF, &HFFFFFB2C, &H1EAE9, &H5BA00, &HD8890000, &HFFE711E8, &H5BAFF, &H1050000, &H89000001, &HFFF9C085, &HE8D889FF, &HFFFFE6FA, &H4BA&, &H85894000, &HFFFFF9B8, &HE7E8D889, &H81FFFFE6, &HFFF9C0BD, &H11EFF, &H4588D00, &HFE3D870F, &HBD83FFFF
+    pvAppendBuffer &HFFFFF9B8, &H30870F1E, &H31FFFFFE, &H584C6C0, &HFFFFF9CC, &HF8834000, &H31F27513, &H73DE39F6, &H3BA30, &H858D0000, &HFFFFFB0C, &HFFE6A1E8, &H8BC289FF, &HFFF9A885, &H74808BFF, &HFFFFF07, &H703084B6, &H4600002B, &HCC059488, &HEBFFFFF9, &H13B9CC, &H958D0000, &HFFFFF9CC, &HFB2C858D, &H9AE8FFFF, &H89FFFFE5, &HFC085C1, &H19285, &H8C858B00, &H89FFFFFD, &HFFF9B085, &H840F40FF
+    pvAppendBuffer &HFFFFFDB7, &H858BFF31, &HFFFFF9C0, &HF9B8B58B, &HC601FFFF, &H830FF739, &HA8&, &HFB0C858D, &H958DFFFF, &HFFFFFB2C, &HF9BC8589, &H76E8FFFF, &H89FFFFE6, &HB08539C3, &HFFFFFF9, &HFFFD7A8C, &H11F883FF, &HF8833474, &HB8447412, &H1&, &H7510FB83, &HFFF8559, &HFFFD5E84, &HBC858BFF, &HBAFFFFF9, &H2&, &H3D9CB60F, &HFFFFF9CB, &HFFE5DDE8, &H3C083FF, &H858B2AEB, &HFFFFF9BC
+    pvAppendBuffer &H3BA&, &HE5C8E800, &HC083FFFF, &H8B13EB03, &HFFF9BC85, &H7BAFF, &HB3E80000, &H83FFFFE5, &HDB310BC0, &HC639FE29, &HFD0D820F, &HF801FFFF, &HF9CB958D, &HC739FFFF, &HFF48840F, &H8847FFFF, &HF2EB3A1C, &HFACCBD80, &HF00FFFF, &HFFFCEA84, &HCC9D8DFF, &H8DFFFFF9, &HFFFB2CB5, &H89C189FF, &H8DF089DA, &HFFFB0CBD, &HE493E8FF, &HC189FFFF, &H850FC085, &H8B&, &HF9C0958B, &H8D8BFFFF
+    pvAppendBuffer &HFFFFF9B8, &H9D8DDA01, &HFFFFFD90, &H6EE8D889, &H89FFFFE4, &H75C085C1, &H89D9896A, &HE8F889F2, &HFFFFFA9A, &HC085C189, &HBD835975, &HFFFFF9A4, &H4A840F00, &H8BFFFFFC, &HFFFB1C8D, &HFC985FF, &HFFFC7685, &HACBD8BFF, &H8BFFFFF9, &HFFFB2485, &H8BEFF, &H852B0000, &HFFFFFB20, &HFB0C9D8B, &H789FFFF, &HF9B4858B, &HC329FFFF, &HFB18858B, &HF799FFFF, &H8BC329FE, &H18890845, &HFBB905EB
+    pvAppendBuffer &H81FFFFFF, &H650C4, &H5BC88900, &HC25D5F5E, &H89550004, &H14458DE5, &H104D8B50, &H8B0C558B, &H70E80845, &HC9FFFFFB, &H550010C2, &H5657E589, &H18EC8353, &H5147D83, &H7710758B, &HFFFDBB0A, &HC7E9FFFF, &HF000000, &HB60F3EB6, &H1FB90156, &H89000000, &H88D389F8, &HE0C1DC45, &H31D00108, &H89F1F7D2, &HD285E055, &H4D8AD375, &HFE183DC, &H7508F980, &H7FFF83C8, &HE380C377, &H8BBE7520
+    pvAppendBuffer &H4E8D1445, &HFA788D02, &H89F0458D, &H8B50F07D, &H458B0C55, &HFAFDE808, &HC389FFFF, &H9D75C085, &H75F07D3B, &H14458B98, &H1B9&, &HFFF1BF00, &H448B0000, &HC80FFC06, &H8BDC4589, &H308B0C45, &H3774F685, &H15B0B8, &HFC63900, &HC629C646, &HFF084503, &H558B0845, &H52B60F08, &H1D101FF, &H4539E04D, &H89EC7508, &HF7D231C8, &HE0458BF7, &HD231D189, &H5589F7F7, &H8BC5EBE0, &H7D8BE045
+    pvAppendBuffer &H10E0C1DC, &HF839C809, &HFF2F850F, &H658DFFFF, &H5BD889F4, &HC25D5F5E, &H8D570010, &H8308247C, &H77FFF0E4, &HE58955FC, &H81535657, &H8CEC&, &H4778B00, &H89085F8B, &H578BC055, &H7C85890C, &H8BFFFFFF, &HB84D8907, &H9589FF31, &HFFFFFF78, &HFF7C958B, &H100FFFFF, &HCC08338, &H1FC8A8B, &H45890000, &H7D290F84, &HBC4D89A8, &HFFA7B7E8, &HC47D89FF, &H8B804589, &H100FB845, &H80458B38
+    pvAppendBuffer &HC87D290F, &H7D700F66, &H45891BC8, &H7D290FC8, &H80458B98, &HFF788D8B, &HC801FFFF, &HFC84539, &H1C684, &HBC458B00, &H31FF570F, &H1B9FF, &H280F0000, &HC8458B10, &HFFD69BE8, &H75280FFF, &H3A0F66A8, &H8B03F022, &H570FC845, &H85E840F2, &HFFFFFD6, &H66A86D28, &HE8223A0F, &HC8458B03, &H83EA570F, &H6DE802C0, &HFFFFFD6, &H66A86528, &HE0223A0F, &HC8458B03, &H83E2570F, &H55E803C0
+    pvAppendBuffer &HFFFFFD6, &HFA84528, &H66887D29, &HC0223A0F, &HD0570F03, &H8BC7280F, &HFFFF7C85, &H39008BFF, &HBE830FC1, &H8B000000, &HF889BC55, &H7D83D8F7, &H280F00C4, &H6610024C, &HF1DC380F, &HDC380F66, &H380F66E9, &HF66E1DC, &HFD1DC38, &H8B84&, &H4F98300, &H82870F, &H458B0000, &HD8558DC4, &HFF688D89, &HF829FFFF, &HFFD516E8, &H5D280FFF, &H688D8B98, &H66FFFFFF, &HD84D700F, &HD9570F1B
+    pvAppendBuffer &H7401F983, &HD9280F03, &HFC0458B, &H40384C10, &H688D290F, &HFFFFFFF, &HF66CB28, &H688D443A, &HFFFFFF, &HFC1570F, &HF66CB28, &H688D443A, &H11FFFFFF, &H66F9570F, &H4ECB700F, &HFD9570F, &HC0388C10, &H66000000, &HD9443A0F, &H5D570F00, &H8D290F88, &HFFFFFF68, &H885D290F, &H10EF8341, &HFFFF32E9, &HBC7D8BFF, &H8304E0C1, &HF00C47D, &H66070C28, &HF1DD380F, &HDD380F66, &H380F66E9
+    pvAppendBuffer &HF66E1DD, &HFD1DD38, &H570F0E10, &HB110FCE, &H104E100F, &HFCD570F, &HF104B11, &HF204E10, &H110FCC57, &H100F204B, &H570F304E, &H4B110FCA, &HF267430, &H570FC828, &H4D570FCF, &HD1280F88, &HD9730F66, &H730F6608, &H570F08FA, &HC2570FCF, &HFFE389E8, &H45290FFF, &HC45D8998, &H8340C683, &H458340C3, &H26E904C8, &H8BFFFFFE, &H7D83B845, &HF6600C4, &H1B984570, &H7400110F, &HC0458B1D
+    pvAppendBuffer &H90888D, &H508D0000, &H6A505010, &HC475FF04, &HE8B8458B, &HFFFFEC7D, &H558B595A, &HC8458B84, &HFFA57EE8, &HF4658DFF, &H5D5F5E5B, &H5FF8678D, &H570010C2, &H8247C8D, &HFFF8E483, &H8955FC77, &H535657E5, &HB4EC81, &H85890000, &HFFFFFF54, &HC801C889, &HFF6C8D89, &HC931FFFF, &H50958948, &H89FFFFFF, &HFFFF4C85, &H608D89FF, &H89FFFFFF, &HFFFF648D, &H708D89FF, &H89FFFFFF, &HFFFF748D
+    pvAppendBuffer &H788D89FF, &H89FFFFFF, &HFFFF7C8D, &H78858BFF, &H8BFFFFFF, &HFFFF7CBD, &H74958BFF, &H29FFFFFF, &H688589F8, &H8BFFFFFF, &HFFFF7085, &H5C9589FF, &H8BFFFFFF, &HFFFF6495, &H588589FF, &H8BFFFFFF, &HFFFF6085, &H749589FF, &H89FFFFFF, &HFFFF7085, &H89C031FF, &HFFFF6085, &H648589FF, &H8BFFFFFF, &HFFFF7C9D, &H789D39FF, &H73FFFFFF, &H78858B62, &H8BFFFFFF, &HFFFF589D, &H90558DFF, &HFF5CB58B
+    pvAppendBuffer &H85FFFFFF, &HFFFFFF78, &H8BC21C89, &HFFFF4C8D, &HC27489FF, &H788D3904, &HFFFFFFF, &H12083, &H8BD23100, &HFFFF6CBD, &H7C9589FF, &H39FFFFFF, &HFFFF78BD, &H52820FFF, &H8BFFFFFF, &HFFFF7885, &H40F829FF, &HFF7C8589, &H3EE9FFFF, &H8BFFFFFF, &HFFFF7C9D, &H689D39FF, &H72FFFFFF, &H50BD8B90, &H8BFFFFFF, &HFFFF7C9D, &H80458DFF, &HFF688D8B, &H748BFFFF, &H1C8B04DF, &H44B589DF, &H89FFFFFF
+    pvAppendBuffer &H409D89DA, &HFFFFFFFF, &HFF04CF74, &HF189CF34, &HFFB375E8, &H80758BFF, &H8B847D8B, &H5D8B884D, &H68958B8C, &H39FFFFFF, &HFFFF7C95, &H892A73FF, &H31D089DA, &H1FE8C1D2, &HFF608501, &H9511FFFF, &HFFFFFF64, &HC901FA89, &HDB11D089, &HE8C1D231, &H9D3091F, &H11F601C1, &H58B503FF, &H13FFFFFF, &HFFFF5CBD, &HC0920FFF, &HBD89D231, &HFFFFFF5C, &H89C0B60F, &HFFFF58B5, &H11C801FF, &H708501DA
+    pvAppendBuffer &HB8FFFFFF, &H1&, &HFF749511, &HBD8BFFFF, &HFFFFFF74, &H8D39D231, &HFFFFFF70, &H472DF19, &HD231C031, &HFF608501, &H9511FFFF, &HFFFFFF64, &HFF7C85FF, &H8DFFFFFF, &HFFFFFF68, &HFFFE9EE9, &H6C858BFF, &H8BFFFFFF, &HFFFF709D, &H74B58BFF, &HC1FFFFFF, &HBD8304E0, &HFFFFFF6C, &H55C8904, &H5748988, &H54858B8C, &H75FFFFFF, &HB383E807, &H5EBFFFF, &HFFB6A5E8, &HF4658DFF, &H5D5F5E5B
+    pvAppendBuffer &H5FF8678D, &H7C8D57C3, &HE4830824, &HFC77FFF8, &H57E58955, &H9A69E856, &HC6810000, &H9A72&, &H89C38953, &H4CEC83C8, &HBAA85589, &H4&, &HE8AC4D89, &HFFFFADBC, &H850FC085, &H1E3&, &H8BB07D8D, &H4B9A855, &H89000000, &HFD61E8F8, &HF989FFFF, &H52D0458D, &H46ADA89, &HFFEBF1E8, &H89FA89FF, &H4B959F8, &HE8000000, &HFFFFFD43, &HA8558B57, &H4D8B046A, &HE8D089AC, &HFFFFEBD2
+    pvAppendBuffer &HB9AC558B, &H4&, &HE8D08958, &HFFFFFD23, &H774868B, &H46AFFFF, &H4D8BDA89, &HBB005AC, &H89500000, &HB278E8D8, &H868BFFFF, &HFFFF0774, &H6AAC4D8B, &HBB00504, &HCA890000, &HE8C88950, &HFFFFB25E, &H774868B, &H4D8BFFFF, &H6ADA89AC, &HBB00504, &H89500000, &HE4FAE8C8, &HDA89FFFF, &HAC4D8B50, &H46AD889, &HFFEB65E8, &H74868BFF, &H89FFFF07, &HC7DA89D9, &H42404, &HB0050000
+    pvAppendBuffer &H5000000B, &HE8AC458B, &HFFFFB216, &H774868B, &H4D8BFFFF, &H6ADA89AC, &HBB00504, &H89500000, &HB1FCE8D8, &H38BFFFF, &H8301E083, &H347400C8, &H7748E8B, &H8952FFFF, &H6ADA89D8, &HB0C18104, &HE800000B, &HFFFFB044, &H4BA&, &H59C78900, &HFEE8D889, &HC1FFFFAE, &HC0311FE7, &H91C7B09, &HCEB1843, &H4BA&, &HE8D88900, &HFFFFAEE5, &HB9AC458B, &H4&, &H7D8DDA89, &HFC31E8D0
+    pvAppendBuffer &H868BFFFF, &HFFFF0774, &H6AAC558B, &H5F98904, &HBB0&, &HE8D08950, &HFFFFE43C, &H774868B, &H558BFFFF, &H6AF989AC, &HBB00504, &H89500000, &HE422E8D0, &H868BFFFF, &HFFFF0774, &H89AC4D8B, &H5046AFA, &HBB0&, &HE8F88950, &HFFFFE408, &HDA89F989, &H6AD88950, &HEA74E804, &H868BFFFF, &HFFFF0774, &H89B0758D, &H2404C7DA, &H4&, &HB005F189, &H5000000B, &HD9E8F089, &H8BFFFFE3
+    pvAppendBuffer &H4B9AC55, &H89000000, &HAC7AE8D8, &H558BFFFF, &HAC458BA8, &HFFAC6FE8, &HA8458BFF, &H65E8F289, &H8DFFFFAC, &H5E5BF465, &H678D5D5F, &H57C35FF8, &H8247C8D, &HFFF8E483, &H8955FC77, &H535657E5, &H83B05D8D, &H458954EC, &H89C889A4, &H4BAA055, &H89000000, &HB7E8AC4D, &H89FFFFAC, &H89D789C6, &H4BAD8, &H72E80000, &H31FFFFAB, &HB045C7C0, &H1&, &H8DB44589, &H4589D045, &HAB5BE8A8
+    pvAppendBuffer &H8B52FFFF, &HDA89AC45, &H5657046A, &HFFAC1BE8, &HA0558BFF, &H59A4458B, &HE8AC4D8B, &HFFFFFD65, &HA8558B53, &H458B046A, &HE85657AC, &HFFFFABFC, &HF4658D5E, &H5D5F5E5B, &H5FF8678D, &H7C8D57C3, &HE4830824, &HFC77FFF8, &H57E58955, &H8956C789, &H4B9CE, &H8D530000, &HD889D05D, &H892CEC83, &HF289CC55, &HFFFACAE8, &H89D989FF, &HF88950FA, &H5BE8046A, &H89FFFFE9, &H89DA89F1, &HE8046AD8
+    pvAppendBuffer &HFFFFE94E, &H89CC558B, &H89046AD9, &HE940E8D0, &H8D5AFFFF, &H5E5BF465, &H678D5D5F, &H57C35FF8, &H8247C8D, &HFFF8E483, &H8955FC77, &HE85657E5, &H974F&, &H9758C681, &H89530000, &H34EC83C3, &H8DC45589, &H3F8BD055, &H89C84D89, &H74868BD9, &H89FFFF07, &H46ACC55, &H5C8558B, &HBB0&, &HCC458B50, &HFFE26FE8, &HCC558BFF, &H4B9&, &HE8D08900, &HFFFFFA3B, &H8B50DA89, &HD889CC4D
+    pvAppendBuffer &HCBE8046A, &H8BFFFFE8, &H4D8BC855, &H89046ACC, &HE8BCE8D0, &H868BFFFF, &HFFFF0774, &H89C44D8B, &H2404C7FA, &H4&, &HBB005, &HF8895000, &HFFE223E8, &HCC458BFF, &H4B9FA89, &HE8000000, &HFFFFF9EF, &H774868B, &H558BFFFF, &H89046ACC, &HBB005D9, &H89500000, &HE1FAE8D0, &H868BFFFF, &HFFFF0774, &H6ACC558B, &HC84D8B04, &HBB005, &HD0895000, &HFFE1DFE8, &H74868BFF, &H8BFFFF07
+    pvAppendBuffer &HD989C855, &HB005046A, &H5000000B, &HC5E8D089, &H52FFFFE1, &H6AC4558B, &HC84D8B04, &H2FE8D089, &H8BFFFFE8, &HFF077486, &HCC4D8BFF, &H4C7DA89, &H424&, &HBB00500, &H8B500000, &H95E8C845, &H89FFFFE1, &H51F889FA, &H6AC84D8B, &HE800E804, &H868BFFFF, &HFFFF0774, &H89C44D8B, &H2404C7FA, &H4&, &HBB005, &HF8895000, &HFFE167E8, &HCC558BFF, &HB9C8458B, &H4&, &HFFAA07E8
+    pvAppendBuffer &HF4658DFF, &H5D5F5E5B, &H5FF8678D, &H570004C2, &H8247C8D, &HFFF8E483, &H8955FC77, &H895657E5, &HD8E853CE, &H81000095, &H95E5C3, &H7CEC8300, &H8B884589, &H907D8D07, &HFF7C9589, &H4D8BFFFF, &H89F28988, &H838B8445, &HFFFF0774, &H6A807D89, &HBB00504, &H89500000, &HB07D8DF8, &HFFE0F7E8, &H80558BFF, &H4B9&, &HE8D08900, &HFFFFF8C3, &H88558B50, &H4D8B046A, &HE8D08980, &HFFFFE752
+    pvAppendBuffer &H89804D8B, &H6AF089F2, &HE744E804, &H838BFFFF, &HFFFF0774, &HFF7C8D8B, &H4C7FFFF, &H424&, &H84558B00, &HBB005, &H458B5000, &HADF0E880, &H838BFFFF, &HFFFF0774, &H6A84558B, &H7C8D8B04, &H5FFFFFF, &HBB0&, &HE8D08950, &HFFFFE088, &H774838B, &H7D89FFFF, &H6AF2898C, &H884D8B04, &HBB005, &HF8895000, &HE8D07D8D, &HFFFFE068, &H7C958B52, &H6AFFFFFF, &H8C4D8B04, &HCFE8D089
+    pvAppendBuffer &H8BFFFFE6, &HFF077483, &H88558BFF, &H4C7F189, &H424&, &HBB00500, &H8B500000, &H7FE88C45, &H8BFFFFAD, &HF0898455, &H4B9&, &HF801E800, &H838BFFFF, &HFFFF0774, &HF289046A, &H58C4D8B, &HBB0&, &HE8F08950, &HFFFFE00C, &H774838B, &H558BFFFF, &H6AF18988, &HBB00504, &H89500000, &HDFF2E8F8, &H8B51FFFF, &HF9898455, &HD089046A, &HFFE65DE8, &H74838BFF, &H8BFFFF07, &H4C78455
+    pvAppendBuffer &H424&, &H7C8D8B00, &H5FFFFFF, &HBB0&, &HE8D08950, &HFFFFDFC0, &H8980558B, &H4B9F8, &H8CE80000, &H8BFFFFF7, &HFF077483, &H89046AFF, &H8C4D8BFA, &HBB005, &HF8895000, &HFFDF97E8, &H74838BFF, &H8BFFFF07, &HFA89884D, &HB005046A, &H5000000B, &HE88C458B, &HFFFFDF7C, &H8C558B56, &H4D8B046A, &HE8D08980, &HFFFFE5E6, &H774838B, &H8D8BFFFF, &HFFFFFF7C, &H42404C7, &H8B000000
+    pvAppendBuffer &HB0058C55, &H5000000B, &H49E8C889, &H8BFFFFDF, &HFA898845, &H4B9&, &HA7EAE800, &H658DFFFF, &H5F5E5BF4, &HF8678D5D, &H4C25F, &H247C8D57, &HF8E48308, &H55FC77FF, &H5657E589, &H93C2E8, &HCBC68100, &H53000093, &H18CEC81, &H85890000, &HFFFFFE88, &H5F8B078B, &H7C958908, &HBAFFFFFE, &H4&, &HFE788589, &HC889FFFF, &HFEA0B589, &H778BFFFF, &H9C8D8904, &HE8FFFFFE, &HFFFFA812
+    pvAppendBuffer &H4B9&, &H90858900, &H31FFFFFE, &HFF309C0, &H9589C095, &HFFFFFE94, &HFE9C958B, &HFF31FFFF, &H858DC689, &HFFFFFEB0, &H8589DEF7, &HFFFFFEAC, &HE800D783, &HFFFFF67B, &HFED0858D, &HDFF7FFFF, &HFEA48589, &H8B52FFFF, &HFFFE9C8D, &H8B046AFF, &HFFFEAC95, &HE4F8E8FF, &H958BFFFF, &HFFFFFEAC, &HFE788D8B, &H46AFFFF, &HE3E8D089, &H8BFFFFE4, &HFFFE7885, &HA4958BFF, &H83FFFFFE, &H858920C0
+    pvAppendBuffer &HFFFFFE68, &HD089C189, &HC3E8046A, &H8BFFFFE4, &HFFFEA085, &HAC958BFF, &H8BFFFFFE, &HFFFE888D, &H74808BFF, &HC7FFFF07, &H42404, &HB0050000, &H5000000B, &H1DE8D089, &H8BFFFFDE, &HFFFEA085, &HA4958BFF, &H8BFFFFFE, &HFFFE7C8D, &H74808BFF, &H6AFFFF07, &HBB00504, &H89500000, &HDDF6E8D0, &H858BFFFF, &HFFFFFEAC, &H4BA&, &HA720E800, &H8589FFFF, &HFFFFFEA8, &HFEA4858B, &HD389FFFF
+    pvAppendBuffer &H4BA&, &HA708E800, &H8D8BFFFF, &HFFFFFE90, &HFE8C8589, &H858BFFFF, &HFFFFFE94, &HFE749589, &H958BFFFF, &HFFFFFE8C, &HD0F7D1F7, &HFE988589, &H858BFFFF, &HFFFFFEA8, &H958BD021, &HFFFFFE74, &H858BC121, &HFFFFFE98, &H958BD321, &HFFFFFE88, &HFE808D89, &H4B9FFFF, &H21000000, &HF09D8DD8, &H89FFFFFE, &HFFFE8485, &H70858DFF, &H89FFFFFF, &HFFFE7485, &HA60EE8FF, &H958BFFFF, &HFFFFFE7C
+    pvAppendBuffer &H8990458D, &HFFFE7085, &HA5FAE8FF, &H958BFFFF, &HFFFFFE9C, &H89B0458D, &HFFFE6C85, &HA5E6E8FF, &H8D8BFFFF, &HFFFFFE6C, &HFE70958B, &H858BFFFF, &HFFFFFE74, &HFFF976E8, &HAC958BFF, &HB9FFFFFE, &H4&, &HE8E8D889, &H8DFFFFF4, &HFFFF1085, &H89DA89FF, &HFFFE8C85, &H8D8B51FF, &HFFFFFEAC, &H6BE8046A, &H8BFFFFE3, &HFFFE888D, &H89DA89FF, &HE8046AD8, &HFFFFE35A, &HFF30858D, &H4B9FFFF
+    pvAppendBuffer &H89000000, &HFFFEA885, &H958B5AFF, &HFFFFFEA4, &HFFF49EE8, &HA0858BFF, &H8BFFFFFE, &HFFFEA895, &H8C8D8BFF, &H8BFFFFFE, &HFF077480, &H5046AFF, &HBB0&, &HE8D08950, &HFFFFDC9C, &HFEA0858B, &H958BFFFF, &HFFFFFEA8, &H808BD989, &HFFFF0774, &HB005046A, &H5000000B, &H79E8D089, &H8BFFFFDC, &HFFFEA085, &HA8958BFF, &H89FFFFFE, &H74808BD9, &H6AFFFF07, &HBB00504, &H89500000, &HDC56E8D0
+    pvAppendBuffer &H858BFFFF, &HFFFFFEA0, &HFEA88D8B, &HDA89FFFF, &H774808B, &H46AFFFF, &HBB005, &HD8895000, &HFFDC33E8, &H50858DFF, &H89FFFFFF, &HFFFE9885, &H958B51FF, &HFFFFFEA4, &H46AD989, &HFFE291E8, &H8C958BFF, &H8BFFFFFE, &HFFFE7C8D, &H89046AFF, &HE27CE8D0, &H858BFFFF, &HFFFFFEA0, &HFE98958B, &H8D8BFFFF, &HFFFFFE8C, &H774808B, &H4C7FFFF, &H424&, &HBB00500, &H89500000, &HDBD6E8D0
+    pvAppendBuffer &H8B53FFFF, &HFFFEAC95, &HD05D8DFF, &H8D8B046A, &HFFFFFE9C, &H37E8D089, &HBAFFFFE2, &H4&, &HE8D88958, &HFFFFA3B5, &H45C7C031, &H1D0&, &HD4458900, &H78958B50, &H6AFFFFFE, &HA8858B04, &HFFFFFFFE, &HFFFE94B5, &H90B5FFFF, &HE8FFFFFE, &HFFFFA458, &HFE68958B, &H858BFFFF, &HFFFFFE98, &HB5FF046A, &HFFFFFE94, &HFE90B5FF, &H39E8FFFF, &H8BFFFFA4, &HFFFEAC85, &H6ADA89FF, &H94B5FF04
+    pvAppendBuffer &HFFFFFFFE, &HFFFE90B5, &HA41EE8FF, &H958BFFFF, &HFFFFFE74, &HFEA8858B, &H46AFFFF, &HFE84B5FF, &HB5FFFFFF, &HFFFFFE80, &HFFA3FFE8, &H70958BFF, &H8BFFFFFE, &HFFFE9885, &HFF046AFF, &HFFFE84B5, &H80B5FFFF, &HE8FFFFFE, &HFFFFA3E0, &HFE6C958B, &H858BFFFF, &HFFFFFEAC, &HB5FF046A, &HFFFFFE84, &HFE80B5FF, &HC1E8FFFF, &H8BFFFFA3, &HFFFEA895, &H88858BFF, &H6AFFFFFE, &HE8565704, &HFFFFA3AC
+    pvAppendBuffer &HFE98958B, &H858BFFFF, &HFFFFFE7C, &H5657046A, &HFFA397E8, &H9C858BFF, &H8BFFFFFE, &HFFFEAC95, &H57046AFF, &HA382E856, &H8D58FFFF, &H5E5BF465, &H678D5D5F, &HCC25FF8, &H7C8D5700, &HE4830824, &HFC77FFF8, &H57E58955, &H8F35E856, &HC6810000, &H8F3E&, &H54EC8353, &H89A84589, &H4D89A455, &H4B9A0, &H75890000, &H4778BAC, &HDBF7F389, &HD1DE480F, &H6E3C1FB, &H7D8D1F03, &H89DA89B0
+    pvAppendBuffer &HA302E8F8, &H538DFFFF, &HD05D8D20, &HF5E8D889, &H85FFFFA2, &H8B1C79F6, &H908BAC45, &HFFFF0774, &H89D88951, &H81046AD9, &HBB0C2, &HA65AE800, &H505BFFFF, &H8BA4558B, &H458BA04D, &H6A006AA8, &HE5E85701, &H5AFFFFFA, &H5BF4658D, &H8D5D5F5E, &HC25FF867, &H8D570008, &H8308247C, &H77FFF8E4, &HE58955FC, &H8E9DE857, &HC7810000, &H8EA2&, &HEC815356, &HCC&, &HFF308589, &H858DFFFF
+    pvAppendBuffer &HFFFFFF50, &HFF2C9589, &H4BAFFFF, &H89000000, &HFFFF40BD, &HA1C3E8FF, &H858DFFFF, &HFFFFFF70, &HFF448589, &HB2E8FFFF, &H8DFFFFA1, &H85899045, &HFFFFFF4C, &HFFA1A4E8, &H3885C7FF, &H33FFFFFF, &H8B000000, &HFFFF4C8D, &H44958BFF, &H8DFFFFFF, &HFFFF5085, &HE8F631FF, &HFFFFF5D3, &H9D8BC031, &HFFFFFF38, &HFF3C8589, &HFB81FFFF, &HFF&, &HBD8B2F7F, &HFFFFFF2C, &HD989D889, &H8306E8C1
+    pvAppendBuffer &H548B3FE1, &H48B04C7, &HD0AD0FC7, &HC1F6EAD3, &HFF18920, &HE083C245, &H9E0D301, &HFFFF3C85, &HC38346FF, &H5FE8334, &H458DC075, &H4BAB0, &H30BB0000, &HE800000C, &HFFFFA121, &HE8D0458D, &HFFFFA119, &H1B9&, &H3C8D3900, &H89FFFFFF, &HFFFF288D, &HC0940FFF, &HB60FFF31, &H8BC689C0, &HFFFF4085, &H83DEF7FF, &H908B00D7, &HFFFF0774, &HF7B0458D, &H488589DF, &H51FFFFFF, &H46ADA01
+    pvAppendBuffer &HA5E85657, &H8BFFFFA1, &HFFFF4085, &H74808BFF, &H8DFFFF07, &H8D201854, &HC383D045, &H34858940, &H6AFFFFFF, &HE8565704, &HFFFFA180, &HFF288D8B, &H415EFFFF, &H7520F983, &H858B5690, &HFFFFFF3C, &H9D8DD231, &HFFFFFF50, &H4C8D8B52, &H50FFFFFF, &HFF44958B, &HD889FFFF, &HFF48B5FF, &H49E8FFFF, &HFFFFFFF9, &HFFFF388D, &H38BD83FF, &HFFFFFFFF, &HCC850F5F, &H8BFFFFFE, &HFFFF4085, &H74888BFF
+    pvAppendBuffer &H50FFFF07, &HFF4C958B, &H46AFFFF, &HBB0C181, &HD0890000, &HFFD883E8, &H48858BFF, &HB9FFFFFF, &H4&, &H4C958B5A, &HE8FFFFFF, &HFFFFF003, &H4C8D8B51, &H8BFFFFFF, &HFFFF4895, &H34858BFF, &H6AFFFFFF, &HDE88E804, &H8D8BFFFF, &HFFFFFF48, &HFF30858B, &HDA89FFFF, &H73E8046A, &H8BFFFFDE, &HFFFF3085, &H348D8BFF, &H6AFFFFFF, &H44958B04, &H83FFFFFF, &H57E820C0, &H5BFFFFDE, &H5BF4658D
+    pvAppendBuffer &H8D5D5F5E, &HC35FF867, &H4244C8D, &HFFF8E483, &H8955FC71, &H6CE857E5, &H8100008C, &H8C71C7, &H8D535600, &H8951905D, &H60EC83D8, &H8B04518B, &HAC1FE831, &H4BAFFFF, &H89000000, &H9FB2E8D8, &HC085FFFF, &HC0310474, &H878B67EB, &HFFFF0774, &H4B9&, &H5DA8900, &H15F0&, &HFFA0E7E8, &H197448FF, &H7748F8B, &H8950FFFF, &H6AD889DA, &HF0C18104, &HE8000015, &HFFFFA390, &HB07D8D5A
+    pvAppendBuffer &HF889DA89, &HFFFD4DE8, &HE8F889FF, &HFFFFAB9A, &HB275C085, &H8D0406C6, &HFA890146, &HFFABE2E8, &H21468DFF, &HE8D0558D, &HFFFFABD7, &H1B8&, &HF0658D00, &H5F5E5B59, &HFC618D5D, &H8D0008C2, &H8304244C, &H4BAF8E4, &HFF000000, &H8955FC71, &H535657E5, &H8BA6E8, &HB3C38100, &H5100008B, &H98EC81, &H18B0000, &H890C798B, &HFFFF6085, &H4418BFF, &HFF5C8589, &H418BFFFF, &H6C858908
+    pvAppendBuffer &HE8FFFFFF, &HFFFF9EEC, &H774C085, &H56E9C031, &H8B000001, &HFF077483, &H6C958BFF, &HB9FFFFFF, &H4&, &H15F005, &HA01AE800, &H7448FFFF, &H748B8B1D, &H50FFFF07, &HFF6C958B, &H46AFFFF, &H15F0C181, &HD0890000, &HFFA2BFE8, &H958B58FF, &HFFFFFF6C, &H89B0758D, &HFC78E8F0, &H838BFFFF, &HFFFF0774, &H4B9&, &H5F28900, &H15F0&, &HFF9FD3E8, &H197448FF, &H7748B8B, &H8950FFFF
+    pvAppendBuffer &H6AF089F2, &HF0C18104, &HE8000015, &HFFFFA27C, &HB0458D58, &H4BA&, &H64858900, &HE8FFFFFF, &HFFFF9E50, &H850FC085, &HFFFFFF60, &HFF64958B, &HF889FFFF, &HE890758D, &HFFFFAAC7, &HFF60958B, &H858DFFFF, &HFFFFFF70, &HFF688589, &H82E8FFFF, &H8BFFFFAA, &HFF077483, &H8D8B52FF, &HFFFFFF68, &HFF64958B, &HF005FFFF, &H50000015, &HA6E8F089, &H8BFFFFDC, &HFFFF5C95, &H68858BFF, &H59FFFFFF
+    pvAppendBuffer &HFFAA50E8, &H74838BFF, &H6AFFFF07, &H8BF18904, &HFFFF6895, &H15F005FF, &H89500000, &HA300E8F0, &H8B8BFFFF, &HFFFF0774, &H6C958B50, &H6AFFFFFF, &HF0C18104, &H89000015, &HD5DEE8D0, &H838BFFFF, &HFFFF0774, &HFF6C8D8B, &HF289FFFF, &H15F005, &HF0895000, &HFFDC40E8, &H20478DFF, &HE8F2895A, &HFFFFAA1F, &H1B8&, &HF0658D00, &H5F5E5B59, &HFC618D5D, &H570010C2, &H4B9&, &H247C8D00
+    pvAppendBuffer &HF8E48308, &H55FC77FF, &HE857E589, &H89F7&, &H89FCC781, &H8D560000, &HFFFB90B5, &HD38953FF, &H4C4EC81, &H85890000, &HFFFFFB30, &HFBF0858D, &H8589FFFF, &HFFFFFB48, &HFB3CBD89, &HBD8DFFFF, &HFFFFFB70, &HFF9DBFE8, &H20438DFF, &HFB408589, &H958BFFFF, &HFFFFFB40, &HFCF0858D, &H8589FFFF, &HFFFFFB44, &HFF9D9FE8, &HF0858DFF, &HBAFFFFFD, &H4&, &HFB4C8589, &HDEE8FFFF, &H31FFFF9C
+    pvAppendBuffer &H4C8D8BC0, &H8BFFFFFB, &HFFFB4495, &HF48589FF, &H8BFFFFFD, &HFFFB4885, &HF085C7FF, &H1FFFFFD, &HE8000000, &HFFFFEEDD, &HFB3C858B, &H888BFFFF, &HFFFF0774, &H6AF88950, &H4C958B04, &H81FFFFFB, &HBB0C1, &HD4D2E800, &HFA89FFFF, &H4B9&, &HF0895800, &HFFEC5AE8, &H8DF189FF, &HFFFBB085, &H958B52FF, &HFFFFFB48, &HE3E8046A, &H89FFFFDA, &H89F289F9, &HE8046AF0, &HFFFFDAD6, &HFB44958B
+    pvAppendBuffer &HF189FFFF, &HFBD0858D, &H46AFFFF, &HFFDAC1E8, &H48858BFF, &H89FFFFFB, &H59DB31DA, &H4B9&, &H9CE2E800, &H958BFFFF, &HFFFFFB40, &HFB44858B, &HD1E8FFFF, &H8BFFFF9C, &HFFFB4C85, &H4BAFF, &H16E80000, &H8BFFFF9C, &HFFFB4C95, &H4B9FF, &H858D0000, &HFFFFFEF0, &HFDF49D89, &H8589FFFF, &HFFFFFB38, &HFDF085C7, &H1FFFF, &H95E80000, &H8DFFFF9C, &HFFFCD085, &H38B58BFF, &H8BFFFFFB
+    pvAppendBuffer &HFFFB4CBD, &H348589FF, &H8BFFFFFB, &HFFFB4485, &H489D8BFF, &H89FFFFFB, &HFFFB4085, &H83DA89FF, &H4B920C3, &H89000000, &H9C5AE8D8, &H958BFFFF, &HFFFFFB40, &HFB408583, &H8B20FFFF, &HFFFB4085, &H9C42E8FF, &HFA89FFFF, &H8920C783, &H9C36E8F8, &HF989FFFF, &HB0858D50, &H8BFFFFFB, &HFFFB4095, &H6A006AFF, &HD8895001, &HFFF43FE8, &H83F289FF, &HF98920C6, &HF089046A, &HFFD9D5E8, &H858B58FF
+    pvAppendBuffer &HFFFFFB34, &H9575C339, &HFB3C858B, &H558DFFFF, &H74888BD0, &H53FFFF07, &HFB50858D, &HE0BBFFFF, &H6A000000, &HB0C18104, &HE800000B, &HFFFFD36C, &HFB70858D, &HB58BFFFF, &HFFFFFB30, &H3C85895F, &HBFFFFFFB, &H7&, &H1C0C681, &H858D0000, &HFFFFFB50, &H8589FF85, &HFFFFFB40, &H858B3974, &HFFFFFB38, &HE0184C8D, &H40958B50, &H6AFFFFFB, &H3C858B04, &HE8FFFFFB, &HFFFFD956, &HFB4C858B
+    pvAppendBuffer &H958BFFFF, &HFFFFFB40, &HC8D046A, &HE8D08918, &HFFFFD93E, &H8B16EB58, &HFFFB4095, &H3C858BFF, &HB9FFFFFB, &H4&, &HFF9B5BE8, &H3C958BFF, &H8DFFFFFB, &HFFFB9085, &H4B9FF, &H894F0000, &HFFFB4085, &HEA69E8FF, &H858BFFFF, &HFFFFFB48, &H5018148D, &HFB408D8B, &HF089FFFF, &HEFE8046A, &H8BFFFFD8, &HFFFB4095, &H3C8D8BFF, &H6AFFFFFB, &HE8D08904, &HFFFFD8DA, &HFB44858B, &H8D8BFFFF
+    pvAppendBuffer &HFFFFFB40, &H148D046A, &H20468D18, &H8320EB83, &HBBE840EE, &H5AFFFFD8, &HFFFFF83, &HFFFF2D85, &HF4658DFF, &H5D5F5E5B, &H5FF8678D, &H6B957C3, &H8D000000, &H8308247C, &H77FFF8E4, &HE58955FC, &H7D8D5657, &H86B9E898, &HC6810000, &H86C2&, &H42D38953, &H8974EC83, &HC0318845, &HC031ABF3, &H39045C7, &H89000000, &H458B9445, &HA663E888, &H458BFFFF, &H20C08388, &H89043B80, &HD758C45
+    pvAppendBuffer &HE821538D, &HFFFFA64D, &H12EE9, &H88558B00, &HB98C458B, &H4&, &HE8B87D8D, &HFFFFE993, &H774868B, &H46AFFFF, &H5904D8D, &HBB0&, &H8C558B50, &H9DE8D089, &H50FFFFD1, &H558B046A, &H884D8B8C, &H7E8D089, &H8BFFFFD8, &HFF077486, &H748E8BFF, &HC7FFFF07, &H42404, &HB0050000, &H8100000B, &HBD0C1, &H558B5000, &HE8D0898C, &HFFFF9EAE, &H6B9C031, &H31000000, &H8DABF3D2
+    pvAppendBuffer &H6B9D87D, &H89000000, &HABF3B455, &H7D8DC931, &H74968BB0, &H89FFFF07, &HF989D44D, &H1B045C7, &H81000000, &HBB0C2, &HD045C700, &H1&, &H6AF88950, &H9CD2E804, &H4BAFFFF, &H58000000, &H82E8F889, &H8DFFFF99, &H458DFF78, &H1FF83D0, &H4B9&, &H84458900, &H558B2C76, &HE8D08984, &HFFFFE8CF, &H89B0458D, &H9928E8FA, &HC209FFFF, &H6A511174, &H84558B04, &H898C4D8B, &HD750E8D0
+    pvAppendBuffer &H4F58FFFF, &HC289C4EB, &HE88C458B, &HFFFF9978, &H8B03B60F, &H4333885D, &H1E08320, &H7400C883, &H74968B1A, &H50FFFF07, &H4D8B046A, &HB0C2818C, &H8900000B, &H9CD2E8C8, &H8D5AFFFF, &H5E5BF465, &H678D5D5F, &HE8C35FF8, &H8527&, &H854005, &H244C8D00, &HF8E48304, &H55FC71FF, &H5657E589, &H53B07D8D, &HFEF09D8D, &H8151FFFF, &H158EC, &HA4858900, &H8BFFFFFE, &H718B0841, &H89118B04
+    pvAppendBuffer &HFFFE9885, &HE8D889FF, &HFFFFFE21, &HFEB0858D, &HF289FFFF, &H89D0758D, &HFFFEA885, &HA4B3E8FF, &H858DFFFF, &HFFFFFF70, &H4B9&, &H89DA8900, &HFFFEA085, &H90458DFF, &HFF309D8D, &H8589FFFF, &HFFFFFEAC, &HFF98BFE8, &H10958DFF, &H89FFFFFF, &H98B2E8F0, &H958BFFFF, &HFFFFFEAC, &HFEA0858B, &HA1E8FFFF, &H89FFFF98, &HE8F889F2, &HFFFF9898, &H4BAD889, &HE8000000, &HFFFF97E1, &HD989C031
+    pvAppendBuffer &H8589F289, &HFFFFFF34, &HFEAC858B, &H85C7FFFF, &HFFFFFF30, &H1&, &HFFECA0E8, &HAC858BFF, &H89FFFFFE, &HE8F289D9, &HFFFFE9D9, &HFEA0858B, &HD989FFFF, &H82E8FA89, &H8BFFFFEC, &HFFFEA885, &H4BAFF, &HFEE80000, &H8DFFFF97, &HDB85FE58, &HDA89687E, &HFEB0858D, &H758DFFFF, &H97B4E8B0, &HC931FFFF, &H958DD009, &HFFFFFF70, &H4BC1940F, &HE0C1C889, &H63C8D05, &H8589D001, &HFFFFFEAC
+    pvAppendBuffer &H1B8&, &HC1C82900, &HC60105E0, &H8589D001, &HFFFFFEA8, &HAC8D8B52, &H89FFFFFE, &HECE857F2, &H8BFFFFED, &HFFFEA88D, &HAC858BFF, &H89FFFFFE, &H68E856FA, &H59FFFFEC, &H958B94EB, &HFFFFFEB0, &HFF709D8D, &H758DFFFF, &H83D2F7B0, &HD08901E2, &H8D05E0C1, &HD801063C, &HFE9C8589, &H1B8FFFF, &H29000000, &HA0BD89D0, &HC1FFFFFE, &H3C8D05E0, &H89D80106, &HFFFEA885, &H8D8B52FF, &HFFFFFE9C
+    pvAppendBuffer &HB5FFFA89, &HFFFFFEA0, &HFFED82E8, &HA4858BFF, &H8DFFFFFE, &HFFFED08D, &H90558DFF, &H774808B, &H8D89FFFF, &HFFFFFEAC, &H4C7D989, &H424&, &HBB00500, &H8B500000, &HFFFEAC85, &HCE96E8FF, &H8B51FFFF, &HFFFEAC95, &H6AF989FF, &HE8D08904, &HFFFFD4FE, &HFEAC958B, &H8D8DFFFF, &HFFFFFEF0, &HD089046A, &HFFD4E9E8, &HA4858BFF, &H8BFFFFFE, &HFFFEAC95, &H74888BFF, &H6AFFFF07, &H81D08904
+    pvAppendBuffer &HBB0C1, &HCE92E800, &H958BFFFF, &HFFFFFEAC, &HFF108D8D, &H46AFFFF, &HB3E8D089, &H8BFFFFD4, &HFFFEAC95, &HA88D8BFF, &H6AFFFFFE, &HE8D08904, &HFFFFD49E, &HFEA88D8B, &H958BFFFF, &HFFFFFEA0, &H9C858B57, &HE8FFFFFE, &HFFFFEB53, &HFEAC8D8B, &HF289FFFF, &H8D5FD889, &HFFFF30BD, &HEADBE8FF, &H4B9FFFF, &H89000000, &HE8F889DA, &HFFFF9698, &HFF50858D, &HF289FFFF, &HFF968BE8, &H98858BFF
+    pvAppendBuffer &H89FFFFFE, &HA279E8FA, &HF889FFFF, &HFFA219E8, &HFC085FF, &H658DC094, &HB60F59F0, &H5F5E5BC0, &HFC618D5D, &H55000CC2, &H5356E589, &H83F8E483, &H5D8B40EC, &H8558B0C, &HF089E689, &HFFFB6CE8, &H403C6FF, &H8901438D, &HA235E8F2, &H438DFFFF, &H24548D21, &HA229E820, &H658DFFFF, &H1B8F8, &H5E5B0000, &H8C25D, &H4244C8D, &HFFF8E483, &H8955FC71, &HCE857E5, &H81000082, &H8211C7
+    pvAppendBuffer &H858D5600, &HFFFFFBA8, &HEC815153, &H5A8&, &H8B08598B, &H4C858911, &H8BFFFFFA, &HAE80471, &H8DFFFFFB, &HFFFB6885, &H89DA89FF, &HFFFA5885, &HA19FE8FF, &H538DFFFF, &H889D8D20, &H89FFFFFB, &HA18FE8D8, &H858BFFFF, &HFFFFFA58, &H4BA&, &H951EE800, &HC085FFFF, &HFF310D74, &HFA5CBD89, &HFDE9FFFF, &HBA000002, &H4&, &H1E8D889, &H85FFFF95, &H8BE375C0, &HFF077487, &H58958BFF
+    pvAppendBuffer &HB9FFFFFA, &H4&, &H15F005, &H9636E800, &H7548FFFF, &H74878BC5, &HB9FFFF07, &H4&, &HF005DA89, &HE8000015, &HFFFF961C, &HFA5C8589, &H7548FFFF, &HA8858DA5, &H8BFFFFFA, &HFF07748F, &H548589FF, &H52FFFFFA, &H15F0C181, &HDA890000, &HC5E8046A, &H8DFFFFCC, &HFFFA6885, &H89F289FF, &HFFFA5085, &HEAE859FF, &H8BFFFFA0, &HFF077487, &H9D8D53FF, &HFFFFFA88, &HFA50958B, &H8D8BFFFF
+    pvAppendBuffer &HFFFFFA54, &H15F005, &HD0895000, &HFFD308E8, &H74878BFF, &H8BFFFF07, &HFFFA548D, &H58958BFF, &H5FFFFFA, &H15F0&, &HE8D88950, &HFFFFD2E9, &HFA4C958B, &H858DFFFF, &HFFFFFDF0, &HF6B5E85E, &H958BFFFF, &HFFFFFA50, &H4B9&, &HEE858D00, &HE8FFFFFB, &HFFFF96C9, &H4B9&, &H89DA8900, &HFFFA5085, &HEF858DFF, &HE8FFFFFC, &HFFFF96B1, &H4BA&, &H8DC68900, &HFFFAC885, &H93DBE8FF
+    pvAppendBuffer &H858DFFFF, &HFFFFFAE8, &HFF93D0E8, &H54858BFF, &HE8FFFFFA, &HFFFF93C5, &HFA509D8B, &HB539FFFF, &HFFFFFA50, &H4BDE420F, &HFAA8858D, &HFB83FFFF, &H588589FF, &HFFFFFFA, &HAE84&, &H588D8B00, &H8DFFFFFA, &HFFFAC885, &HE8958DFF, &H89FFFFFA, &HFFFA5485, &H4C9589FF, &HE8FFFFFA, &HFFFFE5A5, &HFA50858B, &HC339FFFF, &HBE0F3173, &HFBEE1D84, &H958BFFFF, &HFFFFFA4C, &H1F74C084, &H7748F8B
+    pvAppendBuffer &H8B50FFFF, &HFFFA5485, &HF0C181FF, &H51000013, &HFA588D8B, &H9EE8FFFF, &H39FFFFF0, &HF8873F3, &HEF1D84BE, &H84FFFFFC, &H78840FC0, &H8DFFFFFF, &HFFFAE895, &HA88D8DFF, &H89FFFFFA, &HFFFA5895, &HC8958DFF, &H89FFFFFA, &HFFFA5495, &H58958BFF, &H50FFFFFA, &HFDF0858D, &H8B50FFFF, &HFFFA5485, &HF053E8FF, &H3CE9FFFF, &HBAFFFFFF, &H4&, &HFF92FFE8, &HFC085FF, &HFFFDDD85, &H58958BFF
+    pvAppendBuffer &H8DFFFFFA, &HFFFB4885, &H4B9FF, &HB58D0000, &HFFFFFB68, &HFA548589, &H94E8FFFF, &H8DFFFFE2, &HFFFB0885, &H89F289FF, &HFFFA5885, &H8D8B53FF, &HFFFFFA54, &H17E8046A, &H8DFFFFD1, &HFFFAC885, &H4B9FF, &H85890000, &HFFFFFA50, &H8BC2895A, &HFFFA5885, &H93EEE8FF, &HC085FFFF, &H82840F, &H8F8B0000, &HFFFF0774, &H289D8D50, &H89FFFFFB, &H89046AF2, &HF0C181D8, &HE8000015, &HFFFF960C
+    pvAppendBuffer &HF59C209, &HFFFD5185, &H74978BFF, &HB9FFFF07, &H4&, &HC281D889, &HBB0&, &HFF93A7E8, &HFC085FF, &HFFFD3189, &H8D8B50FF, &HFFFFFA54, &H46ADA89, &HFA58858B, &H93E8FFFF, &H8BFFFFD0, &HFFFA5885, &H4B9FF, &H8B5A0000, &HFFFA5095, &H9372E8FF, &HC085FFFF, &HFC0940F, &H8589C0B6, &HFFFFFA5C, &HFA5C858B, &H658DFFFF, &H5E5B59F0, &H618D5D5F, &HCC2FC, &H247C8D57, &HF8E48308
+    pvAppendBuffer &H55FC77FF, &H5657E589, &H7E76E8, &H7FC68100, &H5300007E, &HC889C389, &H896CEC83, &H6BA8855, &H89000000, &HC9E88C4D, &H85FFFF91, &HE3850FC0, &H8D000001, &H558B907D, &H6B988, &HF8890000, &HFFE16EE8, &H8DF989FF, &H8952C045, &HE8066ADA, &HFFFFCFFE, &HF889FA89, &H6B959, &H50E80000, &H57FFFFE1, &H6A88558B, &H8C4D8B06, &HDFE8D089, &H8BFFFFCF, &H6B98C55, &H58000000, &H30E8D089
+    pvAppendBuffer &H8BFFFFE1, &HFF077486, &H89066AFF, &H8C4D8BDA, &H161005, &HD8895000, &HFF9685E8, &H74868BFF, &H8BFFFF07, &H66A8C4D, &H161005, &H50CA8900, &H6BE8C889, &H8BFFFF96, &HFF077486, &H8C4D8BFF, &H66ADA89, &H161005, &HC8895000, &HFFC907E8, &H50DA89FF, &H898C4D8B, &HE8066AD8, &HFFFFCF72, &H774868B, &HD989FFFF, &H4C7DA89, &H624&, &H16100500, &H8B500000, &H23E88C45, &H8BFFFF96
+    pvAppendBuffer &HFF077486, &H8C4D8BFF, &H66ADA89, &H161005, &HD8895000, &HFF9609E8, &H83038BFF, &HC88301E0, &H8B347400, &HFF07748E, &HD88952FF, &H66ADA89, &H1610C181, &H51E80000, &HBAFFFF94, &H6&, &H8959C789, &H930BE8D8, &HE7C1FFFF, &H9C0311F, &H43092C7B, &HBA0CEB28, &H6&, &HF2E8D889, &H8BFFFF92, &H6B98C45, &H89000000, &HC07D8DDA, &HFFE03EE8, &H74868BFF, &H8BFFFF07, &H66A8C55
+    pvAppendBuffer &H1005F989, &H50000016, &H49E8D089, &H8BFFFFC8, &HFF077486, &H8C558BFF, &H66AF989, &H161005, &HD0895000, &HFFC82FE8, &H74868BFF, &H8BFFFF07, &HFA898C4D, &H1005066A, &H50000016, &H15E8F889, &H89FFFFC8, &H50DA89F9, &H66AD889, &HFFCE81E8, &H74868BFF, &H8DFFFF07, &HDA899075, &H62404C7, &H89000000, &H161005F1, &H89500000, &HC7E6E8F0, &H558BFFFF, &H6B98C, &HD8890000, &HFF9087E8
+    pvAppendBuffer &H88558BFF, &HE88C458B, &HFFFF907C, &H8988458B, &H9072E8F2, &H658DFFFF, &H5F5E5BF4, &HF8678D5D, &H8D57C35F, &H8308247C, &H77FFF8E4, &HE58955FC, &H8D535657, &HEC83905D, &H84458974, &H5589C889, &H6BA80, &H4D890000, &H90C4E88C, &HC689FFFF, &HD889D789, &H6BA&, &H8F7FE800, &HC031FFFF, &H19045C7, &H89000000, &H458D9445, &H884589C0, &HFF8F68E8, &H458B52FF, &H6ADA898C, &HE8565706
+    pvAppendBuffer &HFFFF9028, &H8B80558B, &H8B598445, &H65E88C4D, &H53FFFFFD, &H6A88558B, &H8C458B06, &H9E85657, &H5EFFFF90, &H5BF4658D, &H8D5D5F5E, &HC35FF867, &H247C8D57, &HF8E48308, &H55FC77FF, &H8957E589, &HCE8956C7, &H6B9&, &H5D8D5300, &H83D889C0, &H55893CEC, &HE8F289BC, &HFFFFDED7, &HFA89D989, &H6AF88950, &HCD68E806, &HF189FFFF, &HD889DA89, &H5BE8066A, &H8BFFFFCD, &HD989BC55, &HD089066A
+    pvAppendBuffer &HFFCD4DE8, &H658D5AFF, &H5F5E5BF4, &HF8678D5D, &H8D57C35F, &H8308247C, &H77FFF8E4, &HE58955FC, &H5CE85657, &H8100007B, &H7B65C6, &HC3895300, &H8944EC83, &H558DB455, &H893F8BC0, &HD989B84D, &H774868B, &H5589FFFF, &H8B066ABC, &H1005B855, &H50000016, &HE8BC458B, &HFFFFC67C, &HB9BC558B, &H6&, &H48E8D089, &H89FFFFDE, &H4D8B50DA, &H6AD889BC, &HCCD8E806, &H558BFFFF, &HBC4D8BB8
+    pvAppendBuffer &HD089066A, &HFFCCC9E8, &H74868BFF, &H8BFFFF07, &HFA89B44D, &H62404C7, &H5000000, &H1610&, &HE8F88950, &HFFFFC630, &H89BC458B, &H6B9FA, &HFCE80000, &H8BFFFFDD, &HFF077486, &HBC558BFF, &HD989066A, &H161005, &HD0895000, &HFFC607E8, &H74868BFF, &H8BFFFF07, &H66ABC55, &H5B84D8B, &H1610&, &HE8D08950, &HFFFFC5EC, &H774868B, &H558BFFFF, &H6AD989B8, &H16100506, &H89500000
+    pvAppendBuffer &HC5D2E8D0, &H8B52FFFF, &H66AB455, &H89B84D8B, &HCC3CE8D0, &H868BFFFF, &HFFFF0774, &H89BC4D8B, &H2404C7DA, &H6&, &H161005, &H458B5000, &HC5A2E8B8, &HFA89FFFF, &H8B51F889, &H66AB84D, &HFFCC0DE8, &H74868BFF, &H8BFFFF07, &HFA89B44D, &H62404C7, &H5000000, &H1610&, &HE8F88950, &HFFFFC574, &H8BBC558B, &H6B9B845, &HE8000000, &HFFFF8E14, &H5BF4658D, &H8D5D5F5E, &HC25FF867
+    pvAppendBuffer &H8D570004, &H8308247C, &H77FFF8E4, &HE58955FC, &HCE895657, &H79E5E853, &HC3810000, &H79F2&, &HACEC81, &H85890000, &HFFFFFF58, &HBD8D078B, &HFFFFFF60, &HFF4C9589, &H8D8BFFFF, &HFFFFFF58, &H8589F289, &HFFFFFF54, &H774838B, &HBD89FFFF, &HFFFFFF50, &H1005066A, &H50000016, &H7D8DF889, &HC4F2E890, &H958BFFFF, &HFFFFFF50, &H6B9&, &HE8D08900, &HFFFFDCBB, &H58958B50, &H6AFFFFFF
+    pvAppendBuffer &H508D8B06, &H89FFFFFF, &HCB44E8D0, &H8D8BFFFF, &HFFFFFF50, &HF089F289, &H33E8066A, &H8BFFFFCB, &HFF077483, &H4C8D8BFF, &HC7FFFFFF, &H62404, &H958B0000, &HFFFFFF54, &H161005, &H858B5000, &HFFFFFF50, &HFF91D9E8, &H74838BFF, &H8BFFFF07, &HFFFF5495, &H8B066AFF, &HFFFF4C8D, &H161005FF, &H89500000, &HC46EE8D0, &H838BFFFF, &HFFFF0774, &HFF5CBD89, &HF289FFFF, &H8D8B066A, &HFFFFFF58
+    pvAppendBuffer &H161005, &HF8895000, &HE8C07D8D, &HFFFFC448, &H4C958B52, &H6AFFFFFF, &H5C8D8B06, &H89FFFFFF, &HCAACE8D0, &H838BFFFF, &HFFFF0774, &HFF58958B, &HF189FFFF, &H62404C7, &H5000000, &H1610&, &H5C858B50, &HE8FFFFFF, &HFFFF9156, &HFF54958B, &HF089FFFF, &H6B9&, &HDBD5E800, &H838BFFFF, &HFFFF0774, &HF289066A, &HFF5C8D8B, &H1005FFFF, &H50000016, &HDDE8F089, &H8BFFFFC3, &HFF077483
+    pvAppendBuffer &H58958BFF, &H89FFFFFF, &H5066AF1, &H1610&, &HE8F88950, &HFFFFC3C0, &H54958B51, &H89FFFFFF, &H89066AF9, &HCA28E8D0, &H838BFFFF, &HFFFF0774, &HFF54958B, &H4C7FFFF, &H624&, &H4C8D8B00, &H5FFFFFF, &H1610&, &HE8D08950, &HFFFFC388, &HFF50958B, &HF889FFFF, &H6B9&, &HDB51E800, &H838BFFFF, &HFFFF0774, &HFA89066A, &HFF5C8D8B, &H1005FFFF, &H50000016, &H59E8F889, &H8BFFFFC3
+    pvAppendBuffer &HFF077483, &H588D8BFF, &H89FFFFFF, &H5066AFA, &H1610&, &H5C858B50, &HE8FFFFFF, &HFFFFC338, &H5C958B56, &H6AFFFFFF, &H508D8B06, &H89FFFFFF, &HC99CE8D0, &H838BFFFF, &HFFFF0774, &HFF4C8D8B, &H4C7FFFF, &H624&, &H5C958B00, &H5FFFFFF, &H1610&, &HE8C88950, &HFFFFC2FC, &HFF58858B, &HFA89FFFF, &H6B9&, &H8B9AE800, &H658DFFFF, &H5F5E5BF4, &HF8678D5D, &H4C25F, &H247C8D57
+    pvAppendBuffer &HF8E48308, &H55FC77FF, &H5657E589, &H7772E8, &H7BC68100, &H53000077, &H22CEC81, &H85890000, &HFFFFFDE8, &H5F8B078B, &HDC958908, &HBAFFFFFD, &H6&, &HFDD88589, &HC889FFFF, &HFE00B589, &H778BFFFF, &HFC8D8904, &HE8FFFFFD, &HFFFF8BC2, &H6B9&, &HF0858900, &H31FFFFFD, &HFF309C0, &H9589C095, &HFFFFFDF4, &HFDFC958B, &HFF31FFFF, &H858DC689, &HFFFFFE10, &H8589DEF7, &HFFFFFE0C
+    pvAppendBuffer &HE800D783, &HFFFFDA2B, &HFE40858D, &HDFF7FFFF, &HFE048589, &H8B52FFFF, &HFFFDFC8D, &H8B066AFF, &HFFFE0C95, &HC8A8E8FF, &H958BFFFF, &HFFFFFE0C, &HFDD88D8B, &H66AFFFF, &H93E8D089, &H8BFFFFC8, &HFFFDD885, &H4958BFF, &H83FFFFFE, &H858930C0, &HFFFFFDC8, &HD089C189, &H73E8066A, &H8BFFFFC8, &HFFFE0085, &HC958BFF, &H8BFFFFFE, &HFFFDE88D, &H74808BFF, &HC7FFFF07, &H62404, &H10050000
+    pvAppendBuffer &H50000016, &HCDE8D089, &H8BFFFFC1, &HFFFE0085, &H4958BFF, &H8BFFFFFE, &HFFFDDC8D, &H74808BFF, &H6AFFFF07, &H16100506, &H89500000, &HC1A6E8D0, &H858BFFFF, &HFFFFFE0C, &H6BA&, &H8AD0E800, &H8589FFFF, &HFFFFFE08, &HFE04858B, &HD389FFFF, &H6BA&, &H8AB8E800, &H8D8BFFFF, &HFFFFFDF0, &HFDEC8589, &H858BFFFF, &HFFFFFDF4, &HFDD49589, &H958BFFFF, &HFFFFFDEC, &HD0F7D1F7, &HFDF88589
+    pvAppendBuffer &H858BFFFF, &HFFFFFE08, &H958BD021, &HFFFFFDD4, &H858BC121, &HFFFFFDF8, &H958BD321, &HFFFFFDE8, &HFDE08D89, &H6B9FFFF, &H21000000, &H709D8DD8, &H89FFFFFE, &HFFFDE485, &H30858DFF, &H89FFFFFF, &HFFFDD485, &H89BEE8FF, &H958BFFFF, &HFFFFFDDC, &HFF60858D, &H8589FFFF, &HFFFFFDD0, &HFF89A7E8, &HFC958BFF, &H8DFFFFFD, &H85899045, &HFFFFFDCC, &HFF8993E8, &HCC8D8BFF, &H8BFFFFFD, &HFFFDD095
+    pvAppendBuffer &HD4858BFF, &HE8FFFFFD, &HFFFFF916, &HFE0C958B, &H6B9FFFF, &H89000000, &HD895E8D8, &H858DFFFF, &HFFFFFEA0, &H8589DA89, &HFFFFFDEC, &HC8D8B51, &H6AFFFFFE, &HC718E806, &H8D8BFFFF, &HFFFFFDE8, &HD889DA89, &H7E8066A, &H8DFFFFC7, &HFFFED085, &H6B9FF, &H85890000, &HFFFFFE08, &H4958B5A, &HE8FFFFFE, &HFFFFD84B, &HFE00858B, &H958BFFFF, &HFFFFFE08, &HFDEC8D8B, &H808BFFFF, &HFFFF0774
+    pvAppendBuffer &H1005066A, &H50000016, &H49E8D089, &H8BFFFFC0, &HFFFE0085, &H8958BFF, &H89FFFFFE, &H74808BD9, &H6AFFFF07, &H16100506, &H89500000, &HC026E8D0, &H858BFFFF, &HFFFFFE00, &HFE08958B, &HD989FFFF, &H774808B, &H66AFFFF, &H161005, &HD0895000, &HFFC003E8, &H858BFF, &H8BFFFFFE, &HFFFE088D, &H8BDA89FF, &HFF077480, &H5066AFF, &H1610&, &HE8D88950, &HFFFFBFE0, &HFF00858D, &H8589FFFF
+    pvAppendBuffer &HFFFFFDF8, &H4958B51, &H89FFFFFE, &HE8066AD9, &HFFFFC63E, &HFDEC958B, &H8D8BFFFF, &HFFFFFDDC, &HD089066A, &HFFC629E8, &H858BFF, &H8BFFFFFE, &HFFFDF895, &HEC8D8BFF, &H8BFFFFFD, &HFF077480, &H2404C7FF, &H6&, &H161005, &HD0895000, &HFFBF83E8, &H958B53FF, &HFFFFFE0C, &H6AC05D8D, &HFC8D8B06, &H89FFFFFD, &HC5E4E8D0, &H6BAFFFF, &H58000000, &H62E8D889, &H31FFFF87, &HC045C7C0
+    pvAppendBuffer &H1&, &H50C44589, &HFDD8958B, &H66AFFFF, &HFE08858B, &HB5FFFFFF, &HFFFFFDF4, &HFDF0B5FF, &H5E8FFFF, &H8BFFFF88, &HFFFDC895, &HF8858BFF, &H6AFFFFFD, &HF4B5FF06, &HFFFFFFFD, &HFFFDF0B5, &H87E6E8FF, &H858BFFFF, &HFFFFFE0C, &H66ADA89, &HFDF4B5FF, &HB5FFFFFF, &HFFFFFDF0, &HFF87CBE8, &HD4958BFF, &H8BFFFFFD, &HFFFE0885, &HFF066AFF, &HFFFDE4B5, &HE0B5FFFF, &HE8FFFFFD, &HFFFF87AC
+    pvAppendBuffer &HFDD0958B, &H858BFFFF, &HFFFFFDF8, &HB5FF066A, &HFFFFFDE4, &HFDE0B5FF, &H8DE8FFFF, &H8BFFFF87, &HFFFDCC95, &HC858BFF, &H6AFFFFFE, &HE4B5FF06, &HFFFFFFFD, &HFFFDE0B5, &H876EE8FF, &H958BFFFF, &HFFFFFE08, &HFDE8858B, &H66AFFFF, &H59E85657, &H8BFFFF87, &HFFFDF895, &HDC858BFF, &H6AFFFFFD, &HE8565706, &HFFFF8744, &HFDFC858B, &H958BFFFF, &HFFFFFE0C, &H5657066A, &HFF872FE8, &H658D58FF
+    pvAppendBuffer &H5F5E5BF4, &HF8678D5D, &HCC25F, &H247C8D57, &HF8E48308, &H55FC77FF, &H5657E589, &H72E2E8, &HEBC68100, &H53000072, &H8974EC83, &H55898845, &H804D8984, &H6B9&, &H8C758900, &H8904778B, &HFDBF7F3, &HFBD1DE48, &H360DB6B, &H907D8D1F, &HF889DA89, &HFF86AFE8, &H30538DFF, &H89C05D8D, &H86A2E8D8, &HF685FFFF, &H458B1C79, &H74908B8C, &H51FFFF07, &HD989D889, &HC281066A, &H1610&
+    pvAppendBuffer &HFF8A07E8, &H8B505BFF, &H4D8B8455, &H88458B80, &H16A006A, &HFAE2E857, &H8D5AFFFF, &H5E5BF465, &H678D5D5F, &H8C25FF8, &H7C8D5700, &HE4830824, &HFC77FFF8, &H57E58955, &H724AE8, &H4FC78100, &H56000072, &H1CEC8153, &H89000001, &HFFFEE085, &H858DFF, &H89FFFFFF, &HFFFEDC95, &H6BAFF, &HBD890000, &HFFFFFEF0, &HFF8570E8, &H30858DFF, &H89FFFFFF, &HFFFEF485, &H855FE8FF, &H858DFFFF
+    pvAppendBuffer &HFFFFFF60, &HFEFC8589, &H4EE8FFFF, &HC7FFFF85, &HFFFEEC85, &H4CFF&, &HFC8D8B00, &H8BFFFFFE, &HFFFEF495, &H858DFF, &H31FFFFFF, &HF570E8F6, &HC031FFFF, &HFEEC9D8B, &H8589FFFF, &HFFFFFEE8, &H180FB81, &H38740000, &HFEDCBD8B, &HD889FFFF, &HE8C1D989, &H3FE18306, &H4C7548B, &HFC7048B, &HEAD3D0AD, &H8920C1F6, &HC2450FF1, &H4DC38346, &HD301E083, &HE88509E0, &H83FFFFFE, &HC07505FE
+    pvAppendBuffer &HBA90458D, &H6&, &H16D0BB, &H84CBE800, &H458DFFFF, &H84C3E8C0, &H1B9FFFF, &H39000000, &HFFFEE88D, &HD88D89FF, &HFFFFFFE, &HFF31C094, &H89C0B60F, &HF0858BC6, &HF7FFFFFE, &HD783DE, &H774908B, &H458DFFFF, &H89DFF790, &HFFFEF885, &HDA0151FF, &H5657066A, &HFF854FE8, &HF0858BFF, &H8BFFFFFE, &HFF077480, &H18548DFF, &HC0458D30, &H8960C383, &HFFFEE485, &H57066AFF, &H852AE856
+    pvAppendBuffer &H8D8BFFFF, &HFFFFFED8, &HF983415E, &H56907520, &HFEE8858B, &HD231FFFF, &HFF009D8D, &H8B52FFFF, &HFFFEFC8D, &H958B50FF, &HFFFFFEF4, &HB5FFD889, &HFFFFFEF8, &HFFF943E8, &HEC8DFFFF, &H83FFFFFE, &HFFFEECBD, &HF5FFFFF, &HFFFECC85, &HF0858BFF, &H8BFFFFFE, &HFF077488, &H958B50FF, &HFFFFFEFC, &HC181066A, &H1610&, &H2DE8D089, &H8BFFFFBC, &HFFFEF885, &H6B9FF, &H8B5A0000, &HFFFEFC95
+    pvAppendBuffer &HD3ADE8FF, &H8B51FFFF, &HFFFEFC8D, &HF8958BFF, &H8BFFFFFE, &HFFFEE485, &HE8066AFF, &HFFFFC232, &HFEF88D8B, &H858BFFFF, &HFFFFFEE0, &H66ADA89, &HFFC21DE8, &HE0858BFF, &H8BFFFFFE, &HFFFEE48D, &H8B066AFF, &HFFFEF495, &H30C083FF, &HFFC201E8, &H658D5BFF, &H5F5E5BF4, &HF8678D5D, &H4C8DC35F, &HE4830424, &HFC71FFF8, &H57E58955, &H7016E8, &H1BC78100, &H56000070, &H609D8D53, &H51FFFFFF
+    pvAppendBuffer &HEC81D889, &H90&, &H8B04518B, &H907AE831, &H6BAFFFF, &H89000000, &H8356E8D8, &HC085FFFF, &HC0310474, &H878B67EB, &HFFFF0774, &H6B9&, &H5DA8900, &H2570&, &HFF848BE8, &H197448FF, &H7748F8B, &H8950FFFF, &H6AD889DA, &H70C18106, &HE8000025, &HFFFF8734, &H907D8D5A, &HF889DA89, &HFFFD44E8, &HE8F889FF, &HFFFF8FF5, &HB275C085, &H8D0406C6, &HFA890146, &HFF903DE8, &H31468DFF
+    pvAppendBuffer &HE8C0558D, &HFFFF9032, &H1B8&, &HF0658D00, &H5F5E5B59, &HFC618D5D, &H8D0008C2, &H8304244C, &H6BAF8E4, &HFF000000, &H8955FC71, &H535657E5, &H6F4AE8, &H57C38100, &H5100006F, &HD8EC81, &H18B0000, &H890C798B, &HFFFF2085, &H4418BFF, &HFF1C8589, &H418BFFFF, &H2C858908, &HE8FFFFFF, &HFFFF8290, &H774C085, &H59E9C031, &H8B000001, &HFF077483, &H2C958BFF, &HB9FFFFFF, &H6&
+    pvAppendBuffer &H257005, &H83BEE800, &H7448FFFF, &H748B8B1D, &H50FFFF07, &HFF2C958B, &H66AFFFF, &H2570C181, &HD0890000, &HFF8663E8, &H958B58FF, &HFFFFFF2C, &H8990758D, &HFC6FE8F0, &H838BFFFF, &HFFFF0774, &H6B9&, &H5F28900, &H2570&, &HFF8377E8, &H197448FF, &H7748B8B, &H8950FFFF, &H6AF089F2, &H70C18106, &HE8000025, &HFFFF8620, &H90458D58, &H6BA&, &H24858900, &HE8FFFFFF, &HFFFF81F4
+    pvAppendBuffer &H850FC085, &HFFFFFF60, &HFF24958B, &HF889FFFF, &HFF60B58D, &H1FE8FFFF, &H8BFFFF8F, &HFFFF2095, &H30858DFF, &H89FFFFFF, &HFFFF2885, &H8EDAE8FF, &H838BFFFF, &HFFFF0774, &H288D8B52, &H8BFFFFFF, &HFFFF2495, &H257005FF, &H89500000, &HC231E8F0, &H958BFFFF, &HFFFFFF1C, &HFF28858B, &HE859FFFF, &HFFFF8EA8, &H774838B, &H66AFFFF, &H958BF189, &HFFFFFF28, &H257005, &HF0895000, &HFF86A1E8
+    pvAppendBuffer &H748B8BFF, &H50FFFF07, &HFF2C958B, &H66AFFFF, &H2570C181, &HD0890000, &HFFB97FE8, &H74838BFF, &H8BFFFF07, &HFFFF2C8D, &H5F289FF, &H2570&, &HE8F08950, &HFFFFC1CB, &H5A30478D, &H77E8F289, &HB8FFFF8E, &H1&, &H59F0658D, &H5D5F5E5B, &HC2FC618D, &HB9570010, &H6&, &H8247C8D, &HFFF8E483, &H8955FC77, &H98E857E5, &H8100006D, &H6D9DC7, &HB58D5600, &HFFFFF960, &H81D38953
+    pvAppendBuffer &H714EC, &HE0858900, &H8DFFFFF8, &HFFF9F085, &HF88589FF, &H89FFFFF8, &HFFF8ECBD, &H30BD8DFF, &HE8FFFFF9, &HFFFF8160, &H8930438D, &HFFF8F085, &HF0958BFF, &H8DFFFFF8, &HFFFB7085, &HF48589FF, &HE8FFFFF8, &HFFFF8140, &HFCF0858D, &H6BAFFFF, &H89000000, &HFFF8FC85, &H807FE8FF, &HC031FFFF, &HF8FC8D8B, &H958BFFFF, &HFFFFF8F4, &HFCF48589, &H858BFFFF, &HFFFFF8F8, &HFCF085C7, &H1FFFF
+    pvAppendBuffer &H71E80000, &H8BFFFFEE, &HFFF8EC85, &H74888BFF, &H50FFFF07, &H66AF889, &HF8FC958B, &HC181FFFF, &H1610&, &HFFB873E8, &HB9FA89FF, &H6&, &HE8F08958, &HFFFFCFFB, &H858DF189, &HFFFFF990, &HF8958B52, &H6AFFFFF8, &HBE84E806, &HF989FFFF, &HF089F289, &H77E8066A, &H8BFFFFBE, &HFFF8F495, &H8DF189FF, &HFFF9C085, &HE8066AFF, &HFFFFBE62, &HF8F8858B, &HDA89FFFF, &HB959DB31, &H6&
+    pvAppendBuffer &HFF8083E8, &HF0958BFF, &H8BFFFFF8, &HFFF8F485, &H8072E8FF, &H858BFFFF, &HFFFFF8FC, &H6BA&, &H7FB7E800, &H958BFFFF, &HFFFFF8FC, &H6B9&, &H70858D00, &H89FFFFFE, &HFFFCF49D, &HE88589FF, &HC7FFFFF8, &HFFFCF085, &H1FF&, &H8036E800, &H858DFFFF, &HFFFFFB40, &HF8E8B58B, &HBD8BFFFF, &HFFFFF8FC, &HF8E48589, &H858BFFFF, &HFFFFF8F4, &HF8F89D8B, &H8589FFFF, &HFFFFF8F0, &HC383DA89
+    pvAppendBuffer &H6B930, &HD8890000, &HFF7FFBE8, &HF0958BFF, &H83FFFFF8, &HFFF8F085, &H858B30FF, &HFFFFF8F0, &HFF7FE3E8, &H83FA89FF, &HF88930C7, &HFF7FD7E8, &H50F989FF, &HF990858D, &H958BFFFF, &HFFFFF8F0, &H16A006A, &HE8D88950, &HFFFFF430, &HC683F289, &H6AF98930, &HE8F08906, &HFFFFBD76, &HE4858B58, &H39FFFFF8, &H8B9575C3, &HFFF8EC85, &HC0558DFF, &H774888B, &H8D53FFFF, &HFFF90085, &H150BBFF
+    pvAppendBuffer &H66A0000, &H1610C181, &HDE80000, &H8DFFFFB7, &HFFF93085, &HE0B58BFF, &H5FFFFFF8, &HF8EC8589, &H7BFFFFF, &H81000000, &H2A0C6, &H858D00, &H85FFFFF9, &HF08589FF, &H74FFFFF8, &HE8858B39, &H8DFFFFF8, &H50D0184C, &HF8F0958B, &H66AFFFF, &HF8EC858B, &HF7E8FFFF, &H8BFFFFBC, &HFFF8FC85, &HF0958BFF, &H6AFFFFF8, &H180C8D06, &HDFE8D089, &H58FFFFBC, &H958B16EB, &HFFFFF8F0, &HF8EC858B
+    pvAppendBuffer &H6B9FFFF, &HE8000000, &HFFFF7EFC, &HF8EC958B, &H858DFFFF, &HFFFFF960, &H6B9&, &H85894F00, &HFFFFF8F0, &HFFCE0AE8, &HF8858BFF, &H8DFFFFF8, &H8B501814, &HFFF8F08D, &H6AF089FF, &HBC90E806, &H958BFFFF, &HFFFFF8F0, &HF8EC8D8B, &H66AFFFF, &H7BE8D089, &H8BFFFFBC, &HFFF8F485, &HF08D8BFF, &H6AFFFFF8, &H18148D06, &H8330468D, &HEE8330EB, &HBC5CE860, &H835AFFFF, &H850FFFFF, &HFFFFFF2D
+    pvAppendBuffer &H5BF4658D, &H8D5D5F5E, &HC35FF867, &HAB957, &H7C8D0000, &HE4830824, &HFC77FFF8, &H57E58955, &H68BD8D56, &HE8FFFFFF, &H6A57&, &H6A60C681, &H89530000, &HEC8142D3, &HA4&, &HFF588589, &HC031FFFF, &HC031ABF3, &HFF6085C7, &H3FFFF, &H85890000, &HFFFFFF64, &HFF58858B, &HA9E8FFFF, &H8BFFFF8A, &HFFFF5885, &H30C083FF, &H89043B80, &HFFFF5C85, &H8D0D75FF, &H8DE83153, &HE9FFFF8A
+    pvAppendBuffer &H158&, &HFF58958B, &H858BFFFF, &HFFFFFF5C, &H6B9&, &H987D8D00, &HFFCD16E8, &H74868BFF, &H6AFFFF07, &H608D8D06, &H5FFFFFF, &H1610&, &H5C958B50, &H89FFFFFF, &HB51AE8D0, &H6A50FFFF, &H5C958B06, &H8BFFFFFF, &HFFFF588D, &HE8D089FF, &HFFFFBB7E, &H774868B, &H8E8BFFFF, &HFFFF0774, &H62404C7, &H5000000, &H1610&, &H1640C181, &H8B500000, &HFFFF5C95, &HE8D089FF, &HFFFF8222
+    pvAppendBuffer &HAB9C031, &H31000000, &H8DABF3D2, &HAB9C87D, &H89000000, &HABF39455, &H7D8DC931, &H74968B90, &H89FFFF07, &HF989C44D, &H19045C7, &H81000000, &H1610C2, &HC045C700, &H1&, &H6AF88950, &H8046E806, &H6BAFFFF, &H58000000, &HF6E8F889, &H8DFFFF7C, &H458DFF78, &H1FF83C0, &H6B9&, &H54858900, &H76FFFFFF, &H54958B35, &H89FFFFFF, &HCC3DE8D0, &H458DFFFF, &HE8FA8990, &HFFFF7C96
+    pvAppendBuffer &H1774C209, &H8B066A51, &HFFFF5495, &H5C8D8BFF, &H89FFFFFF, &HBAB8E8D0, &H4F58FFFF, &HC289B8EB, &HFF5C858B, &HDDE8FFFF, &HFFFFF7C, &H9D8B03B6, &HFFFFFF58, &H83304333, &HC88301E0, &H8B1D7400, &HFF077496, &H66A50FF, &HFF5C8D8B, &HC281FFFF, &H1610&, &H31E8C889, &H5AFFFF80, &H5BF4658D, &H8D5D5F5E, &HC35FF867, &H6886E8, &H689F0500, &H4C8D0000, &HE4830424, &HFC71FFF8, &H57E58955
+    pvAppendBuffer &H907D8D56, &H709D8D53, &H51FFFFFE, &H1F8EC81, &H85890000, &HFFFFFE04, &H8B08418B, &H118B0471, &HFDF88589, &HD889FFFF, &HFFFDDFE8, &H10858DFF, &H89FFFFFE, &HC0758DF2, &HFE088589, &HC9E8FFFF, &H8DFFFF88, &HFFFF3085, &H6B9FF, &HDA890000, &HFE008589, &H858DFFFF, &HFFFFFF60, &HFED09D8D, &H8589FFFF, &HFFFFFE0C, &HFF7C1BE8, &HA0958DFF, &H89FFFFFE, &H7C0EE8F0, &H958BFFFF, &HFFFFFE0C
+    pvAppendBuffer &HFE00858B, &HFDE8FFFF, &H89FFFF7B, &HE8F889F2, &HFFFF7BF4, &H6BAD889, &HE8000000, &HFFFF7B3D, &HD989C031, &H8589F289, &HFFFFFED4, &HFE0C858B, &H85C7FFFF, &HFFFFFED0, &H1&, &HFFEBEFE8, &HC858BFF, &H89FFFFFE, &HE8F289D9, &HFFFFE928, &HFE00858B, &HD989FFFF, &HD1E8FA89, &H8BFFFFEB, &HFFFE0885, &H6BAFF, &H5AE80000, &H8DFFFF7B, &HDB85FE58, &HDA89667E, &HFE10858D, &H758DFFFF
+    pvAppendBuffer &H7B10E890, &HC931FFFF, &H958DD009, &HFFFFFF30, &H4BC1940F, &H8D30C16B, &HD001063C, &HFE0C8589, &H1B8FFFF, &H29000000, &H30C06BC8, &HD001C601, &HFE088589, &H8B52FFFF, &HFFFE0C8D, &H57F289FF, &HFFED3DE8, &H88D8BFF, &H8BFFFFFE, &HFFFE0C85, &H56FA89FF, &HFFEBB9E8, &H96EB59FF, &HFE10958B, &H9D8DFFFF, &HFFFFFF30, &HF790758D, &H1E283D2, &H8D30C26B, &HD801063C, &HFDFC8589, &H1B8FFFF
+    pvAppendBuffer &H29000000, &HBD89D0, &H6BFFFFFE, &H3C8D30C0, &H89D80106, &HFFFE0885, &H8D8B52FF, &HFFFFFDFC, &HB5FFFA89, &HFFFFFE00, &HFFECD5E8, &H4858BFF, &H8DFFFFFE, &HFFFE408D, &H60958DFF, &H8BFFFFFF, &HFF077480, &HC8D89FF, &H89FFFFFE, &H2404C7D9, &H6&, &H161005, &H858B5000, &HFFFFFE0C, &HFFB1F3E8, &H958B51FF, &HFFFFFE0C, &H66AF989, &H5BE8D089, &H8BFFFFB8, &HFFFE0C95, &H708D8DFF
+    pvAppendBuffer &H6AFFFFFE, &HE8D08906, &HFFFFB846, &HFE04858B, &H958BFFFF, &HFFFFFE0C, &H774888B, &H66AFFFF, &HC181D089, &H1610&, &HFFB1EFE8, &HC958BFF, &H8DFFFFFE, &HFFFEA08D, &H89066AFF, &HB810E8D0, &H958BFFFF, &HFFFFFE0C, &HFE088D8B, &H66AFFFF, &HFBE8D089, &H8BFFFFB7, &HFFFE088D, &H958BFF, &H57FFFFFE, &HFDFC858B, &HA3E8FFFF, &H8BFFFFEA, &HFFFE0C8D, &H89F289FF, &HBD8D5FD8, &HFFFFFED0
+    pvAppendBuffer &HFFEA2BE8, &H6B9FF, &HDA890000, &HF5E8F889, &H8DFFFF79, &HFFFF0085, &HE8F289FF, &HFFFF79E8, &HFDF8858B, &HFA89FFFF, &HFF868DE8, &HE8F889FF, &HFFFF862D, &H940FC085, &HF0658DC0, &HC0B60F59, &H5D5F5E5B, &HC2FC618D, &H8955000C, &H835356E5, &HEC83F8E4, &HC5D8B60, &H8908558B, &HE8F089E6, &HFFFFFB28, &H8D0403C6, &HF2890143, &HFF8649E8, &H31438DFF, &H3024548D, &HFF863DE8, &HF8658DFF
+    pvAppendBuffer &H1B8&, &H5D5E5B00, &H8D0008C2, &H8304244C, &H71FFF8E4, &HE58955FC, &H6569E857, &HC7810000, &H656E&, &H88858D56, &H53FFFFF9, &H68EC8151, &H8B000008, &H118B0859, &HF78C8589, &H718BFFFF, &HFAC6E804, &H858DFFFF, &HFFFFF928, &H8589DA89, &HFFFFF798, &HFF85B3E8, &H30538DFF, &HF9589D8D, &HD889FFFF, &HFF85A3E8, &H98858BFF, &HBAFFFFF7, &H6&, &HFF787BE8, &H74C085FF, &H89FF310D
+    pvAppendBuffer &HFFF79CBD, &H2FDE9FF, &H6BA0000, &H89000000, &H785EE8D8, &HC085FFFF, &H878BE375, &HFFFF0774, &HF798958B, &H6B9FFFF, &H5000000, &H2570&, &HFF7993E8, &HC57548FF, &H774878B, &H6B9FFFF, &H89000000, &H257005DA, &H79E80000, &H89FFFF79, &HFFF79C85, &HA57548FF, &HF808858D, &H8F8BFFFF, &HFFFF0774, &HF7948589, &H8152FFFF, &H2570C1, &H6ADA8900, &HB022E806, &H858DFFFF, &HFFFFF7A8
+    pvAppendBuffer &H8589F289, &HFFFFF790, &H84FEE859, &H878BFFFF, &HFFFF0774, &HD89D8D53, &H8BFFFFF7, &HFFF79095, &H948D8BFF, &H5FFFFF7, &H2570&, &HE8D08950, &HFFFFB84F, &H774878B, &H8D8BFFFF, &HFFFFF794, &HF798958B, &H7005FFFF, &H50000025, &H30E8D889, &H8BFFFFB8, &HFFF78C95, &HF0858DFF, &H5EFFFFFC, &HFFF671E8, &H90958BFF, &HB9FFFFF7, &H6&, &HF9EE858D, &H26E8FFFF, &HB9FFFF7A, &H6&
+    pvAppendBuffer &H8589DA89, &HFFFFF790, &HFB6F858D, &HEE8FFFF, &HBAFFFF7A, &H6&, &H858DC689, &HFFFFF838, &HFF7738E8, &H68858DFF, &HE8FFFFF8, &HFFFF772D, &HF794858B, &H22E8FFFF, &H8BFFFF77, &HFFF7909D, &H90B539FF, &HFFFFFF7, &H8D4BDE42, &HFFF80885, &HFFFB83FF, &HF7988589, &H840FFFFF, &HAE&, &HF7988D8B, &H858DFFFF, &HFFFFF838, &HF868958D, &H8589FFFF, &HFFFFF794, &HF78C9589, &HF5E8FFFF
+    pvAppendBuffer &H8BFFFFE4, &HFFF79085, &H73C339FF, &H84BE0F31, &HFFF9EE1D, &H8C958BFF, &H84FFFFF7, &H8B1F74C0, &HFF07748F, &H858B50FF, &HFFFFF794, &H2270C181, &H8B510000, &HFFF7988D, &HF04EE8FF, &HF339FFFF, &HBE0F8873, &HFB6F1D84, &HC084FFFF, &HFF78840F, &H958DFFFF, &HFFFFF868, &HF8088D8D, &H9589FFFF, &HFFFFF798, &HF838958D, &H9589FFFF, &HFFFFF794, &HF798958B, &H8D50FFFF, &HFFFCF085, &H858B50FF
+    pvAppendBuffer &HFFFFF794, &HFFF003E8, &HFF3CE9FF, &H6BAFFFF, &HE8000000, &HFFFF765C, &H850FC085, &HFFFFFDDD, &HF798958B, &H858DFFFF, &HFFFFF8F8, &H6B9&, &H28B58D00, &H89FFFFF9, &HFFF79485, &HC5F1E8FF, &H858DFFFF, &HFFFFF898, &H8589F289, &HFFFFF798, &H948D8B53, &H6AFFFFF7, &HB474E806, &H858DFFFF, &HFFFFF838, &H6B9&, &H90858900, &H5AFFFFF7, &H858BC289, &HFFFFF798, &HFF774BE8, &HFC085FF
+    pvAppendBuffer &H8284&, &H748F8B00, &H50FFFF07, &HF8C89D8D, &HF289FFFF, &HD889066A, &H2570C181, &H69E80000, &H9FFFF79, &H850F59C2, &HFFFFFD51, &H774978B, &H6B9FFFF, &H89000000, &H10C281D8, &HE8000016, &HFFFF7704, &H890FC085, &HFFFFFD31, &H948D8B50, &H89FFFFF7, &H8B066ADA, &HFFF79885, &HB3F0E8FF, &H858BFFFF, &HFFFFF798, &H6B9&, &H958B5A00, &HFFFFF790, &HFF76CFE8, &HFC085FF, &HB60FC094
+    pvAppendBuffer &H9C8589C0, &H8BFFFFF7, &HFFF79C85, &HF0658DFF, &H5F5E5B59, &HFC618D5D, &H55000CC2, &H3156E589, &HF08953F6, &HE483F189, &H10EC83F8, &HF883A20F, &HB83B7E06, &H1&, &HA20FF189, &HE181&, &HF9811800, &H18000000, &HF1892475, &H31D0010F, &H6E083D2, &H906F083, &H75C189D0, &H7B811, &HA20F0000, &HB820E380, &H2&, &H1B80575, &H8D000000, &H5E5BF865, &H8955C35D, &H558B53E5
+    pvAppendBuffer &H104D8B08, &HD101D089, &H974C839, &H400C5D8A, &HEBFF5888, &H5BD089F3, &H8D57C35D, &H8308247C, &H77FFF0E4, &HE58955FC, &H89535657, &H2CEC83FB, &H8BE04589, &H4D890847, &H4778BE4, &H8BDC4589, &HFF310C47, &HFD84589, &H458903B6, &H8B0A8BD4, &HCB29E45D, &H470FF339, &H75FF85DE, &HE0458B1E, &H53CC5589, &H75FFC801, &HD04D89D4, &HFF88E850, &H558BFFFF, &HD04D8BCC, &H850CC483, &H390575C9
+    pvAppendBuffer &HB74E45D, &H1E4458B, &H75C139D9, &HBF05EB20, &H1&, &H50D05589, &HDC458B50, &HFFE075FF, &HD0FFD875, &H8B5AC031, &HEB59D055, &H1028B04, &H290289D8, &H8D9675DE, &H5E5BF465, &H678D5D5F, &H10C25FF8, &H60ADE800, &HC2810000, &H60C2&, &H247C8D57, &HF0E48308, &H55FC77FF, &H5657E589, &H8D53C689, &H4B53C, &HEC830000, &H74828B18, &H57FFFF07, &HC38910FF, &H6A575050, &HF7E85300
+    pvAppendBuffer &H89FFFFFE, &HF4658D33, &H5E5BD889, &H678D5D5F, &H57C35FF8, &H8247C8D, &HFFF0E483, &H8955FC77, &H535657E5, &HEC83C389, &H24408B0C, &H2774C085, &HBA14738D, &H10&, &HF001C229, &H50006A52, &HFFFEB5E8, &HCEC83FF, &HCE85356, &H31FFFF98, &H244389C0, &H8D18C483, &H5E5BF465, &H678D5D5F, &H55C35FF8, &H8953E589, &H6A52C3, &HFE88E850, &H38AFFFF, &H8B0CC483, &HC3C9FC5D, &H4244C8D
+    pvAppendBuffer &HFFF0E483, &H8955FC71, &HF4E856E5, &H8100005F, &H5FFDC6, &H83515300, &H198B0CEC, &H1C74DB85, &H32CBA, &HE8D88900, &HFFFFFFB7, &H774868B, &HEC83FFFF, &H50FF530C, &HCC48308, &H59F4658D, &H8D5D5E5B, &H4C2FC61, &HE5895500, &HD6895657, &H83CB8953, &HEC81E0E4, &H740&, &H24948D, &H89000003, &H2BC2484, &HC9E80000, &H8DFFFF88, &H3402494, &HC0310000, &H587DE2C4, &H3008484
+    pvAppendBuffer &H83400000, &HFDC520C2, &H83E0427F, &HE87510F8, &H3024848B, &H8B000003, &HD231084D, &HB8248489, &H8B000002, &H2B824BC, &H848B0000, &H33424, &H89F90100, &H2802484, &H8C890000, &H2B424, &H248C8B00, &H2B4&, &HF983F929, &HAC860F07, &H8B00000A, &H2BC248C, &H79830000, &H940F0878, &H2602484, &HD2310000, &HC031F989, &H8C89D101, &H2C094, &H248C8B00, &H260&, &H21C0920F
+    pvAppendBuffer &H8BC189C8, &H2802484, &HC1010000, &HE0948C89, &H42000002, &H7508FA83, &H6FFDC5CF, &H2C024BC, &HC0310000, &HBC7FFDC5, &H4C024, &H6FFDC500, &H2E024BC, &HFDC50000, &HE024BC7F, &HC5000004, &H4BC6FFD, &H340&, &HBC7FFDC5, &H54004, &H20C08300, &H2003D, &HC5E47500, &H24B46FFD, &H6C0&, &HAB8&, &H6FFDC500, &H54024BC, &HFDC50000, &HA024AC6F, &HC5000005, &H24846FFD
+    pvAppendBuffer &H5C0&, &HB47FFDC5, &H20024, &H6FFDC500, &H5E024B4, &HFDC50000, &H248C6F, &HC5000007, &H24BC7FFD, &HC0&, &HBC6FFDC5, &H64024, &H7FFDC500, &H26024B4, &HFDC50000, &H6024B46F, &HC5000006, &H24BC7FFD, &H100&, &HBC6FFDC5, &H56024, &H7FFDC500, &H14024B4, &HFDC50000, &H24B46F, &HC5000006, &H24AC7FFD, &H160&, &HAC6FFDC5, &H6A024, &H7FFDC500, &H28024B4
+    pvAppendBuffer &HFDC50000, &H8024B46F, &HC5000005, &H24BC7FFD, &H120&, &HBC6FFDC5, &H6E024, &H7FFDC500, &HE024B4, &HFDC50000, &H8024B46F, &HC5000006, &H24AC7FFD, &H80&, &HB47FFDC5, &HA024&, &H6FFDC500, &H62024B4, &HFDC50000, &H4024B47F, &HC5000002, &H24B46FFD, &H720&, &HB47FFDC5, &H22024, &HFEFDC500, &HC02494, &HEDC50000, &H249CEF, &HC5000002, &HB1DB70FF, &HDB70FEC5
+    pvAppendBuffer &HFEE5C5B1, &H10024A4, &HFDC50000, &HD5C5C4EF, &HC514D072, &HCF072FD, &HC5EBFDC5, &HE8FEEDC5, &HAC7FFDC5, &H1E024, &HEFE5C500, &H1E0249C, &HEDC50000, &HC518D372, &H8F372E5, &HF2EBE5C5, &HB47FFDC5, &H1A024, &HFEDDC500, &H1A024AC, &HFDC50000, &HC5242C7F, &H2404EFFD, &HAC6FFDC5, &H12024, &H72EDC500, &HFDC519D0, &HC507F072, &HC5F2EBFD, &H2484FED5, &H260&, &H747FFDC5
+    pvAppendBuffer &HC5C52024, &HFFC5D0EF, &HC5B1D270, &HB1D270FE, &HBCFEEDC5, &H14024, &HEFC5C500, &H26024A4, &HE5C50000, &HC514D472, &HCF472DD, &HE3EBDDC5, &HECFEFDC5, &HAC7FFDC5, &H20024, &HEFEDC500, &H2002494, &HFDC50000, &HC518D272, &H8F272ED, &HF0EBEDC5, &H747FFDC5, &HC5C54024, &H40247CFE, &H7C7FFDC5, &HDDC56024, &H602464EF, &HBC6FFDC5, &HE024&, &HFEC5C500, &H2802494, &HFDC50000
+    pvAppendBuffer &HC519D472, &H7F472DD, &HCAEFF5C5, &HE0EBDDC5, &HC970FFC5, &H70FEC5B1, &HF5C5B1C9, &HA024ACFE, &HC5000000, &H2484EFD5, &H280&, &HD072E5C5, &H72FDC514, &HFDC50CF0, &HEDC5C3EB, &HFDC5F8FE, &H24BC7F, &HC5000001, &H248CEFF5, &H100&, &HD172EDC5, &H72F5C518, &HF5C508F1, &HFDC5FAEB, &H4024BC7F, &HC5000001, &H24ACFED5, &H140&, &HBC6FFDC5, &H16024, &HFEC5C500, &H24024B4
+    pvAppendBuffer &HCDC50000, &H20249CEF, &HC5000002, &HC5C5EFFD, &H19D072F5, &HF072FDC5, &H70FFC507, &HFDC5B1DB, &HFEC5C1EB, &HC5B1DB70, &H2494FEE5, &H80&, &H8CEFEDC5, &H24024, &H72C5C500, &HF5C514D1, &HC50CF172, &HC5CFEBF5, &HC5F9FECD, &H24BC7FFD, &H160&, &H9CEFE5C5, &H16024, &H72CDC500, &HE5C518D3, &HC508F372, &HC5DEEBE5, &HC5D3FEED, &HC5CAEFF5, &H19D172CD, &HF172F5C5, &HEBF5C507
+    pvAppendBuffer &HFEDDC5CE, &H1E024B4, &HE5C50000, &HFFC5DEEF, &HC5B1DB70, &HB1DB70FE, &HEBFED5C5, &HE5EFDDC5, &HD472C5C5, &H72DDC514, &HC5C50CF4, &HCDC5E4EB, &HFDC5FCFE, &HE024BC7F, &HC5000001, &H24B46FFD, &H1E0&, &HB47FFDC5, &HC024&, &HEFE5C500, &H72CDC5DE, &HE5C518D3, &HC508F372, &HC5FBEBCD, &H24BC7FFD, &H220&, &HACFED5C5, &H22024, &H7FFDC500, &H1C024AC, &HFDC50000, &HC024AC6F
+    pvAppendBuffer &HC5000001, &H24AC7FFD, &HA0&, &HE5EFDDC5, &HD472E5C5, &H72DDC519, &HE5C507F4, &HFDC5F4EB, &H24A4FE, &HC5000002, &H249CEFDD, &H1A0&, &HB47FFDC5, &H26024, &H70FFC500, &HFEC5B1DB, &HC5B1DB70, &HC5D3FEED, &HC5C2EFFD, &H14D072D5, &HF072FDC5, &HEBD5C50C, &HFEDDC5C0, &H7FFDC5F0, &H1A024B4, &HFDC50000, &HA024AC6F, &HC5000001, &H24AC7FFD, &H120&, &HDDEFE5C5, &HD372DDC5
+    pvAppendBuffer &H72E5C518, &HDDC508F3, &HFDC5FBEB, &H24BC7F, &HC5000002, &H24B4FEED, &H200&, &HB47FFDC5, &H18024, &H6FFDC500, &H18024AC, &HF5C50000, &H24B4FE, &HC5000001, &H24AC7FFD, &H80&, &HC5EFFDC5, &HD072EDC5, &H72FDC519, &HEDC507F0, &HCDC5F8EB, &H402454EF, &HBC7FFDC5, &H28024, &H70FFC500, &HFEC5B1D2, &HC5B1D270, &H242CFEED, &HCDEFF5C5, &HD172FDC5, &H72F5C514, &HFDC50CF1
+    pvAppendBuffer &HCDC5C1EB, &HFDC5F0FE, &HE024B47F, &HC5000000, &HC5D2EFCD, &H18D272F5, &HF272EDC5, &HEBF5C508, &HFED5C5FA, &H7FFDC5EF, &H10024AC, &HFDC50000, &HF5C5C5EF, &HC519D072, &H7F072FD, &HE0EBF5C5, &HA47FFDC5, &H24024, &H6FFDC500, &H16024A4, &HDDC50000, &H202464FE, &H84EFDDC5, &H14024, &H70FFC500, &HFEC5B1C0, &HC5B1C070, &H245CFEFD, &HEFE5C560, &HC520244C, &H14D172ED, &HF172F5C5
+    pvAppendBuffer &HEBEDC50C, &HFEDDC5D1, &H7FFDC5E2, &H16024A4, &HDDC50000, &HF5C5C0EF, &HC518D072, &H8F072FD, &HC8EBF5C5, &HD9FEE5C5, &H9C7FFDC5, &H14024, &HEFEDC500, &H72FDC5D3, &HEDC519D2, &HC507F272, &H48C2EBFD, &HFB9B850F, &HFDC5FFFF, &HE024946F, &H8D000001, &H3402494, &HFDC50000, &H8024B47F, &HC5000005, &H24B46FFD, &H240&, &HBC7FFDC5, &H6E024, &H7FFDC500, &H5402494, &HFDC50000
+    pvAppendBuffer &H2024946F, &HC5000002, &H24AC7FFD, &H640&, &H947FFDC5, &H72024, &H6FFDC500, &H1C02494, &HFDC50000, &H2024B47F, &HC5000006, &H24947FFD, &H680&, &H946FFDC5, &H26024, &H7FFDC500, &H5A024A4, &HFDC50000, &HE024947F, &HC5000005, &H24946FFD, &H1A0&, &H8C7FFDC5, &H70024, &H7FFDC500, &H5602494, &HFDC50000, &H24946F, &HC5000002, &H249C7FFD, &H660&, &H947FFDC5
+    pvAppendBuffer &H6C024, &H6FFDC500, &H1802494, &HFDC50000, &HC024847F, &HC5000005, &H24947FFD, &H6A0&, &H946FFDC5, &H28024, &H7FFDC500, &H6002494, &HFDC50000, &H4004AC6F, &HC5000005, &H1004FED5, &H847FFDC5, &H54004, &H20C08300, &H2003D, &HC5DF7500, &H24BC6FFD, &H540&, &H3108C783, &H62C5C5C0, &H560248C, &HFDC50000, &H8024B46F, &HC5000005, &H24AC62CD, &H5A0&, &H946ACDC5
+    pvAppendBuffer &H5A024, &H6AC5C500, &H5602484, &HFDC50000, &H24B46F, &HC5000006, &HC5DD6CF5, &HC526EFE1, &HC5CD6DF5, &H24AC6FFD, &H5C0&, &H397DE3C4, &HFDC501DB, &HC024BC6F, &HC5000005, &HC5237FFA, &H9EEFE1, &HC5000001, &H9B7FFA, &HC5000001, &H405EEFF1, &H397DE3C4, &HFAC501C9, &HC5405B7F, &H408EEFF1, &HC5000001, &H408B7FFA, &HC5000001, &HC5CA6CFD, &HC5C26DFD, &H809EEFF1, &HC5000000
+    pvAppendBuffer &H24946ACD, &H620&, &H397DE3C4, &HFAC501C9, &H809B7F, &HF1C50000, &H1808EEF, &HFAC50000, &H1808B7F, &HF9C50000, &HC08EEF, &HE3C40000, &H1C0397D, &H8B7FFAC5, &HC0&, &H86EFF9C5, &H1C0&, &H8C62D5C5, &H5E024, &H6FFDC500, &H60024AC, &HD5C50000, &H2024AC62, &HC5000006, &HC0837FFA, &HC5000001, &H24846AC5, &H5E0&, &HDD6CF5C5, &H66EFE1C5, &H6DF5C510, &H7DE3C4CD
+    pvAppendBuffer &HC501DB39, &H10637FFA, &H9EEFE1C5, &H110&, &HBC6FFDC5, &H68024, &H6FFDC500, &H64024AC, &HFDC50000, &H4024B46F, &HC5000006, &H109B7FFA, &HC5000001, &H505EEFF1, &H397DE3C4, &HFAC501C9, &HC5505B7F, &H508EEFF1, &HC5000001, &H508B7FFA, &HC5000001, &HC5CA6CFD, &HC5C26DFD, &H909EEFF1, &HC5000000, &H24946AC5, &H6A0&, &H397DE3C4, &HFAC501C9, &H909B7F, &HF1C50000, &H1908EEF
+    pvAppendBuffer &HFAC50000, &H1908B7F, &HF9C50000, &HD08EEF, &HE3C40000, &H1C0397D, &H8B7FFAC5, &HD0&, &H86EFF9C5, &H1D0&, &H8C62D5C5, &H66024, &H62C5C500, &H6A024AC, &HFAC50000, &H1D0837F, &HCDC50000, &H6024846A, &HC5000006, &HC5DD6CF5, &H2066EFE1, &HCD6DF5C5, &H397DE3C4, &HFAC501DB, &HC520637F, &H209EEFE1, &HC5000001, &H209B7FFA, &HC5000001, &H605EEFF1, &H397DE3C4, &HFAC501C9
+    pvAppendBuffer &HC5605B7F, &H608EEFF1, &HC5000001, &H608B7FFA, &HC5000001, &HC5CA6CFD, &HC5C26DFD, &HA09EEFF1, &HC4000000, &HC9397DE3, &H7FFAC501, &HA09B&, &HEFF1C500, &H1A08E, &H7FFAC500, &H1A08B, &HEFF9C500, &HE08E&, &H6FFDC500, &H6C024AC, &HE3C40000, &H1C0397D, &HBC6FFDC5, &H70024, &H248C8B00, &H2BC&, &H8B7FFAC5, &HE0&, &H86EFF9C5, &H1E0&, &H8C62D5C5, &H6E024
+    pvAppendBuffer &H62C5C500, &H72024AC, &H948B0000, &H2FC24, &H7FFAC500, &H1E083, &H6AC5C500, &H7202494, &HFDC50000, &HC024B46F, &HC5000006, &H24846ACD, &H6E0&, &HDD6CF5C5, &H66EFE1C5, &H7DE3C430, &HC501DB39, &HC5CD6DF5, &H30637FFA, &H9EEFE1C5, &H130&, &H9B7FFAC5, &H130&, &H5EEFF1C5, &H7DE3C470, &HC501C939, &H705B7FFA, &H8EEFF1C5, &H170&, &H8B7FFAC5, &H170&, &HCA6CFDC5
+    pvAppendBuffer &HC26DFDC5, &H9EEFF1C5, &HB0&, &H397DE3C4, &HFAC501C9, &HB09B7F, &HF1C50000, &H1B08EEF, &HFAC50000, &H1B08B7F, &HF9C50000, &HF08EEF, &HE3C40000, &H1C0397D, &H8B7FFAC5, &HF0&, &H86EFF9C5, &H1F0&, &H837FFAC5, &H1F0&, &H8787983, &HBC3B0A75, &H2DC24, &HC0920F00, &H81C0B60F, &H200C6, &HC38100, &H1000002, &H8901B2D0, &H2802484, &H42E90000, &H8BFFFFF5
+    pvAppendBuffer &HE383085D, &H74D284F8, &H24848B1E, &H280&, &H34248489, &H8B000003, &H2B82484, &HD8010000, &H30248489, &H8B000003, &H2BC2484, &H508D0000, &H24848B20, &H330&, &HFF5CF3E8, &H24848BFF, &H2BC&, &H8B24508D, &H3342484, &HDDE80000, &H8DFFFF5C, &H5402484, &HBA0000, &HE8000002, &HFFFFF3FF, &H4024848D, &HBA000003, &H200&, &HFFF3EEE8, &H24848DFF, &H300&, &H40BA&
+    pvAppendBuffer &HF3DDE800, &HD889FFFF, &H8D77F8C5, &H5E5BF465, &H4C25D5F, &HE5895500, &HCE895657, &H83D38953, &HEC81F0E4, &H3E0&, &HA024948D, &H89000001, &H15C2484, &HFDE80000, &H8DFFFF7C, &H1E02494, &HC0310000, &HBC6E0F66, &H1A084, &HC2834000, &H700F6610, &H290F00C7, &HF883F042, &H8BE57510, &H1D02484, &H4D8B0000, &H89D23108, &H1582484, &HBC8B0000, &H15824, &H24848B00, &H1D4&
+    pvAppendBuffer &H8489F901, &H14024, &H248C8900, &H154&, &H54248C8B, &H29000001, &H3F983F9, &H96D860F, &H8C8B0000, &H15C24, &H78798300, &H84940F08, &H13024, &H89D23100, &H1C031F9, &H948C89D1, &H160&, &H30248C8B, &HF000001, &HC821C092, &H848BC189, &H14024, &H89C10100, &H180948C, &H83420000, &HCF7504FA, &H24AC280F, &H160&, &H24BC280F, &H180&, &H290FC031, &H2A024AC
+    pvAppendBuffer &H290F0000, &H2B024BC, &H280F0000, &H1E004AC, &H290F0000, &H2E004AC, &HC0830000, &H1003D10, &HE6750000, &H24AC280F, &H3A0&, &H24B4280F, &H340&, &HAB8&, &HBC280F00, &H2E024, &H84280F00, &H32024, &HAC290F00, &H11024, &HAC280F00, &H33024, &H8C280F00, &H3C024, &HB4290F00, &H14024, &HB4280F00, &H38024, &HAC290F00, &H13024, &HAC280F00, &H37024
+    pvAppendBuffer &H7C290F00, &H280F4024, &H36024BC, &H290F0000, &HA024AC, &H280F0000, &H30024AC, &H290F0000, &HF502474, &H1024B428, &HF000003, &H60246C29, &H24AC280F, &H350&, &H24BC290F, &H80&, &H24BC280F, &H2F0&, &H24AC290F, &H120&, &H24AC280F, &H3D0&, &H24B4290F, &HB0&, &H24B4280F, &H390&, &H24BC290F, &H90&, &H24BC280F, &H3B0&, &H24AC290F, &H100&
+    pvAppendBuffer &H2474290F, &H54280F70, &H280F4024, &H110249C, &H280F0000, &H8024A4, &HF660000, &H570FD0FE, &H700FF2DA, &HFF3B1DB, &H66B1DB70, &HFE3FE0F, &H280FC457, &H720F66E8, &HF660CF0, &HF14D572, &HF66C556, &H290FD0FE, &HE02494, &H570F0000, &HE0249C, &H280F0000, &H720F66D3, &HF6608F3, &HF18D272, &H560FF328, &HB4290FF2, &HF024&, &HFE0F6600, &HF024A4, &H290F0000, &H570F2424
+    pvAppendBuffer &H280F2404, &H720F66D0, &HF6607F0, &HF19D272, &H280FF028, &H1302484, &H560F0000, &H94280FF2, &H9024&, &HFE0F6600, &H1302494, &H290F0000, &HF102474, &HFF2FA57, &HFB1DF70, &HA024BC28, &HF3000000, &HB1DB700F, &HFBFE0F66, &HFC7570F, &HF66E828, &H660CF072, &H14D5720F, &HFC5560F, &H50246C28, &HD0FE0F66, &H2494290F, &H110&, &H249C570F, &H110&, &H66D3280F, &H8F3720F
+    pvAppendBuffer &HD2720F66, &HF3280F18, &HFF2560F, &H20247429, &H7CFE0F66, &H280F2024, &HB024B4, &HF660000, &H2024B4FE, &HF000001, &H30247C29, &H2444570F, &HD0280F30, &HF0720F66, &H720F6607, &H280F19D2, &H84280FE0, &H14024, &HE2560F00, &H2454280F, &HFE0F6660, &H1402494, &H570F0000, &H700FF2CA, &HFF3B1C9, &H66B1C970, &HFE9FE0F, &H280FC557, &H720F66D8, &HF660CF0, &HF14D372, &H280FC356
+    pvAppendBuffer &H100249C, &HF660000, &H290FD0FE, &H802494, &H570F0000, &H80248C, &H570F0000, &H700FF2DE, &H280FB1DB, &H720F66D1, &HFF308F1, &H66B1DB70, &H18D2720F, &HFF9280F, &H280FFA56, &HF702454, &HA024BC29, &H66000000, &H24ACFE0F, &HA0&, &HD3FE0F66, &HFC5570F, &HF66C828, &H6607F072, &H19D1720F, &HFC1560F, &H20248C28, &HF000001, &H280FCA57, &H720F66F9, &HF660CF1, &HF14D772
+    pvAppendBuffer &HF66CF56, &H290FF1FE, &HB024B4, &H570F0000, &HB0249C, &H280F0000, &H720F66F3, &HF6608F3, &HF18D672, &HF66DE56, &H570FD3FE, &HF1280FCA, &HF1720F66, &H720F6607, &H560F19D6, &HB4280FCE, &HE024&, &HFE0F6600, &HDE570FF4, &HDB700FF2, &H700FF3B1, &HF66B1DB, &H570FEBFE, &HFC280FE5, &HF4720F66, &H720F660C, &H560F14D7, &HFE0F66E7, &HB4290FF4, &HC024&, &HBC280F00, &HC024&
+    pvAppendBuffer &HDF570F00, &H247C290F, &HF3280F40, &HF3720F66, &H720F6608, &H280F18D6, &HFE560FFB, &H24B4280F, &H80&, &H24BC290F, &H100&, &HACFE0F66, &H10024, &HFE0F6600, &HAC290FF1, &HD024&, &HBC280F00, &HD024&, &HE7570F00, &H247C290F, &HDC280F50, &HF4720F66, &H720F6607, &H280F19D3, &HA4280FFC, &H11024, &HFB560F00, &H249C280F, &HF0&, &HE0FE0F66, &H24BC290F, &H130&
+    pvAppendBuffer &HF2DC570F, &HB1DB700F, &HDB700FF3, &HFE0F66B1, &HC2570FD3, &H66E8280F, &HCF0720F, &HD5720F66, &HC5560F14, &HE0FE0F66, &H24A4290F, &HF0&, &H24BC280F, &HF0&, &HFDF570F, &H9024BC29, &HF000000, &HF66E328, &H6608F372, &H18D4720F, &HFFC280F, &H290FFB56, &H11024BC, &HF660000, &H102494FE, &HF000001, &HE0249429, &HF000000, &HE024BC28, &HF000000, &H290FC757, &HF70247C
+    pvAppendBuffer &HF66D028, &H6607F072, &H19D2720F, &HFEA280F, &H20245428, &HFE8560F, &H290FD657, &H14024AC, &H280F0000, &HFF2242C, &HF3B1D270, &HB1D2700F, &HEAFE0F66, &HFCD570F, &HF66C128, &H660CF172, &H14D0720F, &H66C1560F, &HFF0FE0F, &H290FD657, &HF602474, &HF66CA28, &H6608F272, &H18D1720F, &HFF9280F, &HF66FA56, &H570FEFFE, &HAC290FC5, &H8024&, &HC8280F00, &HF0720F66, &H720F6607
+    pvAppendBuffer &H280F19D1, &HE0560FE1, &H24A4290F, &H120&, &H24A4280F, &HB0&, &H64FE0F66, &H280F1024, &HA02484, &H280F0000, &HF30245C, &H10244C28, &HF2C4570F, &HB1C0700F, &HC0700FF3, &HFE0F66B1, &HCB570FD8, &H66D1280F, &HCF1720F, &HD2720F66, &HD1560F14, &HE2FE0F66, &HFC4570F, &HB024A429, &HF000000, &HF66C828, &H6608F072, &H18D1720F, &H66C8560F, &HFD9FE0F, &H290FD357, &HA0249C
+    pvAppendBuffer &H280F0000, &H720F66C2, &HF6607F2, &HF19D072, &HF48C256, &HFFFB6C85, &H94280FFF, &HC024&, &HAC290F00, &H36024, &HAC280F00, &H12024, &H24948D00, &H1E0&, &H24B4290F, &H300&, &H2494290F, &H2E0&, &H2494280F, &H100&, &H24BC290F, &H3B0&, &H2494290F, &H3D0&, &H2494280F, &HD0&, &H24AC290F, &H350&, &H2494290F, &H380&, &H2494280F, &H130&
+    pvAppendBuffer &H24A4290F, &H310&, &H2494290F, &H330&, &H2494280F, &HF0&, &H248C290F, &H3C0&, &H2494290F, &H2F0&, &H2494280F, &H110&, &H249C290F, &H370&, &H2494290F, &H3A0&, &H2494280F, &HE0&, &H2484290F, &H320&, &H2494290F, &H390&, &H2494280F, &H140&, &H2494290F, &H340&, &H484280F, &H2E0&, &H4FE0F66, &H84290F10, &H2E004, &H10C08300
+    pvAppendBuffer &H1003D, &HFE17500, &HE0249428, &HF000002, &HC7833310, &HFC03104, &H24A428, &HF000003, &HE0248428, &H66000002, &H2494620F, &H2F0&, &H248C280F, &H300&, &HA4620F66, &H31024, &H6A0F6600, &H2F02484, &HF660000, &H10248C6A, &HF000003, &HF66DA28, &HF66DC6C, &H280FD46D, &H34024A4, &HF660000, &H5024A462, &HF000003, &H110FDE57, &H7B100F1E, &HD7570F40, &H4056110F
+    pvAppendBuffer &HFD0280F, &H80AB10, &HF660000, &HF66C16D, &H280FD16C, &H320248C, &HF660000, &H30248C62, &HF000003, &H110FD557, &H8096&, &HB3100F00, &HC0&, &H66D9280F, &H66CC6D0F, &HFDC6C0F, &H40249428, &H66000003, &H24946A0F, &H350&, &HFC6570F, &HC08611, &H100F0000, &H280F107B, &H3202484, &HF660000, &H3024846A, &HF000003, &H110FDF57, &H100F105E, &H570F506B, &H4E110FCD
+    pvAppendBuffer &HC8280F50, &H90B3100F, &H66000000, &H66C26D0F, &HFCA6C0F, &H110FCE57, &H908E&, &HBB100F00, &HD0&, &HFC7570F, &HD08611, &H280F0000, &H360248C, &HF660000, &H70248C62, &HF000003, &H8024A428, &HF000003, &H66206B10, &H24A4620F, &H390&, &HFD9280F, &H60248428, &H66000003, &H24846A0F, &H370&, &H2494280F, &H380&, &HDC6C0F66, &HCC6D0F66, &H946A0F66, &H39024
+    pvAppendBuffer &HA4280F00, &H3C024, &H620F6600, &H3D024A4, &H570F0000, &H5E110FDD, &H73100F20, &HCE570F60, &H604E110F, &HFC8280F, &HA0BB10, &HF660000, &HF66C26D, &H280FCA6C, &H3C02494, &HF660000, &HD024946A, &HF000003, &H110FCF57, &HA08E&, &HAB100F00, &HE0&, &H248C280F, &H3A0&, &H8C620F66, &H3B024, &HC5570F00, &HE086110F, &HF000000, &H100FD928, &H280F3073, &H3A02484
+    pvAppendBuffer &HF660000, &HF66DC6C, &HF66CC6D, &HB024846A, &HF000003, &H110FDE57, &H100F305E, &H570F707B, &H4E110FCF, &HC8280F70, &HB0AB100F, &H66000000, &H66C26D0F, &HFCA6C0F, &H110FCD57, &HB08E&, &HB3100F00, &HF0&, &HFC6570F, &HF08611, &H948B0000, &H18C24, &H248C8B00, &H15C&, &H8787983, &HBC3B0A75, &H16C24, &HC0920F00, &H81C0B60F, &H100C3, &HC68100, &H1000001
+    pvAppendBuffer &H8901B2D0, &H1402484, &H81E90000, &H8BFFFFF6, &HE383085D, &H74D284FC, &H24848B1E, &H140&, &HD4248489, &H8B000001, &H1582484, &HD8010000, &HD0248489, &H8B000001, &H15C2484, &H508D0000, &H24848B20, &H1D0&, &HFF5263E8, &H24848BFF, &H15C&, &H8B24508D, &H1D42484, &H4DE80000, &H8DFFFF52, &H2E02484, &HBA0000, &HE8000001, &HFFFFE96F, &HE024848D, &HBA000001, &H100&
+    pvAppendBuffer &HFFE95EE8, &H24848DFF, &H1A0&, &H40BA&, &HE94DE800, &H658DFFFF, &H5BD889F4, &HC25D5F5E, &H8D570004, &H8308247C, &H77FFF0E4, &HE58955FC, &HCE895657, &H4945E853, &HC3810000, &H4952&, &H892CEC83, &H5D89E455, &H8BC389DC, &H7C7B8307, &HE0458900, &H8974438D, &H438DD845, &HD4458934, &H9B840F, &H7D810000, &HFFE0&, &H8E860F00, &H83000000, &H7B8B0CEC, &H458B5374, &H8DFE01DC
+    pvAppendBuffer &HFF297580, &H515750FF, &H40B9&, &H458B5200, &HD8558BD4, &HFF6A21E8, &HE4458BFF, &H10CC483, &HE44589F8, &H29E0458B, &H7C7B83F8, &HE0458902, &HEC832175, &H6E8C10C, &H8B50F189, &HD889E455, &HFFE904E8, &H6E0C1FF, &H83E44501, &H45290CC4, &H8BC601E0, &HEC83E045, &HC1F1890C, &H8B5006E8, &HD889E455, &HFFF4ACE8, &HE47D8BFF, &HC1E0558B, &HC48306E0, &H29C7010C, &H89C601C2, &H5589E47D
+    pvAppendBuffer &HCEC83E0, &H40B9&, &H458B5300, &H75808DDC, &H50FFFF29, &H56E075FF, &H8BE475FF, &H458BD855, &H6994E8D4, &HC483FFFF, &HF4658D0C, &H5D5F5E5B, &H5FF8678D, &HE80004C2, &H4837&, &H485005, &HE5895500, &H83535657, &HEC81F8E4, &H1B8&, &H890C558B, &H310C2444, &H20C8AC0, &H20044C88, &H1FF88340, &H428AF375, &H2464801F, &H948DF820, &H14024, &H3FE08300, &H8840C883, &H8D3F2444
+    pvAppendBuffer &H1182484, &HDB310000, &H8904C083, &H58897458, &H2458894C, &H39FC5889, &HC7EB75D0, &H1682484, &H10000, &H84C70000, &H14024, &H100&, &H2444C700, &H3214&, &H24848D00, &H118&, &HFF58E0E8, &H31C931FF, &H244C89D2, &H33CA6B10, &H1424448B, &HC889C101, &HC107E183, &HB60F03F8, &HD3200444, &H42D189F8, &HD301E083, &H244409E0, &H5FA8310, &HC031D775, &H5489D231, &H83404084
+    pvAppendBuffer &HF47518F8, &H602444C7, &H1&, &H1BA&, &H2444C700, &H140&, &H8DC03100, &H5439FF4A, &H940F1024, &H18F96BC0, &H4489D8F7, &HC0310824, &H4247C89, &HC247C8B, &H40244C8D, &H774B78B, &H7C8BFFFF, &HC7010424, &H3C8BFB89, &H9E7C3381, &H245C8B0C, &H21FE8908, &H813433DE, &H40813489, &H7518F883, &HFA8342CF, &H8DAE7520, &HA024B4, &HCA890000, &HC824BC8D, &H89000000, &H5235E8F0
+    pvAppendBuffer &H548DFFFF, &HF8896024, &HFF522AE8, &H24948DFF, &H80&, &HF024848D, &HE8000000, &HFFFF5217, &H1824848D, &H89000001, &H590AE8F2, &H4CFFFFFF, &H7C831424, &HFFF1424, &HFFFEFC85, &H249C8DFF, &H168&, &H40248C8D, &H89000001, &HE8DA89F0, &HFFFF5232, &HF889DA89, &HFF5247E8, &H89FA89FF, &H53F8E8F8, &HF989FFFF, &HF089F289, &HFF5251E8, &H8458BFF, &HDAE8F289, &H8DFFFF50, &HBA202444
+    pvAppendBuffer &H20&, &HFFE65AE8, &HF4658DFF, &H5D5F5E5B, &H570008C2, &H8247C8D, &HFFF0E483, &H8955FC77, &HC78957E5, &H1B8&, &HCE895600, &H8153C931, &H12CEC, &HD0958900, &HFFFFFFE, &HE181A2, &H31020800, &HF981C0, &HF020800, &H1B585, &HC1F08900, &HDB3102EE, &H4B9&, &HEE85C700, &H1FFFFFE, &H99080402, &H85C7F9F7, &HFFFFFEF2, &H80402010, &HF685C766, &H1BFFFFFE, &H4578D36
+    pvAppendBuffer &HC083F189, &H89078906, &H83D8F7D0, &HD0010CE0, &H100978D, &H87890000, &H1FC&, &HFEE48589, &HD089FFFF, &HE083D8F7, &H89D0010C, &H20087, &H89FF3100, &HFFFEE085, &H6468DFF, &HFEDC8589, &H48DFFFF, &H1CB5&, &HD8858900, &H6BFFFFFE, &H848DFCC6, &HFFFEF805, &HD48589FF, &H39FFFFFE, &HFFFED89D, &H87840FFF, &H39000000, &H8B1273CB, &HFFFED085, &H98048DFF, &HFF4E30E8, &HEBC689FF
+    pvAppendBuffer &H31D88964, &H9DB48BD2, &HFFFFFEF4, &HF983F1F7, &H89107508, &H7E083D8, &H7504F883, &H74D28506, &H8526EB06, &HF3575D2, &HF66C057, &H1C6223A, &H3DB4B60F, &HFFFFFEEE, &H3A0F6647, &H6600C0DF, &HC2163A0F, &HEBD63101, &HC0570F13, &H223A0F66, &HF6601C6, &HC0DF3A, &HC67E0F66, &HFED4858B, &H3433FFFF, &H9DB48998, &HFFFFFEF8, &HFF6DE943, &H958BFFFF, &HFFFFFEE4, &H8D04E1C1, &HFFFEF885
+    pvAppendBuffer &HA4C8DFF, &H6E0F6670, &HF660848, &HC283006E, &H10C08310, &H223A0F66, &H6601FC48, &H40223A0F, &HF6601F4, &H290FC16C, &HD139F042, &H858DD775, &HFFFFFEF8, &HF068&, &H50006A00, &HFFE339E8, &HDC958BFF, &H83FFFFFE, &HC0310CC4, &HFEE4BD8B, &HC189FFFF, &HF04E1C1, &H850F0428, &H850974C0, &H660574D2, &HC0DB380F, &H9D8BD189, &HFFFFFEE0, &HE1C14A40, &H4290F04, &HDC85390B, &H73FFFFFE
+    pvAppendBuffer &H1B8CB, &H658D0000, &H5F5E5BF4, &HF8678D5D, &H8D57C35F, &H8308247C, &H77FFF0E4, &HE58955FC, &H5CE85657, &H81000044, &H4465C6, &HEC835300, &HDC55891C, &H578B1F8B, &H87F8B04, &H89E44D89, &H458BE045, &H89F989E4, &HC4E8D855, &H8BFFFFFD, &HC085D855, &H55896575, &HF46850E4, &H6A000000, &H93E85300, &H83FFFFE2, &HFF8310C4, &HE4558B18, &HFF831774, &H831F7420, &H2C7510FF, &HA03C7
+    pvAppendBuffer &H10B90000, &HEB000000, &HC03C718, &HB9000000, &H18&, &H3C70BEB, &HE&, &H20B9&, &HE8D88900, &HFFFF753C, &H968DC931, &HFFFF3399, &H35E8868D, &H4D89FFFF, &H8B0FEBE4, &H968DE45D, &HFFFF47C8, &H4AB7868D, &H758BFFFF, &H84689E0, &HC7DC458B, &H1006&, &H4568900, &H458B1889, &HF4658DE4, &H5D5F5E5B, &H5FF8678D, &H57000CC2, &H8247C8D, &HFFF0E483, &H8955FC77, &H895657E5
+    pvAppendBuffer &HD38953C6, &H680CEC83, &H114&, &HE850006A, &HFFFFE1E6, &HF289D889, &HFF7A66E8, &H1B8FF, &HC9310000, &HC031A20F, &H800CC483, &H950F02E1, &H108689C0, &H74000001, &H908E8D10, &H8D000000, &HF0891056, &HFF8AB4E8, &HF4658DFF, &H5D5F5E5B, &H5FF8678D, &H4319E8C3, &H32050000, &H8D000043, &H8304244C, &H71FFF0E4, &HE58955FC, &H51535657, &H8B24EC83, &HFF077480, &H8B318BFF, &H2C680479
+    pvAppendBuffer &HFF000003, &HC0570F10, &H110FC389, &HC483D845, &H74C0850C, &H2C68504C, &H6A000003, &H57E85300, &H8DFFFFE1, &HC483104B, &HC538D0C, &H56D88957, &H51D8758D, &HFFFE59E8, &H148389FF, &H56000002, &HC73FF56, &H8D0453FF, &H21883, &HF2895A00, &HFFFF1AE8, &H10BAFF, &HF0890000, &HFFE282E8, &HF0658DFF, &H5B59D889, &H8D5D5F5E, &H8C2FC61, &H7C8D5700, &HE4830824, &HFC77FFF8, &H57E58955
+    pvAppendBuffer &H53D68956, &HEC83C389, &H89078B5C, &HCF899C55, &H89A84D89, &HFF83A445, &H8B7B7601, &H458DA44D, &H83F289B4, &H458902EF, &H731DE8A0, &H458BFFFF, &H8D0301B4, &H458B1056, &H44301B8, &H8B20C683, &H4301BC45, &HC0458B08, &H8B0C4301, &H4301C445, &HA44D8B10, &HE8A0458B, &HFFFF72EF, &H6AC8458D, &H89006A28, &HE850AC45, &HFFFFE08E, &H83AC458B, &H4B8D0CC4, &HE8DA8928, &HFFFF700F, &H8BA0558B
+    pvAppendBuffer &H4B8DAC45, &H7001E814, &H558BFFFF, &HE8D889AC, &HFFFF71C0, &H458B80EB, &H6BE8D1A8, &H5503FED0, &H8B5674A8, &H4D8B9C55, &H5E0C1A4, &H1C8758D, &HB4458DC2, &HFF7292E8, &HB4458BFF, &H458B0301, &H44301B8, &H1BC458B, &H458B0843, &HC4301C0, &H1C4458B, &H6A501043, &H56006A28, &HFFE019E8, &H144B8DFF, &HF089DA89, &HFF6F9EE8, &H89F289FF, &H715EE8D8, &HC483FFFF, &HF4658D10, &H5D5F5E5B
+    pvAppendBuffer &H5FF8678D, &H570004C2, &H8247C8D, &HFFF8E483, &H8955FC77, &HC78957E5, &HEC835356, &H5C408B2C, &H85EC5589, &H8D3074C0, &H10BA4C5F, &H29000000, &H52D801C2, &HE850006A, &HFFFFDFBE, &HB95C478B, &H1&, &H44C6DA89, &H89014C07, &HE8006AF8, &HFFFFFE9D, &H8B0CC483, &HC889044F, &HFFFFE181, &HE8C103FF, &H847031A, &HE8C1C689, &HC47031A, &HFFFFE681, &H758903FF, &HC1C689E8, &H47031AE8
+    pvAppendBuffer &HFFE68110, &H8903FFFF, &HDC7589C2, &H891AEAC1, &HDC6&, &HE681FC00, &H3FFFFFF, &H392148D, &HCC758917, &HEAC1D689, &HFFE6811A, &H8903FFFF, &H5D8BD875, &H11348DD8, &H83E84D8B, &HDA8905C3, &HC1D45D89, &H1C8D1AEA, &HC1DA8932, &HD1011AEA, &H89DC558B, &HE9C1D04D, &H89D1011A, &H1AEAC1CA, &H558BD001, &HE04589D4, &H481FE8C1, &HC221C121, &H4D89C321, &HE04D8BD4, &HFFFFE381, &H558903FF
+    pvAppendBuffer &HD0558BC8, &H211FF9C1, &H9C221CE, &HE85D8BDE, &HFFFFE281, &HCB2103FF, &H5D8BDA09, &HE85589D4, &H81DC558B, &HFFFFFFE3, &H9CA2103, &HE05D8BDA, &H5D8BD821, &H9CB21CC, &HC85D8BD8, &HC1104789, &HE38108E0, &H3FFFFFF, &H8BE05D89, &HD921D85D, &H9E05D8B, &HC1F389D9, &HE3C106EE, &H89D9091A, &H12EAC1D3, &HC1E04D89, &HC2090EE3, &H893C478D, &HE84D8B0F, &H310C5789, &H14E1C1D2, &H4D8BCE09
+    pvAppendBuffer &H47789E8, &H90CE9C1, &H89DB31D9, &H9AE8084F, &H89FFFF48, &HE0458BC6, &HC101F189, &H11E0458B, &HEC558BD3, &HD989F001, &H81E8DB31, &H8DFFFF48, &HD2314047, &HFF4874E8, &HE04D89FF, &H89044F8B, &HDB31E45D, &H458BC101, &H3D311EC, &H5D13E04D, &H4508DE4, &HD989C889, &H51E8DB31, &H8DFFFF48, &HD2314447, &HFF4844E8, &HE04D89FF, &H89084F8B, &HDB31E45D, &H458BC101, &H3D311EC, &H5D13E04D
+    pvAppendBuffer &H8508DE4, &H25E8C889, &H8DFFFF48, &H1AE84847, &H8BFFFF48, &H4703EC75, &H8DD8010C, &HDE80C56, &H89FFFF48, &H60BAF8, &H34E80000, &H8DFFFFDF, &H5E5BF465, &H678D5D5F, &H55C35FF8, &H8B53E589, &HC868085D, &H6A000000, &HABE85300, &HC7FFFFDD, &HBCC90803, &HCC483F3, &H670443C7, &HC76A09E6, &HA73B0843, &H43C784CA, &H67AE850C, &H1043C7BB, &HFE94F82B, &H721443C7, &HC73C6EF3, &H36F11843
+    pvAppendBuffer &H43C75F1D, &H4FF53A1C, &H2043C7A5, &HADE682D1, &H7F2443C7, &HC7510E52, &H6C1F2843, &H43C72B3E, &H5688C2C, &H3043C79B, &HFB41BD6B, &HAB3443C7, &HC71F83D9, &H21793843, &H43C7137E, &HE0CD193C, &HFC5D8B5B, &H4C2C9, &H53E58955, &H68085D8B, &HC8&, &HE853006A, &HFFFFDD1E, &H9ED803C7, &HC483C105, &H443C70C, &HCBBB9D5D, &H70843C7, &HC7367CD5, &H292A0C43, &H43C7629A, &H70DD1710
+    pvAppendBuffer &H1443C730, &H9159015A, &H391843C7, &HC7F70E59, &HECD81C43, &H43C7152F, &HC00B3120, &H2443C7FF, &H67332667, &H112843C7, &HC7685815, &H4A872C43, &H43C78EB4, &HF98FA730, &H3443C764, &HDB0C2E0D, &HA43843C7, &HC7BEFA4F, &H481D3C43, &H5D8B47B5, &H4C2C9FC, &H3E19E800, &H32050000, &H5500003E, &H5657E589, &H18EC8353, &H8908758B, &H6C6AE045, &HE856006A, &HFFFFDC82, &H83E0458B, &H6C70CC4
+    pvAppendBuffer &H6A09E667, &H850446C7, &H8BBB67AE, &HFF077480, &H846C7FF, &H3C6EF372, &H3A0C46C7, &HC7A54FF5, &H527F1046, &H46C7510E, &H5688C14, &H1846C79B, &H1F83D9AB, &H191C46C7, &H8B5BE0CD, &H26A0B8, &H75FF8500, &H89F88962, &H85A20FF9, &HB8487EC0, &H1&, &HA20FF989, &H89DC4D89, &HFF989F8, &H6F883A2, &H458B0D7F, &H9E8C1DC, &H8901E083, &HB824EBC7, &H7&, &HA20FF989, &H1DE3BA0F
+    pvAppendBuffer &H89E44589, &H5589EC4D, &HFDB73F0, &H13DC65BA, &H2BFD473, &H8B000000, &H8B47E045, &HFF077480, &HA0B889FF, &H8B000026, &H808BE045, &HFFFF0774, &H26A0808B, &H89480000, &H658D6846, &H5F5E5BF4, &H4C25D, &H83E58955, &H127430F8, &H7440F883, &H20F88315, &HE8521675, &HFFFFFEF9, &HE8520EEB, &HFFFFFE64, &HE85206EB, &HFFFFFDCF, &H8955C3C9, &H8B5657E5, &H558B0845, &HC758B10, &HC201C789
+    pvAppendBuffer &H374D739, &H5EF9EBA4, &H57C35D5F, &H8247C8D, &HFFF0E483, &H8955FC77, &H895657E5, &HC38953D6, &H8B2CEC83, &HD04D8907, &H8BCC4589, &H83388B03, &H7400CC7D, &H38B504D, &H89D8558D, &H5652D455, &HFF0473FF, &H4B8D0850, &H8B525208, &H8957D455, &HC84D89D0, &HFF5DBFE8, &H8B5151FF, &H5657C84D, &HE851FE01, &HFFFFFF86, &H571CC483, &HFFD475FF, &H77E8D075, &H1FFFFFF, &HC483D07D, &HCC4DFF10
+    pvAppendBuffer &H658DADEB, &H5F5E5BF4, &HF8678D5D, &H4C25F, &H4244C8D, &HFFF0E483, &HC889FC71, &H57E58955, &H83515356, &H118B28EC, &H8B08788B, &H408B0C58, &HC728B10, &H8904498B, &HEBC1D055, &HD4758904, &HFFD0758D, &H458D5032, &H1FE850D8, &H53FFFFFF, &HF089FA89, &HFFFF32E8, &HCC483FF, &H59F0658D, &H5D5F5E5B, &HC2FC618D, &H8D570014, &H8308247C, &H77FFF0E4, &HE58955FC, &H89535657, &H2CEC83C3
+    pvAppendBuffer &H4D89078B, &HD04589D4, &H308B038B, &HD07D83, &H8D563C74, &H458D087B, &H89F989D8, &H4589C855, &H5CF2E8CC, &H8B50FFFF, &HCC458B0B, &H73FF5057, &H451FF04, &H75FF5756, &HFEB0E8D4, &H558BFFFF, &HD47501C8, &HFF10C483, &HF201D04D, &H658DBEEB, &H5F5E5BF4, &HF8678D5D, &H4C25F, &H56E58955, &HD8458D53, &H83E85D8D, &H106A30EC, &HE850006A, &HFFFFDA06, &H75FF106A, &H6FE8530C, &H83FFFFFE
+    pvAppendBuffer &HC03118C4, &H8908758B, &H5FAC1C2, &H89960C8B, &HFD2F7C2, &H1473D1A3, &H758DD231, &H960C8BD8, &H89930C33, &H8342960C, &HEE7504FA, &H8BEC558B, &HC766E875, &HE100D645, &HC1D18940, &HE9D11FE6, &H91FE2C1, &HEC4D89F1, &H89F04D8B, &H1FE1C1CE, &HD609EED1, &H89F4558B, &HD689F075, &HD101E283, &H54B60FEE, &HCE09D615, &HC1E84D8B, &H758918E2, &H31E9D1F4, &HE85589CA, &H803D&, &H8D857500
+    pvAppendBuffer &H106AD845, &H1075FF50, &HFFFDE1E8, &HCC483FF, &H5BF8658D, &HCC25D5E, &H7C8D5700, &HE4830824, &HFC77FFF8, &H57E58955, &H8956D789, &H568D53C6, &H83CB894C, &H408B0CEC, &HEC55895C, &H4274C085, &H10B9&, &H39C12900, &HCB470FD9, &H5751D001, &HFD98E850, &H468BFFFF, &HCC4835C, &H4689C801, &HFF8835C, &H8B504E76, &HF089EC55, &H16ACF01, &H1B9CB29, &HE8000000, &HFFFFF7F5, &H4689C031
+    pvAppendBuffer &HFB83585C, &H521C760F, &HFA89D989, &H16AF089, &HE804E9C1, &HFFFFF7D9, &HE383D889, &HF0E0830F, &H50C70159, &H75FF5753, &HFD40E8EC, &H5E89FFFF, &H10C4835C, &H5BF4658D, &H8D5D5F5E, &HC35FF867, &HC0570F57, &H8247C8D, &HFFF0E483, &H8955FC77, &HE85657E5, &H3A2B&, &H3A34C681, &H89530000, &H81C789FB, &H17CEC, &H89038B00, &HFFFE788D, &HA08D8DFF, &HFFFFFFE, &HFEA08511, &H8589FFFF
+    pvAppendBuffer &HFFFFFE8C, &H8904438B, &HFFFE8885, &H8438BFF, &HFE948589, &H438BFFFF, &H8485890C, &H8BFFFFFE, &H85891043, &HFFFFFE80, &H8914438B, &HFFFE7C85, &HA4858DFF, &H6AFFFFFE, &HE850520C, &HFFFFFCAE, &HFF68858D, &H110FFFFF, &HFFFEC085, &H85110FFF, &HFFFFFED0, &H8357106A, &HE85010C7, &HFFFFFC8E, &HFF78858D, &H106AFFFF, &H7FE85057, &H8BFFFFFC, &HFF077486, &H24C483FF, &H294005, &H98458900
+    pvAppendBuffer &H6A88458D, &HC9315110, &HFC60E850, &H868BFFFF, &HFFFF0774, &H890CC483, &H45C7DC4D, &H4E0&, &H54B88300, &H29&, &H6CE81275, &H8BFFFFD7, &HFF077496, &H828940FF, &H2954&, &H774868B, &HEC83FFFF, &H68BD8D0C, &H8DFFFFFF, &HFFFF089D, &HE0B58DFF, &H8BFFFFFE, &H295480, &H45894800, &HC0858DE4, &H89FFFFFE, &HFFFE9085, &H89C289FF, &H6AF889C1, &HEFA8E820, &H5050FFFF, &H6A606A
+    pvAppendBuffer &HD774E853, &H858BFFFF, &HFFFFFE90, &HE820C483, &HFFFF4199, &HFFFFFF25, &H1C858903, &H8DFFFFFF, &HFFFEC385, &H4183E8FF, &HE8C1FFFF, &HFF032502, &H858903FF, &HFFFFFF20, &HFEC6858D, &H6AE8FFFF, &HC1FFFF41, &HFF2504E8, &H8903FFC0, &HFFFF2485, &HC9858DFF, &HE8FFFFFE, &HFFFF4151, &H2506E8C1, &H3F03FFF, &HFF288589, &H858DFFFF, &HFFFFFECC, &HFF4138E8, &H8E8C1FF, &HFFFFF25, &H2C858900
+    pvAppendBuffer &H52FFFFFF, &H6A286A, &HD6ECE856, &H958DFFFF, &HFFFFFF1C, &HD189F089, &HFF666EE8, &H8DF289FF, &HFFFF3085, &H682AE8FF, &HC483FFFF, &HD0858D0C, &H6AFFFFFE, &H858D5010, &HFFFFFF44, &HFB2CE850, &H858BFFFF, &HFFFFFE90, &H20BA&, &HD811E800, &H8D8BFFFF, &HFFFFFE90, &H202404C7, &H89000000, &HE8CA89F8, &HFFFFEEBA, &HFE90858B, &H20BAFFFF, &HF000000, &HC483C057, &HD7E5E80C, &H8D8BFFFF
+    pvAppendBuffer &HFFFFFE8C, &H958BD889, &HFFFFFE78, &HB085110F, &HE8FFFFFE, &HFFFFFD01, &HFE8C8D8B, &H958DFFFF, &HFFFFFEB0, &HD9F7D889, &HE80FE183, &HFFFFFCE9, &HFE80BD83, &H7501FFFF, &H88858B5B, &H8BFFFFFE, &HFFFE94B5, &H84BD8BFF, &H89FFFFFE, &HFFFE9085, &H74F685FF, &H800BB52, &H958B0000, &HFFFFFE90, &H858DF989, &HFFFFFF68, &H460FDE39, &HCEC83DE, &HE8DE2953, &HFFFFEE2A, &H858DFA89, &HFFFFFF08
+    pvAppendBuffer &HC483D989, &HE8DF010C, &HFFFFFC8D, &HFE909D01, &HBDEBFFFF, &HFE948D8B, &H958BFFFF, &HFFFFFE88, &H72E8D889, &H8BFFFFFC, &HFFFE948D, &HB09D8DFF, &H8DFFFFFE, &HFFFF08B5, &H89DA89FF, &H83D9F7F0, &H52E80FE1, &H8BFFFFFC, &HFFFE8C85, &H10B9FF, &HDA890000, &HFEB08589, &H858BFFFF, &HFFFFFE94, &HFEB88589, &HF089FFFF, &HFFFC2CE8, &H80BD83FF, &H1FFFFFE, &H958B1A75, &HFFFFFE7C, &H84E8F089
+    pvAppendBuffer &H8DFFFFF5, &HFFFF6885, &H80BAFF, &H6AEB0000, &HFEE09D8D, &HF089FFFF, &H68E8DA89, &H31FFFFF5, &H8BD231C0, &HFFFE7CBD, &H30C8DFF, &H348D098A, &HB60F4007, &H9F13136, &H10F883CA, &HD284E575, &HFF68B58D, &H3B75FFFF, &HFF0CEC83, &HFFFE94B5, &H848D8BFF, &H89FFFFFE, &H88958BF0, &HE8FFFFFE, &HFFFFED3E, &H80BA&, &H83F08900, &H70E80CC4, &HBAFFFFD6, &H10&, &H64E8D889, &H31FFFFD6
+    pvAppendBuffer &H8337EBC0, &HFFFE94BD, &H117400FF, &HFE94958B, &H858BFFFF, &HFFFFFE84, &HFFD646E8, &H80BAFF, &HF0890000, &HFFD63AE8, &HBAD889FF, &H10&, &HFFD62EE8, &H1B8FF, &H658D0000, &H5F5E5BF4, &HF8678D5D, &H18C25F, &H4244C8D, &HFFF0E483, &HC889FC71, &H57E58955, &H83515356, &H198B20EC, &H8B0C708B, &H518B1878, &HE45D8904, &H8910588B, &H708BE075, &H8498B14, &H6A1C70FF, &H53565701
+    pvAppendBuffer &H8BE075FF, &HB5E8E445, &H58FFFFFB, &HF0658D5A, &H5F5E5B59, &HFC618D5D, &H8D0020C2, &H8304244C, &H71FFF0E4, &HE58955FC, &H51535657, &H8B28EC83, &H1C518B01, &H8B0C598B, &H45891071, &H4418BD4, &H8914798B, &H4589C855, &H8418BD0, &H8BCC4589, &H4D8D1841, &H50106AD8, &HF890E851, &H558BFFFF, &HCEC83C8, &H51D4458B, &H6ACC4D8B, &H558B5200, &H535657D0, &HFFFB47E8, &HF0658DFF, &H5F5E5B59
+    pvAppendBuffer &HFC618D5D, &H8D0020C2, &H8304244C, &H71FFF0E4, &H55C889FC, &H5657E589, &HC09D8D53, &H51FFFFFD, &H24CEC81, &H798B0000, &H8B318B04, &HBD890851, &HFFFFFDB0, &H8910798B, &HFFFDB4B5, &HC718BFF, &HFDE48D8D, &H9589FFFF, &HFFFFFDAC, &HFDBC958D, &H70FFFFFF, &H57D88914, &HF0B4E851, &H858BFFFF, &HFFFFFDBC, &HFDCC9D89, &H9D8DFFFF, &HFFFFFDCC, &HFDD08589, &H858DFFFF, &HFFFFFDD4, &HFDC0B5FF
+    pvAppendBuffer &H5056FFFF, &HFFF7E5E8, &HAC858BFF, &H8BFFFFFD, &HFFFDB48D, &HB0958BFF, &HC1FFFFFD, &H48904E8, &HE8D88924, &HFFFFF8C2, &H8D0CC483, &H5B59F065, &H8D5D5F5E, &H18C2FC61, &H244C8D00, &HF0E48304, &H89FC71FF, &HE58955C8, &H51535657, &H8B28EC83, &H8788B11, &H8B0C588B, &H728B1040, &H4498B0C, &HC1D05589, &H758904EB, &HD0758DD4, &H8D5032FF, &HE850D845, &HFFFFF776, &H89FA8953, &HF868E8F0
+    pvAppendBuffer &HC483FFFF, &HF0658D0C, &H5F5E5B59, &HFC618D5D, &H8D0014C2, &H8304244C, &H71FFF0E4, &H55C889FC, &H5657E589, &HC09D8D53, &H51FFFFFD, &H24CEC81, &H798B0000, &H8B318B04, &HBD890851, &HFFFFFDB0, &H8910798B, &HFFFDB4B5, &HC718BFF, &HFDE48D8D, &H9589FFFF, &HFFFFFDAC, &HFDBC958D, &H70FFFFFF, &H57D88914, &HEFA8E851, &H858BFFFF, &HFFFFFDBC, &HFDCC9D89, &H9D8DFFFF, &HFFFFFDCC, &HFDD08589
+    pvAppendBuffer &H858DFFFF, &HFFFFFDD4, &HFDC0B5FF, &H5056FFFF, &HFFF6D9E8, &HAC858BFF, &H8BFFFFFD, &HFFFDB48D, &HB0958BFF, &HC1FFFFFD, &H48904E8, &HE8D88924, &HFFFFF6D7, &H8D0CC483, &H5B59F065, &H8D5D5F5E, &H18C2FC61, &H244C8D00, &HF0E48304, &H55FC71FF, &H5657E589, &HEC835153, &H8B018B28, &H798B0471, &H10598B0C, &H8BDC4589, &H45890841, &H14418BE4, &H8BD44589, &H45891841, &H1C418BD0, &H8BD84589
+    pvAppendBuffer &H74C08506, &H74DB8572, &HE4558B6E, &HDA39C229, &H89D3470F, &H8B52E055, &H157DC55, &H4BE850D0, &H8BFFFFF6, &H558BE045, &HCC483E4, &H603C329, &HD0390689, &HDB852475, &H50500D75, &HFFD0458B, &H75FFDC75, &H500BEBD8, &HD4458B50, &HFFDC75FF, &HD0FFD875, &H5A58C931, &H458B0E89, &HEBC701E0, &H501D7516, &HD0458B50, &HD875FF57, &H5859D0FF, &H1E4458B, &H8BC329C7, &HC339E445, &HBEBE373
+    pvAppendBuffer &H458B5050, &H75FF57D4, &H85E1EBD8, &H8B2574DB, &HE44D8B06, &HDC558B52, &HD939C129, &H1CB470F, &HCB2951D0, &H50CF0157, &HFFF5C1E8, &H830E01FF, &HD7EB10C4, &H59F0658D, &H5D5F5E5B, &HC2FC618D, &HB0E80020, &H81000032, &H32C5C2, &H244C8D00, &HF0E48304, &H55FC71FF, &H5153E589, &H928D018B, &HFFFF5752, &H8B04598B, &H52500849, &H64508D52, &H5120C083, &H52406A53, &HFEC7E850, &H658DFFFF
+    pvAppendBuffer &H5D5B59F8, &HC2FC618D, &H8D57000C, &H8308247C, &H77FFF0E4, &HE58955FC, &HD6895657, &H2CEC8353, &H8BD44589, &H45F8B07, &HC6087F8B, &HC600E745, &H8380E645, &H1D7401F8, &H7502F883, &HE6458D23, &H6A535357, &H89515001, &HFF52D04D, &H72E8D475, &HEBFFFFFE, &HE6458D42, &H6A535357, &H43EB5001, &H89E6558D, &H5357CC45, &H52016A53, &HD04D8951, &HD475FF56, &HFFFE4CE8, &HE77D80FF, &HD04D8B00
+    pvAppendBuffer &H74CC458B, &H2E8832A, &H53F28957, &HD4458B50, &H83E8006A, &H8DFFFFD0, &H8B57E745, &H5353D04D, &H5150016A, &HD475FF56, &HFFFE18E8, &H4810EBFF, &H53F28957, &HD4458B50, &H5BE8006A, &H8DFFFFD0, &H5E5BF465, &H678D5D5F, &HCC25FF8, &H244C8D00, &HF0E48304, &H71FFD231, &HE58955FC, &HA0E85657, &H81000031, &H31A9C6, &H83515300, &H198B2CEC, &H8B04798B, &H8E8D6043, &HFFFF5752, &H6C2A40F
+    pvAppendBuffer &H8906E0C1, &H438BD045, &HD4558964, &H4589D231, &HD0458BC8, &H89C84503, &H4589CC55, &HD0758BD0, &H8B20438D, &H5513D455, &H8C683CC, &H8DD45589, &H83536453, &HB9513FE6, &H40&, &HB951F129, &H40&, &HFFFEC1E8, &HD0458BFF, &H8DD4558B, &HF5EE04D, &HC103C2A4, &HA1E803E0, &H50FFFF39, &H5351086A, &HFFFE59E8, &H58FA89FF, &HB0E8038B, &H8BFFFF39, &H578D0443, &H39A5E804, &H438BFFFF
+    pvAppendBuffer &H8578D08, &HFF399AE8, &HC438BFF, &HE80C578D, &HFFFF398F, &H8D10438B, &H84E81057, &H8BFFFF39, &H578D1443, &H3979E814, &H438BFFFF, &H18578D18, &HFF396EE8, &H1C438BFF, &HE81C578D, &HFFFF3963, &H6A6C6A50, &H2FE85300, &H83FFFFCF, &H658D10C4, &H5E5B59F0, &H618D5D5F, &H8C2FC, &H247C8D57, &HF0E48308, &H55FC77FF, &HE857E589, &H3097&, &H309CC781, &H89560000, &HC38953CE, &H8314C083
+    pvAppendBuffer &H45891CEC, &H83038BE4, &H110B8, &H7D890000, &HFD789E0, &H8C84&, &H24438B00, &H3F74C085, &H10B9&, &H39C12900, &HCE470FF1, &H558B5251, &H50D001E4, &HFFF335E8, &H24438BFF, &H10CC483, &H244389C8, &H760FF883, &H29CF0178, &HFF5151CE, &HE853E475, &HFFFF6803, &H4389C031, &H835A5824, &H2E760FFE, &H508D038B, &H90888D10, &H8D000000, &H45890443, &H895050E0, &H4E8C1F0, &H458B5750
+    pvAppendBuffer &H7F8FE8E0, &HF089FFFF, &H830FE683, &HC701F0E0, &H56505A58, &HE475FF57, &HFFF2D1E8, &H247389FF, &HEB10C483, &H458B531C, &H24C383E0, &H37CF808D, &H5050FFFF, &H106A5251, &HE475FF53, &HFFFC04E8, &HF4658DFF, &H5D5F5E5B, &H5FF8678D, &HE58955C3, &H53D78957, &HE483C389, &H10EC83F0, &H1387883, &H4C891475, &H28E80C24, &HC7FFFFCF, &H23843, &H4C8B0000, &HD2310C24, &H89304B01, &H345311D8
+    pvAppendBuffer &HD5E8FA89, &H8DFFFFFE, &H5F5BF865, &H8955C35D, &H895657E5, &HC38953D6, &H83F0E483, &H408B10EC, &HF8834838, &H890C7701, &HE8FF31D8, &HFFFFCEE3, &H8B387B89, &H538B2843, &H247C8D2C, &HFF98908, &HC103C2A4, &HB5E803E0, &H89FFFF37, &HB9D889FA, &H8&, &HFFFE83E8, &H30438BFF, &H8934538B, &HC2A40FF9, &H3E0C103, &HFF3793E8, &H89FA89FF, &H8B9D8, &H61E80000, &H8BFFFFFE, &HF2890443
+    pvAppendBuffer &HFF379EE8, &H8438BFF, &HE804568D, &HFFFF3793, &H8D0C438B, &H88E80856, &H8BFFFF37, &H568D1043, &H377DE80C, &H658DFFFF, &H5F5E5BF4, &H8D57C35D, &H8308247C, &H77FFF0E4, &HE58955FC, &HC0E85657, &H8100002E, &H2EC9C6, &HFB895300, &HECEC81, &H85890000, &HFFFFFF24, &H8D89078B, &HFFFFFF2C, &H89104F8B, &HFFFF3485, &H4478BFF, &HFF208D89, &H4B8BFFFF, &H2885891C, &H8BFFFFFF, &H95890847
+    pvAppendBuffer &HFFFFFF1C, &HFF308589, &H478BFFFF, &H148D890C, &H89FFFFFF, &HFFFF1885, &H14478BFF, &H6A187F8B, &H858D500C, &HFFFFFF44, &HF140E850, &H458DFFFF, &H5085C7A8, &HFFFFFF, &H6A010000, &H50006A40, &HFFCCB5E8, &H34958BFF, &H83FFFFFF, &H858B18C4, &HFFFFFF34, &H1E045C7, &H8B000000, &HFFFF208D, &H10BA83FF, &H1&, &H8DA84589, &HFF473486, &H8D0675FF, &HFFC45086, &H1D231FF, &H9D8DD04D
+    pvAppendBuffer &HFFFFFF74, &H8BD45511, &HFFFF1895, &HE44589FF, &H89A8458D, &HFFFF2085, &HFD3EE8FF, &H570FFFFF, &H85110FC0, &HFFFFFF54, &H6A346A50, &H47E85300, &H31FFFFCC, &H24B58BC0, &H83FFFFFF, &H45890CC4, &H24858BA0, &H31FFFFFF, &H74B589D2, &H8BFFFFFF, &HFFFF1CB5, &H89008BFF, &HB5899C55, &HFFFFFF78, &HFF7CB58D, &H4589FFFF, &H858D50A4, &HFFFFFF44, &H77E85650, &HC7FFFFF0, &HCA045, &H958D0000
+    pvAppendBuffer &HFFFFFF54, &H45C7D889, &H4A4&, &HC7D18900, &H102404, &HE0E80000, &H83FFFF64, &HBD830CC4, &HFFFFFF2C, &H8B5F7400, &HFFFF3485, &H10B883FF, &H1&, &H9D8B5074, &HFFFFFF30, &HFF20858B, &HC931FFFF, &H82E8FA89, &H83FFFFFD, &H958BC0E3, &HFFFFFF34, &H89AC4D8D, &H4E8C1D8, &H2C858B50, &H57FFFFFF, &HFF28B5FF, &HE856FFFF, &HFFFF8DAA, &H5D01D231, &HDC5511D8, &H9D01DF01, &HFFFFFF28
+    pvAppendBuffer &HFF309D29, &H858DFFFF, &HFFFFFF74, &H89A85D8D, &HFFFF3485, &H8B5252FF, &HFFFF288D, &H30B5FFFF, &H8BFFFFFF, &HFFFF2C95, &H24E857FF, &H89FFFF77, &H8DD889FA, &HFFFF54BD, &H8D8B59FF, &HFFFFFF30, &H64B58D5E, &HE8FFFFFF, &HFFFFFD01, &HD889F289, &HFC0570F, &HFF648511, &H2FE8FFFF, &H83FFFFFD, &H858B0CEC, &HFFFFFF14, &H106AF989, &HA5E8F289, &H8DFFFF4D, &HFFFF4485, &H10BAFF, &HC4830000
+    pvAppendBuffer &HCC5DE80C, &HF889FFFF, &H10BA&, &HCC51E800, &HF089FFFF, &H10BA&, &HCC45E800, &HD889FFFF, &H40BA&, &HCC39E800, &H858BFFFF, &HFFFFFF34, &H34BA&, &HCC29E800, &H658DFFFF, &H5F5E5BF4, &HF8678D5D, &H20C25F, &H4244C8D, &HFF0E483, &H71FFC057, &HE58955FC, &HBD8D5657, &HFFFFFDE4, &HFCB4B58D, &H8D53FFFF, &HFFFCB095, &HC09D8DFF, &H51FFFFFC, &H37CEC81, &H18B0000, &HC085110F
+    pvAppendBuffer &H89FFFFFC, &HFFFCA4BD, &H9C8589FF, &H8BFFFFFC, &HB5890441, &HFFFFFCA0, &HFC988589, &H418BFFFF, &H94858908, &H8BFFFFFC, &H85890C41, &HFFFFFC90, &H8910418B, &HFFFC8C85, &H14418BFF, &HFC888589, &H418BFFFF, &H84858918, &H8BFFFFFC, &H71FF1C41, &H50F98920, &HB58DF089, &HFFFFFCD0, &HE730E857, &HBD8BFFFF, &HFFFFFCB0, &HFC808589, &H5353FFFF, &HB895FF57, &H89FFFFFC, &HF08958DA, &HFFE7EEE8
+    pvAppendBuffer &H98B5FFFF, &H8BFFFFFC, &HFFFC808D, &H8BFA89FF, &HFFFCA085, &H9CB5FFFF, &HFFFFFFFC, &HFFFC84B5, &H88B5FFFF, &HFFFFFFFC, &HFFFC8CB5, &H90B5FFFF, &HFFFFFFFC, &HFFFC94B5, &H6FE856FF, &H89FFFFFC, &H10BAD8, &H18E80000, &H89FFFFCB, &H114BAF0, &HCE80000, &H8BFFFFCB, &HFFFCA485, &H204BAFF, &HFCE80000, &H8DFFFFCA, &H5B59F065, &H8D5D5F5E, &H24C2FC61, &H244C8D00, &HF0E48304, &H89FC71FF
+    pvAppendBuffer &HE58955C8, &H51535657, &H8B18EC83, &H518B0C71, &H8B198B10, &H75890479, &H14718BE4, &H8BE05589, &H75891851, &H1C718BDC, &H8BD85589, &H2148B, &HC538B00, &H8D0870FF, &H21883, &HFF565700, &H75FFD875, &HE075FFDC, &H50E475FF, &HDBE8D889, &H8DFFFFFB, &H5B59F065, &H8D5D5F5E, &H20C2FC61, &H7C8D5700, &HE4830824, &HFC77FFF0, &H57E58955, &H2A8DE856, &HC6810000, &H2A96&, &H89FB8953
+    pvAppendBuffer &HECEC81C7, &H8B000000, &H8D890443, &HFFFFFF24, &H89104B8B, &HFFFF3095, &H2C8589FF, &H8BFFFFFF, &H138B0843, &HFF348D89, &H8589FFFF, &HFFFFFF28, &H8B0C438B, &H9589184B, &HFFFFFF14, &HFF208589, &H438BFFFF, &H1C5B8B14, &HFF1C8D89, &H9D89FFFF, &HFFFFFF18, &H8D500C6A, &HFFFF4485, &HBE850FF, &H8DFFFFED, &H85C7A845, &HFFFFFF50, &H1000000, &H6A406A, &HC880E850, &H958BFFFF, &HFFFFFF14
+    pvAppendBuffer &HC718C483, &H1E045, &H8D8B0000, &HFFFFFF34, &H4734868D, &HBA83FFFF, &H110&, &HA8558900, &H868D0675, &HFFFFC450, &H4D01D231, &H749D8DD0, &H11FFFFFF, &H958BD455, &HFFFFFF20, &H8DE44589, &H8589A845, &HFFFFFF34, &HFFF90FE8, &HC0570FFF, &H5485110F, &H56FFFFFF, &H6A346A, &HC818E853, &HC031FFFF, &HFF30B58B, &HC483FFFF, &HA045890C, &HD231078B, &HFF78B589, &HB58DFFFF, &HFFFFFF44
+    pvAppendBuffer &H89A44589, &HBD899C55, &HFFFFFF74, &H7C858D50, &H56FFFFFF, &HEC54E850, &H858DFFFF, &HFFFFFF54, &HCA045C7, &H89000000, &HFFFF3085, &H89C189FF, &HC7D889C2, &H4A445, &H9D8D0000, &HFFFFFF64, &H102404C7, &HE8000000, &HFFFF60AF, &HFF288D8B, &H958BFFFF, &HFFFFFF2C, &HFF34858B, &HC483FFFF, &HF967E80C, &H858BFFFF, &HFFFFFF34, &H9BE8DA89, &H83FFFFF9, &H8D8B0CEC, &HFFFFFF30, &H106ADA89
+    pvAppendBuffer &H11E8D889, &H31FFFF4A, &H83D231C0, &HBD8B0CC4, &HFFFFFF1C, &H8A030C8D, &H40C70109, &H313FB60F, &H83CA09F9, &HE67510F8, &H1BB&, &H75D28400, &H858D5229, &HFFFFFF74, &H2C8D8B52, &HFFFFFFFF, &HFFFF28B5, &H24958BFF, &HFFFFFFFF, &HFFFF18B5, &H72FDE8FF, &H5B59FFFF, &HF089DB31, &H10BA&, &HC87DE800, &H858BFFFF, &HFFFFFF30, &H10BA&, &HC86DE800, &H858DFFFF, &HFFFFFF64, &H10BA&
+    pvAppendBuffer &HC85DE800, &H858BFFFF, &HFFFFFF34, &H40BA&, &HC84DE800, &H858DFFFF, &HFFFFFF74, &H34BA&, &HC83DE800, &H658DFFFF, &H5BD889F4, &H8D5D5F5E, &HC25FF867, &H4C8D0020, &HE4830424, &HC0570FF0, &H55FC71FF, &H5657E589, &HFDE4B58D, &H958DFFFF, &HFFFFFCB0, &HB49D8D53, &H51FFFFFC, &H37CEC81, &H18B0000, &HC085110F, &H89FFFFFC, &HFFFCA4B5, &H9C8589FF, &H8BFFFFFC, &H9D890441, &HFFFFFCA0
+    pvAppendBuffer &HFC988589, &H418BFFFF, &H94858908, &H8BFFFFFC, &H85890C41, &HFFFFFC90, &H8910418B, &HFFFC8C85, &H14418BFF, &HFC888589, &H418BFFFF, &H84858918, &H8BFFFFFC, &H71FF1C41, &H50F18920, &H9D8DD889, &HFFFFFCC0, &HD0B58D56, &HE8FFFFFC, &HFFFFE342, &HFCB0BD8B, &H8589FFFF, &HFFFFFC80, &HFF575353, &HFFFCB895, &H58DA89FF, &HE8F089, &HFFFFFFE4, &HFFFC9CB5, &H808D8BFF, &H89FFFFFC, &HA0858BFA
+    pvAppendBuffer &HFFFFFFFC, &HFFFC90B5, &H84B5FFFF, &HFFFFFFFC, &HFFFC88B5, &H8CB5FFFF, &HFFFFFFFC, &HFFFC94B5, &H98B5FFFF, &H56FFFFFC, &HFFFCB4E8, &H10BAFF, &HC7890000, &H28E8D889, &H89FFFFC7, &H114BAF0, &H1CE80000, &H8BFFFFC7, &HFFFCA485, &H204BAFF, &HCE80000, &H8DFFFFC7, &HF889F065, &H5F5E5B59, &HFC618D5D, &H8D0024C2, &H8304244C, &H71FFF0E4, &H55C889FC, &H5657E589, &HEC835153, &H8718B18
+    pvAppendBuffer &H8B0C798B, &H14518B19, &H8BE47589, &H7D891871, &H10798BE0, &H8BD87589, &H55891C71, &H148B8BDC, &H8B000002, &H70FF0C53, &H18838D04, &H57000002, &HD875FF56, &HFFDC75FF, &H75FFE075, &HD88950E4, &HFFFC1CE8, &HF0658DFF, &H5F5E5B59, &HFC618D5D, &HE80020C2, &H269F&, &H26B4C281, &H4C8D0000, &HE4830424, &HFC71FFF0, &H53E58955, &H8D018B51, &HFF21C292, &H4598BFF, &H5008498B, &H908D5252
+    pvAppendBuffer &HC4&, &H5140C083, &H806853, &H50520000, &HFFF2B0E8, &HF8658DFF, &H8D5D5B59, &HCC2FC61, &H244C8D00, &HF0E48304, &H71FFD231, &HE58955FC, &H4CE85657, &H81000026, &H2655C6, &H83515300, &H198B2CEC, &H8B04798B, &HC083&, &HC28E8D00, &HFFFFF21, &HC107C2A4, &H458907E0, &HC4838BD0, &H89000000, &HD231D455, &H8BC84589, &H4503D045, &HCC5589C8, &H8BD04589, &H438DD075, &HD4558B40
+    pvAppendBuffer &H83CC5513, &H558910C6, &HC4938DD4, &H53000000, &H517FE683, &H80B9&, &H8DF12900, &HB951E075, &H80&, &HFFF361E8, &H31F189FF, &HC03158D2, &HFF2E4BE8, &H86A50FF, &H14E85356, &H8BFFFFFF, &H558BD045, &HF18959D4, &H3C2A40F, &HE803E0C1, &HFFFF2E2C, &H56086A50, &HFEF5E853, &H38BFFFF, &H5904538B, &H15E8F989, &H8BFFFF2E, &H538B0843, &H84F8D0C, &HFF2E07E8, &H10438BFF, &H8D14538B
+    pvAppendBuffer &HF9E8104F, &H8BFFFF2D, &H538B1843, &H184F8D1C, &HFF2DEBE8, &H20438BFF, &H8D24538B, &HDDE8204F, &H8BFFFF2D, &H538B2843, &H284F8D2C, &HFF2DCFE8, &H30438BFF, &H8D34538B, &HC1E8304F, &H8BFFFF2D, &H538B3843, &H384F8D3C, &HFF2DB3E8, &HC86856FF, &H6A000000, &H9FE85300, &H83FFFFC3, &H658D10C4, &H5E5B59F0, &H618D5D5F, &H8C2FC, &H4244C8D, &HFFF0E483, &H8955FC71, &H8D5356E5, &H8351A85D
+    pvAppendBuffer &H718B54EC, &H31FF5304, &HFFFE94E8, &HCEC83FF, &H5653306A, &HFFE7D5E8, &H20C483FF, &H59F4658D, &H8D5D5E5B, &H8C2FC61, &H7C8D5700, &HE4830824, &HFC77FFF0, &H57E58955, &H30F88353, &HF8831574, &H831B7440, &H217520F8, &H52515050, &HFFF2FCE8, &H5714EBFF, &HE8525157, &HFFFFFF90, &H535309EB, &H3AE85251, &H58FFFFFE, &HF8658D5A, &H8D5D5F5B, &HC35FF867, &H4244C8D, &HFFF0E483, &H8955FC71
+    pvAppendBuffer &HEC8351E5, &H4418B08, &H500871FF, &HC0E831FF, &H8BFFFFFD, &HC95AFC4D, &HC2FC618D, &H8D57000C, &H8308247C, &H77FFF0E4, &HE58955FC, &HC3895357, &H178BD089, &H83D07B8D, &H1074EFE7, &H7520FB83, &H51525715, &HF178E850, &H9EBFFFF, &H50515253, &HFFFD7EE8, &H658D58FF, &H5D5F5BF8, &H5FF8678D, &H570004C2, &H8247C8D, &HFFF0E483, &H8955FC77, &H8D5657E5, &HFFFF20BD, &HC8B08DFF, &H53000000
+    pvAppendBuffer &HEC81C389, &H12C&, &HFED48D89, &H808BFFFF, &H190&, &H32B9&, &H8DA5F300, &HFFFEE0BD, &H20B58DFF, &H89FFFFFF, &HFEFBE8F9, &H838BFFFF, &H190&, &H890CEC83, &H50F289F9, &HFFFF5DE8, &H90838BFF, &H8B000001, &HFFFED48D, &H83F289FF, &HD2E80CC4, &H8DFFFFFE, &H5E5BF465, &H678D5D5F, &H8DC35FF8, &H8304244C, &H71FFF0E4, &H55C889FC, &H5657E589, &HEC815153, &HF4&, &H798B198B
+    pvAppendBuffer &H4518B0C, &H32B9&, &H14BD8900, &H89FFFFFF, &H20BD8DDE, &HF3FFFFFF, &H90BB8BA5, &HFF000001, &HD1890870, &HFF20B58D, &HF289FFFF, &HEBE8F889, &H8BFFFFFE, &HFFFF148D, &H89F289FF, &HCC483D8, &HFFFF1EE8, &HF0658DFF, &H5F5E5B59, &HFC618D5D, &H8D0010C2, &H8304244C, &H71FFF0E4, &HE58955FC, &H51535657, &H98EC81, &H18B0000, &H890C798B, &HFFFF6085, &H4418BFF, &HFF648589, &H418BFFFF
+    pvAppendBuffer &H5C858908, &H8BFFFFFF, &HFFFF6485, &H30E883FF, &H74EFE083, &H83C03116, &HFFFF64BD, &H40BB20FF, &HF000000, &H12885, &HBB05EB00, &H80&, &HFF60858B, &H958BFFFF, &HFFFFFF64, &HFF68B58D, &H9089FFFF, &H190&, &H8068&, &H56006A00, &HFFC125E8, &HCC483FF, &H4473FB39, &HFF60958B, &H858BFFFF, &HFFFFFF64, &HFFE557E8, &HCEC83FF, &HFF5C8D8B, &H958BFFFF, &HFFFFFF60, &H64858B57
+    pvAppendBuffer &HE8FFFFFF, &HFFFFFE16, &HFF60958B, &H858BFFFF, &HFFFFFF64, &HC483F189, &HFD8BE80C, &H15EBFFFF, &H1174FF85, &HB5FF5752, &HFFFFFF5C, &HE53CE856, &HC483FFFF, &H68B58D10, &H89FFFFFF, &HFFFF5CB5, &H1E3C8DFF, &H3080F089, &HF8394036, &H958BF875, &HFFFFFF60, &HFF64858B, &HE5E8FFFF, &H83FFFFE4, &H958B0CEC, &HFFFFFF60, &HFF64858B, &H8D53FFFF, &HFFFF688D, &HFDA4E8FF, &HC483FFFF, &H6A36800C
+    pvAppendBuffer &H75F73946, &H60B58BF8, &H8BFFFFFF, &HFFFF6485, &HC8C681FF, &H89000000, &HE4A6E8F2, &HEC83FFFF, &H64858B0C, &H89FFFFFF, &H8D8B53F2, &HFFFFFF5C, &HFFFD69E8, &H685050FF, &H80&, &HB5FF006A, &HFFFFFF5C, &HFFC031E8, &H20C483FF, &H1B8&, &HF0658D00, &H5F5E5B59, &HFC618D5D, &HE80010C2, &H218F&, &H21A805, &H244C8D00, &HF0E48304, &H55FC71FF, &H5657E589, &HEC815153, &H2D8&
+    pvAppendBuffer &HFD248589, &H18BFFFF, &H8B04598B, &H85890871, &HFFFFFD34, &H890C418B, &HFFFD2085, &H10418BFF, &HFD2C8589, &H418BFFFF, &H2CBD8114, &HF9FFFFFD, &H89000000, &HFFFD1C85, &H18418BFF, &HFD288589, &H418BFFFF, &H1885891C, &H8BFFFFFD, &H85892041, &HFFFFFD30, &HBD810C77, &HFFFFFD28, &HFF&, &HC0310776, &H1E1E9, &H34856900, &HFFFFFFFD, &HBA000000, &HFFFF&, &HFD30BD8B, &HD039FFFF
+    pvAppendBuffer &H39C2470F, &H8DDB72F8, &HFFFE5085, &HFF5356FF, &HFFFD34B5, &HB8E850FF, &H85FFFFFD, &H8BC374C0, &HFFFD3085, &H86DB31FF, &H858966E0, &HFFFFFD45, &HFD2C858A, &HC083FFFF, &H47858806, &H8AFFFFFD, &HFFFD2885, &H448588FF, &HB0FFFFFD, &H43858801, &H8BFFFFFD, &HFFFD3085, &H50B58DFF, &H39FFFFFE, &H3A830FC3, &H8D000001, &HFFFD88BD, &H32B9FF, &HA5F30000, &H2374DB85, &HFF0CEC83, &HFFFD34B5
+    pvAppendBuffer &H34858BFF, &H8DFFFFFD, &HFFFD488D, &H88958DFF, &HE8FFFFFD, &HFFFFFC06, &H830CC483, &HB58D0CEC, &HFFFFFD88, &HFD34858B, &H8D8DFFFF, &HFFFFFD45, &HF289036A, &HFD48BD8D, &HDFE8FFFF, &H8BFFFFFB, &HFFFD2485, &H8BF289FF, &HFF077488, &H34858BFF, &H6AFFFFFD, &H28C18106, &HE8000029, &HFFFFFBBE, &HFD2CB5FF, &H8D8BFFFF, &HFFFFFD20, &H858BF289, &HFFFFFD34, &HFFFBA5E8, &H34858BFF, &H89FFFFFD
+    pvAppendBuffer &H448D8DF2, &H6AFFFFFD, &HFB90E801, &HB5FFFFFF, &HFFFFFD28, &HFD1C8D8B, &HF289FFFF, &HFD34858B, &H77E8FFFF, &H8BFFFFFB, &HFFFD3485, &H8DF289FF, &HFFFD438D, &HE8016AFF, &HFFFFFB62, &H858DF289, &HFFFFFE50, &HC483F989, &HFB95E80C, &H958BFFFF, &HFFFFFD30, &HFD18858B, &HB58BFFFF, &HFFFFFD34, &HD801DA29, &H1473F239, &H50575251, &HFFE27DE8, &H309D8BFF, &H83FFFFFD, &H19EB10C4, &H34B5FF52
+    pvAppendBuffer &H57FFFFFD, &HE264E850, &H858BFFFF, &HFFFFFD34, &H110C483, &H43858AC3, &H40FFFFFD, &HFFFEACE9, &H986850FF, &H6A000001, &HCBE85600, &H83FFFFBD, &H858D0CC4, &HFFFFFD48, &H6A406A, &HBDB8E850, &HC483FFFF, &H1B810, &H658D0000, &H5E5B59F0, &H618D5D5F, &H24C2FC, &H8BE58955, &H558B0845, &H74C0850C, &H74D28510, &H89C2010C, &H1C640C1, &H75C23900, &H8C25DF6, &H7C8D5700, &HE4830824
+    pvAppendBuffer &HFC77FFF0, &H57E58955, &H1EF5E856, &HC6810000, &H1EFE&, &HCEC8353, &H8504508B, &H892574D2, &H8B5050C3, &H4E0C103, &HA9E85250, &H8BFFFFFF, &HFF077486, &H73FF52FF, &H850FF04, &H4B89C931, &HCC48304, &H5BF4658D, &H8D5D5F5E, &HC35FF867, &H247C8D57, &HF0E48308, &H55FC77FF, &H5657E589, &H1E9EE8, &HA7C68100, &H5300001E, &HC789FB89, &H8B38EC83, &HE4558903, &H89D44D89, &H7589CC45
+    pvAppendBuffer &HDC458BDC, &H808B328B, &HFFFF0774, &HB51C8D, &H89000000, &HFF53D05D, &HE4558B10, &HC483C389, &H39C0310C, &H8B0D7DF0, &H8BC1290A, &HC898A0C, &HEFEB4083, &H4589078B, &H7CC639E4, &H1468D06, &H8BE44589, &H558BDC45, &HCEC83E4, &H774808B, &HC8DFFFF, &H95&, &HD84D8900, &H8910FF51, &HC483E045, &H39C0310C, &HB7EE445, &H31E04D8B, &H811489D2, &H8BF0EB40, &H4D8BE045, &H8148DD8
+    pvAppendBuffer &H1B8&, &H4EA8300, &H87C0739, &H40870C8B, &HF1EB0A89, &HD089138B, &HE8C85589, &HFFFF5D70, &H85C8558B, &H74C789C0, &HD3C18917, &H1FE83E2, &H20B90E7E, &H29000000, &H4438BC1, &HC209E8D3, &H7EE8D089, &H57FFFF5D, &HFF50D989, &H8B56CC75, &H458BE455, &H5E41E8E0, &H7D83FFFF, &H267400D4, &HBAE4458B, &H1&, &H3114EB48, &H78C085C9, &HE0758B06, &H8B860C8B, &H8948D47D, &H8B42970C
+    pvAppendBuffer &H1639D475, &H5050E57D, &H53D075FF, &HFFFE47E8, &HDC458BFF, &H774808B, &H5352FFFF, &H830850FF, &H75FF0CEC, &HE075FFD8, &HFFFE2BE8, &HDC458BFF, &H8B0CC483, &HFF077480, &HE075FFFF, &H8D0850FF, &H5E5BF465, &H678D5D5F, &H4C25FF8, &HE5895500, &H8B08558B, &H1F88302, &H3C830B76, &H5750082, &HEB028948, &H4C25DEE, &H1D05E800, &H1E050000, &H8D00001D, &H8304244C, &H71FFF0E4, &HE58955FC
+    pvAppendBuffer &H198B5153, &H774808B, &H138BFFFF, &H8D0CEC83, &H49514, &HFF520000, &H50C18910, &H8D038B50, &H48504, &H53500000, &HDFC0E851, &H658DFFFF, &H59C889F8, &H618D5D5B, &H4C2FC, &H4244C8D, &HFFF0E483, &H8955FC71, &HB4E856E5, &H8100001C, &H1CBDC6, &H83515300, &H198B14EC, &H48D038B, &H485&, &HE8535000, &HFFFFFD6C, &H774868B, &H5352FFFF, &H830850FF, &H658D0CC4, &H5E5B59F4
+    pvAppendBuffer &HFC618D5D, &H8D0004C2, &H8304244C, &H71FFF0E4, &HE58955FC, &H1C69E856, &HC6810000, &H1C72&, &HEC835153, &H85198B0C, &H8B840FDB, &H8D000000, &H42E80843, &H8DFFFFFD, &H3AE81C43, &H8BFFFFFD, &HC0853043, &HEC830C74, &H6DE8500C, &H83FFFFFF, &H438B0CC4, &H74C08534, &HCEC830C, &HFF5AE850, &HC483FFFF, &H40538B0C, &H1F74D285, &H438B5151, &H2E0C144, &HDDE85250, &H8BFFFFFC, &HFF077486
+    pvAppendBuffer &H73FF52FF, &H850FF40, &H8B0CC483, &HC0850443, &H968B1074, &HFFFF0774, &H500CEC83, &H830852FF, &H50500CC4, &HE853486A, &HFFFFFCAC, &H774868B, &H5352FFFF, &H830850FF, &H658D0CC4, &H5E5B59F4, &HFC618D5D, &HE80004C2, &H1BA7&, &H1BC005, &H244C8D00, &HF0E48304, &H55FC71FF, &H5657E589, &HEC835153, &H8598B44, &H4589398B, &H4718BE4, &H4589038B, &HE4458BE0, &H8BE04D8B, &HFF077480
+    pvAppendBuffer &H2E1C1FF, &H51C44D89, &H458910FF, &HCC483DC, &H4D8BC031, &H7DC839E0, &H8B138B10, &HC229DC4D, &H8993148B, &HEB408114, &H8B068BE9, &HFC3391F, &H48DD842, &H7FC8391B, &HE0458B0E, &H2B9&, &HF9F79900, &H8B01588D, &HC8DE445, &H9D&, &HCEC8300, &H774808B, &H4D89FFFF, &H10FF51CC, &H172BDA89, &H83D84589, &HC0310CC4, &HD7DD039, &HC7D84D8B, &H8104&, &HEB400000, &HD8458BEF
+    pvAppendBuffer &H31900C8D, &H39178BC0, &H290B7EC2, &H97148BC2, &H40811489, &H458BEFEB, &HCEC83E4, &H774808B, &H75FFFFFF, &H8910FFCC, &H89162BDA, &HC483D445, &H39C0310C, &H8B0B7DD0, &HC931D47D, &H40870C89, &H458BF1EB, &H900C8DD4, &H168BC031, &HB7EC239, &H148BC229, &H81148996, &H8BEFEB40, &H348DE445, &HDD&, &HCEC8300, &H774808B, &H7589FFFF, &H10FF56C0, &H83D04589, &HD8890CC4, &HFF5367E8
+    pvAppendBuffer &HCEC83FF, &H458BC289, &H95348DE4, &H0&, &H774808B, &H7589FFFF, &H10FF56BC, &H8BC84589, &HC483DC45, &H89388B0C, &H59E2E8F8, &HC689FFFF, &H1E74C085, &HE7D3C189, &H1E07D83, &H20B9147E, &H29000000, &HDC458BC1, &H8904408B, &HE8D3B845, &HF889C709, &HFF59ECE8, &HC78951FF, &HD04D8B51, &H8BD4558B, &H75FFD845, &HDB0153C8, &HFF530DE8, &HDC4D8BFF, &H89565A58, &H458B57DA, &HFF006AD0
+    pvAppendBuffer &H94E8E075, &H8BFFFF5A, &HC339E045, &H4E0FC789, &H29F889FB, &HB92BE8FB, &HC689FFFF, &H8DD0458B, &HC031980C, &HF839168B, &H198B167D, &HC183C229, &H1C894004, &H83EDEB96, &H7500863C, &H689480A, &HF883068B, &H50F07701, &HBC75FF50, &HE8C875FF, &HFFFFFA84, &H8BE4458B, &HFF077480, &H75FF52FF, &H850FFC8, &HFF0CEC83, &H75FFC075, &HFA66E8D0, &H458BFFFF, &HCC483E4, &H774808B, &H75FFFFFF
+    pvAppendBuffer &H850FFD0, &HFF0CEC83, &H75FFC475, &HFA46E8DC, &H458BFFFF, &HCC483E4, &H774808B, &H75FFFFFF, &H850FFDC, &HFF0CEC83, &H75FFCC75, &HFA26E8D8, &H458BFFFF, &HCC483E4, &H774808B, &H75FFFFFF, &H850FFD8, &HFF0CEC83, &H75FFCC75, &HFA06E8D4, &H458BFFFF, &HCC483E4, &H774808B, &H75FFFFFF, &H850FFD4, &H89F0658D, &H5E5B59F0, &H618D5D5F, &HCC2FC, &H1B955, &HE5890000, &H85D8B53
+    pvAppendBuffer &H8B04438D, &H7E0B3910, &H75D28510, &HFF00C70C, &H41FFFFFF, &HEB04C083, &H10894AEA, &H4C25D5B, &H244C8D00, &HF0E48304, &H55FC71FF, &H5657E589, &HEC835153, &H4718B18, &H4B9398B, &H8D000000, &HF7990346, &HE44589F9, &HFFB7F8E8, &HB8C389FF, &H1&, &H39E4558B, &H31087FD0, &H831489D2, &H83F1EB40, &H217201EE, &H4B9F089, &H47000000, &HFF9F799, &H8DFF57B6, &HF50C&, &HE1830000
+    pvAppendBuffer &H9E2D318, &HEB048354, &HCEC83DA, &HFB3BE853, &H658DFFFF, &H59D889F0, &H5D5F5E5B, &HC2FC618D, &H89550008, &H8558BE5, &HE1C10A8B, &HC9854905, &HC8890F78, &H8B05F8C1, &HD3048244, &H74C085E8, &H1418DEC, &H4C25D, &H89C03155, &H4D8B53E5, &H85D8B0C, &H2378C985, &H148D038B, &H85&, &H39C03100, &H89147ECA, &H3E183C8, &HC102F8C1, &H448B03E1, &HE8D30483, &H5BC0B60F, &H8C25D
+    pvAppendBuffer &H89C03155, &H4D8B53E5, &H85D8B0C, &H1778C985, &HE2C1138B, &H7ECA3905, &HC1C8890E, &H448B05F8, &HE8D30483, &H5B01E083, &H8C25D, &H247C8D57, &HF0E48308, &H55FC77FF, &H5657E589, &H64EC8353, &H388B378B, &H89CC4589, &H48DAC4D, &HFD&, &HB4558900, &H89061C8D, &H4D8BD45D, &HC1FB89D4, &HC80104E3, &HBD0C8D, &H89000000, &H4589B85D, &HBD048DC4, &H0&, &H8BE04589, &HC801C445
+    pvAppendBuffer &H89D04589, &HD04D8BF8, &H107E0C1, &HE44589C8, &H8BCC458B, &H45890840, &HCC458BDC, &H8BDC4D8B, &H45890440, &H57C289D8, &H8BE475FF, &H67E8B445, &H8BFFFF54, &H4D8BCC45, &H10508BE0, &HFFB4458B, &H157E475, &HE8F189C8, &HFFFF5032, &H8BD8558B, &HF089DC4D, &HE475FF57, &HFF543DE8, &HE0558BFF, &HC031585B, &H1B7DF839, &H8BCC4D8B, &H498BD05D, &H810C8B0C, &H8B830C89, &H8940160C, &HC283130C
+    pvAppendBuffer &H6BE1EB04, &H5D8B84C7, &HB84D8BE4, &H1EBBD801, &H89000000, &H4589C045, &H3F048DC8, &H8BBC4589, &HC829D045, &H50B84589, &H8B50F189, &H75FFC055, &HC8458BE4, &H4FC4E857, &H4D8BFFFF, &HD8558BDC, &HFF57F089, &HCFE8E475, &H8BFFFF53, &H558BD045, &H90148DBC, &H59C03158, &HC7DF839, &H8BB84D8B, &HC89810C, &HF0EB4082, &H1E0558B, &H5501BC7D, &HB3754BC8, &HB9AC458B, &H5&, &HE0C1008B
+    pvAppendBuffer &H4C08305, &H89F9F799, &H4589B845, &HC04589C8, &HC07D83, &H1258E0F, &H5D6B0000, &H438D05C0, &H4BBFB, &H45890000, &H89C031B0, &H458BBC45, &H89C001BC, &H5151BC45, &H1B0458B, &H75FF50D8, &HFE3AE8AC, &H595AFFFF, &H9BC4D8B, &HBC4D89C1, &H7301EB83, &H39C031D9, &H8B0B7EC7, &HD231C45D, &H40831489, &HDB31F1EB, &H5D89C931, &HBC558BB0, &H8BD0458B, &HCA31B05D, &H98048D4A, &H891FFAC1
+    pvAppendBuffer &HC031A845, &H39A45589, &H8B147EC7, &H5D8BA855, &H821C23A4, &H5D8BDA89, &H831409C4, &H41E8EB40, &H83B07D01, &HC57520F9, &HBBC04D8B, &H5&, &H75B84D39, &HE0458B1D, &H3106148D, &H7DF839C0, &HC45D8B76, &HC89C931, &H830C8B86, &H40820C89, &H458BEBEB, &HCEC83E0, &H89E475FF, &HD4558BF9, &HBEE8F001, &H8BFFFF63, &H558BDC4D, &HCEC83D8, &H57D4458B, &HE8E475FF, &HFFFF529E, &H4B18C483
+    pvAppendBuffer &HF0890A74, &H89D4758B, &HC6EBD445, &H8BE05D8B, &H8952D445, &H558B52F1, &HE475FFC4, &HE857D801, &HFFFF4E5A, &H8BDC4D8B, &HF089D855, &HE475FF57, &HFF5265E8, &HFF5B59FF, &HD1E9C04D, &H83FFFFFE, &H7500B87D, &HE0458B07, &H1CEBF001, &H51F08951, &H57D8558B, &HFFDC4D8B, &H3BE8E475, &H8DFFFF52, &HD2313F04, &H21EB5F5B, &H7DC87D39, &HC85D8BDF, &H1489D231, &HCC5D8B9E, &H8B0C538B, &H45FFC85D
+    pvAppendBuffer &H9A148BC8, &HEB981489, &H7ED039DF, &H960C8B0C, &H89B47D8B, &HEB42970C, &HF4658DF0, &H5D5F5E5B, &H5FF8678D, &H8D0004C2, &H8304244C, &H71FFF0E4, &HE58955FC, &H51535657, &H8B38EC83, &H198B0841, &H8904518B, &H38BC045, &H31D04589, &HD04539C0, &H4B8B0E7E, &H10C8A04, &H75020C38, &HEDEB400E, &HBF&, &H29840F00, &H8B000002, &HC8A0473, &H38FF3102, &H820F060C, &H218&, &H8B08738B
+    pvAppendBuffer &H48D407B, &HF5&, &HDC458900, &H4D8BC701, &H89F801DC, &HC801D845, &H1D44589, &HE44589C8, &H8936048D, &HC031E045, &H7EE04539, &H89C93108, &HEB40870C, &HE04D8BF3, &H8949C031, &H4D8BC84D, &H89CA01D0, &H4539C455, &H8B337ED0, &HD039DC55, &HC2892C7D, &HC1C84D8B, &HD12902FA, &H4D89C289, &HC44D8BCC, &HB60FDAF7, &H89FF1154, &HE18340C1, &H3E1C103, &H4D8BE2D3, &H8F1409CC, &HC031C8EB
+    pvAppendBuffer &H7EE04539, &H87148B0C, &H89D84D8B, &HEB408114, &H304B8BEF, &HFF0CEC83, &H438DE475, &HE8FA8908, &HFFFFFC08, &HFF344B8B, &H438DE475, &HD8558B1C, &HFFFBF7E8, &H10438BFF, &H890CEC83, &H438BC845, &HC84D8B0C, &H89CC4589, &H56F889C2, &HE8E475FF, &HFFFF50C6, &HC483C031, &HE0453918, &H558B0F7E, &HD44D8BD8, &H8982148B, &HEB408114, &H8B5050EC, &H458BCC55, &HC84D8BD4, &HE475FF56, &HFF5099E8
+    pvAppendBuffer &HD8558BFF, &HB5048D, &H29000000, &HD05589C2, &H29E4558B, &HC45589C2, &H5AC03158, &H327DF039, &H8BC44D8B, &HC8BD055, &H820C3981, &HEB400375, &HD4558BEB, &H148BF001, &H87143982, &HEC831473, &HD04D8B0C, &H56CC558B, &H5BE8C889, &H83FFFF4B, &HEC830CC4, &HD04D8B0C, &H56C4558B, &HA9E8C889, &H8BFFFF4B, &H4D8B3C53, &HCEC83D4, &H8BE475FF, &HE856D045, &HFFFF4C06, &H8BC84D8B, &H8B56CC55
+    pvAppendBuffer &H75FFD445, &H5010E8E4, &H438BFFFF, &HE475FF38, &H558BF989, &HF63156C4, &HFF4BE1E8, &HD8558BFF, &HF889F989, &HFF0CC483, &HFBE8E075, &H8BFFFF4A, &HCC48303, &H39E44589, &H377EE475, &H7539C031, &H891D7EDC, &H4B9F0, &HF7990000, &HE0558BF9, &HE183F189, &H3E1C103, &H448BC229, &HE8D3FC97, &H8BC0558B, &HD101E44D, &HF746F289, &H114488DA, &H50C4EBFF, &HE07D8B50, &H2944438B, &H1BFF8
+    pvAppendBuffer &HE0C10000, &H458B5002, &H404303DC, &HF346E850, &H595AFFFF, &H89F0658D, &H5E5B59F8, &H618D5D5F, &HCC2FC, &H53E58955, &H8B0C4D8B, &HC9850855, &H28B2A78, &H3905E0C1, &HB8217EC8, &H1&, &HF9C1E0D3, &H8A4C8D05, &H8BC28904, &H21D2F719, &H83D809DA, &HF00107D, &H189C244, &HCC25D5B, &H244C8D00, &HF0E48304, &H55FC71FF, &H5156E589, &H8B10EC83, &H20B931, &HF0890000, &H40F9F799
+    pvAppendBuffer &HFFB140E8, &H16A52FF, &H45895056, &HFF92E8F4, &H458BFFFF, &HF8658DF4, &H8D5D5E59, &H4C2FC61, &HE5895500, &H8B535657, &H5D8B0845, &H8B088B0C, &H1F98313, &HC9310975, &H47883, &H83C1950F, &H97501FA, &H7B83D231, &H950F0004, &H89D139C2, &HC14D0FD0, &H3674C085, &HC7DC139, &H217CC239, &H833C83, &H1CEB1B74, &H8B087D8B, &HC239873C, &H348B097C, &H73F73983, &H3109EB04, &H72FE39F6
+    pvAppendBuffer &HD0EB4808, &HEBFFC883, &H1B805, &H5E5B0000, &H8C25D5F, &H1159E800, &H72050000, &H8D000011, &H8304244C, &H71FFF0E4, &HE58955FC, &H51535657, &H8B28EC83, &H4798B31, &H8BD44589, &H45890841, &H89068BDC, &H78BE445, &H89E44539, &H5D4D0FC3, &HD84589E4, &HDE8D889, &H83FFFF4A, &HC2890CEC, &H8DD4458B, &H808B9A14, &HFFFF0774, &H8902E2C1, &HFF52D055, &HE0458910, &HC483C289, &H89D8890C
+    pvAppendBuffer &H39C129D9, &H311D7ECB, &H7C0639C9, &H860C8B03, &HC9310A89, &H37C0739, &H89870C8B, &H83489A0C, &HDBEB04C2, &H89E0458B, &H4E6C1DE, &H48DC601, &HDD&, &H29F18900, &H9D048DC1, &H0&, &HC229CA89, &H458B5050, &HE85356E0, &HFFFF49AE, &H8BD87D8B, &H7D83E445, &H448D00DC, &H45890138, &H745A58D8, &HDC458B10, &H8BD87D8B, &H7CF83900, &H45894004, &HD8458BD8, &HC6E8DB01, &H89FFFFAF
+    pvAppendBuffer &H89C031C7, &H1B8E445, &H39000000, &H311D7C07, &H7CC339D2, &HFC568B0E, &H85E44D8B, &HC8450FD2, &H89E44D89, &HEE838714, &HDFEB4004, &H83E4458B, &H8900DC7D, &H314E7407, &H1BEC9, &H4D890000, &HD87539CC, &HC0313F7C, &H37C3739, &H8BB7048B, &HC931DC5D, &H37C3339, &H31B30C8B, &H1D231DB, &HCC4D8BC8, &HDB31DA11, &HD311C101, &H89B70C89, &HC985CC5D, &H458B0C74, &HE47539E4, &H89C64C0F
+    pvAppendBuffer &HEB46E445, &HE4458BBC, &H50500789, &HFFD075FF, &HC1E8E075, &H8BFFFFF0, &H808BD445, &HFFFF0774, &HE075FF52, &H8D0850FF, &HF889F065, &H5F5E5B59, &HFC618D5D, &H8D000CC2, &H8304244C, &H71FFF0E4, &HE58955FC, &H8EC8351, &H6A04418B, &H31FF5000, &HFFFE40E8, &HFC4D8BFF, &HFC618DC9, &H550008C2, &H5657E589, &HF0E48353, &H8B10EC83, &H458B0C5D, &H8B138B08, &H15A8D00, &HC245C89, &H57ED039
+    pvAppendBuffer &H24448940, &H24448B0C, &HBEFF310C, &H1&, &HFFAEB0E8, &H244489FF, &H89C03108, &H8B042444, &H390C2444, &H8B417FC6, &HC0310855, &H37C3239, &H8BB2048B, &HC9310C5D, &H37C3339, &H31B30C8B, &H1D231DB, &H244C8BC8, &H31DA1104, &H11C101DB, &H24548BD3, &H245C8908, &HB20C8904, &H574C985, &H4C0FF739, &HB7EB46FE, &H824448B, &H658D3889, &H5F5E5BF4, &H8C25D, &H4244C8D, &HFFF0E483
+    pvAppendBuffer &H8955FC71, &HBE5657E5, &H1&, &HEC835153, &H89018B28, &H418BDC45, &HD8458904, &H8BDC458B, &HD8458B10, &HC239008B, &H89C24D0F, &H12E8D445, &H31FFFFAE, &HE05589D2, &HB8E44589, &H1&, &H7CD47539, &HDC558B47, &H3239C931, &HC8B037C, &HD8558BB2, &H3239FF31, &H3C8B037C, &H31D7F7B2, &H1DB31D2, &H11F889C1, &HE47D8BD3, &HC801D231, &HC189DA11, &H89B70489, &H74C985D0, &HE05D8B0C
+    pvAppendBuffer &HFE07539, &H5D89DE4C, &HB4EB46E0, &H8BE47D8B, &H1789E055, &H1175C085, &H570CEC83, &HFFF19BE8, &H89C031FF, &HC483E445, &HE4458B0C, &H59F0658D, &H5D5F5E5B, &HC2FC618D, &H4C8D0008, &HE4830424, &HFC71FFF0, &H57E58955, &H83515356, &H798B08EC, &H8B318B04, &HAD6BE807, &HEC83FFFF, &H6AFA890C, &H89C18900, &HE8F089C3, &HFFFFEF64, &H8B0CC483, &H1F88303, &H3C830B76, &H5750083, &HEB038948
+    pvAppendBuffer &HF0658DEE, &H5B59D889, &H8D5D5F5E, &H8C2FC61, &HDDDE800, &HF6050000, &H8D00000D, &H8304244C, &H71FFF0E4, &HE58955FC, &H51535657, &H8934EC83, &H418BD845, &H89318B04, &HE850D445, &HFFFFF0A9, &HE8C38956, &HFFFFF0A1, &H458BC789, &H74808BD8, &H5FFFF07, &H2B64&, &HF08BE850, &H4589FFFF, &HD8458BE0, &H774808B, &H6805FFFF, &H5000002B, &HFFF074E8, &HD045C7FF, &H1&, &H83E44589
+    pvAppendBuffer &H458B0CC4, &H74808BD8, &H51FFFF07, &H2B680551, &H57500000, &HFFFB88E8, &H855A5EFF, &HDC840FC0, &H8B000000, &H808BD845, &HFFFF0774, &H64055656, &H5000002B, &HFB67E857, &H595AFFFF, &H2C75C085, &H570CEC83, &HFFF073E8, &H6DE853FF, &HFFFFFFF0, &H65E8E075, &HFFFFFFF0, &H5DE8E475, &H31FFFFF0, &HE44D89C9, &HE90CC483, &H129&, &H52E8078B, &H89FFFFAC, &H38BDC45, &HFFAC48E8, &HCEC83FF
+    pvAppendBuffer &H89DC4D8B, &HC68950FA, &H41E8D889, &H83FFFFEE, &H458B0CC4, &H83008BDC, &H1A7601F8, &H83DC558B, &H7500823C, &HDC558B11, &HEB028948, &H863C83E5, &H480A7500, &H68B0689, &H7701F883, &HCEC83F0, &HEFF6E853, &H5151FFFF, &HFFE075FF, &HE856E475, &HFFFFFB41, &H89D05DF7, &HFF5A58C3, &HD9E8E075, &H56FFFFEF, &HFFEFD3E8, &HE4458BFF, &H89E45D89, &HCC483FB, &H89DC7D8B, &H3E9E045, &H83FFFFFF
+    pvAppendBuffer &HE8570CEC, &HFFFFEFB4, &HEFAEE853, &H75FFFFFF, &HEFA6E8E0, &HC483FFFF, &HD07D830C, &H8B7675FF, &H1BFD445, &H31000000, &HE8008BF6, &HFFFFAB95, &H1B8C389, &H39000000, &H8B477C03, &HD231D44D, &H39E05589, &H8B067C01, &H4D89810C, &HE4558BE0, &H239C931, &HC8B037C, &HE0558B82, &HCA29F229, &H1489D1F7, &H74F68583, &HFCA3907, &H5EBC193, &H920FD139, &HFD285C1, &H450FC9B6, &H40CE89F8
+    pvAppendBuffer &H3B89B5EB, &HFF0CEC83, &H2DE8E475, &H89FFFFEF, &HC483E45D, &HE4458B0C, &H59F0658D, &H5D5F5E5B, &HC2FC618D, &HD0E80008, &H8100000B, &HBE1C1, &H7C8D5700, &HE4830824, &HFC77FFF0, &H57E58955, &H53C68956, &HEC83D389, &H89028B48, &H4589D84D, &H5E0C1E4, &HF987E850, &HEC83FFFF, &H50C7890C, &HFDABE853, &H4589FFFF, &HE85753D0, &HFFFFFD4A, &H89E04589, &H5050241C, &HFFEFCAE8, &H75FF53FF
+    pvAppendBuffer &H458950E0, &HEFBDE8DC, &H4589FFFF, &H575859CC, &HFFEEA7E8, &HDC558BFF, &HEE9EE852, &H458BFFFF, &HD84D8BE4, &H89E4558B, &H74818B06, &HC1FFFF07, &HFF5204E2, &HD4458910, &H890CC483, &H458B0446, &H853C8DE4, &H0&, &H1D4458B, &H84689F8, &HF801C189, &H890C4689, &HF801DC45, &H89104689, &HC84589FE, &H4589C031, &HE4558BD8, &H7DD85539, &HD8458B3C, &H483548B, &H89D4458B, &H31FC3054
+    pvAppendBuffer &HD8458BD2, &H8BC45589, &H239D055, &H548B077E, &H55890482, &HC4558BC4, &H45FFC031, &H315489D8, &HDC558BFC, &HFC324489, &HEB04EE83, &HCEC83BC, &HDC458B52, &H51E8CA89, &H31FFFF43, &HCC483C0, &H39E44D8B, &H8B2E7DC8, &HD231E05D, &H47E0339, &H483548B, &H8BDC5D8B, &H5489CC4D, &HD231FC3B, &H47E0139, &H481548B, &H40C8758B, &HFC3E5489, &HEB04EF83, &HCEC83CB, &HE8D075FF, &HFFFFEDBC
+    pvAppendBuffer &HE8E075FF, &HFFFFEDB4, &HE8CC75FF, &HFFFFEDAC, &H8D0CC483, &H5E5BF465, &H678D5D5F, &H8DC35FF8, &H8304244C, &H71FFF0E4, &HE58955FC, &HA55E857, &HC7810000, &HA5A&, &H83515356, &H418B68EC, &H89198B04, &H418BAC45, &HBC458908, &H10440F6, &H75FF1174, &HF1C8E8AC, &HF883FFFF, &H218F0F40, &H50000003, &HBC75FF50, &HFBCCE853, &H4589FFFF, &HBC458B9C, &H4589008B, &HC4758BC4, &H774878B
+    pvAppendBuffer &H1C8DFFFF, &HB5&, &HB85D8900, &H10FF5352, &H83B44589, &HC0310CC4, &H7EC44539, &HBC5D8B1B, &HDA891B8B, &H8BC05D89, &HC229BC5D, &H8B93148B, &H1489B45D, &HE0EB4083, &H774878B, &HEC83FFFF, &HB875FF0C, &H558B10FF, &HA84589C4, &H839C458B, &H102B0CC4, &HC239C031, &H5D8B0B7E, &H89F631A8, &HEB408334, &HA8458BF1, &H31900C8D, &H9C5D8BC0, &HD039138B, &H5D8B0E7D, &H8BC2299C, &H14899314
+    pvAppendBuffer &HE9EB4081, &H8BC4758B, &HFF077487, &HCEC83FF, &HF50C8D, &H89000000, &HFF51A44D, &HC0458910, &H774878B, &H75FFFFFF, &H8910FFA4, &H458BB045, &HCC483C4, &H4589C001, &H8BC03194, &HC839944D, &H5D8B0B7D, &H89C931C0, &HEB40830C, &HC0458BEE, &HC7A45D8B, &H1FC1844, &H8B000000, &HDB31C445, &HFF4203E8, &HCEC83FF, &H878BC289, &HFFFF0774, &H950C8D, &H89000000, &HFF51904D, &H98458910
+    pvAppendBuffer &H83AC458B, &H8B0CC4, &H8BA04589, &H758BAC45, &HB0048DA0, &H1FBE&, &HA05D3900, &H108B1B7E, &HEAD3F189, &HE180D189, &H890E7501, &HCE8949F1, &H43E67541, &HEB04E883, &HB4458BDB, &HD089108B, &HE88C5589, &HFFFF4848, &H858C558B, &HA04589C0, &H4D8A1F74, &H83E2D3A0, &H7E01C47D, &H20B914, &HC1290000, &H8BB4458B, &H45890440, &H9E8D38C, &HE8D089C2, &HFFFF484D, &H8B8C4589, &H183BAC45
+    pvAppendBuffer &HA88D0F, &H4D8B0000, &HC0458BB8, &HFF0CEC83, &H558B9875, &H8BC801B0, &H86E8C44D, &H8BFFFF56, &H558BB44D, &HCC48394, &H8BA075FF, &H75FFB045, &HFF006A8C, &HE0E8C475, &H8BFFFF48, &H558BAC45, &H8BF189AC, &H88458900, &H48BD829, &HA8E8D382, &H8B387401, &H458BB84D, &H51C801B0, &HC04D8B51, &H8B9875FF, &H75FFA855, &H4110E8C4, &H4D8BFFFF, &HFF5A58B4, &H558BA075, &H8C75FF94, &H6AC0458B
+    pvAppendBuffer &HC475FF00, &HFF4892E8, &H8B0CEBFF, &H558BC045, &HB04589B0, &H89C05589, &HC68948F0, &H63850F40, &H43FFFFFF, &H1FBE&, &HFF4DE900, &H458BFFFF, &HE8008BBC, &HFFFFA70D, &H89B84D8B, &HC0458BC3, &HC031C101, &H4539138B, &H8B147EC4, &HC2298134, &H93348940, &H3C83EEEB, &HA750083, &H8B038948, &H1F88303, &H5656F077, &HFFA475FF, &H65E8C075, &H8BFFFFE8, &HFF077487, &H75FF52FF, &H850FFC0
+    pvAppendBuffer &HFF0CEC83, &H75FF9075, &HE84AE898, &H878BFFFF, &HFFFF0774, &HFF0CC483, &H50FF9875, &HCEC8308, &HFFA475FF, &H2DE8B075, &H8BFFFFE8, &HFF077487, &HCC483FF, &HFFB075FF, &HEC830850, &HB875FF0C, &HE8B475FF, &HFFFFE810, &H774878B, &HC483FFFF, &HB475FF0C, &H830850FF, &H75FF0CEC, &HA875FFB8, &HFFE7F3E8, &H74878BFF, &H83FFFF07, &H75FF0CC4, &H850FFA8, &HE89C75FF, &HFFFFEA40, &HE90CC483
+    pvAppendBuffer &H12C&, &H75FF5050, &HABE853BC, &H5AFFFFF8, &H89BC558B, &HD4458DC3, &HFB08E859, &H458BFFFF, &HCEC83D4, &H8BC44589, &H878BC475, &HFFFF0774, &H8903E6C1, &HFF56B875, &HC0458910, &H83B8458B, &H758B0CC4, &H89F001C0, &H31C289C6, &HC44539C0, &H4D8B1D7E, &H8104C7C0, &H0&, &H33BC931, &H4C8B047D, &H4A890483, &HEA8340FC, &H83DEEB04, &HE8530CEC, &HFFFFE9C4, &H83C4458B, &H65E80CC4
+    pvAppendBuffer &H8BFFFF3F, &HFF077497, &HCEC83FF, &H456BC189, &HC80128C4, &H8902E0C1, &HFF50B045, &HAC4D8B12, &H89C0558B, &H458DB445, &HB475FFD4, &HFFEE7BE8, &HBC458BFF, &H8B0CC483, &HA587E800, &HF189FFFF, &H458BC389, &H2E0C1C4, &HC031C129, &H4539138B, &H8B147EC4, &HC2298134, &H93348940, &H3C83EEEB, &HA750083, &H8B038948, &H1F88303, &H5050F077, &HFFB075FF, &HDDE8B475, &H8BFFFFE6, &HFF077487
+    pvAppendBuffer &H75FF52FF, &H850FFB4, &HFF0CEC83, &H75FFB875, &HE6C2E8C0, &H878BFFFF, &HFFFF0774, &HFF0CC483, &H50FFC075, &HD4458D08, &HE80CC483, &HFFFFE6C9, &H89F0658D, &H5E5B59D8, &H618D5D5F, &HCC2FC, &H4244C8D, &HFFF0E483, &HC889FC71, &H57E58955, &H83515356, &H508B50EC, &H4498B08, &H8B0C588B, &H55891078, &H18508BE0, &H8914708B, &H508BD455, &H89008B1C, &H4589AC55, &HE85150E4, &HFFFFECA1
+    pvAppendBuffer &HFFDC4589, &H558BE475, &H92E852E0, &H89FFFFEC, &H75FFD845, &H86E853E4, &H8BFFFFEC, &H4589E45D, &H53EBD1CC, &HEC77E857, &H4589FFFF, &HE85653E0, &HFFFFEC6D, &HFFC78953, &H62E8D475, &H89FFFFEC, &HFF50C845, &H1EE8E075, &H89FFFFE8, &HE850D445, &HFFFFEC20, &HE80FE857, &H4589FFFF, &H11E850D0, &H83FFFFEC, &H75FF0CEC, &HD875FFD4, &HFFF6C9E8, &HC44589FF, &HFFD075FF, &HBBE8D875, &H89FFFFF6
+    pvAppendBuffer &HFF58C045, &H75FFE075, &HDC75FFC4, &HFFFA8EE8, &HC38957FF, &HFFC075FF, &H80E8DC75, &H83FFFFFA, &HC6890CC4, &HF6E85350, &H5AFFFFF2, &H79C08559, &HFF51511B, &HE853E075, &HFFFFF523, &H50BC4589, &HE7F6E853, &H5D8BFFFF, &HCC483BC, &H53565050, &HFFF5A3E8, &HBC4589FF, &HC875FF57, &HFFF4D6E8, &HCEC83FF, &H56B84589, &H50BC75FF, &HFFF324E8, &HCC483FF, &HFFB44589, &HE850CC75, &HFFFFF63A
+    pvAppendBuffer &H58B04589, &HE44DFF5A, &HFFE47D83, &H50501A74, &HFFE475FF, &H2DE8B075, &H5AFFFFEC, &HAC45FF59, &H88AC4D8B, &HDDEBFF41, &HFF0CEC83, &H89E8D475, &HFFFFFFE7, &H81E8D075, &HFFFFFFE7, &H79E8C475, &HFFFFFFE7, &H71E8C075, &H53FFFFE7, &HFFE76BE8, &H65E856FF, &HFFFFFFE7, &H5DE8BC75, &HFFFFFFE7, &H55E8B875, &HFFFFFFE7, &H4DE8B475, &HFFFFFFE7, &H45E8DC75, &HFFFFFFE7, &H3DE8D875, &HFFFFFFE7
+    pvAppendBuffer &H35E8CC75, &HFFFFFFE7, &H2DE8E075, &H57FFFFE7, &HFFE727E8, &HC875FFFF, &HFFE71FE8, &HB075FFFF, &HFFE717E8, &HCC483FF, &H59F0658D, &H5D5F5E5B, &HC2FC618D, &H4C8D0020, &HE4830424, &HFC71FFF0, &H57E58955, &H3BEE8, &HC3C78100, &H56000003, &HEC835153, &H8B318B18, &H4E8B1446, &H245E8B04, &H8BE44589, &H45891846, &H1C468BE0, &H8BDC4589, &H45892046, &H2F983D8, &HF9832E74, &H313C7403
+    pvAppendBuffer &H487549C0, &HFF4076FF, &H76FF3C76, &H3476FF38, &HFF3076FF, &H76FF2C76, &HC76FF28, &HFFFD9FE8, &H1B8FF, &H24EB0000, &HFF3476FF, &H76FF3076, &H2876FF2C, &HFF7786E8, &HFF11EBFF, &H76FF3476, &H2C76FF30, &HE82876FF, &HFFFF93CF, &HB9084689, &H1&, &HFF0C031, &HF8830EB1, &H501D7502, &H6A1076FF, &H8FE85600, &H8BFFFFA1, &HFF077487, &H243489FF, &H830850FF, &H12EB0CC4, &HE74DB85
+    pvAppendBuffer &HFFD875FF, &H75FFDC75, &HE475FFE0, &H658DD3FF, &H59C031F0, &H5D5F5E5B, &HC2FC618D, &H4C8D0004, &HE4830424, &HFC71FFF0, &H57E58955, &H83515356, &H518B20EC, &H8B198B08, &H718B0441, &H10798B0C, &H53E05589, &HE9D7E850, &H4589FFFF, &H558B53E4, &HCAE852E0, &H89FFFFE9, &H5653E045, &HFFE9C0E8, &HCEC83FF, &H50DC4589, &HFFE075FF, &H2CE8E475, &H89FFFFF8, &H14C483C6, &H7201EB83, &H50475011
+    pvAppendBuffer &H41E85653, &H5AFFFFEA, &HFF478859, &HEC83EAEB, &HE475FF0C, &HFFE5A3E8, &HE075FFFF, &HFFE59BE8, &HDC75FFFF, &HFFE593E8, &H8DE856FF, &H83FFFFE5, &H658D0CC4, &H5E5B59F0, &H618D5D5F, &H14C2FC, &H22EE8, &H2470500, &H4C8D0000, &HE4830424, &HFC71FFF0, &H57E58955, &HCB895356, &H30EC8351, &H538B318B, &HD8458910, &H8B04418B, &H55890849, &H147B8BE0, &H8BD04D89, &HF3890C4B, &H4D89EBD1
+    pvAppendBuffer &HE85056E4, &HFFFFE919, &H89E44D8B, &H5153D445, &HFFE90CE8, &HE0558BFF, &H53E44589, &HE8FFE852, &H4589FFFF, &HE85753DC, &HFFFFE8F5, &H8BCC4589, &H5B59E445, &H40F6DB31, &H840F0104, &H180&, &HF6DC458B, &HF010440, &H17384, &HE4458B00, &H4589008B, &HDC458BE0, &H3BE04D8B, &H5D850F08, &H8B000001, &HEC83D845, &H74808B0C, &H6AFFFF07, &H8910FF48, &H6A5050C3, &H53006A48, &HFF9FF9E8
+    pvAppendBuffer &HD8458BFF, &H8914C483, &H74808B33, &H56FFFF07, &H438910FF, &H56525204, &H50D075FF, &HFFC44DE8, &HE4558BFF, &H8D20C483, &H77E80843, &H8BFFFFF5, &H438DDC55, &HF56CE81C, &HEC83FFFF, &HE475FF0C, &HFFE424E8, &HC78950FF, &HFFE827E8, &HDC75FFFF, &HFFE414E8, &HC68950FF, &HFFE817E8, &HCEC83FF, &HD475FF57, &HFFF2D1E8, &H304389FF, &HD475FF56, &HFFF2C5E8, &HCC483FF, &H57344389, &HFFE43BE8
+    pvAppendBuffer &H35E856FF, &H8BFFFFE4, &HE0C1E045, &HCEE85005, &H51FFFFEE, &HFF51C689, &H5050E475, &HFFE526E8, &HE475FFFF, &HFFC78950, &H18E8CC75, &H89FFFFE5, &H5A58D045, &HE402E856, &HE857FFFF, &HFFFFE3FC, &H83E0458B, &H9DE80CC4, &H6BFFFF39, &H8330E055, &HD0010CEC, &H89D8558B, &HE0C14443, &H74928B02, &H50FFFF07, &HC28912FF, &H83404389, &H43890CC4, &HE0458B38, &H850C8D, &H8D000000, &H45890A04
+    pvAppendBuffer &H3C4389D8, &H758BC031, &H7DF039E0, &HDC7D8B25, &H8BD0758B, &H8904877C, &H31FC0A7C, &H7E0639FF, &H867C8B04, &HD8758B04, &HE7C8940, &H4E983FC, &HEC83D4EB, &HD075FF0C, &HFFE37FE8, &HCC483FF, &HFF0CEC83, &H71E8D475, &HFFFFFFE3, &H69E8E475, &HFFFFFFE3, &H61E8DC75, &HFFFFFFE3, &H59E8CC75, &H8DFFFFE3, &HD889F065, &H5F5E5B59, &HFC618D5D, &H8B0018C2, &H8BC32404, &H8BC32414, &H8BC3240C
+    pvAppendBuffer &H8BC3241C, &H8BC32434, &H90C3243C, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&, &H0&
     '--- end thunk data
-    ReDim baBuffer(0 To 34347 - 1) As Byte
+    ReDim baBuffer(0 To 63631 - 1) As Byte
     Call CopyMemory(baBuffer(0), m_baBuffer(0), UBound(baBuffer) + 1)
     Erase m_baBuffer
 End Sub